@@ -7899,6 +7899,8 @@ DECLARE_API(ThreadPool)
                     "Stabilizing",
                     "Starvation",
                     "ThreadTimedOut",
+                    "CooperativeBlocking",
+                    "QueueLatencyMove",
                     "Undefined"
                 };
 
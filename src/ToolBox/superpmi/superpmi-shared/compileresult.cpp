@@ -473,6 +473,21 @@ CorInfoInline CompileResult::repReportInliningDecision(CORINFO_METHOD_HANDLE inl
     }
     return result;
 }
+unsigned int CompileResult::ReportInliningDecision_GetInlineCount()
+{
+    unsigned int inlineCount = 0;
+    if (ReportInliningDecision != nullptr)
+    {
+        Agnostic_ReportInliningDecision* items = ReportInliningDecision->GetRawItems();
+        unsigned int                     cnt   = ReportInliningDecision->GetCount();
+        for (unsigned int i = 0; i < cnt; i++)
+        {
+            if (items[i].inlineResult == INLINE_PASS)
+                inlineCount++;
+        }
+    }
+    return inlineCount;
+}
 
 void CompileResult::recSetEHcount(unsigned cEH)
 {
@@ -653,6 +668,12 @@ const char* relocationTypeToString(WORD fRelocType)
             return "UNKNOWN";
     }
 }
+unsigned int CompileResult::RecordRelocation_GetCount()
+{
+    if (RecordRelocation == nullptr)
+        return 0;
+    return RecordRelocation->GetCount();
+}
 void CompileResult::dmpRecordRelocation(DWORD key, const Agnostic_RecordRelocation& value)
 {
     printf("RecordRelocation key %u, value loc-%016llX tgt-%016llX fRelocType-%u(%s) slotNum-%u addlDelta-%d", key,
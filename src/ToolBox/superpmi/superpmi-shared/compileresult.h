@@ -221,6 +221,7 @@ public:
                                    const char*           reason);
     void dmpReportInliningDecision(DWORD key, const Agnostic_ReportInliningDecision& value);
     CorInfoInline repReportInliningDecision(CORINFO_METHOD_HANDLE inlinerHnd, CORINFO_METHOD_HANDLE inlineeHnd);
+    unsigned int ReportInliningDecision_GetInlineCount();
 
     void recSetEHcount(unsigned cEH);
     void dmpSetEHcount(DWORD key, DWORD value);
@@ -257,6 +258,7 @@ public:
     void dmpRecordRelocation(DWORD key, const Agnostic_RecordRelocation& value);
     void repRecordRelocation(void* location, void* target, WORD fRelocType, WORD slotNum, INT32 addlDelta);
     void applyRelocs(unsigned char* block1, ULONG blocksize1, void* originalAddr);
+    unsigned int RecordRelocation_GetCount();
 
     void recProcessName(const char* name);
     void dmpProcessName(DWORD key, DWORD value);
@@ -533,6 +533,9 @@ void getFieldInfo(CORINFO_RESOLVED_TOKEN* pResolvedToken,
 // Returns true iff "fldHnd" represents a static field.
 bool isFieldStatic(CORINFO_FIELD_HANDLE fldHnd);
 
+// Returns the class of the object an initialized ref class static currently refers to.
+CORINFO_CLASS_HANDLE getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative);
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -1065,4 +1068,12 @@ DWORD getJitFlags(CORJIT_FLAGS* flags,      /* IN: Points to a buffer that will
                                                    version number for the CORJIT_FLAGS value. */
                   );
 
+// Reports the thread cycles and JIT arena memory spent in one phase of the current compilation.
+// Only called when the compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS.
+void reportJitPhaseStats(unsigned         phaseIndex,     /* IN: The index of the phase, in the JIT's phase order */
+                         const char*      phaseName,      /* IN: The name of the phase */
+                         unsigned __int64 cycles,         /* IN: Thread cycles spent in the phase */
+                         unsigned __int64 allocatedBytes  /* IN: Bytes of JIT arena memory allocated during the phase */
+                         );
+
 #endif // _ICorJitInfoImpl
@@ -140,6 +140,7 @@ LWM(InitConstraintsForVerification, DWORDLONG, DD)
 LWM(IsCompatibleDelegate, Agnostic_IsCompatibleDelegate, DD)
 LWM(IsDelegateCreationAllowed, DLDL, DWORD)
 LWM(IsFieldStatic, DWORDLONG, DWORD)
+LWM(GetStaticFieldCurrentClass, DWORDLONG, DLD)
 LWM(IsInSIMDModule, DWORDLONG, DWORD)
 LWM(IsInstantiationOfVerifiedGeneric, DWORDLONG, DWORD)
 LWM(IsSDArray, DWORDLONG, DWORD)
@@ -1437,6 +1437,7 @@ void MethodContext::repGetCallInfo(CORINFO_RESOLVED_TOKEN* pResolvedToken,
         pResult->stubLookup.runtimeLookup.indirections        = (WORD)value.stubLookup.runtimeLookup.indirections;
         pResult->stubLookup.runtimeLookup.testForNull         = value.stubLookup.runtimeLookup.testForNull != 0;
         pResult->stubLookup.runtimeLookup.testForFixup        = value.stubLookup.runtimeLookup.testForFixup != 0;
+        pResult->stubLookup.runtimeLookup.sizeOffset          = value.stubLookup.runtimeLookup.sizeOffset;
         pResult->stubLookup.runtimeLookup.indirectFirstOffset = value.stubLookup.runtimeLookup.indirectFirstOffset != 0;
         pResult->stubLookup.runtimeLookup.indirectSecondOffset =
             value.stubLookup.runtimeLookup.indirectSecondOffset != 0;
@@ -6096,6 +6097,41 @@ bool MethodContext::repIsFieldStatic(CORINFO_FIELD_HANDLE fhld)
     return result;
 }
 
+void MethodContext::recGetStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field,
+                                                  bool                 isSpeculative,
+                                                  CORINFO_CLASS_HANDLE result)
+{
+    if (GetStaticFieldCurrentClass == nullptr)
+        GetStaticFieldCurrentClass = new LightWeightMap<DWORDLONG, DLD>();
+
+    DLD value;
+    value.A = (DWORDLONG)result;
+    value.B = (DWORD)isSpeculative;
+
+    GetStaticFieldCurrentClass->Add((DWORDLONG)field, value);
+    DEBUG_REC(dmpGetStaticFieldCurrentClass((DWORDLONG)field, value));
+}
+void MethodContext::dmpGetStaticFieldCurrentClass(DWORDLONG key, const DLD& value)
+{
+    printf("GetStaticFieldCurrentClass key %016llX, value clsHnd-%016llX isSpeculative-%u", key, value.A, value.B);
+}
+CORINFO_CLASS_HANDLE MethodContext::repGetStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    AssertCodeMsg(GetStaticFieldCurrentClass != nullptr, EXCEPTIONCODE_MC, "Didn't find anything for %016llX",
+                  (DWORDLONG)field);
+    AssertCodeMsg(GetStaticFieldCurrentClass->GetIndex((DWORDLONG)field) != -1, EXCEPTIONCODE_MC,
+                  "Didn't find %016llX", (DWORDLONG)field);
+    DLD value = GetStaticFieldCurrentClass->Get((DWORDLONG)field);
+    DEBUG_REP(dmpGetStaticFieldCurrentClass((DWORDLONG)field, value));
+
+    if (pIsSpeculative != nullptr)
+    {
+        *pIsSpeculative = (value.B != 0);
+    }
+
+    return (CORINFO_CLASS_HANDLE)value.A;
+}
+
 void MethodContext::recGetIntConfigValue(const wchar_t* name, int defaultValue, int result)
 {
     if (GetIntConfigValue == nullptr)
@@ -215,6 +215,7 @@ public:
         DWORD     indirections;
         DWORD     testForNull;
         DWORD     testForFixup;
+        WORD      sizeOffset;
         DWORDLONG offsets[CORINFO_MAXINDIRECTIONS];
         DWORD     indirectFirstOffset;
         DWORD     indirectSecondOffset;
@@ -1275,6 +1276,10 @@ public:
     void dmpIsFieldStatic(DWORDLONG key, DWORD value);
     bool repIsFieldStatic(CORINFO_FIELD_HANDLE fhld);
 
+    void recGetStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool isSpeculative, CORINFO_CLASS_HANDLE result);
+    void dmpGetStaticFieldCurrentClass(DWORDLONG key, const DLD& value);
+    CORINFO_CLASS_HANDLE repGetStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative);
+
     void recGetIntConfigValue(const wchar_t* name, int defaultValue, int result);
     void dmpGetIntConfigValue(const Agnostic_ConfigIntInfo& key, int value);
     int repGetIntConfigValue(const wchar_t* name, int defaultValue);
@@ -1388,6 +1393,7 @@ enum mcPackets
     Packet_GetClassSize                                  = 47,
     Packet_GetHeapClassSize                              = 170, // Added 10/5/2018
     Packet_CanAllocateOnStack                            = 171, // Added 10/5/2018
+    Packet_GetStaticFieldCurrentClass                    = 172, // Added 11/7/2018
     Packet_GetIntConfigValue                             = 151, // Added 2/12/2015
     Packet_GetStringConfigValue                          = 152, // Added 2/12/2015
     Packet_GetCookieForPInvokeCalliSig                   = 48,
@@ -1142,6 +1142,14 @@ bool interceptor_ICJI::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return result;
 }
 
+CORINFO_CLASS_HANDLE interceptor_ICJI::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    mc->cr->AddCall("getStaticFieldCurrentClass");
+    CORINFO_CLASS_HANDLE result = original_ICorJitInfo->getStaticFieldCurrentClass(field, pIsSpeculative);
+    mc->recGetStaticFieldCurrentClass(field, *pIsSpeculative, result);
+    return result;
+}
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -2160,3 +2168,14 @@ DWORD interceptor_ICJI::getExpectedTargetArchitecture()
 {
     return original_ICorJitInfo->getExpectedTargetArchitecture();
 }
+
+// Reports the time and memory spent in one JIT phase; only called when the
+// compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS.
+void interceptor_ICJI::reportJitPhaseStats(unsigned         phaseIndex,
+                                           const char*      phaseName,
+                                           unsigned __int64 cycles,
+                                           unsigned __int64 allocatedBytes)
+{
+    mc->cr->AddCall("reportJitPhaseStats");
+    original_ICorJitInfo->reportJitPhaseStats(phaseIndex, phaseName, cycles, allocatedBytes);
+}
@@ -895,6 +895,12 @@ bool interceptor_ICJI::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return original_ICorJitInfo->isFieldStatic(fldHnd);
 }
 
+CORINFO_CLASS_HANDLE interceptor_ICJI::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    mcs->AddCall("getStaticFieldCurrentClass");
+    return original_ICorJitInfo->getStaticFieldCurrentClass(field, pIsSpeculative);
+}
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -1725,3 +1731,14 @@ DWORD interceptor_ICJI::getExpectedTargetArchitecture()
     mcs->AddCall("getExpectedTargetArchitecture");
     return original_ICorJitInfo->getExpectedTargetArchitecture();
 }
+
+// Reports the time and memory spent in one JIT phase; only called when the
+// compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS.
+void interceptor_ICJI::reportJitPhaseStats(unsigned         phaseIndex,
+                                           const char*      phaseName,
+                                           unsigned __int64 cycles,
+                                           unsigned __int64 allocatedBytes)
+{
+    mcs->AddCall("reportJitPhaseStats");
+    original_ICorJitInfo->reportJitPhaseStats(phaseIndex, phaseName, cycles, allocatedBytes);
+}
@@ -800,6 +800,11 @@ bool interceptor_ICJI::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return true;
 }
 
+CORINFO_CLASS_HANDLE interceptor_ICJI::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    return original_ICorJitInfo->getStaticFieldCurrentClass(field, pIsSpeculative);
+}
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -1538,3 +1543,13 @@ DWORD interceptor_ICJI::getExpectedTargetArchitecture()
 {
     return original_ICorJitInfo->getExpectedTargetArchitecture();
 }
+
+// Reports the time and memory spent in one JIT phase; only called when the
+// compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS.
+void interceptor_ICJI::reportJitPhaseStats(unsigned         phaseIndex,
+                                           const char*      phaseName,
+                                           unsigned __int64 cycles,
+                                           unsigned __int64 allocatedBytes)
+{
+    original_ICorJitInfo->reportJitPhaseStats(phaseIndex, phaseName, cycles, allocatedBytes);
+}
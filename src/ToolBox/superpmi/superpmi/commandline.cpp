@@ -78,6 +78,8 @@ void CommandLine::DumpHelp(const char* program)
     printf("         h - method hash to uniquely identify a method across MCH files\n");
     printf("         n - method number inside the source MCH\n");
     printf("         t - method throughput time\n");
+    printf("         r - number of relocations in the compiled code (calls, helpers and data references)\n");
+    printf("         l - number of methods successfully inlined\n");
     printf("         * - all available method stats\n");
     printf("\n");
     printf(" -a[pplyDiff]\n");
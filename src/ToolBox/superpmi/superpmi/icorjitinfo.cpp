@@ -956,6 +956,12 @@ bool MyICJI::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return jitInstance->mc->repIsFieldStatic(fldHnd);
 }
 
+CORINFO_CLASS_HANDLE MyICJI::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    jitInstance->mc->cr->AddCall("getStaticFieldCurrentClass");
+    return jitInstance->mc->repGetStaticFieldCurrentClass(field, pIsSpeculative);
+}
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -1868,3 +1874,14 @@ DWORD MyICJI::getExpectedTargetArchitecture()
     return IMAGE_FILE_MACHINE_UNKNOWN;
 #endif
 }
+
+// Reports the time and memory spent in one JIT phase; only called when the
+// compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS.
+void MyICJI::reportJitPhaseStats(unsigned         phaseIndex,
+                                 const char*      phaseName,
+                                 unsigned __int64 cycles,
+                                 unsigned __int64 allocatedBytes)
+{
+    jitInstance->mc->cr->AddCall("reportJitPhaseStats");
+    // Nothing to report to during replay.
+}
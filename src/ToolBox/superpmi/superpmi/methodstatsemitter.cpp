@@ -84,6 +84,16 @@ void MethodStatsEmitter::Emit(int methodNumber, MethodContext* mc, ULONGLONG fir
             charCount +=
                 sprintf_s(rowData + charCount, _countof(rowData) - charCount, "%llu,%llu,", firstTime, secondTime);
         }
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'r') != NULL || strchr(statsTypes, 'R') != NULL)
+        {
+            charCount += sprintf_s(rowData + charCount, _countof(rowData) - charCount, "%u,",
+                                   mc->cr->RecordRelocation_GetCount());
+        }
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'l') != NULL || strchr(statsTypes, 'L') != NULL)
+        {
+            charCount += sprintf_s(rowData + charCount, _countof(rowData) - charCount, "%u,",
+                                   mc->cr->ReportInliningDecision_GetInlineCount());
+        }
 
         // get rid of the final ',' and replace it with a '\n'
         rowData[charCount - 1] = '\n';
@@ -116,6 +126,10 @@ void MethodStatsEmitter::SetStatsTypes(char* types)
             charCount += sprintf_s(rowHeader + charCount, _countof(rowHeader) - charCount, "ASM_CODE_SIZE,");
         if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 't') != NULL || strchr(statsTypes, 'T') != NULL)
             charCount += sprintf_s(rowHeader + charCount, _countof(rowHeader) - charCount, "Time1,Time2,");
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'r') != NULL || strchr(statsTypes, 'R') != NULL)
+            charCount += sprintf_s(rowHeader + charCount, _countof(rowHeader) - charCount, "RELOC_COUNT,");
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'l') != NULL || strchr(statsTypes, 'L') != NULL)
+            charCount += sprintf_s(rowHeader + charCount, _countof(rowHeader) - charCount, "INLINE_COUNT,");
 
         // get rid of the final ',' and replace it with a '\n'
         rowHeader[charCount - 1] = '\n';
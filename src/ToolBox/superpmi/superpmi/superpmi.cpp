@@ -240,6 +240,11 @@ int __cdecl main(int argc, char* argv[])
     int index             = 0;
     int excludedCount     = 0;
 
+    // Sums of the per-method cycle counts chosen in throughput mode, to compare whole collections
+    int       throughputCount   = 0;
+    ULONGLONG throughputCycles  = 0;
+    ULONGLONG throughputCycles2 = 0;
+
     st1.Start();
     NearDiffer nearDiffer(o.targetArchitecture, o.useCoreDisTools);
 
@@ -467,6 +472,10 @@ int __cdecl main(int argc, char* argv[])
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
                                                  mc->cr->clockCyclesToCompile);
                     }
+
+                    throughputCount++;
+                    throughputCycles += crl->clockCyclesToCompile;
+                    throughputCycles2 += mc->cr->clockCyclesToCompile;
                 }
                 else
                 {
@@ -478,6 +487,9 @@ int __cdecl main(int argc, char* argv[])
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0);
                     }
+
+                    throughputCount++;
+                    throughputCycles += mc->cr->clockCyclesToCompile;
                 }
             }
 
@@ -571,6 +583,21 @@ int __cdecl main(int argc, char* argv[])
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount);
     }
 
+    if (collectThroughput && throughputCount > 0)
+    {
+        // Deliberately not prefixed with g_AllFormatStringFixedPrefix, so parallel mode doesn't try to parse it
+        if (o.nameOfJit2 != nullptr)
+        {
+            LogInfo("Throughput: Methods %d  Cycles %llu  Cycles2 %llu  Ratio %.4f", throughputCount,
+                    throughputCycles, throughputCycles2,
+                    (throughputCycles == 0) ? 0.0 : (double)throughputCycles2 / (double)throughputCycles);
+        }
+        else
+        {
+            LogInfo("Throughput: Methods %d  Cycles %llu", throughputCount, throughputCycles);
+        }
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
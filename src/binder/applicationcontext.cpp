@@ -228,6 +228,15 @@ namespace BINDER_SPACE
         BINDER_LOG_ENTER(W("ApplicationContext::SetupBindingPaths"));
         BINDER_LOG_POINTER(W("this"), this);
 
+        // The extensions of TPA entries, built once rather than for every entry.
+        // GCC complains if we create SStrings inline as part of a function call
+        SString sNiDll(W(".ni.dll"));
+        SString sNiExe(W(".ni.exe"));
+        SString sNiWinmd(W(".ni.winmd"));
+        SString sDll(W(".dll"));
+        SString sExe(W(".exe"));
+        SString sWinmd(W(".winmd"));
+
 #ifndef CROSSGEN_COMPILE
         CRITSEC_Holder contextLock(fAcquireLock ? GetCriticalSectionCookie() : NULL);
 #endif
@@ -248,6 +257,22 @@ namespace BINDER_SPACE
         
         sTrustedPlatformAssemblies.Normalize();
 
+        // Size both tables for the whole list up front, so that long lists are not rehashed
+        // over and over while they are parsed
+        {
+            COUNT_T cTpaEntries = 1;
+            for (LPCWSTR pwzTpa = sTrustedPlatformAssemblies.GetUnicode(); *pwzTpa != W('\0'); pwzTpa++)
+            {
+                if (*pwzTpa == PATH_SEPARATOR_CHAR_W)
+                {
+                    cTpaEntries++;
+                }
+            }
+
+            m_pTrustedPlatformAssemblyMap->Reallocate(2 * cTpaEntries);
+            m_pFileNameHash->Reallocate(2 * cTpaEntries);
+        }
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
@@ -284,14 +309,6 @@ namespace BINDER_SPACE
             SString simpleName;
             bool isNativeImage = false;
 
-            // GCC complains if we create SStrings inline as part of a function call
-            SString sNiDll(W(".ni.dll"));
-            SString sNiExe(W(".ni.exe"));
-            SString sNiWinmd(W(".ni.winmd"));
-            SString sDll(W(".dll"));
-            SString sExe(W(".exe"));
-            SString sWinmd(W(".winmd"));
-            
             if (fileName.EndsWithCaseInsensitive(sNiDll) ||
                 fileName.EndsWithCaseInsensitive(sNiExe))
             {
@@ -467,6 +467,11 @@ void ArrayNative::CastCheckEachElement(const BASEARRAYREF pSrcUnsafe, const unsi
     gc.pDest = pDestUnsafe;
     gc.pSrc = pSrcUnsafe;
 
+    // Arrays needing the check tend to hold many elements of the same type, so the
+    // last type that passed the check is remembered to skip the cast logic for it.
+    // ICastable and COM objects decide the cast per object, so they are never remembered.
+    MethodTable * pLastCheckedMT = NULL;
+
     GCPROTECT_BEGIN(gc);
     
     for(unsigned int i=srcIndex; i<srcIndex + len; ++i)
@@ -475,8 +480,15 @@ void ArrayNative::CastCheckEachElement(const BASEARRAYREF pSrcUnsafe, const unsi
 
         // Now that we have grabbed obj, we are no longer subject to races from another
         // mutator thread.
-        if (gc.obj != NULL && !ObjIsInstanceOf(OBJECTREFToObject(gc.obj), destTH))
-            COMPlusThrow(kInvalidCastException, W("InvalidCast_DownCastArrayElement"));
+        if (gc.obj != NULL && gc.obj->GetMethodTable() != pLastCheckedMT)
+        {
+            if (!ObjIsInstanceOf(OBJECTREFToObject(gc.obj), destTH))
+                COMPlusThrow(kInvalidCastException, W("InvalidCast_DownCastArrayElement"));
+
+            MethodTable * pMT = gc.obj->GetMethodTable();
+            if (!pMT->IsICastable() && !pMT->IsComObjectType())
+                pLastCheckedMT = pMT;
+        }
 
         OBJECTREF * destData = (OBJECTREF*)(gc.pDest->GetDataPtr()) + i - srcIndex + destIndex;
         SetObjectReference(destData, gc.obj, gc.pDest->GetAppDomain());
@@ -606,6 +618,16 @@ fail:
 }
 
 
+// Converts each element in a simple loop, which the compiler can vectorize
+template <typename TSrc, typename TDest>
+static void WidenEachElement(const TSrc * pSrc, TDest * pDest, unsigned int length)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (unsigned int i = 0; i < length; i++)
+        pDest[i] = (TDest)pSrc[i];
+}
+
 // Widen primitive types to another primitive type.
 void ArrayNative::PrimitiveWiden(BASEARRAYREF pSrc, unsigned int srcIndex, BASEARRAYREF pDest, unsigned int destIndex, unsigned int length)
 {
@@ -637,6 +659,23 @@ void ArrayNative::PrimitiveWiden(BASEARRAYREF pSrc, unsigned int srcIndex, BASEA
     _ASSERTE(srcElType != destElType);  // We shouldn't be here if these are the same type.
     _ASSERTE(CorTypeInfo::IsPrimitiveType_NoThrow(srcElType) && CorTypeInfo::IsPrimitiveType_NoThrow(destElType));
 
+    // The most common widenings do not need the per element dispatch below
+    if (srcElType == ELEMENT_TYPE_I4 && destElType == ELEMENT_TYPE_I8)
+    {
+        WidenEachElement((INT32*)srcData, (INT64*)data, length);
+        return;
+    }
+    if (srcElType == ELEMENT_TYPE_I4 && destElType == ELEMENT_TYPE_R8)
+    {
+        WidenEachElement((INT32*)srcData, (double*)data, length);
+        return;
+    }
+    if (srcElType == ELEMENT_TYPE_R4 && destElType == ELEMENT_TYPE_R8)
+    {
+        WidenEachElement((float*)srcData, (double*)data, length);
+        return;
+    }
+
     for(; length>0; length--, srcData += srcSize, data += destSize)
     {
         // We pretty much have to do some fancy datatype mangling every time here, for
@@ -34,6 +34,10 @@ CORECLR_HOSTING_API(coreclr_shutdown_2,
             unsigned int domainId,
             int* latchedExitCode);
 
+CORECLR_HOSTING_API(coreclr_notify_startup_complete,
+            void* hostHandle,
+            unsigned int domainId);
+
 CORECLR_HOSTING_API(coreclr_create_delegate,
             void* hostHandle,
             unsigned int domainId,
@@ -7,6 +7,18 @@
 #include <stdint.h>
 #include "icushim.h"
 
+// ASCII code units are cased directly; ICU is only called for the rest of the
+// string's code points.
+static inline UChar ToUpperAscii(UChar c)
+{
+    return (UChar)(c - (((UChar)(c - 'a') <= (UChar)('z' - 'a')) ? 0x20 : 0));
+}
+
+static inline UChar ToLowerAscii(UChar c)
+{
+    return (UChar)(c + (((UChar)(c - 'A') <= (UChar)('Z' - 'A')) ? 0x20 : 0));
+}
+
 /*
 Function:
 ChangeCase
@@ -35,6 +47,12 @@ extern "C" void GlobalizationNative_ChangeCase(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80)
+            {
+                lpDst[dstIdx++] = ToUpperAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_toupper(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -45,6 +63,12 @@ extern "C" void GlobalizationNative_ChangeCase(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80)
+            {
+                lpDst[dstIdx++] = ToLowerAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_tolower(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -74,6 +98,12 @@ extern "C" void GlobalizationNative_ChangeCaseInvariant(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80)
+            {
+                lpDst[dstIdx++] = ToUpperAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             // On Windows with InvariantCulture, the LATIN SMALL LETTER DOTLESS I (U+0131)
             // capitalizes to itself, whereas with ICU it capitalizes to LATIN CAPITAL LETTER I (U+0049).
             // We special case it to match the Windows invariant behavior.
@@ -87,6 +117,12 @@ extern "C" void GlobalizationNative_ChangeCaseInvariant(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80)
+            {
+                lpDst[dstIdx++] = ToLowerAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             // On Windows with InvariantCulture, the LATIN CAPITAL LETTER I WITH DOT ABOVE (U+0130)
             // lower cases to itself, whereas with ICU it lower cases to LATIN SMALL LETTER I (U+0069).
             // We special case it to match the Windows invariant behavior.
@@ -118,6 +154,12 @@ extern "C" void GlobalizationNative_ChangeCaseTurkish(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80 && lpSrc[srcIdx] != (UChar)0x0069)
+            {
+                lpDst[dstIdx++] = ToUpperAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             // In turkish casing, LATIN SMALL LETTER I (U+0069) upper cases to LATIN
             // CAPITAL LETTER I WITH DOT ABOVE (U+0130).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
@@ -130,6 +172,12 @@ extern "C" void GlobalizationNative_ChangeCaseTurkish(
     {
         while (srcIdx < cwSrcLength)
         {
+            if (lpSrc[srcIdx] < 0x80 && lpSrc[srcIdx] != (UChar)0x0049)
+            {
+                lpDst[dstIdx++] = ToLowerAscii(lpSrc[srcIdx++]);
+                continue;
+            }
+
             // In turkish casing, LATIN CAPITAL LETTER I (U+0049) lower cases to
             // LATIN SMALL LETTER DOTLESS I (U+0131).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
@@ -6,6 +6,7 @@
 #include <assert.h>
 #include <pthread.h>
 #include <stdint.h>
+#include <string.h>
 #include <vector>
 #include <map>
 
@@ -18,6 +19,7 @@ const int32_t CompareOptionsIgnoreNonSpace = 0x2;
 const int32_t CompareOptionsIgnoreSymbols = 0x4;
 const int32_t CompareOptionsIgnoreKanaType = 0x8;
 const int32_t CompareOptionsIgnoreWidth = 0x10;
+const int32_t CompareOptionsMask = 0x1f;
 // const int32_t CompareOptionsStringSort = 0x20000000;
 // ICU's default is to use "StringSort", i.e. nonalphanumeric symbols come before alphanumeric.
 // When StringSort is not specified (.NET's default), the sort order will be different between
@@ -35,14 +37,19 @@ typedef std::pair<int32_t, UCollator*> TCollatorMapPair;
  * For increased performance, we cache the UCollator objects for a locale and
  * share them across threads. This is safe (and supported in ICU) if we ensure
  * multiple threads are only ever dealing with const UCollators.
+ *
+ * Every combination of the CompareOptionsMask bits has a slot that is published
+ * once and never changes afterwards, so looking up a collator does not take a lock.
+ * Any other options fall back to the map, which is protected by collatorsLockObject.
  */
 typedef struct _sort_handle
 {
     UCollator* regular;
+    UCollator* collatorsPerMaskedOption[CompareOptionsMask + 1];
     TCollatorMap collatorsPerOption;
     pthread_mutex_t collatorsLockObject;
 
-    _sort_handle() : regular(nullptr)
+    _sort_handle() : regular(nullptr), collatorsPerMaskedOption()
     {
         int result = pthread_mutex_init(&collatorsLockObject, NULL);
         if (result != 0)
@@ -358,6 +365,14 @@ extern "C" void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle)
     ucol_close(pSortHandle->regular);
     pSortHandle->regular = nullptr;
 
+    for (int32_t i = 0; i <= CompareOptionsMask; i++)
+    {
+        if (pSortHandle->collatorsPerMaskedOption[i] != nullptr)
+        {
+            ucol_close(pSortHandle->collatorsPerMaskedOption[i]);
+        }
+    }
+
     TCollatorMap::iterator it;
     for (it = pSortHandle->collatorsPerOption.begin(); it != pSortHandle->collatorsPerOption.end(); it++)
     {
@@ -376,6 +391,28 @@ const UCollator* GetCollatorFromSortHandle(SortHandle* pSortHandle, int32_t opti
     {
         pCollator = pSortHandle->regular;
     }
+    else if ((options & ~CompareOptionsMask) == 0)
+    {
+        UCollator** pSlot = &pSortHandle->collatorsPerMaskedOption[options];
+
+        pCollator = __atomic_load_n(pSlot, __ATOMIC_ACQUIRE);
+        if (pCollator == nullptr)
+        {
+            pCollator = CloneCollatorWithOptions(pSortHandle->regular, options, pErr);
+            if (U_FAILURE(*pErr))
+            {
+                return pCollator;
+            }
+
+            // If another thread published its clone first, use that one instead
+            UCollator* pExisting = __sync_val_compare_and_swap(pSlot, nullptr, pCollator);
+            if (pExisting != nullptr)
+            {
+                ucol_close(pCollator);
+                pCollator = pExisting;
+            }
+        }
+    }
     else
     {
         int lockResult = pthread_mutex_lock(&pSortHandle->collatorsLockObject);
@@ -438,6 +475,14 @@ extern "C" int32_t GlobalizationNative_CompareString(
 
     if (U_SUCCESS(err))
     {
+        // Identical strings are equal under every collation, so ICU is only needed
+        // for strings that actually differ
+        if (cwStr1Length >= 0 && cwStr1Length == cwStr2Length &&
+            (lpStr1 == lpStr2 || memcmp(lpStr1, lpStr2, cwStr1Length * sizeof(UChar)) == 0))
+        {
+            return UCOL_EQUAL;
+        }
+
         result = ucol_strcoll(pColl, lpStr1, cwStr1Length, lpStr2, cwStr2Length);
     }
 
@@ -940,18 +940,23 @@ CrashInfo::ValidRegion(const MemoryRegion& region)
 {
     if (region.IsBackedByMemory())
     {
-        uint64_t start = region.StartAddress();
+        // Every page has to be readable. A read stops at the first page that
+        // isn't, so several pages are checked at once and the region is only
+        // valid if each read returns everything that was asked for.
+        BYTE buffer[0x10000];
 
-        uint64_t numberPages = region.Size() / PAGE_SIZE;
-        for (int p = 0; p < numberPages; p++, start += PAGE_SIZE)
+        uint64_t start = region.StartAddress();
+        uint64_t end = region.EndAddress();
+        while (start < end)
         {
-            BYTE buffer[1];
+            uint32_t bytesToRead = (uint32_t)std::min(end - start, (uint64_t)sizeof(buffer));
             uint32_t read;
 
-            if (FAILED(m_dataTarget->ReadVirtual(start, buffer, 1, &read)))
+            if (FAILED(m_dataTarget->ReadVirtual(start, buffer, bytesToRead, &read)) || read < bytesToRead)
             {
                 return false;
             }
+            start += bytesToRead;
         }
     }
     return true;
@@ -34,7 +34,9 @@ private:
     LONG m_ref;                         // reference count
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    // Memory regions are copied to the core file through this buffer, so it is
+    // large enough to keep the number of read and write calls per region low.
+    BYTE m_tempBuffer[0x100000];
 
 public:
     DumpWriter(CrashInfo& crashInfo);
@@ -60,6 +60,14 @@ static NTSTATUS OutOfProcessFindHeader(ReadMemoryFunction fpReadMemory,PVOID pUs
     // get DWORD and shift down our nibble
     //
     move(tmp, pMap);
+
+    // the whole DWORD is inside a method, it holds the distance to the method start
+    if (IS_NIBBLE_POINTER(tmp))
+    {
+        codeHead = POS2MAPDWORDADDR(startPos) - DECODE_NIBBLE_POINTER(tmp) - sizeof(CodeHeader);
+        return STATUS_SUCCESS;
+    }
+
     tmp = tmp >> POS2SHIFTCOUNT(startPos);
 
     // don't allow equality in the next check (tmp & NIBBLE_MASK == offset)
@@ -119,6 +127,12 @@ static NTSTATUS OutOfProcessFindHeader(ReadMemoryFunction fpReadMemory,PVOID pUs
         move (tmp, pMap);
     }
 
+    if (IS_NIBBLE_POINTER(tmp))
+    {
+        codeHead = POS2MAPDWORDADDR(startPos) - DECODE_NIBBLE_POINTER(tmp) - sizeof(CodeHeader);
+        return STATUS_SUCCESS;
+    }
+
 
     while (!(tmp & NIBBLE_MASK))
     {
@@ -7077,8 +7077,8 @@ NativeImageDumper::DumpMethodTable( PTR_MethodTable mt, const char * name,
                     //DictionaryLayout::GetEntryLayout
                     PTR_DictionaryEntryLayout entryLayout(layout->GetEntryLayout(i));
 
-                    //Dictionary::GetSlotAddr
-                    PTR_DictionaryEntry ent(currentDictionary->EntryAddr(mt->GetNumGenericArgs() + i));
+                    //Dictionary::GetSlotAddr (the layout slots follow the size slot)
+                    PTR_DictionaryEntry ent(currentDictionary->EntryAddr(mt->GetNumGenericArgs() + 1 + i));
 
                     DumpDictionaryEntry( "Entry", entryLayout->GetKind(), ent );
                 }
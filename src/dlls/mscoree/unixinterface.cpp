@@ -329,6 +329,27 @@ int coreclr_shutdown_2(
     return hr;
 }
 
+//
+// Notify CoreCLR that the application has finished starting up. Tiered compilation
+// stops delaying tier 1 promotion for new tier 0 activity from this point on.
+//
+// Parameters:
+//  hostHandle              - Handle of the host
+//  domainId                - Id of the domain 
+//
+// Returns:
+//  HRESULT indicating status of the operation. S_OK if the notification was delivered
+//
+extern "C"
+int coreclr_notify_startup_complete(
+            void* hostHandle,
+            unsigned int domainId)
+{
+    CorHost2* host = static_cast<CorHost2*>(reinterpret_cast<ICLRRuntimeHost4*>(hostHandle));
+
+    return host->NotifyStartupComplete(domainId);
+}
+
 //
 // Create a native callable delegate for a managed method.
 //
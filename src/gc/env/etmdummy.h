@@ -21,6 +21,7 @@
 #define FireEtwGCSuspendEEEnd_V1(ClrInstanceID) 0
 #define FireEtwGCSuspendEEBegin(Reason) 0
 #define FireEtwGCSuspendEEBegin_V1(Reason, Count, ClrInstanceID) 0
+#define FireEtwGCSuspendEEThreadRendezvous(ManagedThreadID, OSThreadID, ElapsedMicroseconds, ClrInstanceID) 0
 #define FireEtwGCAllocationTick(AllocationAmount, AllocationKind) 0
 #define FireEtwGCAllocationTick_V1(AllocationAmount, AllocationKind, ClrInstanceID) 0
 #define FireEtwGCAllocationTick_V2(AllocationAmount, AllocationKind, ClrInstanceID, AllocationAmount64, TypeID, TypeName, HeapIndex) 0
@@ -76,6 +77,8 @@
 #define FireEtwThreadPoolWorkerThreadAdjustmentSample(Throughput, ClrInstanceID) 0
 #define FireEtwThreadPoolWorkerThreadAdjustmentAdjustment(AverageThroughput, NewWorkerThreadCount, Reason, ClrInstanceID) 0
 #define FireEtwThreadPoolWorkerThreadAdjustmentStats(Duration, Throughput, ThreadWave, ThroughputWave, ThroughputErrorEstimate, AverageThroughputErrorEstimate, ThroughputRatio, Confidence, NewControlSetting, NewThreadWaveMagnitude, ClrInstanceID) 0
+#define FireEtwThreadPoolWorkerThreadAdjustmentQueueLatencyStats(Duration, Throughput, CpuUtilization, QueueBacklogMs, ThroughputPerCpu, NewWorkerThreadCount, ClrInstanceID) 0
+#define FireEtwThreadPoolWorkerThreadAdjustmentCounters(NativeQueueLength, ActiveWorkerThreadCount, WorkingWorkerThreadCount, BlockedWorkerThreadCount, CompletedWorkItemCount, BlockedTimeMs, QueueLatencyUnder1Ms, QueueLatencyUnder4Ms, QueueLatencyUnder16Ms, QueueLatencyUnder64Ms, QueueLatencyUnder256Ms, QueueLatencyOver256Ms, ClrInstanceID) 0
 #define FireEtwThreadPoolWorkerThreadWait(ActiveWorkerThreadCount, RetiredWorkerThreadCount, ClrInstanceID) 0
 #define FireEtwThreadPoolWorkingThreadCount(Count, ClrInstanceID) 0
 #define FireEtwThreadPoolEnqueue(WorkID, ClrInstanceID) 0
@@ -94,9 +97,12 @@
 #define FireEtwExceptionFilterStart(EntryEIP, MethodID, MethodName, ClrInstanceID) 0
 #define FireEtwExceptionFilterStop() 0
 #define FireEtwExceptionThrownStop() 0
+#define FireEtwExceptionDispatchTiming(ThrowToCatchMicroseconds, FramesWalked, StackTraceMicroseconds, ThrowingMethodID, ClrInstanceID) 0
 #define FireEtwContention() 0
 #define FireEtwContentionStart_V1(ContentionFlags, ClrInstanceID) 0
 #define FireEtwContentionStop(ContentionFlags, ClrInstanceID) 0
+#define FireEtwContentionStop_V1(ContentionFlags, ClrInstanceID, DurationNs) 0
+#define FireEtwContentionSample(ContentionFlags, LockID, CrstType, OwnerThreadID, DurationNs, ClrInstanceID) 0
 #define FireEtwCLRStackWalk(ClrInstanceID, Reserved1, Reserved2, FrameCount, Stack) 0
 #define FireEtwAppDomainMemAllocated(AppDomainID, Allocated, ClrInstanceID) 0
 #define FireEtwAppDomainMemSurvived(AppDomainID, Survived, ProcessSurvived, ClrInstanceID) 0
@@ -46,6 +46,9 @@ struct VirtualReserveFlags
     {
         None = 0,
         WriteWatch = 1,
+        // Back the range with large pages where the OS can do that without committing it up
+        // front. This is only a hint, the range is reserved with normal pages otherwise.
+        LargePages = 2,
     };
 };
 
@@ -165,6 +165,15 @@ size_t GetHighPrecisionTimeStamp()
     
     return (size_t)(ts / (qpf / 1000));    
 }
+
+// Same as GetHighPrecisionTimeStamp but in microseconds, for things where
+// ms is too coarse (like per heap phase times).
+uint64_t GetHighPrecisionTimeStampUs()
+{
+    int64_t ts = GCToOSInterface::QueryPerformanceCounter();
+
+    return (uint64_t)((double)ts * 1000000.0 / (double)qpf);
+}
 #endif
 
 
@@ -836,6 +845,8 @@ public:
 
             fire_event (gch->heap_number, time_start, type_join, join_id);
 
+            uint64_t wait_start_us = GetHighPrecisionTimeStampUs();
+
             //busy wait around the color
             if (color == join_struct.lock_color.LoadWithoutBarrier())
             {
@@ -880,6 +891,11 @@ respin:
 
             fire_event (gch->heap_number, time_end, type_join, join_id);
 
+            if (flavor == join_flavor_server_gc)
+            {
+                gch->join_wait_time_us += GetHighPrecisionTimeStampUs() - wait_start_us;
+            }
+
 #ifdef JOIN_STATS
             // parallel execution starts here
             start[gch->heap_number] = get_ts();
@@ -890,6 +906,11 @@ respin:
         {
             fire_event (gch->heap_number, time_start, type_last_join, join_id);
 
+            if (flavor == join_flavor_server_gc)
+            {
+                gch->join_last_arrival_count++;
+            }
+
             join_struct.joined_p = TRUE;
             dprintf (JOIN_LOG, ("join%d(%d): Last thread to complete the join, setting id", flavor, join_id));
             join_struct.joined_event[!color].Reset();
@@ -1580,6 +1601,16 @@ inline bool can_use_write_watch_for_card_table()
 #define mem_reserve (MEM_RESERVE)
 #endif //WRITE_WATCH
 
+// Set from GCLargePages - segments and the block holding the card, brick and
+// mark arrays are reserved asking the OS to back them with large pages.
+static bool virtual_alloc_large_pages = false;
+
+inline
+uint32_t large_pages_reserve_flag()
+{
+    return (virtual_alloc_large_pages ? (uint32_t)VirtualReserveFlags::LargePages : (uint32_t)VirtualReserveFlags::None);
+}
+
 //check if the low memory notification is supported
 
 #ifndef DACCESS_COMPILE
@@ -2123,6 +2154,9 @@ uint8_t* gc_heap::pad_for_alignment_large (uint8_t* newAlloc, int requiredAlignm
 #define CLR_SIZE ((size_t)(8*1024))
 #endif //SERVER_GC
 
+// The most a thread can raise its allocation quantum to through alloc_quantum_hint
+#define MAX_ALLOCATION_QUANTUM_HINT ((size_t)(256*1024))
+
 #define END_SPACE_AFTER_GC (LARGE_OBJECT_SIZE + MAX_STRUCTALIGN)
 
 #ifdef BACKGROUND_GC
@@ -2479,6 +2513,12 @@ uint32_t    gc_heap::high_memory_load_th = 0;
 
 uint64_t    gc_heap::total_physical_mem = 0;
 
+size_t      gc_heap::heap_hard_limit = 0;
+
+size_t      gc_heap::current_total_committed = 0;
+
+VOLATILE(int32_t) gc_heap::check_commit_lock = -1;
+
 uint64_t    gc_heap::entry_available_physical_mem = 0;
 
 #ifdef BACKGROUND_GC
@@ -2583,6 +2623,18 @@ gen_to_condemn_tuning gc_heap::gen_to_condemn_reasons;
 
 size_t      gc_heap::etw_allocation_running_amount[2];
 
+size_t      gc_heap::etw_allocation_next_tick[2];
+
+uint32_t    gc_heap::etw_allocation_rand_seed;
+
+uint64_t    gc_heap::gc_start_time_us = 0;
+
+uint64_t    gc_heap::gen0_budget_last_gc_start_us = 0;
+
+float       gc_heap::gen0_budget_factor = 1.0f;
+
+uint64_t    gc_heap::gc_phase_time_us[gc_phase_max];
+
 int         gc_heap::gc_policy = 0;
 
 size_t      gc_heap::allocation_running_time;
@@ -4437,11 +4489,11 @@ void* virtual_alloc (size_t size)
         }
     }
 
-    uint32_t flags = VirtualReserveFlags::None;
+    uint32_t flags = large_pages_reserve_flag();
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     if (virtual_alloc_hardware_write_watch)
     {
-        flags = VirtualReserveFlags::WriteWatch;
+        flags |= VirtualReserveFlags::WriteWatch;
     }
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     void* prgmem = GCToOSInterface::VirtualReserve (requested_size, card_size * card_word_width, flags);
@@ -4841,6 +4893,7 @@ void release_segment (heap_segment* sg)
 {
     ptrdiff_t delta = 0;
     FIRE_EVENT(GCFreeSegment_V1, heap_segment_mem(sg));
+    gc_heap::release_commit_accounting (heap_segment_committed (sg) - (uint8_t*)sg);
     virtual_free (sg, (uint8_t*)heap_segment_reserved (sg)-(uint8_t*)sg);
 }
 
@@ -5479,6 +5532,83 @@ bool virtual_alloc_commit_for_heap(void* addr, size_t size, int h_number)
     return GCToOSInterface::VirtualCommit(addr, size);
 }
 
+inline
+static void enter_commit_lock (RAW_KEYWORD(volatile) int32_t* lock)
+{
+    // This lock is only ever held to update a counter so we don't need to 
+    // switch to preemptive mode or wait for GCs here.
+    while (Interlocked::CompareExchange (lock, 0, -1) >= 0)
+    {
+        YieldProcessor();
+    }
+}
+
+inline
+static void leave_commit_lock (RAW_KEYWORD(volatile) int32_t* lock)
+{
+    VolatileStore<int32_t>((int32_t*)lock, -1);
+}
+
+// If we have a hard limit we account for the bytes before asking the OS for them so
+// that heaps committing at the same time can't collectively go over the limit.
+bool gc_heap::virtual_commit (void* address, size_t size, int h_number)
+{
+    if (heap_hard_limit)
+    {
+        bool exceeded_p = false;
+
+        enter_commit_lock (&check_commit_lock);
+        if ((current_total_committed + size) > heap_hard_limit)
+        {
+            exceeded_p = true;
+        }
+        else
+        {
+            current_total_committed += size;
+        }
+        leave_commit_lock (&check_commit_lock);
+
+        if (exceeded_p)
+        {
+            dprintf (1, ("%Id + %Id exceeds the hard limit %Id", 
+                current_total_committed, size, heap_hard_limit));
+            return false;
+        }
+    }
+
+    bool commit_succeeded_p = virtual_alloc_commit_for_heap (address, size, h_number);
+
+    if (!commit_succeeded_p && heap_hard_limit)
+    {
+        release_commit_accounting (size);
+    }
+
+    return commit_succeeded_p;
+}
+
+bool gc_heap::virtual_decommit (void* address, size_t size)
+{
+    bool decommit_succeeded_p = GCToOSInterface::VirtualDecommit (address, size);
+
+    if (decommit_succeeded_p)
+    {
+        release_commit_accounting (size);
+    }
+
+    return decommit_succeeded_p;
+}
+
+void gc_heap::release_commit_accounting (size_t size)
+{
+    if (heap_hard_limit)
+    {
+        enter_commit_lock (&check_commit_lock);
+        assert (current_total_committed >= size);
+        current_total_committed -= size;
+        leave_commit_lock (&check_commit_lock);
+    }
+}
+
 #ifndef SEG_MAPPING_TABLE
 inline
 heap_segment* gc_heap::segment_of (uint8_t* add, ptrdiff_t& delta, BOOL verify_p)
@@ -7054,7 +7184,7 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     assert (g_gc_lowest_address == start);
     assert (g_gc_highest_address == end);
 
-    uint32_t virtual_reserve_flags = VirtualReserveFlags::None;
+    uint32_t virtual_reserve_flags = large_pages_reserve_flag();
 
     size_t bs = size_brick_of (start, end);
     size_t cs = size_card_of (start, end);
@@ -7246,7 +7376,7 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
                                 (size_t)saved_g_highest_address));
 
         bool write_barrier_updated = false;
-        uint32_t virtual_reserve_flags = VirtualReserveFlags::None;
+        uint32_t virtual_reserve_flags = large_pages_reserve_flag();
         uint32_t* saved_g_card_table = g_gc_card_table;
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
@@ -8124,6 +8254,74 @@ private:
 
 #ifdef MULTIPLE_HEAPS
 #ifdef PARALLEL_MARK_LIST_SORT
+// Below this many entries we just use _sort.
+#define MIN_MARK_LIST_RADIX_SORT_COUNT (4*1024)
+
+// LSD radix sort of the mark list entries in [begin, end[ using scratch, which needs
+// to have room for the same number of entries. We sort on the offset from the lowest
+// entry, 8 bits at a time, and skip the digits that are the same for all entries 
+// (eg, the low bits that are always 0 because of alignment) so usually only a few 
+// passes are needed. Unlike _sort, end is exclusive.
+static void radix_sort_mark_list (uint8_t** begin, uint8_t** end, uint8_t** scratch)
+{
+    const int digit_bits = 8;
+    const size_t digit_count = (size_t)1 << digit_bits;
+    size_t count = end - begin;
+
+    uint8_t* lowest = *begin;
+    uint8_t* highest = *begin;
+    for (uint8_t** x = begin + 1; x < end; x++)
+    {
+        if (*x < lowest)
+            lowest = *x;
+        else if (*x > highest)
+            highest = *x;
+    }
+
+    size_t range = (size_t)(highest - lowest);
+    uint8_t** src = begin;
+    uint8_t** dst = scratch;
+    size_t histogram[digit_count];
+
+    for (int shift = 0; (shift < (int)(sizeof (size_t) * 8)) && ((range >> shift) != 0); shift += digit_bits)
+    {
+        memset (histogram, 0, sizeof (histogram));
+        for (size_t i = 0; i < count; i++)
+        {
+            histogram[((size_t)(src[i] - lowest) >> shift) & (digit_count - 1)]++;
+        }
+
+        // If everything has the same digit this pass wouldn't change the order.
+        if (histogram[((size_t)(src[0] - lowest) >> shift) & (digit_count - 1)] == count)
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t d = 0; d < digit_count; d++)
+        {
+            size_t c = histogram[d];
+            histogram[d] = offset;
+            offset += c;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint8_t* o = src[i];
+            dst[histogram[((size_t)(o - lowest) >> shift) & (digit_count - 1)]++] = o;
+        }
+
+        uint8_t** temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != begin)
+    {
+        memcpy (begin, src, count * sizeof (*begin));
+    }
+}
+
 void gc_heap::sort_mark_list()
 {
     // if this heap had a mark list overflow, we don't do anything
@@ -8148,7 +8346,13 @@ void gc_heap::sort_mark_list()
 //    unsigned long start = GetCycleCount32();
 
     dprintf (3, ("Sorting mark lists"));
-    if (mark_list_index > mark_list)
+    if ((size_t)(mark_list_index - mark_list) >= MIN_MARK_LIST_RADIX_SORT_COUNT)
+    {
+        // This heap's part of g_mark_list_copy is only written to by merge_mark_lists
+        // which happens after all heaps are done sorting so we can use it as scratch.
+        radix_sort_mark_list (mark_list, mark_list_index, &g_mark_list_copy [heap_number*mark_list_size]);
+    }
+    else if (mark_list_index > mark_list)
         _sort (mark_list, mark_list_index - 1, 0);
 
 //    printf("first phase of sort_mark_list for heap %d took %u cycles to sort %u entries\n", this->heap_number, GetCycleCount32() - start, mark_list_index - mark_list);
@@ -9165,7 +9369,7 @@ heap_segment* gc_heap::make_heap_segment (uint8_t* new_pages, size_t size, int h
     size_t initial_commit = SEGMENT_INITIAL_COMMIT;
 
     //Commit the first page
-    if (!virtual_alloc_commit_for_heap (new_pages, initial_commit, h_number))
+    if (!virtual_commit (new_pages, initial_commit, h_number))
     {
         return 0;
     }
@@ -9276,7 +9480,7 @@ void gc_heap::decommit_heap_segment_pages (heap_segment* seg,
         page_start += max(extra_space, 32*OS_PAGE_SIZE);
         size -= max (extra_space, 32*OS_PAGE_SIZE);
 
-        GCToOSInterface::VirtualDecommit (page_start, size);
+        virtual_decommit (page_start, size);
         dprintf (3, ("Decommitting heap segment [%Ix, %Ix[(%d)", 
             (size_t)page_start, 
             (size_t)(page_start + size),
@@ -9301,7 +9505,7 @@ void gc_heap::decommit_heap_segment (heap_segment* seg)
 #endif //BACKGROUND_GC
 
     size_t size = heap_segment_committed (seg) - page_start;
-    GCToOSInterface::VirtualDecommit (page_start, size);
+    virtual_decommit (page_start, size);
 
     //re-init the segment object
     heap_segment_committed (seg) = page_start;
@@ -9334,8 +9538,9 @@ void gc_heap::rearrange_small_heap_segments()
     while (seg)
     {
         heap_segment* next_seg = heap_segment_next (seg);
-        // TODO: we need to consider hoarding here.
-        delete_heap_segment (seg, FALSE);
+        // Segments emptied by the background sweep are hoarded the same way as empty
+        // LOH segments so the next SOH expansion can reuse them without going to the OS.
+        delete_heap_segment (seg, GCConfig::GetRetainVM());
         seg = next_seg;
     }
     freeable_small_heap_segment = 0;
@@ -9906,6 +10111,8 @@ HRESULT gc_heap::initialize_gc (size_t segment_size,
 
     HRESULT hres = S_OK;
 
+    virtual_alloc_large_pages = GCConfig::GetLargePages();
+
 #ifdef WRITE_WATCH
     hardware_write_watch_api_supported();
 #ifdef BACKGROUND_GC
@@ -10510,7 +10717,7 @@ gc_heap::init_gc_heap (int  h_number)
 
     generation_table [max_generation].free_list_allocator = allocator(NUM_GEN2_ALIST, BASE_GEN2_ALIST, gen2_alloc_list);
     //assign the alloc_list for the large generation 
-    generation_table [max_generation+1].free_list_allocator = allocator(NUM_LOH_ALIST, BASE_LOH_ALIST, loh_alloc_list);
+    generation_table [max_generation+1].free_list_allocator = allocator(NUM_LOH_ALIST, BASE_LOH_ALIST, loh_alloc_list, TRUE);
     generation_table [max_generation+1].gen_num = max_generation+1;
     make_generation (generation_table [max_generation+1],lseg, heap_segment_mem (lseg), 0);
     heap_segment_allocated (lseg) = heap_segment_mem (lseg) + Align (min_obj_size, get_alignment_constant (FALSE));
@@ -10561,6 +10768,19 @@ gc_heap::init_gc_heap (int  h_number)
     etw_allocation_running_amount[0] = 0;
     etw_allocation_running_amount[1] = 0;
 
+    etw_allocation_rand_seed = (uint32_t)GCToOSInterface::QueryPerformanceCounter() | 1;
+    etw_allocation_next_tick[0] = get_etw_allocation_next_tick();
+    etw_allocation_next_tick[1] = get_etw_allocation_next_tick();
+
+#ifdef MULTIPLE_HEAPS
+    gen0_decommit_smoothed_need = 0;
+    gen0_last_decommit_time = 0;
+#endif //MULTIPLE_HEAPS
+
+    gc_start_time_us = 0;
+    gen0_budget_last_gc_start_us = 0;
+    gen0_budget_factor = 1.0f;
+
     //needs to be done after the dynamic data has been initialized
 #ifndef MULTIPLE_HEAPS
     allocation_running_amount = dd_min_size (dynamic_data_of (0));
@@ -10884,7 +11104,7 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address)
 
     dprintf(3, ("Growing segment allocation %Ix %Ix", (size_t)heap_segment_committed(seg),c_size));
     
-    if (!virtual_alloc_commit_for_heap(heap_segment_committed (seg), c_size, heap_number))
+    if (!virtual_commit (heap_segment_committed (seg), c_size, heap_number))
     {
         dprintf(3, ("Cannot grow heap segment"));
         return FALSE;
@@ -11123,11 +11343,13 @@ void gc_heap::check_batch_mark_array_bits (uint8_t* start, uint8_t* end)
 }
 #endif //VERIFY_HEAP && BACKGROUND_GC
 
-allocator::allocator (unsigned int num_b, size_t fbs, alloc_list* b)
+allocator::allocator (unsigned int num_b, size_t fbs, alloc_list* b, BOOL half_steps)
 {
     assert (num_b < MAX_BUCKET_COUNT);
+    assert (!half_steps || ((fbs & (fbs - 1)) == 0));
     num_buckets = num_b;
     frst_bucket_size = fbs;
+    half_steps_p = half_steps;
     buckets = b;
 }
 
@@ -11220,7 +11442,7 @@ void allocator::thread_item (uint8_t* item, size_t size)
         {
             break;
         }
-        sz = sz * 2;
+        sz = next_bucket_size (sz);
     }
     alloc_list* al = &alloc_list_of (a_l_number);
     thread_free_item (item, 
@@ -11239,7 +11461,7 @@ void allocator::thread_item_front (uint8_t* item, size_t size)
         {
             break;
         }
-        sz = sz * 2;
+        sz = next_bucket_size (sz);
     }
     alloc_list* al = &alloc_list_of (a_l_number);
     free_list_slot (item) = al->alloc_list_head();
@@ -11497,13 +11719,25 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size,
  */
 
 size_t gc_heap::limit_from_size (size_t size, size_t room, int gen_number,
-                                 int align_const)
+                                 alloc_context* acontext, int align_const)
 {
+    size_t quantum = 0;
+    if (gen_number < max_generation+1)
+    {
+        quantum = allocation_quantum;
+
+        // A thread that allocates in bursts can ask for bigger allocation contexts so it
+        // comes back for more less often. new_allocation_limit still keeps it within the budget.
+        size_t quantum_hint = acontext->alloc_quantum_hint;
+        if (quantum_hint > quantum)
+        {
+            quantum = Align (min (quantum_hint, (size_t)MAX_ALLOCATION_QUANTUM_HINT), align_const);
+        }
+    }
+
     size_t new_limit = new_allocation_limit ((size + Align (min_obj_size, align_const)),
                                              min (room,max (size + Align (min_obj_size, align_const),
-                                                            ((gen_number < max_generation+1) ?
-                                                             allocation_quantum :
-                                                             0))),
+                                                            quantum)),
                                              gen_number);
     assert (new_limit >= (size + Align (min_obj_size, align_const)));
     dprintf (100, ("requested to allocate %Id bytes, actual size is %Id", size, new_limit));
@@ -11837,7 +12071,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                     // We ask for more Align (min_obj_size)
                     // to make sure that we can insert a free object
                     // in adjust_limit will set the limit lower
-                    size_t limit = limit_from_size (size, free_list_size, gen_number, align_const);
+                    size_t limit = limit_from_size (size, free_list_size, gen_number, acontext, align_const);
 
                     uint8_t*  remain = (free_list + limit);
                     size_t remain_size = (free_list_size - limit);
@@ -11875,7 +12109,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 free_list = free_list_slot (free_list); 
             }
         }
-        sz_list = sz_list * 2;
+        sz_list = gen_allocator->next_bucket_size (sz_list);
     }
 end:
     return can_fit;
@@ -11982,6 +12216,10 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
 #ifdef BACKGROUND_GC
     int cookie = -1;
 #endif //BACKGROUND_GC
+    // Items in the bucket that size falls into can be smaller or larger than size
+    // so we look for the best fit in that bucket; items in the larger buckets are
+    // all big enough so we just take the first one that fits.
+    BOOL best_fit_p = TRUE;
     size_t sz_list = loh_allocator->first_bucket_size();
     for (unsigned int a_l_idx = 0; a_l_idx < loh_allocator->number_of_buckets(); a_l_idx++)
     {
@@ -11989,6 +12227,9 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
         {
             uint8_t* free_list = loh_allocator->alloc_list_head_of (a_l_idx);
             uint8_t* prev_free_item = 0;
+            uint8_t* fit_free_item = 0;
+            uint8_t* prev_fit_free_item = 0;
+            size_t fit_free_item_size = 0;
             while (free_list != 0)
             {
                 dprintf (3, ("considering free list %Ix", (size_t)free_list));
@@ -12002,63 +12243,86 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
                     (size == free_list_size))
 #endif //FEATURE_LOH_COMPACTION
                 {
+                    if ((fit_free_item == 0) || (free_list_size < fit_free_item_size))
+                    {
+                        fit_free_item = free_list;
+                        prev_fit_free_item = prev_free_item;
+                        fit_free_item_size = free_list_size;
+                    }
+
+                    // Stop looking once what would be left is too small to go back on the free list.
+                    if (!best_fit_p || ((free_list_size - size) < Align (min_free_list, align_const)))
+                    {
+                        break;
+                    }
+                }
+                prev_free_item = free_list;
+                free_list = free_list_slot (free_list); 
+            }
+
+            best_fit_p = FALSE;
+
+            if (fit_free_item != 0)
+            {
+                free_list = fit_free_item;
+                prev_free_item = prev_fit_free_item;
+                size_t free_list_size = fit_free_item_size;
+                dprintf (3, ("fitting free list %Ix(%Id)", (size_t)free_list, free_list_size));
+
 #ifdef BACKGROUND_GC
-                    cookie = bgc_alloc_lock->loh_alloc_set (free_list);
+                cookie = bgc_alloc_lock->loh_alloc_set (free_list);
 #endif //BACKGROUND_GC
 
-                    //unlink the free_item
-                    loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                //unlink the free_item
+                loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
 
-                    // Substract min obj size because limit_from_size adds it. Not needed for LOH
-                    size_t limit = limit_from_size (size - Align(min_obj_size, align_const), free_list_size, 
-                                                    gen_number, align_const);
+                // Substract min obj size because limit_from_size adds it. Not needed for LOH
+                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), free_list_size, 
+                                                gen_number, acontext, align_const);
 
 #ifdef FEATURE_LOH_COMPACTION
-                    make_unused_array (free_list, loh_pad);
-                    limit -= loh_pad;
-                    free_list += loh_pad;
-                    free_list_size -= loh_pad;
+                make_unused_array (free_list, loh_pad);
+                limit -= loh_pad;
+                free_list += loh_pad;
+                free_list_size -= loh_pad;
 #endif //FEATURE_LOH_COMPACTION
 
-                    uint8_t*  remain = (free_list + limit);
-                    size_t remain_size = (free_list_size - limit);
-                    if (remain_size != 0)
-                    {
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                        make_unused_array (remain, remain_size);
-                    }
-                    if (remain_size >= Align(min_free_list, align_const))
-                    {
-                        loh_thread_gap_front (remain, remain_size, gen);
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                    }
-                    else
-                    {
-                        generation_free_obj_space (gen) += remain_size;
-                    }
-                    generation_free_list_space (gen) -= free_list_size;
-                    dprintf (3, ("found fit on loh at %Ix", free_list));
+                uint8_t*  remain = (free_list + limit);
+                size_t remain_size = (free_list_size - limit);
+                if (remain_size != 0)
+                {
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                    make_unused_array (remain, remain_size);
+                }
+                if (remain_size >= Align(min_free_list, align_const))
+                {
+                    loh_thread_gap_front (remain, remain_size, gen);
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                }
+                else
+                {
+                    generation_free_obj_space (gen) += remain_size;
+                }
+                generation_free_list_space (gen) -= free_list_size;
+                dprintf (3, ("found fit on loh at %Ix", free_list));
 #ifdef BACKGROUND_GC
-                    if (cookie != -1)
-                    {
-                        bgc_loh_alloc_clr (free_list, limit, acontext, align_const, cookie, FALSE, 0);
-                    }
-                    else
+                if (cookie != -1)
+                {
+                    bgc_loh_alloc_clr (free_list, limit, acontext, align_const, cookie, FALSE, 0);
+                }
+                else
 #endif //BACKGROUND_GC
-                    {
-                        adjust_limit_clr (free_list, limit, acontext, 0, align_const, gen_number);
-                    }
-
-                    //fix the limit to compensate for adjust_limit_clr making it too short 
-                    acontext->alloc_limit += Align (min_obj_size, align_const);
-                    can_fit = TRUE;
-                    goto exit;
+                {
+                    adjust_limit_clr (free_list, limit, acontext, 0, align_const, gen_number);
                 }
-                prev_free_item = free_list;
-                free_list = free_list_slot (free_list); 
+
+                //fix the limit to compensate for adjust_limit_clr making it too short 
+                acontext->alloc_limit += Align (min_obj_size, align_const);
+                can_fit = TRUE;
+                goto exit;
             }
         }
-        sz_list = sz_list * 2;
+        sz_list = loh_allocator->next_bucket_size (sz_list);
     }
 exit:
     return can_fit;
@@ -12100,7 +12364,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     {
         limit = limit_from_size (size, 
                                  (end - allocated), 
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
         goto found_fit;
     }
 
@@ -12110,7 +12374,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     {
         limit = limit_from_size (size, 
                                  (end - allocated), 
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
         if (grow_heap_segment (seg, allocated + limit))
         {
             goto found_fit;
@@ -13207,7 +13471,7 @@ int gc_heap::try_allocate_more_space (alloc_context* acontext, size_t size,
         etw_allocation_running_amount[etw_allocation_index] += alloc_context_bytes;
 
 
-        if (etw_allocation_running_amount[etw_allocation_index] > etw_allocation_tick)
+        if (etw_allocation_running_amount[etw_allocation_index] > etw_allocation_next_tick[etw_allocation_index])
         {
 #ifdef FEATURE_REDHAWK
             FIRE_EVENT(GCAllocationTick_V1, (uint32_t)etw_allocation_running_amount[etw_allocation_index],
@@ -13223,12 +13487,45 @@ int gc_heap::try_allocate_more_space (alloc_context* acontext, size_t size,
 #endif //FEATURE_EVENT_TRACE
 #endif //FEATURE_REDHAWK
             etw_allocation_running_amount[etw_allocation_index] = 0;
+            etw_allocation_next_tick[etw_allocation_index] = get_etw_allocation_next_tick();
         }
     }
 
     return (int)can_allocate;
 }
 
+// Returns how much we should allocate before firing the next allocation tick event.
+// When randomized, this is exponentially distributed with an average of etw_allocation_tick 
+// so the events are a Poisson sample of the allocated bytes and whichever type happens to 
+// be allocated at a fixed boundary doesn't get all the attribution. 
+size_t gc_heap::get_etw_allocation_next_tick()
+{
+    if (!GCConfig::GetRandomizeAllocationTick())
+    {
+        return etw_allocation_tick;
+    }
+
+    // xorshift32, never produces 0.
+    uint32_t r = etw_allocation_rand_seed;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    etw_allocation_rand_seed = r;
+
+    // -ln(r / 2^32) = ln(2) * (32 - log2(r)). log2 is computed in 16.16 fixed point from the
+    // highest set bit and log2(1 + f) ~= f + 0.3466 * f * (1 - f) for the bits below it, which 
+    // is close enough for sampling purposes and keeps floating point out of the allocation path.
+    int highest_bit = index_of_set_bit (round_down_power2 (r));
+    uint64_t f = (((uint64_t)r - ((uint64_t)1 << highest_bit)) << 16) >> highest_bit;
+    f += (((f * (65536 - f)) >> 16) * 22713) >> 16;
+    uint64_t log2_r = ((uint64_t)highest_bit << 16) + f;
+    uint64_t neg_log2_u = ((uint64_t)32 << 16) - log2_r;
+    // 45426 is ln(2) in 16.16 fixed point.
+    uint64_t neg_ln_u = (neg_log2_u * 45426) >> 16;
+
+    return max ((size_t)((etw_allocation_tick * neg_ln_u) >> 16), (size_t)Align (min_obj_size));
+}
+
 #ifdef MULTIPLE_HEAPS
 void gc_heap::balance_heaps (alloc_context* acontext)
 {
@@ -13283,21 +13580,31 @@ void gc_heap::balance_heaps (alloc_context* acontext)
 
                 dynamic_data* dd = org_hp->dynamic_data_of (0);
                 ptrdiff_t org_size = dd_new_allocation (dd);
+                size_t org_min_size = dd_min_size (dd);
                 int org_alloc_context_count;
                 int max_alloc_context_count;
                 gc_heap* max_hp;
                 ptrdiff_t max_size;
-                size_t delta = dd_min_size (dd)/4;
+                size_t delta = org_min_size/4;
 
+                // Look at the heaps on the node the thread is running on first - this is
+                // the node of the heap select_heap picks, which isn't necessarily the node
+                // of the heap we are currently allocating on if the thread has migrated.
                 int start, end, finish;
-                heap_select::get_heap_range_for_heap(org_hp->heap_number, &start, &end);
+                int local_hn = heap_select::select_heap(acontext, hint);
+                heap_select::get_heap_range_for_heap(local_hn, &start, &end);
                 finish = start + n_heaps;
 
+                // If we are allocating on a remote node, we don't give the current heap
+                // the usual advantage over the local heaps.
+                BOOL org_hp_local_p = (heap_select::find_numa_node_from_heap_no (org_hp->heap_number) ==
+                                       heap_select::find_numa_node_from_heap_no (local_hn));
+
 try_again:
                 do
                 {
                     max_hp = org_hp;
-                    max_size = org_size + delta;
+                    max_size = org_size + ((org_hp_local_p || (end == finish)) ? delta : 0);
                     acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, hint) ));
 
                     if (org_hp == acontext->get_home_heap()->pGenGCHeap)
@@ -13332,7 +13639,9 @@ try_again:
                 if ((max_hp == org_hp) && (end < finish))
                 {   
                     start = end; end = finish; 
-                    delta = dd_min_size(dd)/2; // Make it twice as hard to balance to remote nodes on NUMA.
+                    // Make it much harder to balance to remote nodes on NUMA - every allocation
+                    // made on a remote heap is cross node traffic.
+                    delta = org_min_size;
                     goto try_again;
                 }
 
@@ -13758,7 +14067,7 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
                     free_list = free_list_slot (free_list); 
                 }
             }
-            sz_list = sz_list * 2;
+            sz_list = gen_allocator->next_bucket_size (sz_list);
         }
         //go back to the beginning of the segment list 
         generation_allocate_end_seg_p (gen) = TRUE;
@@ -14859,9 +15168,11 @@ int gc_heap::generation_to_condemn (int n_initial,
     // It's hard to catch when we get to the point that the memory load is so high
     // we get an induced GC from the finalizer thread so we are checking the memory load
     // for every gen0 GC.
+    // With a hard limit we also need to check for gen0 GCs because we can get close to the 
+    // limit without ever triggering a gen1 GC.
     check_memory = (check_only_p ? 
                     (n >= 0) : 
-                    ((n >= 1) || low_memory_detected));
+                    ((n >= 1) || low_memory_detected || (heap_hard_limit != 0)));
 
     if (check_memory)
     {
@@ -14918,6 +15229,16 @@ int gc_heap::generation_to_condemn (int n_initial,
                     local_condemn_reasons->set_condition (gen_max_high_frag_vm_p);
                 }
             }
+
+            if (heap_hard_limit && v_high_memory_load)
+            {
+                // We are about to run into the hard limit. A BGC doesn't compact so do a blocking
+                // gen2 now instead of waiting until we fail to commit.
+                dprintf (GTC_LOG, ("h%d: close to hard limit - BLOCK", heap_number));
+                n = max_generation;
+                *blocking_collection_p = TRUE;
+                local_condemn_reasons->set_condition (gen_very_high_mem_p);
+            }
         }
     }
 
@@ -15321,6 +15642,15 @@ void gc_heap::gc1()
     mark_time = plan_time = reloc_time = compact_time = sweep_time = 0;
 #endif //TIME_GC
 
+    if (!settings.concurrent)
+    {
+        memset (gc_phase_time_us, 0, sizeof (gc_phase_time_us));
+#ifdef MULTIPLE_HEAPS
+        join_wait_time_us = 0;
+        join_last_arrival_count = 0;
+#endif //MULTIPLE_HEAPS
+    }
+
     verify_soh_segment_list();
 
     int n = settings.condemned_generation;
@@ -15795,6 +16125,7 @@ void gc_heap::gc1()
 #endif //FEATURE_LOH_COMPACTION
 
             fire_pevents();
+            fire_per_heap_phase_time_events();
 
             gc_t_join.restart();
         }
@@ -15813,6 +16144,7 @@ void gc_heap::gc1()
 
     if (!(settings.concurrent))
     {
+        fire_per_heap_phase_time_events();
         rearrange_large_heap_segments();
         do_post_gc();
     }
@@ -16007,7 +16339,7 @@ BOOL gc_heap::find_loh_free_for_no_gc()
                 free_list = free_list_slot (free_list); 
             }
         }
-        sz_list = sz_list * 2;
+        sz_list = loh_allocator->next_bucket_size (sz_list);
     }
 
     return FALSE;
@@ -16281,6 +16613,11 @@ void gc_heap::update_collection_counts ()
 
     size_t now = GetHighPrecisionTimeStamp();
 
+    if (!settings.concurrent)
+    {
+        gc_start_time_us = GetHighPrecisionTimeStampUs();
+    }
+
     for (int i = 0; i <= settings.condemned_generation;i++)
     {
         dynamic_data* dd = dynamic_data_of (i);
@@ -17886,6 +18223,79 @@ more_to_do:
     }
 }
 
+#ifdef MULTIPLE_HEAPS
+// Reports how long each heap took to mark and how far behind the fastest heap
+// it was. A large skew means the heaps that finished early sat idle in the join.
+void gc_heap::fire_per_heap_mark_time_events()
+{
+    if (!EVENT_ENABLED(GCPerHeapMarkTime))
+    {
+        return;
+    }
+
+    uint64_t min_mark_time_us = UINT64_MAX;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        min_mark_time_us = min (min_mark_time_us, g_heaps[i]->mark_time_us);
+    }
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        uint64_t stolen_count = 0;
+#ifdef MH_SC_MARK
+        stolen_count = (uint64_t)hp->mark_stolen_count;
+#endif //MH_SC_MARK
+        dprintf (2, ("h%d: mark %I64dus, skew %I64dus, stole %I64d", 
+            i, hp->mark_time_us, (hp->mark_time_us - min_mark_time_us), stolen_count));
+        FIRE_EVENT(GCPerHeapMarkTime, (uint32_t)i, hp->mark_time_us, 
+                   (hp->mark_time_us - min_mark_time_us), stolen_count);
+    }
+}
+#endif //MULTIPLE_HEAPS
+
+// Reports how long each heap spent in each phase of the blocking GC that just
+// finished, and on server GC how long its thread waited in joins and how often
+// it was the last to arrive at one, so the heap holding up a pause stands out.
+void gc_heap::fire_per_heap_phase_time_events()
+{
+    // Background GCs don't reset the phase times (foreground GCs that run during them
+    // use the same arrays), so there is nothing meaningful to report for them.
+    if (settings.concurrent || !EVENT_ENABLED(GCPerHeapPhaseTimes))
+    {
+        return;
+    }
+
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        uint64_t join_wait_us = hp->join_wait_time_us;
+        uint32_t last_join_count = hp->join_last_arrival_count;
+#else
+    {
+        gc_heap* hp = pGenGCHeap;
+        uint64_t join_wait_us = 0;
+        uint32_t last_join_count = 0;
+#endif //MULTIPLE_HEAPS
+        dprintf (2, ("h%d: mark %I64dus, plan %I64dus, relocate %I64dus, compact %I64dus, sweep %I64dus, join wait %I64dus, last at %d joins",
+            hp->heap_number,
+            hp->gc_phase_time_us[gc_phase_mark],
+            hp->gc_phase_time_us[gc_phase_plan],
+            hp->gc_phase_time_us[gc_phase_relocate],
+            hp->gc_phase_time_us[gc_phase_compact],
+            hp->gc_phase_time_us[gc_phase_sweep],
+            join_wait_us, last_join_count));
+        FIRE_EVENT(GCPerHeapPhaseTimes, (uint32_t)hp->heap_number, (uint32_t)settings.condemned_generation,
+                   hp->gc_phase_time_us[gc_phase_mark],
+                   hp->gc_phase_time_us[gc_phase_plan],
+                   hp->gc_phase_time_us[gc_phase_relocate],
+                   hp->gc_phase_time_us[gc_phase_compact],
+                   hp->gc_phase_time_us[gc_phase_sweep],
+                   join_wait_us, last_join_count);
+    }
+}
+
 #ifdef MH_SC_MARK
 BOOL same_numa_node_p (int hn1, int hn2)
 {
@@ -18016,6 +18426,7 @@ gc_heap::mark_steal()
                 }
                 if (success)
                 {
+                    mark_stolen_count++;
 
 #ifdef SNOOP_STATS
                     dprintf (SNOOP_LOG, ("heap%d: marking %Ix from %d [%d] tl:%dms",
@@ -19132,6 +19543,27 @@ void gc_heap::get_memory_info (uint32_t* memory_load,
                                uint64_t* available_page_file)
 {
     GCToOSInterface::GetMemoryStatus(memory_load, available_physical, available_page_file);
+
+    if (heap_hard_limit)
+    {
+        // With a hard limit what matters is how close we are to the limit, not the machine (or
+        // container) wide memory load. Reporting it as the memory load means all the high memory load 
+        // tuning (elevating to gen2, compacting to reclaim fragmentation) kicks in before we actually
+        // fail to commit.
+        size_t committed = current_total_committed;
+        size_t available = ((committed < heap_hard_limit) ? (heap_hard_limit - committed) : 0);
+        uint32_t hard_limit_load = (uint32_t)((uint64_t)committed * 100 / (uint64_t)heap_hard_limit);
+
+        if (memory_load)
+        {
+            *memory_load = max (*memory_load, hard_limit_load);
+        }
+
+        if (available_physical)
+        {
+            *available_physical = min (*available_physical, (uint64_t)available);
+        }
+    }
 }
 
 void fire_mark_event (int heap_num, int root_type, size_t bytes_marked)
@@ -19450,6 +19882,7 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_us = GetHighPrecisionTimeStampUs();
 
     int gen_to_init = condemned_gen_number;
     if (condemned_gen_number == max_generation)
@@ -19509,6 +19942,12 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     static BOOL do_mark_steal_p = FALSE;
 #endif //MH_SC_MARK
 
+#ifdef MULTIPLE_HEAPS
+#ifdef MH_SC_MARK
+    mark_stolen_count = 0;
+#endif //MH_SC_MARK
+#endif //MULTIPLE_HEAPS
+
 #ifdef MULTIPLE_HEAPS
     gc_t_join.join(this, gc_join_begin_mark_phase);
     if (gc_t_join.joined())
@@ -19541,6 +19980,9 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
         gc_t_join.restart();
     }
+
+    // Taken after the join so the time other heaps took to get here isn't counted
+    uint64_t mark_start_us = GetHighPrecisionTimeStampUs();
 #endif //MULTIPLE_HEAPS
 
     {
@@ -19680,6 +20122,10 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     }
 #endif //MH_SC_MARK
 
+#ifdef MULTIPLE_HEAPS
+    mark_time_us = GetHighPrecisionTimeStampUs() - mark_start_us;
+#endif //MULTIPLE_HEAPS
+
     // Dependent handles need to be scanned with a special algorithm (see the header comment on
     // scan_dependent_handles for more detail). We perform an initial scan without synchronizing with other
     // worker threads or processing any mark stack overflow. This is not guaranteed to complete the operation
@@ -19702,6 +20148,10 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #endif // HEAP_ANALYZE
         GCToEEInterface::AfterGcScanRoots (condemned_gen_number, max_generation, &sc);
 
+#ifdef MULTIPLE_HEAPS
+        fire_per_heap_mark_time_events();
+#endif //MULTIPLE_HEAPS
+
 #ifdef MULTIPLE_HEAPS
         if (!full_p)
         {
@@ -19933,6 +20383,8 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
     promoted_bytes (heap_number) -= promoted_bytes_live;
 
+    gc_phase_time_us[gc_phase_mark] = GetHighPrecisionTimeStampUs() - phase_start_us;
+
 #ifdef TIME_GC
         finish = GetCycleCount32();
         mark_time = finish - start;
@@ -21399,6 +21851,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_us = GetHighPrecisionTimeStampUs();
 
     dprintf (2,("---- Plan Phase ---- Condemned generation %d, promotion: %d",
                 condemned_gen_number, settings.promotion ? 1 : 0));
@@ -22346,6 +22799,8 @@ void gc_heap::plan_phase (int condemned_gen_number)
     dprintf (2,("Fragmentation: %Id", fragmentation));
     dprintf (2,("---- End of Plan phase ----"));
 
+    gc_phase_time_us[gc_phase_plan] = GetHighPrecisionTimeStampUs() - phase_start_us;
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     plan_time = finish - start;
@@ -23019,6 +23474,7 @@ void gc_heap::make_free_lists (int condemned_gen_number)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_us = GetHighPrecisionTimeStampUs();
 
     //Promotion has to happen in sweep case.
     assert (settings.promotion);
@@ -23135,6 +23591,8 @@ void gc_heap::make_free_lists (int condemned_gen_number)
         alloc_allocated = start2 + Align (size (start2));
     }
 
+    gc_phase_time_us[gc_phase_sweep] = GetHighPrecisionTimeStampUs() - phase_start_us;
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     sweep_time = finish - start;
@@ -24284,6 +24742,7 @@ void gc_heap::relocate_phase (int condemned_gen_number,
         unsigned finish;
         start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_us = GetHighPrecisionTimeStampUs();
 
 //  %type%  category = quote (relocate);
     dprintf (2,("---- Relocate phase -----"));
@@ -24369,6 +24828,8 @@ void gc_heap::relocate_phase (int condemned_gen_number,
 
 #endif //MULTIPLE_HEAPS
 
+    gc_phase_time_us[gc_phase_relocate] = GetHighPrecisionTimeStampUs() - phase_start_us;
+
 #ifdef TIME_GC
         finish = GetCycleCount32();
         reloc_time = finish - start;
@@ -24735,6 +25196,7 @@ void gc_heap::compact_phase (int condemned_gen_number,
         unsigned finish;
         start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_us = GetHighPrecisionTimeStampUs();
     generation*   condemned_gen = generation_of (condemned_gen_number);
     uint8_t*  start_address = first_condemned_address;
     size_t   current_brick = brick_of (start_address);
@@ -24853,6 +25315,8 @@ void gc_heap::compact_phase (int condemned_gen_number,
 
     recover_saved_pinned_info();
 
+    gc_phase_time_us[gc_phase_compact] = GetHighPrecisionTimeStampUs() - phase_start_us;
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     compact_time = finish - start;
@@ -25212,6 +25676,12 @@ BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
     uint8_t* start = (heap_segment_read_only_p(seg) ? heap_segment_mem(seg) : (uint8_t*)seg);
     uint8_t* end = heap_segment_reserved (seg);
 
+#ifdef MULTIPLE_HEAPS
+    int h_number = hp->heap_number;
+#else
+    int h_number = 0;
+#endif //MULTIPLE_HEAPS
+
     uint8_t* lowest = hp->background_saved_lowest_address;
     uint8_t* highest = hp->background_saved_highest_address;
 
@@ -25238,7 +25708,7 @@ BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
         commit_start = max (lowest, start);
         commit_end = min (highest, end);
 
-        if (!commit_mark_array_by_range (commit_start, commit_end, hp->mark_array))
+        if (!commit_mark_array_by_range (commit_start, commit_end, hp->mark_array, h_number))
         {
             return FALSE;
         }
@@ -25262,7 +25732,7 @@ BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
                                     hp->card_table, new_card_table,
                                     hp->mark_array, ma));
 
-            if (!commit_mark_array_by_range (commit_start, commit_end, ma))
+            if (!commit_mark_array_by_range (commit_start, commit_end, ma, h_number))
             {
                 return FALSE;
             }
@@ -25274,7 +25744,7 @@ BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
     return TRUE;
 }
 
-BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t* mark_array_addr)
+BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t* mark_array_addr, int h_number)
 {
     size_t beg_word = mark_word_of (begin);
     size_t end_word = mark_word_of (align_on_mark_word (end));
@@ -25294,7 +25764,7 @@ BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t
                             size));
 #endif //SIMPLE_DPRINTF
 
-    if (GCToOSInterface::VirtualCommit (commit_start, size))
+    if (virtual_alloc_commit_for_heap (commit_start, size, h_number))
     {
         // We can only verify the mark array is cleared from begin to end, the first and the last
         // page aren't necessarily all cleared 'cause they could be used by other segments or 
@@ -25317,9 +25787,11 @@ BOOL gc_heap::commit_mark_array_with_check (heap_segment* seg, uint32_t* new_mar
 #ifdef MULTIPLE_HEAPS
     uint8_t* lowest = heap_segment_heap (seg)->background_saved_lowest_address;
     uint8_t* highest = heap_segment_heap (seg)->background_saved_highest_address;
+    int h_number = heap_segment_heap (seg)->heap_number;
 #else
     uint8_t* lowest = background_saved_lowest_address;
     uint8_t* highest = background_saved_highest_address;
+    int h_number = 0;
 #endif //MULTIPLE_HEAPS
 
     if ((highest >= start) &&
@@ -25327,7 +25799,7 @@ BOOL gc_heap::commit_mark_array_with_check (heap_segment* seg, uint32_t* new_mar
     {
         start = max (lowest, start);
         end = min (highest, end);
-        if (!commit_mark_array_by_range (start, end, new_mark_array_addr))
+        if (!commit_mark_array_by_range (start, end, new_mark_array_addr, h_number))
         {
             return FALSE;
         }
@@ -25336,7 +25808,7 @@ BOOL gc_heap::commit_mark_array_with_check (heap_segment* seg, uint32_t* new_mar
     return TRUE;
 }
 
-BOOL gc_heap::commit_mark_array_by_seg (heap_segment* seg, uint32_t* mark_array_addr)
+BOOL gc_heap::commit_mark_array_by_seg (heap_segment* seg, uint32_t* mark_array_addr, int h_number)
 {
     dprintf (GC_TABLE_LOG, ("seg: %Ix->%Ix; MA: %Ix",
         seg,
@@ -25344,7 +25816,7 @@ BOOL gc_heap::commit_mark_array_by_seg (heap_segment* seg, uint32_t* mark_array_
         mark_array_addr));
     uint8_t* start = (heap_segment_read_only_p (seg) ? heap_segment_mem (seg) : (uint8_t*)seg);
 
-    return commit_mark_array_by_range (start, heap_segment_reserved (seg), mark_array_addr);
+    return commit_mark_array_by_range (start, heap_segment_reserved (seg), mark_array_addr, h_number);
 }
 
 BOOL gc_heap::commit_mark_array_bgc_init (uint32_t* mark_array_addr)
@@ -25383,7 +25855,7 @@ BOOL gc_heap::commit_mark_array_bgc_init (uint32_t* mark_array_addr)
                 if ((heap_segment_mem (seg) >= lowest_address) && 
                     (heap_segment_reserved (seg) <= highest_address))
                 {
-                    if (commit_mark_array_by_seg (seg, mark_array))
+                    if (commit_mark_array_by_seg (seg, mark_array, heap_number))
                     {
                         seg->flags |= heap_segment_flags_ma_committed;
                     }
@@ -25396,7 +25868,7 @@ BOOL gc_heap::commit_mark_array_bgc_init (uint32_t* mark_array_addr)
                 {
                     uint8_t* start = max (lowest_address, heap_segment_mem (seg));
                     uint8_t* end = min (highest_address, heap_segment_reserved (seg));
-                    if (commit_mark_array_by_range (start, end, mark_array))
+                    if (commit_mark_array_by_range (start, end, mark_array, heap_number))
                     {
                         seg->flags |= heap_segment_flags_ma_pcommitted;
                     }
@@ -25410,7 +25882,7 @@ BOOL gc_heap::commit_mark_array_bgc_init (uint32_t* mark_array_addr)
             {
                 // For normal segments they are by design completely in range so just 
                 // commit the whole mark array for each seg.
-                if (commit_mark_array_by_seg (seg, mark_array))
+                if (commit_mark_array_by_seg (seg, mark_array, heap_number))
                 {
                     if (seg->flags & heap_segment_flags_ma_pcommitted)
                     {
@@ -27353,6 +27825,34 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non-zero card word in [card_word, card_word_end[, or card_word_end
+// if they are all clear. Most card words are clear when gen2 is large and mostly idle
+// so we look at 8 card words (256 cards) per iteration, which the compiler can turn
+// into a couple of wide loads instead of a compare and branch per word.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t card_words_per_chunk = 8;
+
+    while ((size_t)(card_word_end - card_word) >= card_words_per_chunk)
+    {
+        if ((card_word[0] | card_word[1] | card_word[2] | card_word[3] |
+             card_word[4] | card_word[5] | card_word[6] | card_word[7]) != 0)
+        {
+            break;
+        }
+
+        card_word += card_words_per_chunk;
+    }
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 
 // Find the first non-zero card word between cardw and cardw_end.
@@ -27368,22 +27868,28 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         size_t end_cardb = cardw_card_bundle (align_cardw_on_bundle (cardw_end));
         while (1)
         {
-            // Find a non-zero bundle
-            while ((cardb < end_cardb) && (card_bundle_set_p (cardb) == 0))
+            // Find a non-zero bundle. We look at a whole card bundle word at a time so 
+            // clear bundle words are skipped without testing each of their bits.
+            while (cardb < end_cardb)
             {
-                cardb++;
+                uint32_t cbw = card_bundle_table [card_bundle_word (cardb)] >> card_bundle_bit (cardb);
+                DWORD bit_index;
+                if (BitScanForward (&bit_index, cbw))
+                {
+                    cardb = min ((cardb + bit_index), end_cardb);
+                    break;
+                }
+
+                cardb = (card_bundle_word (cardb) + 1) * card_bundle_word_width;
             }
 
-            if (cardb == end_cardb)
+            if (cardb >= end_cardb)
                 return FALSE;
 
             // We found a bundle, so go through its words and find a non-zero card word
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -27409,15 +27915,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_non_zero_card_word (card_word, card_word_end);
+        if (card_word != card_word_end)
         {
-            if (*card_word != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
 
         return FALSE;
@@ -27466,11 +27968,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word ((last_card_word + 1), &card_table [card_word_end]);
 
         if (last_card_word < &card_table [card_word_end])
         {
@@ -27485,23 +27983,28 @@ BOOL gc_heap::find_card(uint32_t* card_table,
     }
 
     // Look for the lowest bit set
-    if (card_word_value)
+    DWORD bit_index;
+    if (BitScanForward (&bit_index, card_word_value))
     {
-        while (!(card_word_value & 1))
-        {
-            bit_position++;
-            card_word_value = card_word_value / 2;
-        }
+        bit_position += bit_index;
+        card_word_value >>= bit_index;
     }
     
     // card is the card word index * card size + the bit index within the card
     card = (last_card_word - &card_table[0]) * card_word_width + bit_position;
 
-    do
+    while (1)
     {
-        // Keep going until we get to an un-set card.
-        bit_position++;
-        card_word_value = card_word_value / 2;
+        // Skip the run of set cards - the first clear bit in card_word_value is where it ends.
+        // If there isn't one the run goes to the end of this card word.
+        if (BitScanForward (&bit_index, ~card_word_value))
+        {
+            bit_position += bit_index;
+        }
+        else
+        {
+            bit_position = card_word_width;
+        }
 
         // If we reach the end of the card word and haven't hit a 0 yet, start going
         // card word by card word until we get to one that's not fully set (0xFFFF...)
@@ -27511,19 +28014,18 @@ BOOL gc_heap::find_card(uint32_t* card_table,
             do
             {
                 card_word_value = *(++last_card_word);
-            } while ((last_card_word < &card_table [card_word_end]) &&
+            } while ((last_card_word < &card_table [card_word_end]) && (card_word_value == ~0u));
 
-#ifdef _MSC_VER
-                     (card_word_value == (1 << card_word_width)-1)
-#else
-                     // if left shift count >= width of type,
-                     // gcc reports error.
-                     (card_word_value == ~0u)
-#endif // _MSC_VER
-                );
             bit_position = 0;
+
+            if (card_word_value & 1)
+            {
+                continue;
+            }
         }
-    } while (card_word_value & 1);
+
+        break;
+    }
 
     end_card = (last_card_word - &card_table [0])* card_word_width + bit_position;
     
@@ -29709,6 +30211,20 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                     new_allocation = min (new_allocation,
                                           max (min_gc_size, (max_size/3)));
                 }
+
+                new_allocation = adjust_gen0_budget_for_pause_time (new_allocation, min_gc_size, pass);
+
+                if (heap_hard_limit)
+                {
+                    // Don't hand out a gen0 budget we can't commit - we want the next GC to happen
+                    // while there's still room left under the limit.
+                    size_t committed = current_total_committed;
+                    size_t available = ((committed < heap_hard_limit) ? (heap_hard_limit - committed) : 0);
+#ifdef MULTIPLE_HEAPS
+                    available /= n_heaps;
+#endif //MULTIPLE_HEAPS
+                    new_allocation = min (new_allocation, max (min_gc_size, (available / 2)));
+                }
             }
         }
 
@@ -29735,6 +30251,39 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
     }
 }
 
+// When GCGen0PauseTimePercent is set we keep a per heap factor that scales the gen0 budget
+// computed from the survival rate. If GCs took a bigger share of the time since the last
+// one than the target we grow the budget so they happen less often, otherwise we shrink it
+// so gen0 stays more cache friendly. The factor only moves part of the way each GC so a
+// single long pause doesn't swing the budget.
+size_t gc_heap::adjust_gen0_budget_for_pause_time (size_t new_allocation, size_t min_gc_size, int pass)
+{
+    size_t target_percent = (size_t)GCConfig::GetGen0PauseTimePercent();
+    if ((target_percent == 0) || (target_percent >= 100))
+    {
+        return new_allocation;
+    }
+
+    if (pass == 0)
+    {
+        uint64_t now_us = GetHighPrecisionTimeStampUs();
+        if ((gen0_budget_last_gc_start_us != 0) && (gc_start_time_us > gen0_budget_last_gc_start_us))
+        {
+            float pause_percent = (float)(now_us - gc_start_time_us) * 100.0f / 
+                                  (float)(gc_start_time_us - gen0_budget_last_gc_start_us);
+            float ratio = min (max ((pause_percent / (float)target_percent), 0.5f), 2.0f);
+            gen0_budget_factor = min (max ((gen0_budget_factor * (1.0f + (ratio - 1.0f) / 4.0f)), 0.25f), 4.0f);
+
+            dprintf (GTC_LOG, ("h%d gen0 pause %d%% (target %d%%), budget factor %d%%", 
+                heap_number, (int)pause_percent, (int)target_percent, (int)(gen0_budget_factor * 100)));
+        }
+        gen0_budget_last_gc_start_us = gc_start_time_us;
+    }
+
+    size_t max_budget = max ((size_t)(6*1024*1024), (size_t)Align (soh_segment_size / 2));
+    return (size_t)min (max ((new_allocation * gen0_budget_factor), (float)min_gc_size), (float)max_budget);
+}
+
 //returns the planned size of a generation (including free list element)
 size_t gc_heap::generation_plan_size (int gen_number)
 {
@@ -30109,8 +30658,37 @@ void gc_heap::decommit_ephemeral_segment_pages()
         slack_space = min (slack_space, new_slack_space);
     }
 
+#ifdef MULTIPLE_HEAPS
+    size_t decommit_rate = (size_t)GCConfig::GetDecommitRate();
+    if (decommit_rate && !g_low_memory_status)
+    {
+        // After a spike we don't want to give back all the extra space at once only 
+        // to commit it again on the next spike so we always keep the smoothed need
+        // and only decommit at the specified rate since our last decommit.
+        size_t desired = dd_desired_allocation (dd);
+        gen0_decommit_smoothed_need = max (desired, (gen0_decommit_smoothed_need / 8 * 7 + desired / 8));
+        slack_space = max (slack_space, gen0_decommit_smoothed_need);
+
+        size_t committed_space = heap_segment_committed (ephemeral_heap_segment) - heap_segment_allocated (ephemeral_heap_segment);
+        uint64_t decommit_allowed = (uint64_t)decommit_rate * (dd_time_clock (dd) - gen0_last_decommit_time) / 1000;
+        if ((committed_space > slack_space) && ((committed_space - slack_space) > decommit_allowed))
+        {
+            slack_space = committed_space - (size_t)decommit_allowed;
+        }
+    }
+
+    uint8_t* committed_before_decommit = heap_segment_committed (ephemeral_heap_segment);
+#endif //MULTIPLE_HEAPS
+
     decommit_heap_segment_pages (ephemeral_heap_segment, slack_space);    
 
+#ifdef MULTIPLE_HEAPS
+    if (heap_segment_committed (ephemeral_heap_segment) != committed_before_decommit)
+    {
+        gen0_last_decommit_time = dd_time_clock (dd);
+    }
+#endif //MULTIPLE_HEAPS
+
     gc_history_per_heap* current_gc_data_per_heap = get_gc_data_per_heap();
     current_gc_data_per_heap->extra_gen0_committed = heap_segment_committed (ephemeral_heap_segment) - heap_segment_allocated (ephemeral_heap_segment);
 }
@@ -31440,7 +32018,7 @@ void gc_heap::background_sweep()
             }
         }
 
-        if ((o < end) && background_object_marked (o, TRUE))
+        if ((o < end) && background_object_marked (o, FALSE))
         {
             plug_start = o;
             if (gen == large_object_generation)
@@ -31458,6 +32036,10 @@ void gc_heap::background_sweep()
                 fix_brick_to_highest (plug_start, plug_start);
             }
 
+            // Instead of clearing the mark bit of each object as we go we clear the
+            // bits for the whole plug at once with word stores. We still need to do
+            // that for what we've swept so far before we allow an FGC in.
+            uint8_t* clear_start = plug_start;
             BOOL m = TRUE;
 
             while (m)
@@ -31466,6 +32048,8 @@ void gc_heap::background_sweep()
                 current_num_objs++;
                 if (current_num_objs >= num_objs)
                 {
+                    bgc_clear_batch_mark_array_bits (clear_start, next_sweep_obj);
+                    clear_start = next_sweep_obj;
                     current_sweep_pos = next_sweep_obj;
 
                     allow_fgc();
@@ -31478,9 +32062,10 @@ void gc_heap::background_sweep()
                     break;
                 }
 
-                m = background_object_marked (o, TRUE);
+                m = background_object_marked (o, FALSE);
             }
             plug_end = o;
+            bgc_clear_batch_mark_array_bits (clear_start, plug_end);
             if (gen != large_object_generation)
             {
                 add_gen_plug (max_generation, plug_end-plug_start);
@@ -32757,6 +33342,7 @@ gc_heap::verify_free_lists ()
         dprintf (3, ("Verifying free list for gen:%d", gen_num));
         allocator* gen_alloc = generation_allocator (generation_of (gen_num));
         size_t sz = gen_alloc->first_bucket_size();
+        size_t prev_sz = 0;
         bool verify_undo_slot = (gen_num != 0) && (gen_num != max_generation+1) && !gen_alloc->discard_if_no_fit_p();
 
         for (unsigned int a_l_number = 0; a_l_number < gen_alloc->number_of_buckets(); a_l_number++)
@@ -32772,7 +33358,7 @@ gc_heap::verify_free_lists ()
                     FATAL_GC_ERROR();
                 }
                 if (((a_l_number < (gen_alloc->number_of_buckets()-1))&& (unused_array_size (free_list) >= sz))
-                    || ((a_l_number != 0) && (unused_array_size (free_list) < sz/2)))
+                    || ((a_l_number != 0) && (unused_array_size (free_list) < prev_sz)))
                 {
                     dprintf (3, ("Verifiying Heap: curr free list item %Ix isn't in the right bucket",
                                  (size_t)free_list));
@@ -32811,7 +33397,8 @@ gc_heap::verify_free_lists ()
                 }
             }
 
-            sz *=2;
+            prev_sz = sz;
+            sz = gen_alloc->next_bucket_size (sz);
         }
     }
 }
@@ -33459,6 +34046,26 @@ HRESULT GCHeap::Initialize ()
     CreatedObjectCount = 0;
 #endif //TRACE_GC
 
+    gc_heap::total_physical_mem = GCToOSInterface::GetPhysicalMemoryLimit();
+
+    // GetPhysicalMemoryLimit already takes the cgroup (or job object) limit into account
+    // so the percent based hard limit is relative to what the container can use.
+    gc_heap::heap_hard_limit = (size_t)GCConfig::GetHeapHardLimit();
+    if (!gc_heap::heap_hard_limit)
+    {
+        uint32_t percent_of_mem = (uint32_t)GCConfig::GetHeapHardLimitPercent();
+        if ((percent_of_mem > 0) && (percent_of_mem < 100))
+        {
+            gc_heap::heap_hard_limit = (size_t)(gc_heap::total_physical_mem * (uint64_t)percent_of_mem / (uint64_t)100);
+        }
+    }
+
+    if (gc_heap::heap_hard_limit)
+    {
+        gc_heap::heap_hard_limit = align_on_page (gc_heap::heap_hard_limit);
+        dprintf (1, ("GC heap hard limit: %Id", gc_heap::heap_hard_limit));
+    }
+
     size_t seg_size = get_valid_segment_size();
     gc_heap::soh_segment_size = seg_size;
     size_t large_seg_size = get_valid_segment_size(TRUE);
@@ -33489,8 +34096,6 @@ HRESULT GCHeap::Initialize ()
     if (hr != S_OK)
         return hr;
 
-    gc_heap::total_physical_mem = GCToOSInterface::GetPhysicalMemoryLimit();
-
     gc_heap::mem_one_percent = gc_heap::total_physical_mem / 100;
 #ifndef MULTIPLE_HEAPS
     gc_heap::mem_one_percent /= g_num_processors;
@@ -33570,6 +34175,21 @@ HRESULT GCHeap::Initialize ()
 
 ////
 // GC callback functions
+#ifdef FEATURE_BASICFREEZE
+bool GCHeap::IsUnmarkedFrozenObject(uint8_t* o)
+{
+    gc_heap* hp = gc_heap::heap_of (o);
+
+    if (hp->ro_segments_in_range && !contain_pointers_or_collectible (o))
+    {
+        heap_segment* seg = seg_mapping_table_segment_of (o);
+        return (seg && heap_segment_read_only_p (seg));
+    }
+
+    return false;
+}
+#endif //FEATURE_BASICFREEZE
+
 bool GCHeap::IsPromoted(Object* object)
 {
 #ifdef _DEBUG
@@ -33578,6 +34198,13 @@ bool GCHeap::IsPromoted(Object* object)
 
     uint8_t* o = (uint8_t*)object;
 
+#ifdef FEATURE_BASICFREEZE
+    if (IsUnmarkedFrozenObject (o))
+    {
+        return true;
+    }
+#endif //FEATURE_BASICFREEZE
+
     if (gc_heap::settings.condemned_generation == max_generation)
     {
 #ifdef MULTIPLE_HEAPS
@@ -33784,6 +34411,18 @@ void GCHeap::Promote(Object** ppObject, ScanContext* sc, uint32_t flags)
     UNREFERENCED_PARAMETER(sc);
 #endif //_DEBUG
 
+#ifdef FEATURE_BASICFREEZE
+    // Objects on frozen segments never move or die, and if they don't contain pointers 
+    // (and their type isn't collectible) there's nothing to trace through them. So we 
+    // don't mark (or pin) them, which would write to the frozen memory, and don't count 
+    // them as promoted. IsPromoted reports them as live.
+    if (IsUnmarkedFrozenObject (o))
+    {
+        dprintf (3, ("Skipping frozen object %Ix", (size_t)o));
+        return;
+    }
+#endif //FEATURE_BASICFREEZE
+
     if (flags & GC_CALL_PINNED)
         hp->pin_object (o, (uint8_t**) ppObject, hp->gc_low, hp->gc_high);
 
@@ -68,6 +68,12 @@ public:
       "Does a DebugBreak at the soonest time we detect an OOM")                                \
   BOOL_CONFIG(NoAffinitize, "GCNoAffinitize", false,                                           \
       "If set, do not affinitize server GC threads")                                           \
+  BOOL_CONFIG(RandomizeAllocationTick, "GCRandomizeAllocationTick", false,                     \
+      "If set, the amount allocated between allocation tick events is randomized with the "    \
+      "same average so the events sample allocations instead of firing at fixed intervals")    \
+  BOOL_CONFIG(LargePages,   "GCLargePages", false,                                             \
+      "Specifies whether the GC heap segments and bookkeeping arrays (card, brick and mark "   \
+      "arrays) should be backed by large pages when the OS supports it")                       \
   BOOL_CONFIG(LogEnabled,   "GCLogEnabled", false,                                             \
       "Specifies if you want to turn on logging in GC")                                        \
   BOOL_CONFIG(ConfigLogEnabled, "GCConfigLogEnabled", false,                                   \
@@ -91,6 +97,17 @@ public:
   INT_CONFIG(LogFileSize,   "GCLogFileSize", 0, "Specifies the GC log file size")              \
   INT_CONFIG(CompactRatio,  "GCCompactRatio", 0,                                               \
       "Specifies the ratio compacting GCs vs sweeping")                                        \
+  INT_CONFIG(HeapHardLimit, "GCHeapHardLimit", 0,                                              \
+      "Specifies the maximum number of bytes the GC is allowed to commit for the managed heap")\
+  INT_CONFIG(HeapHardLimitPercent, "GCHeapHardLimitPercent", 0,                                \
+      "Specifies the GC heap hard limit as a percentage of the physical memory limit (which "  \
+      "is the cgroup limit in a container). Ignored if GCHeapHardLimit is specified")          \
+  INT_CONFIG(Gen0PauseTimePercent, "GCGen0PauseTimePercent", 0,                                \
+      "Specifies the percentage of time that ephemeral GCs should take. When set the gen0 "    \
+      "budget is adjusted per heap based on the measured pause times to meet it")              \
+  INT_CONFIG(DecommitRate,  "GCDecommitRate", 0,                                               \
+      "Specifies the maximum number of bytes per second each server GC heap decommits from "   \
+      "its ephemeral segment. 0 means the decommit is not rate limited")                       \
   STRING_CONFIG(LogFile,    "GCLogFile",    "Specifies the name of the GC log file")           \
   STRING_CONFIG(ConfigLogFile, "GCConfigLogFile",                                              \
       "Specifies the name of the GC config log file")                                          \
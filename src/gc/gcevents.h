@@ -45,5 +45,8 @@ KNOWN_EVENT(GCFullNotify_V1, GCEventProvider_Private, GCEventLevel_Information,
 KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 
+DYNAMIC_EVENT(GCPerHeapMarkTime, GCEventLevel_Information, GCEventKeyword_GC, uint32_t /*heap*/, uint64_t /*markTimeUs*/, uint64_t /*skewUs*/, uint64_t /*stolenObjects*/)
+DYNAMIC_EVENT(GCPerHeapPhaseTimes, GCEventLevel_Information, GCEventKeyword_GC, uint32_t /*heap*/, uint32_t /*condemnedGeneration*/, uint64_t /*markUs*/, uint64_t /*planUs*/, uint64_t /*relocateUs*/, uint64_t /*compactUs*/, uint64_t /*sweepUs*/, uint64_t /*joinWaitUs*/, uint32_t /*lastJoinArrivals*/)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
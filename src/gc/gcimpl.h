@@ -270,6 +270,12 @@ private:
         // the condition here may have to change as well.
         return g_fSuspensionPending == 0;
     }
+
+#ifdef FEATURE_BASICFREEZE
+    // Returns true for pointer-free objects on frozen segments. Promote doesn't mark
+    // those, so they have to be treated as promoted without looking at the mark bit.
+    static bool IsUnmarkedFrozenObject(uint8_t* o);
+#endif //FEATURE_BASICFREEZE
 public:
     //return TRUE if GC actually happens, otherwise FALSE
     bool StressHeap(gc_alloc_context * acontext);
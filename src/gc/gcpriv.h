@@ -455,6 +455,17 @@ enum gc_type
     gc_type_max = 3
 };
 
+// Phases of a blocking GC timed per heap for the GCPerHeapPhaseTimes event
+enum gc_pause_phase
+{
+    gc_phase_mark = 0,
+    gc_phase_plan = 1,
+    gc_phase_relocate = 2,
+    gc_phase_compact = 3,
+    gc_phase_sweep = 4,
+    gc_phase_max = 5
+};
+
 #define v_high_memory_load_th 97
 
 //encapsulates the mechanism for the current gc
@@ -629,8 +640,10 @@ typedef DPTR(class CFinalize)                  PTR_CFinalize;
 //-------------------------------------
 //generation free list. It is an array of free lists bucketed by size, starting at sizes lower than first_bucket_size 
 //and doubling each time. The last bucket (index == num_buckets) is for largest sizes with no limit
+//An allocator can also be created with half steps, in which case the bucket sizes go 
+//first_bucket_size, 1.5x, 2x, 3x, 4x... which gives finer grained buckets for LOH.
 
-#define MAX_BUCKET_COUNT (13)//Max number of buckets for the small generations. 
+#define MAX_BUCKET_COUNT (15)//Max number of buckets for the generation free lists. 
 class alloc_list 
 {
     uint8_t* head;
@@ -658,21 +671,31 @@ class allocator
 {
     size_t num_buckets;
     size_t frst_bucket_size;
+    BOOL half_steps_p;
     alloc_list first_bucket;
     alloc_list* buckets;
     alloc_list& alloc_list_of (unsigned int bn);
     size_t& alloc_list_damage_count_of (unsigned int bn);
 
 public:
-    allocator (unsigned int num_b, size_t fbs, alloc_list* b);
+    allocator (unsigned int num_b, size_t fbs, alloc_list* b, BOOL half_steps = FALSE);
     allocator()
     {
         num_buckets = 1;
         frst_bucket_size = SIZE_T_MAX;
+        half_steps_p = FALSE;
     }
     unsigned int number_of_buckets() {return (unsigned int)num_buckets;}
 
     size_t first_bucket_size() {return frst_bucket_size;}
+    // Returns the size limit of the bucket after the one whose limit is sz. 
+    // With half steps the first bucket size needs to be a power of 2.
+    size_t next_bucket_size (size_t sz)
+    {
+        if (!half_steps_p)
+            return sz * 2;
+        return ((sz & (sz - 1)) ? ((sz / 3) * 4) : (sz + sz / 2));
+    }
     uint8_t*& alloc_list_head_of (unsigned int bn)
     {
         return alloc_list_of (bn).alloc_list_head();
@@ -1168,6 +1191,15 @@ public:
     heap_segment* make_heap_segment (uint8_t* new_pages,
                                      size_t size, 
                                      int h_number);
+
+    // Commits/decommits heap memory and keeps current_total_committed up to date
+    // so we can enforce heap_hard_limit. 
+    PER_HEAP_ISOLATED
+    bool virtual_commit (void* address, size_t size, int h_number);
+    PER_HEAP_ISOLATED
+    bool virtual_decommit (void* address, size_t size);
+    PER_HEAP_ISOLATED
+    void release_commit_accounting (size_t size);
     static
     l_heap* make_large_heap (uint8_t* new_pages, size_t size, BOOL managed);
 
@@ -1400,12 +1432,15 @@ protected:
     PER_HEAP
     void fire_etw_allocation_event (size_t allocation_amount, int gen_number, uint8_t* object_address);
 
+    PER_HEAP
+    size_t get_etw_allocation_next_tick();
+
     PER_HEAP
     void fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject);
 
     PER_HEAP
     size_t limit_from_size (size_t size, size_t room, int gen_number,
-                            int align_const);
+                            alloc_context* acontext, int align_const);
     PER_HEAP
     int try_allocate_more_space (alloc_context* acontext, size_t jsize,
                                  int alloc_generation_number);
@@ -1947,6 +1982,14 @@ protected:
     void mark_steal ();
 #endif //MH_SC_MARK
 
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED
+    void fire_per_heap_mark_time_events();
+#endif //MULTIPLE_HEAPS
+
+    PER_HEAP_ISOLATED
+    void fire_per_heap_phase_time_events();
+
 #ifdef BACKGROUND_GC
 
     PER_HEAP
@@ -2463,6 +2506,9 @@ protected:
     size_t desired_new_allocation (dynamic_data* dd, size_t out,
                                    int gen_number, int pass);
 
+    PER_HEAP
+    size_t adjust_gen0_budget_for_pause_time (size_t new_allocation, size_t min_gc_size, int pass);
+
     PER_HEAP
     void trim_youngest_desired_low_memory();
 
@@ -2636,10 +2682,13 @@ protected:
     PER_HEAP_ISOLATED
     void verify_mark_array_cleared (uint8_t* begin, uint8_t* end, uint32_t* mark_array_addr);
 
+    // h_number is the heap that owns the range, so that its part of the
+    // mark array is committed on that heap's numa node.
     PER_HEAP_ISOLATED
     BOOL commit_mark_array_by_range (uint8_t* begin,
                                      uint8_t* end,
-                                     uint32_t* mark_array_addr);
+                                     uint32_t* mark_array_addr,
+                                     int h_number);
 
     PER_HEAP_ISOLATED
     BOOL commit_mark_array_new_seg (gc_heap* hp, 
@@ -2655,7 +2704,7 @@ protected:
     // seg and heap_segment_reserved (seg) are guaranteed to be 
     // page aligned.
     PER_HEAP_ISOLATED
-    BOOL commit_mark_array_by_seg (heap_segment* seg, uint32_t* mark_array_addr);
+    BOOL commit_mark_array_by_seg (heap_segment* seg, uint32_t* mark_array_addr, int h_number);
 
     // During BGC init, we commit the mark array for all in range
     // segments whose mark array hasn't been committed or fully
@@ -2914,6 +2963,25 @@ public:
     PER_HEAP
     size_t etw_allocation_running_amount[2];
 
+    // When GCRandomizeAllocationTick is set this is the amount we need to allocate
+    // before the next allocation tick event, otherwise it's always etw_allocation_tick.
+    PER_HEAP
+    size_t etw_allocation_next_tick[2];
+
+    PER_HEAP
+    uint32_t etw_allocation_rand_seed;
+
+    // Start time of the current blocking GC, and what we need to adjust the gen0 
+    // budget when GCGen0PauseTimePercent is set.
+    PER_HEAP
+    uint64_t gc_start_time_us;
+
+    PER_HEAP
+    uint64_t gen0_budget_last_gc_start_us;
+
+    PER_HEAP
+    float gen0_budget_factor;
+
     PER_HEAP
     int gc_policy;  //sweep, compact, expand
 
@@ -2959,6 +3027,16 @@ public:
     PER_HEAP_ISOLATED
     size_t gc_gen0_desired_high;
 
+#ifdef MULTIPLE_HEAPS
+    // Used when GCDecommitRate is set - a moving average of the gen0 budget that 
+    // goes up right away and comes down slowly, and when we last decommitted.
+    PER_HEAP
+    size_t gen0_decommit_smoothed_need;
+
+    PER_HEAP
+    size_t gen0_last_decommit_time;
+#endif //MULTIPLE_HEAPS
+
     PER_HEAP
     size_t gen0_big_free_spaces;
 
@@ -2990,6 +3068,20 @@ public:
     PER_HEAP_ISOLATED
     uint64_t total_physical_mem;
 
+    // The max number of bytes we are allowed to commit for heap segments, 0 means no limit.
+    // This comes from GCHeapHardLimit or GCHeapHardLimitPercent.
+    PER_HEAP_ISOLATED
+    size_t heap_hard_limit;
+
+    // How many bytes we've committed for heap segments. Only maintained when heap_hard_limit 
+    // is set.
+    PER_HEAP_ISOLATED
+    size_t current_total_committed;
+
+    // Protects current_total_committed; held only for the accounting, never across the OS call.
+    PER_HEAP_ISOLATED
+    VOLATILE(int32_t) check_commit_lock;
+
     PER_HEAP_ISOLATED
     uint64_t entry_available_physical_mem;
 
@@ -3297,6 +3389,31 @@ protected:
     snoop_stats_data snoop_stat;
 #endif //SNOOP_STATS
 
+    // How long this heap spent in each phase of the current blocking GC.
+    PER_HEAP
+    uint64_t gc_phase_time_us[gc_phase_max];
+
+#ifdef MULTIPLE_HEAPS
+    // How long this heap's GC thread waited in gc_t_join and how many of those
+    // joins it was the last to arrive at in the current GC.
+    PER_HEAP
+    uint64_t join_wait_time_us;
+
+    PER_HEAP
+    uint32_t join_last_arrival_count;
+
+    // How long this heap spent marking from roots (including the time spent
+    // stealing from other heaps) in the current GC, used to report mark skew.
+    PER_HEAP
+    uint64_t mark_time_us;
+
+#ifdef MH_SC_MARK
+    // How many objects this heap stole from other heaps' mark stacks in the current GC.
+    PER_HEAP
+    size_t mark_stolen_count;
+#endif //MH_SC_MARK
+#endif //MULTIPLE_HEAPS
+
 
     PER_HEAP
     uint8_t**          c_mark_list;
@@ -3440,7 +3557,8 @@ protected:
 
 #endif //SYNCHRONIZATION_STATS
 
-#define NUM_LOH_ALIST (7)
+// LOH buckets use half steps from 64k up to 4MB, eg, [64k, 96k[, [96k, 128k[...
+#define NUM_LOH_ALIST (14)
 #define BASE_LOH_ALIST (64*1024)
     PER_HEAP 
     alloc_list loh_alloc_list[NUM_LOH_ALIST-1];
@@ -59,6 +59,12 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // Have the initial scan record the handles that re-scans need to look at. When handles can be created and
+    // destroyed while we scan (concurrent GC) the recorded locations may not stay valid so we don't do it then.
+    pDhContext->m_cPending = 0;
+    pDhContext->m_fPendingValid = false;
+    pDhContext->m_fCollectPending = !sc->concurrent;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -21,6 +21,16 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+//
+// The first scan also records the handles it found with unpromoted primaries in a pending list. Those are the only
+// handles a re-scan can do anything with so re-scans walk (and shrink) that list instead of the whole handle
+// table. If the list can't be grown we fall back to scanning the table.
+struct DhPendingEntry
+{
+    Object        **m_pPrimary;                 // Location of the primary (the handle itself)
+    Object        **m_pSecondary;               // Location of the secondary (the handle's extra info)
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
@@ -29,6 +39,11 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    bool            m_fCollectPending;          // Should the current scan record handles in the pending list?
+    bool            m_fPendingValid;            // Does the pending list hold every handle a re-scan needs to look at?
+    DhPendingEntry *m_pPending;                 // Handles with unpromoted primaries as of the last scan
+    size_t          m_cPending;                 // Number of entries used in m_pPending
+    size_t          m_cMaxPending;              // Number of entries allocated for m_pPending (kept across GCs)
 };
 
 class GCScan
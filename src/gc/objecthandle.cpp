@@ -183,6 +183,8 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+void AddPendingDependentHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef);
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -218,8 +220,82 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        if (pDhContext->m_fCollectPending)
+        {
+            AddPendingDependentHandle(pDhContext, pPrimaryRef, pSecondaryRef);
+        }
     }
 }
+
+// Record a dependent handle with an unpromoted primary so re-scans only need to look at it instead of the whole
+// handle table. If we can't grow the list we stop collecting and re-scans go back to scanning the table.
+void AddPendingDependentHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cMaxPending)
+    {
+        size_t cNewMax = (pDhContext->m_cMaxPending == 0) ? 256 : (pDhContext->m_cMaxPending * 2);
+        DhPendingEntry *pNewPending = new (nothrow) DhPendingEntry[cNewMax];
+        if (pNewPending == NULL)
+        {
+            pDhContext->m_fCollectPending = false;
+            pDhContext->m_fPendingValid = false;
+            return;
+        }
+
+        if (pDhContext->m_pPending != NULL)
+        {
+            memcpy(pNewPending, pDhContext->m_pPending, pDhContext->m_cPending * sizeof(DhPendingEntry));
+            delete [] pDhContext->m_pPending;
+        }
+
+        pDhContext->m_pPending = pNewPending;
+        pDhContext->m_cMaxPending = cNewMax;
+    }
+
+    DhPendingEntry *pEntry = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pEntry->m_pPrimary = pPrimaryRef;
+    pEntry->m_pSecondary = pSecondaryRef;
+}
+
+// Re-scan only the dependent handles recorded by the last table scan, promoting the secondaries of the ones
+// whose primary has been promoted since then and dropping them from the list.
+void ScanPendingDependentHandles(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ScanContext *sc = pDhContext->m_pScanContext;
+    promote_func *callback = pDhContext->m_pfnPromoteFunction;
+    size_t cRemaining = 0;
+
+    for (size_t i = 0; i < pDhContext->m_cPending; i++)
+    {
+        DhPendingEntry entry = pDhContext->m_pPending[i];
+        Object *pPrimary = *entry.m_pPrimary;
+
+        if (pPrimary == NULL)
+            continue;
+
+        if (g_theGCHeap->IsPromoted(pPrimary))
+        {
+            if (!g_theGCHeap->IsPromoted(*entry.m_pSecondary))
+            {
+                LOG((LF_GC|LF_ENC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*entry.m_pSecondary)));
+                callback(entry.m_pSecondary, sc, 0);
+                pDhContext->m_fPromoted = true;
+            }
+        }
+        else
+        {
+            pDhContext->m_fUnpromotedPrimaries = true;
+            pDhContext->m_pPending[cRemaining++] = entry;
+        }
+    }
+
+    pDhContext->m_cPending = cRemaining;
+}
     
 void CALLBACK ClearDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
 {
@@ -644,6 +720,15 @@ bool Ref_Initialize()
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
+    for (int i = 0; i < n_slots; i++)
+    {
+        g_pDependentHandleContexts[i].m_fCollectPending = false;
+        g_pDependentHandleContexts[i].m_fPendingValid = false;
+        g_pDependentHandleContexts[i].m_pPending = NULL;
+        g_pDependentHandleContexts[i].m_cPending = 0;
+        g_pDependentHandleContexts[i].m_cMaxPending = 0;
+    }
+
     return true;
 
 CleanupAndFail:
@@ -662,6 +747,13 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        int n_slots = getNumberOfSlots();
+        for (int i = 0; i < n_slots; i++)
+        {
+            if (g_pDependentHandleContexts[i].m_pPending)
+                delete [] g_pDependentHandleContexts[i].m_pPending;
+        }
+
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1249,6 +1341,16 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
+        if (pDhContext->m_fPendingValid)
+        {
+            ScanPendingDependentHandles(pDhContext);
+
+            if (pDhContext->m_fPromoted)
+                fAnyPromotions = true;
+
+            continue;
+        }
+
         HandleTableMap *walk = &g_HandleTableMap;
         while (walk) 
         {
@@ -1273,6 +1375,14 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
             walk = walk->pNext;
         }
 
+        // If we recorded every handle with an unpromoted primary during this scan the following ones can
+        // use the pending list.
+        if (pDhContext->m_fCollectPending)
+        {
+            pDhContext->m_fCollectPending = false;
+            pDhContext->m_fPendingValid = true;
+        }
+
         if (pDhContext->m_fPromoted)
             fAnyPromotions = true;
 
@@ -14,6 +14,14 @@
 //  * How to implement fast object allocator and write barrier 
 //  * How to allocate objects and work with GC handles
 //
+//  It also doubles as a crude allocation benchmark:
+//
+//      gcsample [iterations] [survivalInterval] [survivorSlots]
+//
+//  keeps every survivalInterval-th object alive in one of survivorSlots strong handles, used round robin, so
+//  survivors live for roughly survivalInterval * survivorSlots allocations. It then reports the elapsed time,
+//  the collection counts and the GC pause statistics gathered by the sample's SuspendEE/RestartEE.
+//
 //  An important part of the sample is the GC environment (gcenv.*) that provides methods for GC to interact 
 //  with the OS and execution engine.
 //
@@ -111,6 +119,15 @@ extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleM
 
 int __cdecl main(int argc, char* argv[])
 {
+    int iterations = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int survivalInterval = (argc > 2) ? atoi(argv[2]) : 0;
+    int survivorSlots = (argc > 3) ? atoi(argv[3]) : 1024;
+    if (iterations <= 0 || survivalInterval < 0 || survivorSlots <= 0)
+    {
+        printf("Usage: gcsample [iterations] [survivalInterval] [survivorSlots]\n");
+        return -1;
+    }
+
     //
     // Initialize system info
     //
@@ -207,7 +224,24 @@ int __cdecl main(int argc, char* argv[])
     if (oh == NULL)
         return -1;
 
-    for (int i = 0; i < 1000000; i++)
+    OBJECTHANDLE * survivors = NULL;
+    if (survivalInterval != 0)
+    {
+        survivors = new (nothrow) OBJECTHANDLE[survivorSlots];
+        if (survivors == NULL)
+            return -1;
+
+        for (int i = 0; i < survivorSlots; i++)
+        {
+            survivors[i] = HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], HNDTYPE_DEFAULT, NULL);
+            if (survivors[i] == NULL)
+                return -1;
+        }
+    }
+
+    int64_t startTicks = GCToOSInterface::QueryPerformanceCounter();
+
+    for (int i = 0; i < iterations; i++)
     {
         Object * pBefore = ((My *)HndFetchHandle(oh))->m_pOther1;
 
@@ -223,6 +257,33 @@ int __cdecl main(int argc, char* argv[])
 
         // Store the newly allocated object into a field using WriteBarrier
         WriteBarrier(&(((My *)HndFetchHandle(oh))->m_pOther1), p);
+
+        if (survivalInterval != 0 && (i % survivalInterval) == 0)
+        {
+            HndAssignHandle(survivors[(i / survivalInterval) % survivorSlots], ObjectToOBJECTREF(p));
+        }
+    }
+
+    int64_t elapsedTicks = GCToOSInterface::QueryPerformanceCounter() - startTicks;
+    double ticksPerMs = GCToOSInterface::QueryPerformanceFrequency() / 1000.0;
+
+    printf("Allocated %d objects in %.2f ms\n", iterations, elapsedTicks / ticksPerMs);
+    printf("Collections gen0 %d gen1 %d gen2 %d\n",
+        pGCHeap->CollectionCount(0), pGCHeap->CollectionCount(1), pGCHeap->CollectionCount(2));
+    if (g_gcPauseStats.count != 0)
+    {
+        printf("Pauses %llu total %.2f ms mean %.3f ms max %.3f ms\n",
+            (unsigned long long)g_gcPauseStats.count,
+            g_gcPauseStats.totalTicks / ticksPerMs,
+            g_gcPauseStats.totalTicks / ticksPerMs / g_gcPauseStats.count,
+            g_gcPauseStats.maxTicks / ticksPerMs);
+    }
+
+    if (survivors != NULL)
+    {
+        for (int i = 0; i < survivorSlots; i++)
+            HndDestroyHandle(HndGetHandleTable(survivors[i]), HNDTYPE_DEFAULT, survivors[i]);
+        delete [] survivors;
     }
 
     // Create weak handle that points to our object
@@ -15,6 +15,10 @@ EEConfig * g_pConfig;
 
 gc_alloc_context g_global_alloc_context;
 
+GCPauseStats g_gcPauseStats;
+
+static int64_t s_gcPauseStart;
+
 bool CLREventStatic::CreateManualEventNoThrow(bool bInitialState)
 {
     m_hEvent = CreateEventW(NULL, TRUE, bInitialState, NULL);
@@ -134,12 +138,20 @@ void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
+
+    s_gcPauseStart = GCToOSInterface::QueryPerformanceCounter();
 }
 
 void GCToEEInterface::RestartEE(bool bFinishedGC)
 {
     // TODO: Implement
 
+    int64_t pauseTicks = GCToOSInterface::QueryPerformanceCounter() - s_gcPauseStart;
+    g_gcPauseStats.count++;
+    g_gcPauseStats.totalTicks += pauseTicks;
+    if (pauseTicks > g_gcPauseStats.maxTicks)
+        g_gcPauseStats.maxTicks = pauseTicks;
+
     g_theGCHeap->SetGCInProgress(false);
 }
 
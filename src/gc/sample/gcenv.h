@@ -172,4 +172,17 @@ public:
 #include "etmdummy.h"
 #define ETW_EVENT_ENABLED(e,f) false
 
+//
+// Pause statistics, collected between SuspendEE and RestartEE
+//
+
+struct GCPauseStats
+{
+    uint64_t count;
+    int64_t totalTicks;
+    int64_t maxTicks;
+};
+
+extern GCPauseStats g_gcPauseStats;
+
 #endif // __GCENV_H__
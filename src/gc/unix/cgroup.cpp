@@ -117,7 +117,8 @@ public:
             return true;
         }
         
-        cpu_count = quota / period;
+        // Round up, a quota of 1.5 processors still keeps two of them busy part of the time
+        cpu_count = (quota + period - 1) / period;
         if (cpu_count < UINT32_MAX)
         {
             *val = cpu_count;
@@ -61,6 +61,83 @@ bool GetCpuLimit(uint32_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
+// Size of a transparent huge page on the platforms we advise them on
+#define LARGE_PAGE_SIZE (2 * 1024 * 1024)
+
+#ifdef MADV_HUGEPAGE
+// Ranges reserved with VirtualReserveFlags::LargePages that were advised to use transparent
+// huge pages. Decommit remaps memory, which drops the advice, so it looks the range up here
+// to know whether to apply it again. There are only a few such reservations (segments and
+// the card table block) and they live long, so a small table searched under a lock will do.
+struct LargePageRange
+{
+    uint8_t* start;
+    size_t size;
+};
+
+static const size_t MaxLargePageRanges = 256;
+static LargePageRange g_largePageRanges[MaxLargePageRanges];
+static pthread_mutex_t g_largePageRangesMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Returns false if the table is full, in which case the range isn't advised
+static bool AddLargePageRange(void* address, size_t size)
+{
+    bool added = false;
+
+    pthread_mutex_lock(&g_largePageRangesMutex);
+    for (size_t i = 0; i < MaxLargePageRanges; i++)
+    {
+        if (g_largePageRanges[i].start == nullptr)
+        {
+            g_largePageRanges[i].start = (uint8_t*)address;
+            g_largePageRanges[i].size = size;
+            added = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_largePageRangesMutex);
+
+    return added;
+}
+
+// Forget the ranges that start within a released range
+static void RemoveLargePageRanges(void* address, size_t size)
+{
+    uint8_t* start = (uint8_t*)address;
+
+    pthread_mutex_lock(&g_largePageRangesMutex);
+    for (size_t i = 0; i < MaxLargePageRanges; i++)
+    {
+        if ((g_largePageRanges[i].start >= start) && (g_largePageRanges[i].start < start + size))
+        {
+            g_largePageRanges[i].start = nullptr;
+            g_largePageRanges[i].size = 0;
+        }
+    }
+    pthread_mutex_unlock(&g_largePageRangesMutex);
+}
+
+static bool IsInLargePageRange(void* address, size_t size)
+{
+    uint8_t* start = (uint8_t*)address;
+    bool found = false;
+
+    pthread_mutex_lock(&g_largePageRangesMutex);
+    for (size_t i = 0; i < MaxLargePageRanges; i++)
+    {
+        LargePageRange* range = &g_largePageRanges[i];
+        if ((range->start != nullptr) && (start >= range->start) && (start + size <= range->start + range->size))
+        {
+            found = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_largePageRangesMutex);
+
+    return found;
+}
+#endif // MADV_HUGEPAGE
+
 uint32_t g_pageSizeUnixInl = 0;
 
 // Initialize the interface implementation
@@ -274,6 +351,15 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
         alignment = OS_PAGE_SIZE;
     }
 
+#ifdef MADV_HUGEPAGE
+    bool useLargePages = (flags & VirtualReserveFlags::LargePages) && (size >= LARGE_PAGE_SIZE);
+    if (useLargePages && (alignment < LARGE_PAGE_SIZE))
+    {
+        // Transparent huge pages can only back naturally aligned large page ranges
+        alignment = LARGE_PAGE_SIZE;
+    }
+#endif // MADV_HUGEPAGE
+
     size_t alignedSize = size + (alignment - OS_PAGE_SIZE);
     void * pRetVal = mmap(nullptr, alignedSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
 
@@ -295,6 +381,19 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
         }
 
         pRetVal = pAlignedRetVal;
+
+#ifdef MADV_HUGEPAGE
+        if (useLargePages)
+        {
+            // This is only advice, if transparent huge pages are disabled or not supported
+            // the range is simply backed by normal pages. Decommit remaps the range so it
+            // needs to apply the advice again, which is why the range is recorded.
+            if (AddLargePageRange(pRetVal, size) && (madvise(pRetVal, size, MADV_HUGEPAGE) != 0))
+            {
+                RemoveLargePageRanges(pRetVal, size);
+            }
+        }
+#endif // MADV_HUGEPAGE
     }
 
     return pRetVal;
@@ -308,6 +407,10 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
 //  true if it has succeeded, false if it has failed
 bool GCToOSInterface::VirtualRelease(void* address, size_t size)
 {
+#ifdef MADV_HUGEPAGE
+    RemoveLargePageRanges(address, size);
+#endif // MADV_HUGEPAGE
+
     int ret = munmap(address, size);
 
     return (ret == 0);
@@ -338,7 +441,17 @@ bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
     // that much more clear to the operating system that we no
     // longer need these pages. Also, GC depends on re-commited pages to
     // be zeroed-out.
-    return mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != NULL;
+    bool success = mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != NULL;
+
+#ifdef MADV_HUGEPAGE
+    if (success && IsInLargePageRange(address, size))
+    {
+        // The new mapping doesn't inherit the huge page advice of the one it replaced.
+        madvise(address, size, MADV_HUGEPAGE);
+    }
+#endif // MADV_HUGEPAGE
+
+    return success;
 }
 
 // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no
@@ -368,6 +481,11 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
 }
 
 // Check if the OS supports write watching
+// Note: Linux soft-dirty page bits (/proc/self/pagemap + /proc/self/clear_refs) are not a usable
+// substitute here. clear_refs resets the bits for the whole process rather than for the requested
+// range, and reading pagemap followed by clearing it cannot be done atomically with respect to
+// concurrent writers, so a write landing between the two would be lost while background GC is
+// resetting write watch concurrently. Software write watch is used on Unix instead.
 bool GCToOSInterface::SupportsWriteWatch()
 {
     return false;
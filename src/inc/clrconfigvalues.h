@@ -272,6 +272,7 @@ CONFIG_DWORD_INFO_DIRECT_ACCESS(INTERNAL_AssertOnFailFast, W("AssertOnFailFast")
 RETAIL_CONFIG_DWORD_INFO_EX(UNSUPPORTED_legacyCorruptedStateExceptionsPolicy, W("legacyCorruptedStateExceptionsPolicy"), 0, "Enabled Pre-V4 CSE behavior", CLRConfig::FavorConfigFile)
 CONFIG_DWORD_INFO_EX(INTERNAL_SuppressLostExceptionTypeAssert, W("SuppressLostExceptionTypeAssert"), 0, "", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO_EX(UNSUPPORTED_FailFastOnCorruptedStateException, W("FailFastOnCorruptedStateException"), 0, "Failfast if a CSE is encountered", CLRConfig::FavorConfigFile)
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ExceptionStackTraceMaxFrames, W("ExceptionStackTraceMaxFrames"), 0, "Maximum number of frames recorded in the stack trace of a thrown exception. 0 means no limit.")
 
 ///
 /// Garbage collector
@@ -321,6 +322,12 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCNumaAware, W("GCNumaAware"), 1, "Specifie
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCHeapCount, W("GCHeapCount"), 0, "")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCNoAffinitize, W("GCNoAffinitize"), 0, "")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCHeapHardLimit, W("GCHeapHardLimit"), 0, "Specifies the maximum commit size for the GC heap")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCHeapHardLimitPercent, W("GCHeapHardLimitPercent"), 0, "Specifies the GC heap usage as a percentage of the total memory")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCGen0PauseTimePercent, W("GCGen0PauseTimePercent"), 0, "Specifies the percentage of time that ephemeral GCs should take, the gen0 budget is adjusted to meet it")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCDecommitRate, W("GCDecommitRate"), 0, "Specifies the maximum rate in bytes per second at which each server GC heap decommits its ephemeral segment")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCRandomizeAllocationTick, W("GCRandomizeAllocationTick"), 0, "Randomizes the amount allocated between allocation tick events")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCLargePages, W("GCLargePages"), 0, "Specifies whether the GC heap and its bookkeeping arrays should be backed by large pages when supported")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 
 ///
@@ -370,6 +377,7 @@ RETAIL_CONFIG_STRING_INFO_EX(INTERNAL_AltJitNgen, W("AltJitNgen"), "Enables AltJ
 RETAIL_CONFIG_DWORD_INFO_DIRECT_ACCESS(EXTERNAL_JitOptimizeType, W("JitOptimizeType"), "")
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_JitPrintInlinedMethods, W("JitPrintInlinedMethods"), 0, "", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_JitTelemetry, W("JitTelemetry"), 1, "If non-zero, gather JIT telemetry data")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_JitPhaseStatsSampleInterval, W("JitPhaseStatsSampleInterval"), 1, "While the MethodJitPhaseStats event is enabled, only every Nth jitted method reports its per-phase JIT time and memory.")
 RETAIL_CONFIG_STRING_INFO(INTERNAL_JitTimeLogFile, W("JitTimeLogFile"), "If set, gather JIT throughput data and write to this file.")
 RETAIL_CONFIG_STRING_INFO(INTERNAL_JitTimeLogCsv, W("JitTimeLogCsv"), "If set, gather JIT throughput data and write to a CSV file. This mode must be used in internal retail builds.")
 RETAIL_CONFIG_STRING_INFO(INTERNAL_JitFuncInfoLogFile, W("JitFuncInfoLogFile"), "If set, gather JIT function info and write to this file.")
@@ -535,6 +543,7 @@ CONFIG_DWORD_INFO_EX(INTERNAL_NgenForceFailureKind, W("NgenForceFailureKind"), 1
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_NGenEnableCreatePdb, W("NGenEnableCreatePdb"), 0, "If set to >0 ngen.exe displays help on, recognizes createpdb in the command line")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_NGenSimulateDiskFull, W("NGenSimulateDiskFull"), 0, "If set to 1, ngen will throw a Disk full exception in ZapWriter.cpp:Save()")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_PartialNGen, W("PartialNGen"), -1, "Generate partial NGen images")
+RETAIL_CONFIG_STRING_INFO(INTERNAL_NGenMethodStatsFile, W("NGenMethodStatsFile"), "If set, NGen writes per-method compile time and size statistics as CSV to this file")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_NgenAllowMscorlibSoftbind, W("NgenAllowMscorlibSoftbind"), 0, "Disable forced hard-binding to mscorlib")
 
 CONFIG_DWORD_INFO(INTERNAL_NoASLRForNgen, W("NoASLRForNgen"), 0, "Turn off IMAGE_DLLCHARACTERISTICS_DYNAMIC_BASE bit in generated ngen images. Makes nidump output repeatable from run to run.")
@@ -578,6 +587,7 @@ CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableSlowELTHooks, W("TestOnlyEnableSlowELTH
 
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_PreVistaETWEnabled, W("ETWEnabled"), 0, "This flag is used on OSes < Vista to enable/disable ETW. It is disabled by default", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_VistaAndAboveETWEnabled, W("ETWEnabled"), 1, "This flag is used on OSes >= Vista to enable/disable ETW. It is enabled by default", CLRConfig::REGUTIL_default)
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ETW_ContentionSamplesPerSecond, W("ETW_ContentionSamplesPerSecond"), 100, "The most ContentionSample events that are logged per second for Crst and monitor contention.")
 RETAIL_CONFIG_STRING_INFO_EX(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W("ETW_ObjectAllocationEventsPerTypePerSec"), "Desired number of GCSampledObjectAllocation ETW events to be logged per type per second.  If 0, then the default built in to the implementation for the enabled event (e.g., High, Low), will be used.", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("ProfAPI_ValidateNGENInstrumentation"), 0, "This flag enables additional validations when using the IMetaDataEmit APIs for NGEN'ed images to ensure only supported edits are made.")
 
@@ -619,7 +629,11 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_Thread_DeadThreadGCTriggerPeriodMilliseconds,
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_ForceMinWorkerThreads, W("ThreadPool_ForceMinWorkerThreads"), 0, "Overrides the MinThreads setting for the ThreadPool worker pool")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_ForceMaxWorkerThreads, W("ThreadPool_ForceMaxWorkerThreads"), 0, "Overrides the MaxThreads setting for the ThreadPool worker pool")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DisableStarvationDetection, W("ThreadPool_DisableStarvationDetection"), 0, "Disables the ThreadPool feature that forces new threads to be added when workitems run for too long")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_MaxBlockingCompensationThreads, W("ThreadPool_MaxBlockingCompensationThreads"), 0, "Maximum number of extra worker threads the ThreadPool releases for workers that are blocked in waits, 0 means the number of processors")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_PrewarmedWorkerThreads, W("ThreadPool_PrewarmedWorkerThreads"), 0, "Number of ThreadPool worker threads created ahead of time and kept parked in retirement, so that adding a worker does not have to create a thread")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_EnableWorkerLocalQueues, W("ThreadPool_EnableWorkerLocalQueues"), 1, "Queues native work items queued by a ThreadPool worker thread on a per processor LIFO queue that other workers steal from")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DebugBreakOnWorkerStarvation, W("ThreadPool_DebugBreakOnWorkerStarvation"), 0, "Breaks into the debugger if the ThreadPool detects work queue starvation")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_TimerCoalescingMs, W("ThreadPool_TimerCoalescingMs"), 1, "Granularity in milliseconds of the ThreadPool timer wheel, timers that are due within the same interval fire together")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_EnableWorkerTracking, W("ThreadPool_EnableWorkerTracking"), 0, "Enables extra expensive tracking of how many workers threads are working simultaneously")
 #ifdef _TARGET_ARM64_
 // Spinning scheme is currently different on ARM64, see CLRLifoSemaphore::Wait(DWORD, UINT32, UINT32)
@@ -645,6 +659,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_MaxSampleErrorPercent,
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_SampleIntervalLow,                   W("HillClimbing_SampleIntervalLow"),                  10, "");
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_SampleIntervalHigh,                  W("HillClimbing_SampleIntervalHigh"),                 200, "");
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_GainExponent,                        W("HillClimbing_GainExponent"),                       200, "The exponent to apply to the gain, times 100.  100 means to use linear gain, higher values will enhance large moves and damp small ones.");
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_UseQueueLatencyController,           W("HillClimbing_UseQueueLatencyController"),          0, "Adjusts the thread count based on how long work has been waiting in the queue and on CPU utilization, instead of searching for the best throughput.");
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_QueueLatencyThresholdMs,             W("HillClimbing_QueueLatencyThresholdMs"),            10, "How long work has to have been waiting in the queue for the queue latency controller to add threads.");
 
 
 ///
@@ -654,7 +670,11 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_GainExponent,
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredCompilation, W("TieredCompilation"), 1, "Enables tiered compilation")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Tier1CallCountThreshold, W("TieredCompilation_Tier1CallCountThreshold"), 30, "Number of times a method must be called after which it is promoted to tier 1.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Tier1CallCountingDelayMs, W("TieredCompilation_Tier1CallCountingDelayMs"), 100, "A perpetual delay in milliseconds that is applied to tier 1 call counting and jitting, while there is tier 0 activity.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Tier1CallCountingMaxDelayMs, W("TieredCompilation_Tier1CallCountingMaxDelayMs"), 5000, "The maximum total time in milliseconds that tier 1 call counting and jitting is delayed by tier 0 activity. 0 means no limit.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Tier1DelayActivityThreshold, W("TieredCompilation_Tier1DelayActivityThreshold"), 1, "The number of methods that must be newly called at tier 0 during one TieredCompilation_Tier1CallCountingDelayMs period for the delay to be extended.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Tier1DelaySingleProcMultiplier, W("TieredCompilation_Tier1DelaySingleProcMultiplier"), 10, "Multiplier for TieredCompilation_Tier1CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_BackgroundWorkerCount, W("TieredCompilation_BackgroundWorkerCount"), 1, "Maximum number of background threads that jit methods at tier 1. Threads beyond the first back off while the thread pool is saturated.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredPGO, W("TieredPGO"), 0, "Instrument tier0 code to collect basic block counts, and use the counts when optimizing at tier1")
 
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Test_CallCounting, W("TieredCompilation_Test_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any tier1 promotion")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TieredCompilation_Test_OptimizeTier0, W("TieredCompilation_Test_OptimizeTier0"), 0, "Use optimized codegen (normally used by tier1) in tier0")
@@ -675,6 +695,7 @@ CONFIG_DWORD_INFO_EX(INTERNAL_VirtualCallStubDumpLogCounter, W("VirtualCallStubD
 CONFIG_DWORD_INFO_EX(INTERNAL_VirtualCallStubDumpLogIncr, W("VirtualCallStubDumpLogIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_VirtualCallStubLogging, W("VirtualCallStubLogging"), 0, "Worth keeping, but should be moved into \"#ifdef STUB_LOGGING\" blocks. This goes for most (or all) of the stub logging infrastructure.", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_EX(INTERNAL_VirtualCallStubMissCount, W("VirtualCallStubMissCount"), 100, "Used only when STUB_LOGGING is defined, which by default is not.", CLRConfig::REGUTIL_default)
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_VirtualCallStubPolymorphicDispatchStubs, W("VirtualCallStubPolymorphicDispatchStubs"), 4, "Maximum number of dispatch stubs chained at a call site before it is switched to the resolve stub. A value of 1 or less disables polymorphic dispatch stubs.")
 CONFIG_DWORD_INFO_EX(INTERNAL_VirtualCallStubResetCacheCounter, W("VirtualCallStubResetCacheCounter"), 0, "Used only when STUB_LOGGING is defined, which by default is not.", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_EX(INTERNAL_VirtualCallStubResetCacheIncr, W("VirtualCallStubResetCacheIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.", CLRConfig::REGUTIL_default)
 
@@ -742,6 +763,9 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_EventPipeOutputPath, W("EventPipeOutputPath")
 RETAIL_CONFIG_STRING_INFO(INTERNAL_EventPipeConfig, W("EventPipeConfig"), "Configuration for EventPipe.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeRundown, W("EventPipeRundown"), 1, "Enable/disable eventpipe rundown.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"), 1024, "The EventPipe circular buffer size in megabytes.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeSampleProfilerOverheadPercent, W("EventPipeSampleProfilerOverheadPercent"), 0, "If non-zero, the sample profiler lengthens its sampling interval so that suspending the runtime and walking stacks take at most about this percentage of the time.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeFlushPeriodMs, W("EventPipeFlushPeriodMs"), 0, "If non-zero, buffered events are written to the trace file about this often instead of only when the session ends or switches files, so the file can be read while it is written.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeRuntimeCountersIntervalMs, W("EventPipeRuntimeCountersIntervalMs"), 1000, "How often the runtime counters are sampled when the Microsoft-DotNETCore-RuntimeCounters provider is enabled.")
 
 #ifdef FEATURE_GDBJIT
 ///
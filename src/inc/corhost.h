@@ -352,6 +352,9 @@ public:
         LPCWSTR* argv,
         DWORD* pReturnValue);
 
+    // Not part of ICLRRuntimeHost4, used by the coreclr_notify_startup_complete hosting API
+    HRESULT NotifyStartupComplete(DWORD dwAppDomainId);
+
     static STARTUP_FLAGS GetStartupFlags();
 
     static EInitializeNewDomainFlags GetAppDomainManagerInitializeNewDomainFlags();
@@ -213,11 +213,11 @@ TODO: Talk about initializing strutures before use
     #define SELECTANY extern __declspec(selectany)
 #endif
 
-SELECTANY const GUID JITEEVersionIdentifier = { /* 12768bf8-549c-455b-a3df-57a751a81813 */
-    0x12768bf8,
-    0x549c,
-    0x455b,
-    {0xa3, 0xdf, 0x57, 0xa7, 0x51, 0xa8, 0x18, 0x13}
+SELECTANY const GUID JITEEVersionIdentifier = { /* 1f9b9bd1-9884-40f9-8dd6-aa052b218aac */
+    0x1f9b9bd1,
+    0x9884,
+    0x40f9,
+    {0x8d, 0xd6, 0xaa, 0x05, 0x2b, 0x21, 0x8a, 0xac}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -825,7 +825,7 @@ enum CorInfoFlag
     CORINFO_FLG_INTRINSIC             = 0x00400000, // This method MAY have an intrinsic ID
     CORINFO_FLG_CONSTRUCTOR           = 0x00800000, // This method is an instance or type initializer
     CORINFO_FLG_AGGRESSIVE_OPT        = 0x01000000, // The method may contain hot code and should be aggressively optimized if possible
-//  CORINFO_FLG_UNUSED                = 0x02000000,
+    CORINFO_FLG_SUPPRESS_GC_TRANSITION = 0x02000000, // P/Invoke that can be called without switching to preemptive mode, see code:MethodDesc::HasSuppressGCTransitionAttribute
     CORINFO_FLG_NOSECURITYWRAP        = 0x04000000, // The method requires no security checks
     CORINFO_FLG_DONT_INLINE           = 0x10000000, // The method should not be inlined
     CORINFO_FLG_DONT_INLINE_CALLER    = 0x20000000, // The method should not be inlined, nor should its callers. It cannot be tail called.
@@ -857,6 +857,7 @@ enum CorInfoMethodRuntimeFlags
     CORINFO_FLG_BAD_INLINEE         = 0x00000001, // The method is not suitable for inlining
     CORINFO_FLG_VERIFIABLE          = 0x00000002, // The method has verifiable code
     CORINFO_FLG_UNVERIFIABLE        = 0x00000004, // The method has unverifiable code
+    CORINFO_FLG_SWITCHED_TO_OPTIMIZED = 0x00000008, // The JIT decided to switch to optimized code for this method
 };
 
 
@@ -1311,6 +1312,7 @@ struct CORINFO_LOOKUP_KIND
 //
 #define CORINFO_MAXINDIRECTIONS 4
 #define CORINFO_USEHELPER ((WORD) 0xffff)
+#define CORINFO_NO_SIZE_CHECK ((WORD) 0xffff)
 
 struct CORINFO_RUNTIME_LOOKUP
 {
@@ -1333,6 +1335,12 @@ struct CORINFO_RUNTIME_LOOKUP
     // If set, test the lowest bit and dereference if set (see code:FixupPointer)
     bool                    testForFixup;
 
+    // CORINFO_NO_SIZE_CHECK = the slot is always present in the dictionary
+    // Otherwise, the dictionary may be older than the slot: the pointer-sized value at this byte-offset from the
+    // dictionary (the pointer produced by the second to last indirection) is the size of the dictionary in bytes,
+    // and the helper must be called if the last offset is not below it. Only used together with testForNull.
+    WORD                    sizeOffset;
+
     SIZE_T                  offsets[CORINFO_MAXINDIRECTIONS];
 
     // If set, first offset is indirect.
@@ -2673,6 +2681,15 @@ public:
     // Returns true iff "fldHnd" represents a static field.
     virtual bool isFieldStatic(CORINFO_FIELD_HANDLE fldHnd) = 0;
 
+    // If "field" is a static field of reference type whose class has already been initialized,
+    // returns the exact class of the object it currently refers to, or NULL if the field is null
+    // or its value cannot be inspected. "*pIsSpeculative" is set to false only when the field is
+    // also readonly, so that the result will hold for the rest of the process lifetime.
+    virtual CORINFO_CLASS_HANDLE getStaticFieldCurrentClass(
+                        CORINFO_FIELD_HANDLE    field,
+                        bool                   *pIsSpeculative /* OUT */
+                        ) = 0;
+
     /*********************************************************************************/
     //
     // ICorDebugInfo
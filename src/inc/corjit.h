@@ -205,6 +205,7 @@ enum CorJitAllocMemFlag
     CORJIT_ALLOCMEM_DEFAULT_CODE_ALIGN = 0x00000000, // The code will be use the normal alignment
     CORJIT_ALLOCMEM_FLG_16BYTE_ALIGN   = 0x00000001, // The code will be 16-byte aligned
     CORJIT_ALLOCMEM_FLG_RODATA_16BYTE_ALIGN = 0x00000002, // The read-only data will be 16-byte aligned
+    CORJIT_ALLOCMEM_FLG_32BYTE_ALIGN   = 0x00000004, // The code will be 32-byte aligned
 };
 
 inline CorJitAllocMemFlag operator |(CorJitAllocMemFlag a, CorJitAllocMemFlag b)
@@ -481,6 +482,16 @@ public:
         DWORD        sizeInBytes   /* IN: The size of the buffer. Note that this is effectively a
                                           version number for the CORJIT_FLAGS value. */
         ) = 0;
+
+    // Reports the thread cycles and JIT arena memory spent in one phase of the current compilation.
+    // Only called when the compilation was started with CORJIT_FLAG_REPORT_PHASE_STATS, once for
+    // each phase that ran, after the native code has been generated.
+    virtual void reportJitPhaseStats(
+        unsigned         phaseIndex,     /* IN: The index of the phase, in the JIT's phase order */
+        const char*      phaseName,      /* IN: The name of the phase */
+        unsigned __int64 cycles,         /* IN: Thread cycles spent in the phase */
+        unsigned __int64 allocatedBytes  /* IN: Bytes of JIT arena memory allocated during the phase */
+        ) = 0;
 };
 
 /**********************************************************************************/
@@ -52,7 +52,7 @@ public:
 
     #endif // !defined(_TARGET_X86_)
 
-        CORJIT_FLAG_UNUSED6                 = 13,
+        CORJIT_FLAG_REPORT_PHASE_STATS      = 13, // Report per-phase time and memory via ICorJitInfo::reportJitPhaseStats
 
     #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
@@ -574,6 +574,14 @@ namespace ETW
             BOOL fSendMethodEvent,
             BOOL fSendILToNativeMapEvent,
             BOOL fGetReJitIDs);
+        static VOID SendEventsForJitMethod(MethodDesc *pMD,
+            TADDR codeStart,
+            ReJITID rejitID,
+            DWORD dwEventOptions,
+            BOOL fLoadOrDCStart,
+            BOOL fUnloadOrDCEnd,
+            BOOL fSendMethodEvent,
+            BOOL fSendILToNativeMapEvent);
         static VOID SendEventsForNgenMethods(Module *pModule, DWORD dwEventOptions);
         static VOID SendMethodJitStartEvent(MethodDesc *pMethodDesc, SString *namespaceOrClassName=NULL, SString *methodName=NULL, SString *methodSignature=NULL);
         static VOID SendMethodILToNativeMapEvent(MethodDesc * pMethodDesc, DWORD dwEventOptions, SIZE_T pCode, ReJITID rejitID);
@@ -809,6 +817,19 @@ namespace ETW
                 NativeContention=1
             } ContentionFlags;
         } ContentionStructs;
+
+#ifdef FEATURE_EVENT_TRACE
+        static VOID InitializeSampling();
+
+        // Returns TRUE if a contention that is starting should be timed and reported with a
+        // ContentionSample event. Samples are limited to a configured number per second.
+        static BOOL ShouldSampleContention();
+        static VOID SendContentionSample(ContentionStructs::ContentionFlags contentionFlags, PVOID pLock, UINT32 crstType, UINT64 ownerThreadID, LARGE_INTEGER contentionStartTicks);
+#else
+        static VOID InitializeSampling() {};
+        static BOOL ShouldSampleContention() { return FALSE; };
+        static VOID SendContentionSample(ContentionStructs::ContentionFlags contentionFlags, PVOID pLock, UINT32 crstType, UINT64 ownerThreadID, LARGE_INTEGER contentionStartTicks) {};
+#endif // FEATURE_EVENT_TRACE
     };    
     // Class to wrap all Interop logic for ETW
     class InteropLog
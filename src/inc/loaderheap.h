@@ -99,6 +99,13 @@ struct TaggedMemAllocPtr
 
 #define VIRTUAL_ALLOC_RESERVE_GRANULARITY (64*1024)    // 0x10000  (64 KB)
 
+#ifdef _WIN64
+// Each reservation a loader heap makes for itself is twice as large as the previous one, up to
+// this size. A large heap then lives in a few big regions instead of many 64 KB ones scattered
+// across the address space, and those regions are large enough for transparent huge pages.
+#define LOADERHEAP_MAX_RESERVE_BLOCK_SIZE (4*1024*1024) // 0x400000 (4 MB)
+#endif
+
 typedef DPTR(struct LoaderHeapBlock) PTR_LoaderHeapBlock;
 
 struct LoaderHeapBlock
@@ -204,7 +211,8 @@ private:
 
     PTR_LoaderHeapBlock m_pCurBlock;
 
-    // When we need to ClrVirtualAlloc() MEM_RESERVE a new set of pages, number of bytes to reserve
+    // When we need to ClrVirtualAlloc() MEM_RESERVE a new set of pages, number of bytes to reserve.
+    // Grows with each reservation on 64-bit, see LOADERHEAP_MAX_RESERVE_BLOCK_SIZE.
     DWORD               m_dwReserveBlockSize;
 
     // When we need to commit pages from our reserved list, number of bytes to commit at a time
@@ -24,6 +24,13 @@
 // In order to speed up "backwards scanning" we start numbering
 // nibbles inside a DWORD from the highest bits (28..31). Because
 // of that we can scan backwards inside the DWORD with right shifts.
+//
+// So that lookups inside large methods do not scan backwards over many
+// empty DWORDs, every DWORD of the map whose code lies entirely inside a
+// method (after the DWORD holding the method's own nibble) holds the
+// distance from the first byte it covers back to the start of the method
+// instead. Such DWORDs are told apart by their lowest nibble, which is
+// never larger than BYTES_PER_BUCKET / CODE_ALIGN in a DWORD of nibbles.
 
 #if defined(_WIN64)
 // TODO: bump up the windows CODE_ALIGN to 16 and iron out any nibble map bugs that exist. 
@@ -45,6 +52,10 @@
 #define MASK_BYTES_PER_BUCKET   (BYTES_PER_BUCKET - 1)                       // 31
 #define HIGHEST_NIBBLE_BIT      (32 - NIBBLE_SIZE)                           // 28 (i.e 32 - 4)
 #define HIGHEST_NIBBLE_MASK     (NIBBLE_MASK << HIGHEST_NIBBLE_BIT)          // 0xf0000000
+#define BYTES_PER_MAP_DWORD     (NIBBLES_PER_DWORD * BYTES_PER_BUCKET)       // 256 bytes per DWORD of the map
+#define LOG2_BYTES_PER_MAP_DWORD (LOG2_NIBBLES_PER_DWORD + LOG2_BYTES_PER_BUCKET) // 8 bits per DWORD of the map
+#define NIBBLE_POINTER_MARKER   NIBBLE_MASK                                  // lowest nibble of a pointer DWORD
+#define MAX_NIBBLE_POINTER_DISTANCE (((size_t)0xffffffff >> NIBBLE_SIZE) << LOG2_CODE_ALIGN)
 
 #define ADDR2POS(x)                      ((x) >> LOG2_BYTES_PER_BUCKET)
 #define ADDR2OFFS(x)            (DWORD)  ((((x) & MASK_BYTES_PER_BUCKET) >> LOG2_CODE_ALIGN) + 1)
@@ -52,5 +63,10 @@
 #define HEAP2MAPSIZE(x)                  (((x) / (BYTES_PER_BUCKET * NIBBLES_PER_DWORD)) * CODE_ALIGN)
 #define POS2SHIFTCOUNT(x)       (DWORD)  (HIGHEST_NIBBLE_BIT - (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
 #define POS2MASK(x)             (DWORD) ~(HIGHEST_NIBBLE_MASK >> (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
+#define POS2MAPDWORDADDR(pos)   (size_t) (((pos) >> LOG2_NIBBLES_PER_DWORD) << LOG2_BYTES_PER_MAP_DWORD)
+
+#define IS_NIBBLE_POINTER(dw)   (((dw) & NIBBLE_MASK) == NIBBLE_POINTER_MARKER)
+#define ENCODE_NIBBLE_POINTER(distance) (DWORD) ((((distance) >> LOG2_CODE_ALIGN) << NIBBLE_SIZE) | NIBBLE_POINTER_MARKER)
+#define DECODE_NIBBLE_POINTER(dw)       (size_t) (((dw) >> NIBBLE_SIZE) << LOG2_CODE_ALIGN)
 
 #endif  // NIBBLEMAPMACROS_H_
@@ -1469,6 +1469,7 @@ public:
     }
 };
 
+BOOL GetCurrentProcessCpuLimit(DWORD* pCpuLimit);
 int GetCurrentProcessCpuCount();
 DWORD_PTR GetCurrentProcessCpuMask();
 
@@ -91,6 +91,7 @@ DEF_CLR_API(getFieldOffset)
 DEF_CLR_API(isWriteBarrierHelperRequired)
 DEF_CLR_API(getFieldInfo)
 DEF_CLR_API(isFieldStatic)
+DEF_CLR_API(getStaticFieldCurrentClass)
 DEF_CLR_API(getBoundaries)
 DEF_CLR_API(setBoundaries)
 DEF_CLR_API(getVars)
@@ -171,6 +172,7 @@ DEF_CLR_API(recordRelocation)
 DEF_CLR_API(getRelocTypeHint)
 DEF_CLR_API(getModuleNativeEntryPointRange)
 DEF_CLR_API(getExpectedTargetArchitecture)
+DEF_CLR_API(reportJitPhaseStats)
 DEF_CLR_API(resolveVirtualMethod)
 DEF_CLR_API(expandRawHandleIntrinsic)
 DEF_CLR_API(getDefaultEqualityComparerClass)
@@ -870,6 +870,14 @@ bool WrapICorJitInfo::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return result;
 }
 
+CORINFO_CLASS_HANDLE WrapICorJitInfo::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    API_ENTER(getStaticFieldCurrentClass);
+    CORINFO_CLASS_HANDLE result = wrapHnd->getStaticFieldCurrentClass(field, pIsSpeculative);
+    API_LEAVE(getStaticFieldCurrentClass);
+    return result;
+}
+
 /*********************************************************************************/
 //
 // ICorDebugInfo
@@ -1649,6 +1657,17 @@ DWORD WrapICorJitInfo::getExpectedTargetArchitecture()
     return result;
 }
 
+void WrapICorJitInfo::reportJitPhaseStats(
+            unsigned         phaseIndex,
+            const char*      phaseName,
+            unsigned __int64 cycles,
+            unsigned __int64 allocatedBytes)
+{
+    API_ENTER(reportJitPhaseStats);
+    wrapHnd->reportJitPhaseStats(phaseIndex, phaseName, cycles, allocatedBytes);
+    API_LEAVE(reportJitPhaseStats);
+}
+
 CORINFO_METHOD_HANDLE WrapICorJitInfo::resolveVirtualMethod(
     CORINFO_METHOD_HANDLE       virtualMethod,          /* IN */
     CORINFO_CLASS_HANDLE        implementingClass,      /* IN */
@@ -39,6 +39,10 @@ size_t ArenaAllocator::getDefaultPageSize()
     return DEFAULT_PAGE_SIZE;
 }
 
+CritSecObject                   ArenaAllocator::s_pagePoolLock;
+ArenaAllocator::PageDescriptor* ArenaAllocator::s_pagePool      = nullptr;
+unsigned                        ArenaAllocator::s_pagePoolCount = 0;
+
 //------------------------------------------------------------------------
 // ArenaAllocator::ArenaAllocator:
 //    Default-constructs an arena allocator.
@@ -87,6 +91,12 @@ void* ArenaAllocator::allocateNewPage(size_t size)
     {
         // Round to the nearest multiple of default page size
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
+
+        // Try to reuse a page left behind by an earlier compilation
+        if (pageSize == DEFAULT_PAGE_SIZE)
+        {
+            newPage = takePooledPage();
+        }
     }
 
     if (newPage == nullptr)
@@ -129,11 +139,36 @@ void* ArenaAllocator::allocateNewPage(size_t size)
 //------------------------------------------------------------------------
 // ArenaAllocator::destroy:
 //    Performs any necessary teardown for an `ArenaAllocator`.
+//
+// Notes:
+//    Default-sized pages are handed to the page pool while it has room;
+//    all other pages are returned to the host.
 void ArenaAllocator::destroy()
 {
     PageDescriptor* page = m_firstPage;
 
-    // Free all of the allocated pages
+    if ((page != nullptr) && !bypassHostAllocator())
+    {
+        CritSecHolder poolLock(s_pagePoolLock);
+
+        for (PageDescriptor* next; (page != nullptr) && (s_pagePoolCount < MAX_POOLED_PAGES); page = next)
+        {
+            next = page->m_next;
+
+            if (page->m_pageBytes == DEFAULT_PAGE_SIZE)
+            {
+                page->m_next = s_pagePool;
+                s_pagePool   = page;
+                s_pagePoolCount++;
+            }
+            else
+            {
+                freeHostMemory(page, page->m_pageBytes);
+            }
+        }
+    }
+
+    // Free the remaining pages
     for (PageDescriptor* next; page != nullptr; page = next)
     {
         next = page->m_next;
@@ -147,6 +182,47 @@ void ArenaAllocator::destroy()
     m_lastFreeByte = nullptr;
 }
 
+//------------------------------------------------------------------------
+// ArenaAllocator::takePooledPage:
+//    Removes a default-sized page from the page pool.
+//
+// Return Value:
+//    The page, or nullptr if the pool is empty.
+ArenaAllocator::PageDescriptor* ArenaAllocator::takePooledPage()
+{
+    CritSecHolder poolLock(s_pagePoolLock);
+
+    PageDescriptor* page = s_pagePool;
+
+    if (page != nullptr)
+    {
+        assert(page->m_pageBytes == DEFAULT_PAGE_SIZE);
+        assert(s_pagePoolCount > 0);
+
+        s_pagePool = page->m_next;
+        s_pagePoolCount--;
+    }
+
+    return page;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::shutdown:
+//    Returns the pages held by the page pool to the host.
+void ArenaAllocator::shutdown()
+{
+    CritSecHolder poolLock(s_pagePoolLock);
+
+    for (PageDescriptor *page = s_pagePool, *next; page != nullptr; page = next)
+    {
+        next = page->m_next;
+        freeHostMemory(page, page->m_pageBytes);
+    }
+
+    s_pagePool      = nullptr;
+    s_pagePoolCount = 0;
+}
+
 // The debug version of the allocator may allocate directly from the
 // OS rather than going through the hosting APIs. In order to do so,
 // it must undef the macros that are usually in place to prevent
@@ -266,15 +342,31 @@ void ArenaAllocator::MemStats::Print(FILE* f)
     PrintByKind(f);
 }
 
-void ArenaAllocator::MemStats::PrintByKind(FILE* f)
+void ArenaAllocator::MemStats::PrintByKind(FILE* f, unsigned nMethods)
 {
-    fprintf(f, "\nAlloc'd bytes by kind:\n  %20s | %10s | %7s\n", "kind", "size", "pct");
-    fprintf(f, "  %20s-+-%10s-+-%7s\n", "--------------------", "----------", "-------");
+    if (nMethods == 0)
+    {
+        fprintf(f, "\nAlloc'd bytes by kind:\n  %20s | %10s | %7s\n", "kind", "size", "pct");
+        fprintf(f, "  %20s-+-%10s-+-%7s\n", "--------------------", "----------", "-------");
+    }
+    else
+    {
+        fprintf(f, "\nAlloc'd bytes by kind:\n  %20s | %10s | %7s | %10s\n", "kind", "size", "pct", "avg/method");
+        fprintf(f, "  %20s-+-%10s-+-%7s-+-%10s\n", "--------------------", "----------", "-------", "----------");
+    }
     float allocSzF = static_cast<float>(allocSz);
     for (int cmk = 0; cmk < CMK_Count; cmk++)
     {
         float pct = 100.0f * static_cast<float>(allocSzByKind[cmk]) / allocSzF;
-        fprintf(f, "  %20s | %10llu | %6.2f%%\n", s_CompMemKindNames[cmk], allocSzByKind[cmk], pct);
+        if (nMethods == 0)
+        {
+            fprintf(f, "  %20s | %10llu | %6.2f%%\n", s_CompMemKindNames[cmk], allocSzByKind[cmk], pct);
+        }
+        else
+        {
+            fprintf(f, "  %20s | %10llu | %6.2f%% | %10llu\n", s_CompMemKindNames[cmk], allocSzByKind[cmk], pct,
+                    allocSzByKind[cmk] / nMethods);
+        }
     }
     fprintf(f, "\n");
 }
@@ -292,7 +384,7 @@ void ArenaAllocator::AggregateMemStats::Print(FILE* f)
     fprintf(f, "\n");
     fprintf(f, "  allocateMemory   : %12llu (avg %7llu per method)\n", nraTotalSizeAlloc, nraTotalSizeAlloc / nMethods);
     fprintf(f, "  nraUsed    : %12llu (avg %7llu per method)\n", nraTotalSizeUsed, nraTotalSizeUsed / nMethods);
-    PrintByKind(f);
+    PrintByKind(f, nMethods);
 }
 
 ArenaAllocator::MemStatsAllocator* ArenaAllocator::getMemStatsAllocator(CompMemKind kind)
@@ -41,6 +41,7 @@ private:
     enum
     {
         DEFAULT_PAGE_SIZE = 0x10000,
+        MAX_POOLED_PAGES  = 16, // Bounds the memory held by the page pool (see below) to 1MB.
     };
 
     PageDescriptor* m_firstPage;
@@ -52,6 +53,15 @@ private:
 
     void* allocateNewPage(size_t size);
 
+    // Default-sized pages are not returned to the host when an arena is destroyed; up to
+    // MAX_POOLED_PAGES of them are kept in a global pool so that later compilations can
+    // reuse them without going through the host.
+    static CritSecObject   s_pagePoolLock;  // This lock protects the pool below.
+    static PageDescriptor* s_pagePool;      // List of free pages, linked through m_next.
+    static unsigned        s_pagePoolCount; // # of pages in s_pagePool.
+
+    static PageDescriptor* takePooledPage();
+
     static void* allocateHostMemory(size_t size, size_t* pActualSize);
     static void freeHostMemory(void* block, size_t size);
 
@@ -78,8 +88,11 @@ private:
             allocSzByKind[cmk] += sz;
         }
 
-        void Print(FILE* f);       // Print these stats to file.
-        void PrintByKind(FILE* f); // Do just the by-kind histogram part.
+        void Print(FILE* f); // Print these stats to file.
+
+        // Do just the by-kind histogram part. If nMethods is non-zero, also show the
+        // average number of bytes of each kind allocated per method.
+        void PrintByKind(FILE* f, unsigned nMethods = 0);
     };
 
     struct AggregateMemStats : public MemStats
@@ -151,6 +164,8 @@ public:
 
     static bool   bypassHostAllocator();
     static size_t getDefaultPageSize();
+
+    static void shutdown();
 };
 
 //------------------------------------------------------------------------
@@ -265,6 +265,17 @@ void CodeGen::genCodeForBBlist()
         {
             getEmitter()->emitLoopAlign();
         }
+        else if (((block->bbFlags & BBF_LOOP_ALIGN) != 0) && ((block->bbFlags & BBF_COLD) == 0))
+        {
+            // Cold code is allocated separately, we don't know its alignment.
+            unsigned alignmentBoundary = (JitConfig.JitAlignHotLoopBoundary() == 16) ? 16 : 32;
+            unsigned maxPadding        = min((unsigned)JitConfig.JitAlignHotLoopMaxPadding(), 15u);
+
+            if (maxPadding > 0)
+            {
+                getEmitter()->emitLoopAlign(alignmentBoundary, maxPadding);
+            }
+        }
 #endif
 
 #ifdef DEBUG
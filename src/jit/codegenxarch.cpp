@@ -2605,7 +2605,8 @@ void CodeGen::genCodeForInitBlkRepStos(GenTreeBlk* initBlkNode)
 // Generate code for InitBlk by performing a loop unroll
 // Preconditions:
 //   a) Both the size and fill byte value are integer constants.
-//   b) The size of the struct to initialize is smaller than INITBLK_UNROLL_LIMIT bytes.
+//   b) The size of the struct to initialize is smaller than INITBLK_UNROLL_LIMIT bytes, or than
+//      INITBLK_UNROLL_LIMIT_AVX bytes when zeroing with 32-byte stores.
 //
 void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* initBlkNode)
 {
@@ -2618,10 +2619,12 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* initBlkNode)
         initVal = initVal->gtGetOp1();
     }
 
+    bool useYmm = compiler->canUseYmmBlockUnroll(initBlkNode);
+
     assert(dstAddr->isUsedFromReg());
-    assert(initVal->isUsedFromReg() || (initVal->IsIntegralConst(0) && ((size & 0xf) == 0)));
+    assert(initVal->isUsedFromReg() || (initVal->IsIntegralConst(0) && (((size & 0xf) == 0) || useYmm)));
     assert(size != 0);
-    assert(size <= INITBLK_UNROLL_LIMIT);
+    assert(size <= (useYmm ? INITBLK_UNROLL_LIMIT_AVX : INITBLK_UNROLL_LIMIT));
     assert(initVal->gtSkipReloadOrCopy()->IsCnsIntOrI());
 
     emitter* emit = getEmitter();
@@ -2656,6 +2659,31 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* initBlkNode)
             emit->emitIns_R_R(INS_xorps, EA_8BYTE, tmpReg, tmpReg);
         }
 
+        if (useYmm)
+        {
+            // The VEX encoded xorps above also zeroed the upper half of the YMM register.
+            size_t slots = size / YMM_REGSIZE_BYTES;
+
+            while (slots-- > 0)
+            {
+                emit->emitIns_AR_R(INS_movdqu, EA_32BYTE, tmpReg, dstAddr->gtRegNum, offset);
+                offset += YMM_REGSIZE_BYTES;
+            }
+
+            // Zero the remainder with a single store that overlaps the bytes we've already
+            // written, which is fine since the whole block is at least YMM_REGSIZE_BYTES long.
+            unsigned remainder = size - offset;
+            if (remainder > XMM_REGSIZE_BYTES)
+            {
+                emit->emitIns_AR_R(INS_movdqu, EA_32BYTE, tmpReg, dstAddr->gtRegNum, size - YMM_REGSIZE_BYTES);
+            }
+            else if (remainder > 0)
+            {
+                emit->emitIns_AR_R(INS_movdqu, EA_8BYTE, tmpReg, dstAddr->gtRegNum, size - XMM_REGSIZE_BYTES);
+            }
+            return;
+        }
+
         // Determine how many 16 byte slots we're going to fill using SSE movs.
         size_t slots = size / XMM_REGSIZE_BYTES;
 
@@ -2782,8 +2810,9 @@ void CodeGen::genCodeForStoreOffset(instruction ins, emitAttr size, regNumber sr
 
 // Generates CpBlk code by performing a loop unroll
 // Preconditions:
-//  The size argument of the CpBlk node is a constant and <= 64 bytes.
-//  This may seem small but covers >95% of the cases in several framework assemblies.
+//  The size argument of the CpBlk node is a constant and <= 64 bytes, or <= CPBLK_UNROLL_LIMIT_AVX
+//  bytes when AVX is available. This may seem small but covers >95% of the cases in several
+//  framework assemblies.
 //
 void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* cpBlkNode)
 {
@@ -2792,7 +2821,8 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* cpBlkNode)
     GenTree* dstAddr = cpBlkNode->Addr();
     GenTree* source  = cpBlkNode->Data();
     GenTree* srcAddr = nullptr;
-    assert(size <= CPBLK_UNROLL_LIMIT);
+    bool     useYmm  = compiler->canUseYmmBlockUnroll(cpBlkNode);
+    assert(size <= (useYmm ? CPBLK_UNROLL_LIMIT_AVX : CPBLK_UNROLL_LIMIT));
 
     emitter* emit = getEmitter();
 
@@ -2828,6 +2858,35 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* cpBlkNode)
 
     unsigned offset = 0;
 
+    // With AVX, copy 32 bytes at a time and finish with a single overlapping
+    // load and store, so no scalar tail is needed.
+    if (useYmm)
+    {
+        regNumber xmmReg = cpBlkNode->GetSingleTempReg(RBM_ALLFLOAT);
+        assert(genIsValidFloatReg(xmmReg));
+        size_t slots = size / YMM_REGSIZE_BYTES;
+
+        while (slots-- > 0)
+        {
+            genCodeForLoadOffset(INS_movdqu, EA_32BYTE, xmmReg, srcAddr, offset);
+            genCodeForStoreOffset(INS_movdqu, EA_32BYTE, xmmReg, dstAddr, offset);
+            offset += YMM_REGSIZE_BYTES;
+        }
+
+        unsigned remainder = size - offset;
+        if (remainder > XMM_REGSIZE_BYTES)
+        {
+            genCodeForLoadOffset(INS_movdqu, EA_32BYTE, xmmReg, srcAddr, size - YMM_REGSIZE_BYTES);
+            genCodeForStoreOffset(INS_movdqu, EA_32BYTE, xmmReg, dstAddr, size - YMM_REGSIZE_BYTES);
+        }
+        else if (remainder > 0)
+        {
+            genCodeForLoadOffset(INS_movdqu, EA_8BYTE, xmmReg, srcAddr, size - XMM_REGSIZE_BYTES);
+            genCodeForStoreOffset(INS_movdqu, EA_8BYTE, xmmReg, dstAddr, size - XMM_REGSIZE_BYTES);
+        }
+        return;
+    }
+
     // If the size of this struct is larger than 16 bytes
     // let's use SSE2 to be able to do 16 byte at a time
     // loads and stores.
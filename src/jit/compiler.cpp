@@ -1449,6 +1449,9 @@ void Compiler::compShutdown()
 
     emitter::emitDone();
 
+    // Release the arena pages kept around for reuse by later compilations
+    ArenaAllocator::shutdown();
+
 #if defined(DEBUG) || defined(INLINE_DATA)
     // Finish reading and/or writing inline xml
     InlineStrategy::FinalizeXml();
@@ -1992,6 +1995,7 @@ void Compiler::compInit(ArenaAllocator* pAlloc, InlineInfo* inlineInfo)
     compQmarkUsed         = false;
     compFloatingPointUsed = false;
     compUnsafeCastUsed    = false;
+    compHasBackwardJump   = false;
 
     compNeedsGSSecurityCookie = false;
     compGSReorderStackLayout  = false;
@@ -4534,6 +4538,11 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         fgTransformFatCalli();
     }
 
+    if (doesMethodHaveGuardedDevirtualization())
+    {
+        fgTransformGuardedDevirtualizationCandidates();
+    }
+
     EndPhase(PHASE_IMPORTATION);
 
     if (compIsForInlining())
@@ -4661,6 +4670,10 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
     fgComputePreds();
     EndPhase(PHASE_COMPUTE_PREDS);
 
+    // Share blocks that throw via identical calls to no-return methods
+    fgTailMergeThrows();
+    EndPhase(PHASE_MERGE_THROWS);
+
     /* If we need to emit GC Poll calls, mark the blocks that need them now.  This is conservative and can
      * be optimized later. */
     fgMarkGCPollBlocks();
@@ -4711,6 +4724,9 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         /* Unroll loops */
         optUnrollLoops();
         EndPhase(PHASE_UNROLL_LOOPS);
+
+        // Pick the hot inner loops the emitter should align
+        optIdentifyLoopsForAlignment();
     }
 
 #ifdef DEBUG
@@ -5228,9 +5244,11 @@ int Compiler::compCompile(CORINFO_METHOD_HANDLE methodHnd,
 
         checkedForJitTimeLog = true;
     }
-    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr))
+    const bool reportPhaseStats = compileFlags->IsSet(JitFlags::JIT_FLAG_REPORT_PHASE_STATS);
+
+    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr) || reportPhaseStats)
     {
-        pCompJitTimer = JitTimer::Create(this, methodInfo->ILCodeSize);
+        pCompJitTimer = JitTimer::Create(this, methodInfo->ILCodeSize, reportPhaseStats);
     }
 #endif // FEATURE_JIT_METHOD_PERF
 
@@ -6047,6 +6065,21 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE            classPtr,
         goto _Next;
     }
 
+    // We may decide to optimize this method,
+    // to avoid spending a long time stuck in Tier0 code.
+    if (fgCanSwitchToOptimized())
+    {
+        // We only expect to be able to do this at Tier0.
+        assert(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0));
+
+        // Honor the config setting that tells the jit to
+        // always optimize methods with loops.
+        if (compHasBackwardJump && (JitConfig.TC_QuickJitForLoops() == 0))
+        {
+            fgSwitchToOptimized();
+        }
+    }
+
     compSetOptimizationLevel();
 
 #if COUNT_BASIC_BLOCKS
@@ -7842,7 +7875,8 @@ void CompTimeSummaryInfo::Print(FILE* f)
     fprintf(f, "\n");
 }
 
-JitTimer::JitTimer(unsigned byteCodeSize) : m_info(byteCodeSize)
+JitTimer::JitTimer(Compiler* comp, unsigned byteCodeSize, bool reportPhaseStats)
+    : m_info(byteCodeSize), m_reportPhaseStats(reportPhaseStats), m_curPhaseStartBytes(0)
 {
 #if MEASURE_CLRAPI_CALLS
     m_CLRcallInvokes = 0;
@@ -7856,6 +7890,16 @@ JitTimer::JitTimer(unsigned byteCodeSize) : m_info(byteCodeSize)
 #endif
 #endif
 
+    if (m_reportPhaseStats)
+    {
+        for (int i = 0; i < PHASE_NUMBER_OF; i++)
+        {
+            m_bytesByPhase[i] = 0;
+        }
+
+        m_curPhaseStartBytes = comp->compArenaAllocator->getTotalBytesUsed();
+    }
+
     unsigned __int64 threadCurCycles;
     if (_our_GetThreadCycles(&threadCurCycles))
     {
@@ -7901,6 +7945,13 @@ void JitTimer::EndPhase(Compiler* compiler, Phases phase)
                 ancPhase = PhaseParent[ancPhase];
             }
 
+            if (m_reportPhaseStats)
+            {
+                size_t bytesUsed = compiler->compArenaAllocator->getTotalBytesUsed();
+                m_bytesByPhase[phase] += bytesUsed - m_curPhaseStartBytes;
+                m_curPhaseStartBytes = bytesUsed;
+            }
+
 #if MEASURE_CLRAPI_CALLS
             const Phases lastPhase = PHASE_CLR_API;
 #else
@@ -8131,12 +8182,42 @@ void JitTimer::PrintCsvMethodStats(Compiler* comp)
     fclose(fp);
 }
 
+//------------------------------------------------------------------------
+// JitTimer::ReportPhaseStats: report the cycles and arena memory of
+//    each leaf phase that ran to the EE.
+//
+// Arguments:
+//    comp - the root compiler instance
+//
+void JitTimer::ReportPhaseStats(Compiler* comp)
+{
+    if (m_info.m_timerFailure)
+    {
+        return;
+    }
+
+    for (int i = 0; i < PHASE_NUMBER_OF; i++)
+    {
+        if (PhaseHasChildren[i] || (m_info.m_invokesByPhase[i] == 0))
+        {
+            continue;
+        }
+
+        comp->info.compCompHnd->reportJitPhaseStats(i, PhaseNames[i], m_info.m_cyclesByPhase[i], m_bytesByPhase[i]);
+    }
+}
+
 // Completes the timing of the current method, and adds it to "sum".
 void JitTimer::Terminate(Compiler* comp, CompTimeSummaryInfo& sum, bool includePhases)
 {
     if (includePhases)
     {
         PrintCsvMethodStats(comp);
+
+        if (m_reportPhaseStats)
+        {
+            ReportPhaseStats(comp);
+        }
     }
 
     sum.AddInfo(m_info, includePhases);
@@ -9571,6 +9652,10 @@ int cTreeFlagsIR(Compiler* comp, GenTree* tree)
                         {
                             chars += printf("[CALL_M_UNMGD_THISCALL]");
                         }
+                        if (call->gtCallMoreFlags & GTF_CALL_M_SUPPRESS_GC_TRANSITION)
+                        {
+                            chars += printf("[CALL_M_SUPPRESS_GC_TRANSITION]");
+                        }
                     }
                     else if (call->IsVirtualStub())
                     {
@@ -731,6 +731,12 @@ public:
     int      lvStkOffs;   // stack offset of home
     unsigned lvExactSize; // (exact) size of the type in bytes
 
+#if FEATURE_FASTTAILCALL
+    // For a param passed on the stack, its offset from the first stack passed param, i.e. not counting
+    // any stack slots reserved for register params. Used to find which params a fast tail call overwrites.
+    unsigned lvArgStackOffs;
+#endif // FEATURE_FASTTAILCALL
+
     // Is this a promoted struct?
     // This method returns true only for structs (including SIMD structs), not for
     // locals that are split on a 32-bit target.
@@ -1120,8 +1126,15 @@ class JitTimer
 #endif
     CompTimeInfo m_info; // The CompTimeInfo for this compilation.
 
+    // When the EE asks for phase stats (JIT_FLAG_REPORT_PHASE_STATS) we also track the arena
+    // memory allocated by each leaf phase, and report it along with the phase's cycles.
+    bool             m_reportPhaseStats;
+    size_t           m_curPhaseStartBytes;             // Arena bytes in use at the start of the current phase.
+    unsigned __int64 m_bytesByPhase[PHASE_NUMBER_OF]; // Arena bytes allocated by each leaf phase.
+
     static CritSecObject s_csvLock; // Lock to protect the time log file.
     void PrintCsvMethodStats(Compiler* comp);
+    void ReportPhaseStats(Compiler* comp);
 
 private:
     void* operator new(size_t);
@@ -1131,11 +1144,11 @@ private:
 
 public:
     // Initialized the timer instance
-    JitTimer(unsigned byteCodeSize);
+    JitTimer(Compiler* comp, unsigned byteCodeSize, bool reportPhaseStats);
 
-    static JitTimer* Create(Compiler* comp, unsigned byteCodeSize)
+    static JitTimer* Create(Compiler* comp, unsigned byteCodeSize, bool reportPhaseStats)
     {
-        return ::new (comp, CMK_Unknown) JitTimer(byteCodeSize);
+        return ::new (comp, CMK_Unknown) JitTimer(comp, byteCodeSize, reportPhaseStats);
     }
 
     static void PrintCsvHeader();
@@ -2606,6 +2619,8 @@ public:
     CORINFO_CLASS_HANDLE gtGetHelperCallClassHandle(GenTreeCall* call, bool* isExact, bool* isNonNull);
     // Get the element handle for an array of ref type.
     CORINFO_CLASS_HANDLE gtGetArrayElementClassHandle(GenTree* array);
+    // Get the handle for a ref type static field.
+    CORINFO_CLASS_HANDLE gtGetStaticFieldClassHandle(CORINFO_FIELD_HANDLE fieldHnd, bool* isExact, bool* isNonNull);
     // Get a class handle from a helper call argument
     CORINFO_CLASS_HANDLE gtGetHelperArgClassHandle(GenTree*  array,
                                                    unsigned* runtimeLookupCount = nullptr,
@@ -3337,7 +3352,8 @@ protected:
                              CORINFO_METHOD_HANDLE*  method,
                              unsigned*               methodFlags,
                              CORINFO_CONTEXT_HANDLE* contextHandle,
-                             CORINFO_CONTEXT_HANDLE* exactContextHandle);
+                             CORINFO_CONTEXT_HANDLE* exactContextHandle,
+                             bool                    isLateDevirtualization);
 
     CORINFO_CLASS_HANDLE impGetSpecialIntrinsicExactReturnType(CORINFO_METHOD_HANDLE specialIntrinsicHandle);
 
@@ -3869,6 +3885,11 @@ private:
                                 bool                   exactContextNeedsRuntimeLookup,
                                 CORINFO_CALL_INFO*     callInfo);
 
+    void impMarkInlineCandidateHelper(GenTreeCall*           call,
+                                      CORINFO_CONTEXT_HANDLE exactContextHnd,
+                                      bool                   exactContextNeedsRuntimeLookup,
+                                      CORINFO_CALL_INFO*     callInfo);
+
     bool impTailCallRetTypeCompatible(var_types            callerRetType,
                                       CORINFO_CLASS_HANDLE callerRetTypeClass,
                                       var_types            calleeRetType,
@@ -4110,6 +4131,8 @@ public:
 
     void fgTransformFatCalli();
 
+    void fgTransformGuardedDevirtualizationCandidates();
+
     void fgInline();
 
     void fgRemoveEmptyTry();
@@ -4744,6 +4767,10 @@ public:
 
     void fgRemoveEmptyBlocks();
 
+    GenTreeCall* fgGetMergeableThrowCall(BasicBlock* block);
+
+    void fgTailMergeThrows();
+
     void fgRemoveStmt(BasicBlock* block, GenTree* stmt);
 
     bool fgCheckRemoveStmt(BasicBlock* block, GenTree* stmt);
@@ -4958,6 +4985,9 @@ protected:
 
     void fgMarkBackwardJump(BasicBlock* startBlock, BasicBlock* endBlock);
 
+    bool fgCanSwitchToOptimized();
+    void fgSwitchToOptimized();
+
     void fgLinkBasicBlocks();
 
     unsigned fgMakeBasicBlocks(const BYTE* codeAddr, IL_OFFSET codeSize, FixedBitVect* jumpTarget);
@@ -5552,6 +5582,10 @@ public:
 
     void optUnrollLoops(); // Unrolls loops (needs to have cost info)
 
+    bool optPartiallyUnrollLoop(unsigned lnum); // Unrolls a counted loop into a main loop and a remainder loop
+
+    void optIdentifyLoopsForAlignment(); // Marks the top of hot inner loops for the emitter to align
+
 protected:
     // This enumeration describes what is killed by a call.
 
@@ -6111,6 +6145,7 @@ public:
 #define OMF_HAS_VTABLEREF 0x00000008  // Method contains method table reference.
 #define OMF_HAS_NULLCHECK 0x00000010  // Method contains null check.
 #define OMF_HAS_FATPOINTER 0x00000020 // Method contains call, that needs fat pointer transformation.
+#define OMF_HAS_GUARDEDDEVIRT 0x00000040 // Method contains guarded devirtualization candidate
 
     bool doesMethodHaveFatPointer()
     {
@@ -6129,6 +6164,26 @@ public:
 
     void addFatPointerCandidate(GenTreeCall* call);
 
+    bool doesMethodHaveGuardedDevirtualization()
+    {
+        return (optMethodFlags & OMF_HAS_GUARDEDDEVIRT) != 0;
+    }
+
+    void setMethodHasGuardedDevirtualization()
+    {
+        optMethodFlags |= OMF_HAS_GUARDEDDEVIRT;
+    }
+
+    void clearMethodHasGuardedDevirtualization()
+    {
+        optMethodFlags &= ~OMF_HAS_GUARDEDDEVIRT;
+    }
+
+    void addGuardedDevirtualizationCandidate(GenTreeCall*          call,
+                                             CORINFO_METHOD_HANDLE methodHandle,
+                                             CORINFO_CLASS_HANDLE  classHandle,
+                                             unsigned              classAttr);
+
     unsigned optMethodFlags;
 
     // Recursion bound controls how far we can go backwards tracking for a SSA value.
@@ -8047,6 +8102,38 @@ private:
 #endif
     }
 
+#ifdef _TARGET_XARCH_
+    //------------------------------------------------------------------------
+    // canUseYmmBlockUnroll: Determine whether an unrolled block store can use 32-byte moves.
+    //
+    // Arguments:
+    //    blkNode - the block store node of interest
+    //
+    // Notes:
+    //    Only zeroing InitBlks can use them, since AVX alone cannot broadcast the fill value
+    //    into the upper half of a YMM register.
+    //
+    bool canUseYmmBlockUnroll(GenTreeBlk* blkNode)
+    {
+        if (!canUseVexEncoding() || (blkNode->gtBlkSize < YMM_REGSIZE_BYTES))
+        {
+            return false;
+        }
+
+        if (blkNode->OperIsInitBlkOp())
+        {
+            GenTree* initVal = blkNode->Data();
+            if (initVal->OperIsInitVal())
+            {
+                initVal = initVal->gtGetOp1();
+            }
+            return initVal->gtSkipReloadOrCopy()->IsIntegralConst(0);
+        }
+
+        return true;
+    }
+#endif // _TARGET_XARCH_
+
     /*
     XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
     XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -8076,6 +8163,7 @@ public:
     bool compQmarkUsed;            // Does the method use GT_QMARK/GT_COLON
     bool compQmarkRationalized;    // Is it allowed to use a GT_QMARK/GT_COLON node.
     bool compUnsafeCastUsed;       // Does the method use LDIND/STIND to cast between scalar/refernce types
+    bool compHasBackwardJump;      // Does the method have a lexically backwards jump?
 
 // NOTE: These values are only reliable after
 //       the importing is completely finished.
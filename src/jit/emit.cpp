@@ -967,6 +967,8 @@ void emitter::emitBegFN(bool hasFramePtr
 #ifdef _TARGET_XARCH_
     emitExitSeqBegLoc.Init();
     emitExitSeqSize = INT_MAX;
+
+    emitMaxLoopAlignment = 0;
 #endif // _TARGET_XARCH_
 
     emitPlaceholderList = emitPlaceholderLast = nullptr;
@@ -1125,6 +1127,27 @@ void emitter::appendToCurIG(instrDesc* id)
     emitCurIGsize += id->idCodeSize();
 }
 
+//------------------------------------------------------------------------
+// emitRemoveLastInstruction: Remove the most recently emitted instruction,
+//    so that a peephole can replace it with a combined instruction.
+//
+// Notes:
+//    The instruction must be in the current instruction group.
+//    There is no record of the instruction before it, so emitLastIns is
+//    left null until the next instruction is emitted.
+//
+void emitter::emitRemoveLastInstruction()
+{
+    assert(emitLastIns != nullptr);
+    assert(emitCurIGinsCnt > 0);
+    assert(((BYTE*)emitLastIns >= emitCurIGfreeBase) && ((BYTE*)emitLastIns < emitCurIGfreeNext));
+
+    emitCurIGsize -= emitLastIns->idCodeSize();
+    emitCurIGfreeNext = (BYTE*)emitLastIns;
+    emitCurIGinsCnt--;
+    emitLastIns = nullptr;
+}
+
 /*****************************************************************************
  *
  *  Display (optionally) an instruction offset.
@@ -4490,6 +4513,19 @@ unsigned emitter::emitEndCodeGen(Compiler* comp,
     }
 #endif
 
+#ifdef _TARGET_XARCH_
+    // Loop alignment padding is computed from the final code address, so the
+    // hot code must start on the largest boundary any loop was aligned to.
+    if (emitMaxLoopAlignment > 16)
+    {
+        allocMemFlag = CORJIT_ALLOCMEM_FLG_32BYTE_ALIGN;
+    }
+    else if (emitMaxLoopAlignment == 16)
+    {
+        allocMemFlag = CORJIT_ALLOCMEM_FLG_16BYTE_ALIGN;
+    }
+#endif // _TARGET_XARCH_
+
 #ifdef _TARGET_ARM64_
     // For arm64, we want to allocate JIT data always adjacent to code similar to what native compiler does.
     // This way allows us to use a single `ldr` to access such data like float constant/jmp table.
@@ -1212,6 +1212,8 @@ protected:
 
     void appendToCurIG(instrDesc* id);
 
+    void emitRemoveLastInstruction();
+
     /********************************************************************************************/
 
     struct instrDescJmp : instrDesc
@@ -1388,6 +1390,8 @@ protected:
     emitLocation   emitExitSeqBegLoc;
     UNATIVE_OFFSET emitExitSeqSize; // minimum size of any return sequence - the 'ret' after the epilog
 
+    unsigned emitMaxLoopAlignment; // largest boundary any loop in the method is aligned to, or 0
+
 #endif // _TARGET_XARCH_
 
     insGroup* emitPlaceholderList; // per method placeholder list - head
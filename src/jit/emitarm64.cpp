@@ -4477,6 +4477,137 @@ void emitter::emitIns_R_I_I(
     appendToCurIG(id);
 }
 
+//------------------------------------------------------------------------
+// emitTryCombineLdrStrPair: Try to combine an ldr or str with the previous
+//    instruction into a single ldp or stp.
+//
+// Arguments:
+//    ins  - INS_ldr or INS_str
+//    attr - size and GC type of reg1
+//    reg1 - the register loaded or stored
+//    reg2 - the base register
+//    imm  - the byte offset from the base register
+//
+// Return Value:
+//    true if the previous instruction was replaced by a pair that also performs this access.
+//
+// Notes:
+//    The previous instruction must be the same kind of access, of the same size and register
+//    class, off the same base register, to an adjacent location. It must also be in the current
+//    instruction group, so that nothing can branch in between the two.
+//
+bool emitter::emitTryCombineLdrStrPair(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, ssize_t imm)
+{
+    assert((ins == INS_ldr) || (ins == INS_str));
+
+    if (emitComp->opts.MinOpts() || emitComp->opts.compDbgCode)
+    {
+        return false;
+    }
+
+    // Prolog and epilog instructions have unwind codes tied to them.
+    if (emitIGisInProlog(emitCurIG) || emitIGisInEpilog(emitCurIG) || emitIGisInFuncletProlog(emitCurIG) ||
+        emitIGisInFuncletEpilog(emitCurIG))
+    {
+        return false;
+    }
+
+    instrDesc* prevId = emitLastIns;
+
+    if ((prevId == nullptr) || (emitCurIGinsCnt == 0) || (prevId->idIns() != ins) || prevId->idIsLclVar() ||
+        !insOptsNone(prevId->idInsOpt()))
+    {
+        return false;
+    }
+
+    insFormat prevFmt = prevId->idInsFmt();
+    if ((prevFmt != IF_LS_2A) && (prevFmt != IF_LS_2B) && (prevFmt != IF_LS_2C))
+    {
+        return false;
+    }
+
+    emitAttr  size     = EA_SIZE(attr);
+    regNumber prevReg1 = prevId->idReg1();
+
+    if ((prevId->idOpSize() != size) || (prevId->idReg2() != encodingSPtoZR(reg2)) ||
+        (isVectorRegister(prevReg1) != isVectorRegister(reg1)))
+    {
+        return false;
+    }
+
+    if (isVectorRegister(reg1) ? !isValidVectorLSPDatasize(size) : !isValidGeneralDatasize(size))
+    {
+        return false;
+    }
+
+    // The pair's first register is loaded before the base would be
+    // overwritten, but a pair can't load the same register twice.
+    if ((ins == INS_ldr) && ((prevReg1 == reg1) || (prevReg1 == reg2)))
+    {
+        return false;
+    }
+
+    const ssize_t accessSize = EA_SIZE_IN_BYTES(size);
+    ssize_t       prevImm    = 0;
+
+    if (prevFmt == IF_LS_2B)
+    {
+        prevImm = emitGetInsSC(prevId) * accessSize;
+    }
+    else if (prevFmt == IF_LS_2C)
+    {
+        prevImm = emitGetInsSC(prevId);
+    }
+
+    emitAttr prevAttr = size;
+    if (prevId->idGCref() == GCT_GCREF)
+    {
+        prevAttr = EA_GCREF;
+    }
+    else if (prevId->idGCref() == GCT_BYREF)
+    {
+        prevAttr = EA_BYREF;
+    }
+
+    regNumber firstReg;
+    regNumber secondReg;
+    emitAttr  firstAttr;
+    emitAttr  secondAttr;
+    ssize_t   pairImm;
+
+    if (imm == prevImm + accessSize)
+    {
+        firstReg   = prevReg1;
+        firstAttr  = prevAttr;
+        secondReg  = reg1;
+        secondAttr = attr;
+        pairImm    = prevImm;
+    }
+    else if (prevImm == imm + accessSize)
+    {
+        firstReg   = reg1;
+        firstAttr  = attr;
+        secondReg  = prevReg1;
+        secondAttr = prevAttr;
+        pairImm    = imm;
+    }
+    else
+    {
+        return false;
+    }
+
+    // The pair's offset is a signed 7-bit multiple of the access size.
+    if (((pairImm % accessSize) != 0) || ((pairImm / accessSize) < -64) || ((pairImm / accessSize) > 63))
+    {
+        return false;
+    }
+
+    emitRemoveLastInstruction();
+    emitIns_R_R_R_I((ins == INS_ldr) ? INS_ldp : INS_stp, firstAttr, firstReg, secondReg, reg2, pairImm, INS_OPTS_NONE,
+                    secondAttr);
+    return true;
+}
+
 /*****************************************************************************
  *
  *  Add an instruction referencing two registers and a constant.
@@ -4902,6 +5033,13 @@ void emitter::emitIns_R_R_I(
 
     } // end switch (ins)
 
+    // Adjacent accesses (e.g. to the fields of a promoted struct) can often use a single ldp/stp
+    if (((ins == INS_ldr) || (ins == INS_str)) && insOptsNone(opt) &&
+        emitTryCombineLdrStrPair(ins, attr, reg1, reg2, imm))
+    {
+        return;
+    }
+
     if (isLdSt)
     {
         assert(!isAddSub);
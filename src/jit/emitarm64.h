@@ -697,6 +697,9 @@ void emitIns_R_I_I(
 void emitIns_R_R_I(
     instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, ssize_t imm, insOpts opt = INS_OPTS_NONE);
 
+// Tries to combine an ldr/str with the previous instruction into an ldp/stp
+bool emitTryCombineLdrStrPair(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, ssize_t imm);
+
 // Checks for a large immediate that needs a second instruction
 void emitIns_R_R_Imm(instruction ins, emitAttr attr, regNumber reg1, regNumber reg2, ssize_t imm);
 
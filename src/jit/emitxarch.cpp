@@ -2374,17 +2374,29 @@ emitter::instrDesc* emitter::emitNewInstrAmdCns(emitAttr size, ssize_t dsp, int
  *  The next instruction will be a loop head entry point
  *  So insert a dummy instruction here to ensure that
  *  the x86 I-cache alignment rule is followed.
+ *
+ *  The next instruction is padded out to 'alignmentBoundary' (16 or 32 bytes),
+ *  unless that would take more than 'maxPadding' bytes of nops, in which case
+ *  no padding is emitted at all.
  */
 
-void emitter::emitLoopAlign()
+void emitter::emitLoopAlign(unsigned alignmentBoundary, unsigned maxPadding)
 {
+    assert((alignmentBoundary == 16) || (alignmentBoundary == 32));
+    assert((maxPadding > 0) && (maxPadding <= 15));
+
     /* Insert a pseudo-instruction to ensure that we align
        the next instruction properly */
 
-    instrDesc* id = emitNewInstrSmall(EA_1BYTE);
+    instrDesc* id = emitNewInstr(EA_1BYTE);
     id->idIns(INS_align);
-    id->idCodeSize(15); // We may need to skip up to 15 bytes of code
-    emitCurIGsize += 15;
+    id->idSmallCns(alignmentBoundary);
+    id->idCodeSize(maxPadding); // We may need to skip up to maxPadding bytes of code
+    emitCurIGsize += maxPadding;
+
+    // The padding is computed from the final code address, so the code
+    // block must be allocated at least this aligned (see emitEndCodeGen).
+    emitMaxLoopAlignment = max(emitMaxLoopAlignment, alignmentBoundary);
 }
 
 /*****************************************************************************
@@ -12389,9 +12401,14 @@ size_t emitter::emitOutputInstr(insGroup* ig, instrDesc* id, BYTE** dp)
             // the loop alignment pseudo instruction
             if (ins == INS_align)
             {
-                sz  = SMALL_IDSC_SIZE;
-                dst = emitOutputNOP(dst, (-(int)(size_t)dst) & 0x0f);
-                assert(((size_t)dst & 0x0f) == 0);
+                unsigned alignmentBoundary = id->idSmallCns();
+                unsigned padding           = (unsigned)(-(int)(size_t)dst) & (alignmentBoundary - 1);
+
+                if (padding <= id->idCodeSize())
+                {
+                    dst = emitOutputNOP(dst, padding);
+                    assert(((size_t)dst & (alignmentBoundary - 1)) == 0);
+                }
                 break;
             }
 
@@ -293,7 +293,7 @@ inline emitAttr emitDecodeScale(unsigned ensz)
 /************************************************************************/
 
 public:
-void emitLoopAlign();
+void emitLoopAlign(unsigned alignmentBoundary = 16, unsigned maxPadding = 15);
 
 void emitIns(instruction ins);
 
@@ -274,8 +274,13 @@ void Compiler::fgInstrumentMethod()
 
     if (!SUCCEEDED(res))
     {
+        if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0))
+        {
+            // Instrumented tier0 code can simply do without counts.
+            return;
+        }
         // The E_NOTIMPL status is returned when we are profiling a generic method from a different assembly
-        if (res == E_NOTIMPL)
+        else if (res == E_NOTIMPL)
         {
             // In such cases we still want to add the method entry callback node
 
@@ -336,6 +341,13 @@ void Compiler::fgInstrumentMethod()
         // Check that we allocated and initialized the same number of ProfileBuffer tuples
         noway_assert(countOfBlocks == 0);
 
+        // Counts collected by tier0 code are consumed by the tier1 compile of
+        // the method; the method entry callback is only needed for IBC.
+        if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0))
+        {
+            return;
+        }
+
         // Add the method entry callback node
 
         GenTree* arg;
@@ -5108,10 +5120,67 @@ void Compiler::fgMarkBackwardJump(BasicBlock* startBlock, BasicBlock* endBlock)
         if ((block->bbFlags & BBF_BACKWARD_JUMP) == 0)
         {
             block->bbFlags |= BBF_BACKWARD_JUMP;
+            compHasBackwardJump = true;
         }
     }
 }
 
+//------------------------------------------------------------------------
+// fgCanSwitchToOptimized: Determines if conditions are met to allow switching the opt level to optimized
+//
+// Return Value:
+//    True if the opt level may be switched from tier 0 to optimized, false otherwise
+//
+// Assumptions:
+//    - compInitOptions() has been called
+//    - compSetOptimizationLevel() has not been called
+//
+// Notes:
+//    This method is to be called at some point before compSetOptimizationLevel() to determine if the opt level may be
+//    changed based on information gathered in early phases.
+
+bool Compiler::fgCanSwitchToOptimized()
+{
+    bool result = opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_MIN_OPT) &&
+                  !opts.compDbgCode && !compIsForInlining();
+    if (result)
+    {
+        // Ensure that it would be safe to change the opt level
+        assert(opts.compFlags == CLFLG_MINOPT);
+        assert(!opts.IsMinOptsSet());
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------
+// fgSwitchToOptimized: Switch the opt level from tier 0 to optimized
+//
+// Assumptions:
+//    - fgCanSwitchToOptimized() is true
+//    - compSetOptimizationLevel() has not been called
+//
+// Notes:
+//    This method is to be called at some point before compSetOptimizationLevel() to switch the opt level to optimized
+//    based on information gathered in early phases. The runtime is told about the switch so that it does not try to
+//    promote the resulting code to tier 1.
+
+void Compiler::fgSwitchToOptimized()
+{
+    assert(fgCanSwitchToOptimized());
+
+    // Switch to optimized and re-init options
+    JITDUMP("****\n**** JIT Tier0 jit request switching to optimized code because of loop\n****\n");
+    assert(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0));
+    opts.jitFlags->Clear(JitFlags::JIT_FLAG_TIER0);
+    opts.jitFlags->Clear(JitFlags::JIT_FLAG_BBINSTR);
+
+    compInitOptions(opts.jitFlags);
+
+    // Notify the VM of the change
+    info.compCompHnd->setMethodAttribs(info.compMethodHnd, CORINFO_FLG_SWITCHED_TO_OPTIMIZED);
+}
+
 /*****************************************************************************
  *
  *  Finally link up the bbJumpDest of the blocks together
@@ -9778,6 +9847,187 @@ void Compiler::fgRemoveEmptyBlocks()
 #endif // DEBUG
 }
 
+//------------------------------------------------------------------------
+// fgGetMergeableThrowCall: see if a block just throws via a call to a
+//    method that does not return, and so might be merged with other blocks
+//    that throw the same way.
+//
+// Arguments:
+//    block - block to examine
+//
+// Return Value:
+//    The no-return call, or nullptr if the block is not a candidate.
+
+GenTreeCall* Compiler::fgGetMergeableThrowCall(BasicBlock* block)
+{
+    if ((block->bbJumpKind != BBJ_THROW) || (block == fgFirstBB) || ((block->bbFlags & BBF_DONT_REMOVE) != 0))
+    {
+        return nullptr;
+    }
+
+    // The shared range check failure blocks are already unique, and are
+    // reached without flow graph edges.
+    if (fgIsThrowHlpBlk(block))
+    {
+        return nullptr;
+    }
+
+    if ((block->bbCatchTyp != BBCT_NONE) || bbIsTryBeg(block))
+    {
+        return nullptr;
+    }
+
+    GenTreeStmt* stmt = block->firstStmt();
+    if ((stmt == nullptr) || (stmt != block->lastStmt()))
+    {
+        return nullptr;
+    }
+
+    GenTree* tree = stmt->gtStmtExpr;
+    if (!tree->IsCall())
+    {
+        return nullptr;
+    }
+
+    GenTreeCall* call = tree->AsCall();
+    if (!call->IsNoReturn() || call->IsTailCall())
+    {
+        return nullptr;
+    }
+
+    return call;
+}
+
+//------------------------------------------------------------------------
+// fgTailMergeThrows: merge blocks that throw via identical calls to
+//    methods that do not return.
+//
+// Notes:
+//    Throw helper methods are marked as not returning when the inliner
+//    sees they have no return blocks, and morph turns the blocks that call
+//    them into BBJ_THROW blocks. Methods that validate several arguments
+//    often end up with many such blocks making the same call with the same
+//    arguments, all but one of which are redundant.
+//
+//    Here we redirect the predecessors of the duplicates to a single
+//    canonical block. The duplicates then become unreachable and are
+//    removed by the subsequent flow graph cleanup.
+//
+//    Predecessors that fall through into a duplicate under a conditional
+//    branch are left alone, since redirecting them would need a new block.
+
+void Compiler::fgTailMergeThrows()
+{
+    noway_assert(fgComputePredsDone);
+
+    JITDUMP("\n*************** In fgTailMergeThrows\n");
+
+    if (opts.MinOpts() || opts.compDbgCode || (JitConfig.JitEnableTailMergeThrows() == 0))
+    {
+        JITDUMP("Tail merging of throws is disabled\n");
+        return;
+    }
+
+    // Most methods have just a few throw blocks, so a simple
+    // list of the canonical blocks seen so far suffices.
+    ArrayStack<BasicBlock*> canonicalBlocks(getAllocator(CMK_ArrayStack));
+    ArrayStack<BasicBlock*> predBlocks(getAllocator(CMK_ArrayStack));
+    unsigned                updateCount = 0;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        GenTreeCall* call = fgGetMergeableThrowCall(block);
+
+        if (call == nullptr)
+        {
+            continue;
+        }
+
+        BasicBlock* canonicalBlock = nullptr;
+
+        for (int i = 0; i < canonicalBlocks.Height(); i++)
+        {
+            BasicBlock* candidate = canonicalBlocks.Index(i);
+
+            if (BasicBlock::sameEHRegion(candidate, block) &&
+                GenTree::Compare(candidate->firstStmt()->gtStmtExpr, call))
+            {
+                canonicalBlock = candidate;
+                break;
+            }
+        }
+
+        if (canonicalBlock == nullptr)
+        {
+            canonicalBlocks.Push(block);
+            continue;
+        }
+
+        JITDUMP("\n" FMT_BB " throws the same way as " FMT_BB "\n", block->bbNum, canonicalBlock->bbNum);
+
+        // Updating the flow graph modifies the pred list, so walk a copy.
+        predBlocks.Reset();
+        for (flowList* pred = block->bbPreds; pred != nullptr; pred = pred->flNext)
+        {
+            predBlocks.Push(pred->flBlock);
+        }
+
+        for (int i = 0; i < predBlocks.Height(); i++)
+        {
+            BasicBlock* predBlock = predBlocks.Index(i);
+
+            switch (predBlock->bbJumpKind)
+            {
+                case BBJ_NONE:
+                    assert(predBlock->bbNext == block);
+                    predBlock->bbJumpKind = BBJ_ALWAYS;
+                    __fallthrough;
+
+                case BBJ_ALWAYS:
+                case BBJ_COND:
+                    // The BBJ_ALWAYS half of a call finally pair has to stay as is.
+                    if ((predBlock->bbFlags & BBF_KEEP_BBJ_ALWAYS) != 0)
+                    {
+                        break;
+                    }
+
+                    if ((predBlock->bbJumpKind == BBJ_ALWAYS) || (predBlock->bbJumpDest == block))
+                    {
+                        JITDUMP("  redirecting " FMT_BB " to " FMT_BB "\n", predBlock->bbNum, canonicalBlock->bbNum);
+                        predBlock->bbJumpDest = canonicalBlock;
+                        fgRemoveRefPred(block, predBlock);
+                        fgAddRefPred(canonicalBlock, predBlock);
+                        updateCount++;
+                    }
+                    break;
+
+                case BBJ_SWITCH:
+                    JITDUMP("  redirecting switch " FMT_BB " to " FMT_BB "\n", predBlock->bbNum,
+                            canonicalBlock->bbNum);
+                    fgReplaceSwitchJumpTarget(predBlock, canonicalBlock, block);
+                    updateCount++;
+                    break;
+
+                default:
+                    // Leave other kinds of flow (e.g. EH flow) alone.
+                    break;
+            }
+        }
+
+        canonicalBlock->bbFlags |= (BBF_JMP_TARGET | BBF_HAS_LABEL);
+    }
+
+    JITDUMP("\n%u predecessor edges redirected to shared throw blocks\n", updateCount);
+
+#ifdef DEBUG
+    if (verbose && (updateCount > 0))
+    {
+        fgDispBasicBlocks();
+    }
+    fgDebugCheckBBlist();
+#endif // DEBUG
+}
+
 /*****************************************************************************
  *
  * Remove a useless statement from a basic block.
@@ -22405,7 +22655,9 @@ Compiler::fgWalkResult Compiler::fgLateDevirtualization(GenTree** pTree, fgWalkD
             CORINFO_METHOD_HANDLE  method      = call->gtCallMethHnd;
             unsigned               methodFlags = 0;
             CORINFO_CONTEXT_HANDLE context     = nullptr;
-            comp->impDevirtualizeCall(call, &method, &methodFlags, &context, nullptr);
+
+            const bool isLateDevirtualization = true;
+            comp->impDevirtualizeCall(call, &method, &methodFlags, &context, nullptr, isLateDevirtualization);
         }
     }
 
@@ -25797,6 +26049,390 @@ private:
     Compiler* compiler;
 };
 
+// GuardedDevirtualizationTransformer expands virtual and interface calls
+// that were marked as guarded devirtualization candidates by the importer.
+//
+// The importer guesses a class for the 'this' object of the call and marks
+// the method that class would invoke as an inline candidate. The jit then
+// checks the method table of 'this' against the guessed class, and makes a
+// direct (and inlineable) call if it matches, or the original virtual call
+// if it does not.
+//
+// before:
+//   current block
+//   {
+//     previous statements
+//     transforming statement
+//     {
+//       call with GTF_CALL_M_GUARDED_DEVIRT flag set
+//     }
+//     subsequent statements
+//   }
+//
+// after:
+//   current block
+//   {
+//     previous statements
+//     spill 'this' (and, if needed, the args) to temps
+//   } BBJ_NONE check block
+//   check block
+//   {
+//     jump to else if the method table of 'this' is not the guessed class.
+//   } BBJ_COND then block, else block
+//   then block
+//   {
+//     direct call to the guessed method, an inline candidate
+//     return temp = ret_expr of the direct call
+//   } BBJ_ALWAYS remainder block
+//   else block
+//   {
+//     return temp = original virtual call
+//   } BBJ_NONE remainder block
+//   remainder block
+//   {
+//     subsequent statements, with the ret_expr of the original call
+//     replaced by the return temp
+//   }
+//
+class GuardedDevirtualizationTransformer
+{
+public:
+    GuardedDevirtualizationTransformer(Compiler* compiler) : compiler(compiler)
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Run: run transformation for each block.
+    //
+    void Run()
+    {
+        for (BasicBlock* block = compiler->fgFirstBB; block != nullptr; block = block->bbNext)
+        {
+            TransformBlock(block);
+        }
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // TransformBlock: look through statements and transform statements with
+    // guarded devirtualization candidates.
+    //
+    // Notes:
+    //    Candidates that did not end up as inline candidates at the root of
+    //    their statement are not worth guarding and are left as they are.
+    //
+    void TransformBlock(BasicBlock* block)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt != nullptr; stmt = stmt->gtNextStmt)
+        {
+            GenTree* expr = stmt->gtStmtExpr;
+
+            if (expr->IsCall() && expr->AsCall()->IsGuardedDevirtualizationCandidate() &&
+                expr->AsCall()->IsInlineCandidate())
+            {
+                StatementTransformer stmtTransformer(compiler, block, stmt);
+                stmtTransformer.Run();
+            }
+            else
+            {
+                compiler->fgWalkTreePre(&stmt->gtStmtExpr, ClearCandidateVisitor);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // ClearCandidateVisitor: callback to clear the candidacy of guarded
+    // devirtualization candidates that are not transformed.
+    //
+    static Compiler::fgWalkResult ClearCandidateVisitor(GenTree** pTree, Compiler::fgWalkData* data)
+    {
+        GenTree* tree = *pTree;
+        if (tree->IsCall() && tree->AsCall()->IsGuardedDevirtualizationCandidate())
+        {
+            assert(!tree->AsCall()->IsInlineCandidate());
+            tree->AsCall()->ClearGuardedDevirtualizationCandidate();
+        }
+        return Compiler::WALK_CONTINUE;
+    }
+
+    class StatementTransformer
+    {
+    public:
+        StatementTransformer(Compiler* compiler, BasicBlock* block, GenTreeStmt* stmt)
+            : compiler(compiler), currBlock(block), stmt(stmt)
+        {
+            remainderBlock = nullptr;
+            checkBlock     = nullptr;
+            thenBlock      = nullptr;
+            elseBlock      = nullptr;
+            origCall       = stmt->gtStmtExpr->AsCall();
+            inlineInfo     = origCall->gtInlineCandidateInfo;
+            returnTemp     = BAD_VAR_NUM;
+            thisTemp       = BAD_VAR_NUM;
+        }
+
+        //------------------------------------------------------------------------
+        // Run: transform the statement as described above.
+        //
+        void Run()
+        {
+            JITDUMP("\n----- Guarded devirtualization of call [%06u] in " FMT_BB "\n", compiler->dspTreeID(origCall),
+                    currBlock->bbNum);
+
+            SpillOperands();
+            FixupRetExpr();
+            CreateRemainder();
+            CreateCheck();
+            CreateThen();
+            CreateElse();
+
+            RemoveOldStatement();
+            SetWeights();
+            ChainFlow();
+        }
+
+    private:
+        //------------------------------------------------------------------------
+        // SpillOperands: evaluate 'this' into a temp at the end of the current
+        // block, so that it can be used by both the check and the calls.
+        //
+        // Notes:
+        //    The check dereferences 'this' ahead of the args, so if any arg has
+        //    side effects, the args are evaluated into temps first as well, to
+        //    keep their side effects ahead of any null reference exception.
+        //
+        void SpillOperands()
+        {
+            bool spillArgs = false;
+            for (GenTreeArgList* args = origCall->gtCallArgs; args != nullptr; args = args->Rest())
+            {
+                if ((args->Current()->gtFlags & GTF_SIDE_EFFECT) != 0)
+                {
+                    spillArgs = true;
+                    break;
+                }
+            }
+
+            GenTree* thisTree = origCall->gtCallObjp;
+            thisTemp          = compiler->lvaGrabTemp(true DEBUGARG("guarded devirt this temp"));
+            InsertAtEndOfCurrBlock(compiler->gtNewTempAssign(thisTemp, thisTree));
+            compiler->lvaSetClass(thisTemp, thisTree);
+            origCall->gtCallObjp = compiler->gtNewLclvNode(thisTemp, TYP_REF);
+
+            if (spillArgs)
+            {
+                for (GenTreeArgList* args = origCall->gtCallArgs; args != nullptr; args = args->Rest())
+                {
+                    GenTree* arg = args->Current();
+                    if (arg->OperIsConst())
+                    {
+                        continue;
+                    }
+
+                    const unsigned argTemp = compiler->lvaGrabTemp(true DEBUGARG("guarded devirt arg temp"));
+                    InsertAtEndOfCurrBlock(compiler->gtNewTempAssign(argTemp, arg));
+                    args->Current() = compiler->gtNewLclvNode(argTemp, genActualType(arg->TypeGet()));
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // FixupRetExpr: redirect the uses of the original call's result to
+        // the return temp, which both calls will assign.
+        //
+        void FixupRetExpr()
+        {
+            if (origCall->TypeGet() == TYP_VOID)
+            {
+                return;
+            }
+
+            returnTemp = compiler->lvaGrabTemp(false DEBUGARG("guarded devirt return temp"));
+            compiler->lvaTable[returnTemp].lvType = genActualType(origCall->TypeGet());
+
+            GenTree* retExpr = inlineInfo->retExpr;
+            assert((retExpr != nullptr) && retExpr->OperIs(GT_RET_EXPR));
+            JITDUMP("Updating [%06u] to refer to return temp V%02u\n", compiler->dspTreeID(retExpr), returnTemp);
+            retExpr->ReplaceWith(compiler->gtNewLclvNode(returnTemp, genActualType(origCall->TypeGet())), compiler);
+        }
+
+        //------------------------------------------------------------------------
+        // CreateRemainder: split current block at the candidate stmt and
+        // insert statements after the call into remainderBlock.
+        //
+        void CreateRemainder()
+        {
+            remainderBlock          = compiler->fgSplitBlockAfterStatement(currBlock, stmt);
+            unsigned propagateFlags = currBlock->bbFlags & BBF_GC_SAFE_POINT;
+            remainderBlock->bbFlags |= BBF_JMP_TARGET | BBF_HAS_LABEL | propagateFlags;
+        }
+
+        //------------------------------------------------------------------------
+        // CreateCheck: create check block, that compares the method table of
+        // 'this' with the guessed class.
+        //
+        void CreateCheck()
+        {
+            checkBlock            = CreateAndInsertBasicBlock(BBJ_COND, currBlock);
+            GenTree* thisLcl      = compiler->gtNewLclvNode(thisTemp, TYP_REF);
+            GenTree* methodTable  = compiler->gtNewIndir(TYP_I_IMPL, thisLcl);
+            GenTree* guessedClass = compiler->gtNewIconEmbClsHndNode(inlineInfo->guardedClassHandle);
+            GenTree* compare      = compiler->gtNewOperNode(GT_NE, TYP_INT, methodTable, guessedClass);
+            GenTree* jmpTree      = compiler->gtNewOperNode(GT_JTRUE, TYP_VOID, compare);
+            GenTree* jmpStmt      = compiler->fgNewStmtFromTree(jmpTree, stmt->gtStmtILoffsx);
+            compiler->fgInsertStmtAtEnd(checkBlock, jmpStmt);
+        }
+
+        //------------------------------------------------------------------------
+        // CreateThen: create then block, that makes a direct call to the
+        // guessed method when the class check succeeds.
+        //
+        void CreateThen()
+        {
+            thenBlock = CreateAndInsertBasicBlock(BBJ_ALWAYS, checkBlock);
+
+            // 'this' is known to be exactly the guessed class here.
+            const unsigned exactThisTemp = compiler->lvaGrabTemp(true DEBUGARG("guarded devirt exact this temp"));
+            GenTree*       thisLcl       = compiler->gtNewLclvNode(thisTemp, TYP_REF);
+            InsertAtEnd(thenBlock, compiler->gtNewTempAssign(exactThisTemp, thisLcl));
+            compiler->lvaSetClass(exactThisTemp, inlineInfo->guardedClassHandle, true);
+
+            GenTreeCall* call = compiler->gtCloneExpr(origCall)->AsCall();
+            call->gtCallObjp  = compiler->gtNewLclvNode(exactThisTemp, TYP_REF);
+
+            // Make the call direct.
+            call->gtFlags &= ~(GTF_CALL_VIRT_VTABLE | GTF_CALL_VIRT_STUB);
+            call->gtCallMoreFlags &= ~(GTF_CALL_M_GUARDED_DEVIRT | GTF_CALL_M_VIRTSTUB_REL_INDIRECT);
+            call->gtCallMoreFlags &= ~GTF_CALL_M_IMPLICIT_TAILCALL;
+            call->gtCallMoreFlags |= GTF_CALL_M_DEVIRTUALIZED;
+            call->gtCallMethHnd         = inlineInfo->guardedMethodHandle;
+            call->gtCallType            = CT_USER_FUNC;
+            call->gtInlineCandidateInfo = inlineInfo;
+            call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
+
+            InsertAtEnd(thenBlock, call);
+
+            if (returnTemp != BAD_VAR_NUM)
+            {
+                GenTree* retExpr = compiler->gtNewInlineCandidateReturnExpr(call, genActualType(call->TypeGet()));
+                inlineInfo->retExpr = retExpr;
+                InsertAtEnd(thenBlock, compiler->gtNewTempAssign(returnTemp, retExpr));
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // CreateElse: create else block, that makes the original virtual call
+        // when the class check fails.
+        //
+        void CreateElse()
+        {
+            elseBlock = CreateAndInsertBasicBlock(BBJ_NONE, thenBlock);
+
+            GenTreeCall* call = origCall;
+            call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+            call->gtCallMoreFlags &= ~GTF_CALL_M_IMPLICIT_TAILCALL;
+            call->ClearGuardedDevirtualizationCandidate();
+
+            if (returnTemp != BAD_VAR_NUM)
+            {
+                InsertAtEnd(elseBlock, compiler->gtNewTempAssign(returnTemp, call));
+            }
+            else
+            {
+                InsertAtEnd(elseBlock, call);
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // CreateAndInsertBasicBlock: ask compiler to create new basic block.
+        // and insert in into the basic block list.
+        //
+        // Arguments:
+        //    jumpKind - jump kind for the new basic block
+        //    insertAfter - basic block, after which compiler has to insert the new one.
+        //
+        // Return Value:
+        //    new basic block.
+        BasicBlock* CreateAndInsertBasicBlock(BBjumpKinds jumpKind, BasicBlock* insertAfter)
+        {
+            BasicBlock* block = compiler->fgNewBBafter(jumpKind, insertAfter, true);
+            if ((insertAfter->bbFlags & BBF_INTERNAL) == 0)
+            {
+                block->bbFlags &= ~BBF_INTERNAL;
+                block->bbFlags |= BBF_IMPORTED;
+            }
+            block->bbFlags |= currBlock->bbFlags & BBF_BACKWARD_JUMP;
+            return block;
+        }
+
+        //------------------------------------------------------------------------
+        // InsertAtEnd: append a statement for the tree to the block.
+        //
+        void InsertAtEnd(BasicBlock* block, GenTree* tree)
+        {
+            GenTreeStmt* newStmt = compiler->fgNewStmtFromTree(tree, stmt->gtStmtILoffsx);
+            compiler->fgInsertStmtAtEnd(block, newStmt);
+        }
+
+        //------------------------------------------------------------------------
+        // InsertAtEndOfCurrBlock: insert a statement for the tree just before
+        // the candidate statement, which ends up last in the current block.
+        //
+        void InsertAtEndOfCurrBlock(GenTree* tree)
+        {
+            GenTreeStmt* newStmt = compiler->fgNewStmtFromTree(tree, stmt->gtStmtILoffsx);
+            compiler->fgInsertStmtBefore(currBlock, stmt, newStmt);
+        }
+
+        //------------------------------------------------------------------------
+        // RemoveOldStatement: remove original stmt from current block.
+        //
+        void RemoveOldStatement()
+        {
+            // The original call now lives in the else block.
+            stmt->gtStmtExpr = compiler->gtNewNothingNode();
+            compiler->fgRemoveStmt(currBlock, stmt);
+        }
+
+        //------------------------------------------------------------------------
+        // SetWeights: set weights for new blocks.
+        //
+        void SetWeights()
+        {
+            remainderBlock->inheritWeight(currBlock);
+            checkBlock->inheritWeight(currBlock);
+            thenBlock->inheritWeightPercentage(currBlock, HIGH_PROBABILITY);
+            elseBlock->inheritWeightPercentage(currBlock, 100 - HIGH_PROBABILITY);
+        }
+
+        //------------------------------------------------------------------------
+        // ChainFlow: link new blocks into correct cfg.
+        //
+        void ChainFlow()
+        {
+            assert(!compiler->fgComputePredsDone);
+            checkBlock->bbJumpDest = elseBlock;
+            thenBlock->bbJumpDest  = remainderBlock;
+        }
+
+        Compiler*            compiler;
+        BasicBlock*          currBlock;
+        BasicBlock*          remainderBlock;
+        BasicBlock*          checkBlock;
+        BasicBlock*          thenBlock;
+        BasicBlock*          elseBlock;
+        GenTreeStmt*         stmt;
+        GenTreeCall*         origCall;
+        InlineCandidateInfo* inlineInfo;
+        unsigned             returnTemp;
+        unsigned             thisTemp;
+
+        const int HIGH_PROBABILITY = 80;
+    };
+
+    Compiler* compiler;
+};
+
 #ifdef DEBUG
 
 //------------------------------------------------------------------------
@@ -25842,6 +26478,17 @@ void Compiler::fgTransformFatCalli()
 #endif
 }
 
+//------------------------------------------------------------------------
+// fgTransformGuardedDevirtualizationCandidates: expand guarded
+// devirtualization candidates into a class check and two calls.
+//
+void Compiler::fgTransformGuardedDevirtualizationCandidates()
+{
+    GuardedDevirtualizationTransformer guardedDevirtualizationTransformer(this);
+    guardedDevirtualizationTransformer.Run();
+    clearMethodHasGuardedDevirtualization();
+}
+
 //------------------------------------------------------------------------
 // fgMeasureIR: count and return the number of IR nodes in the function.
 //
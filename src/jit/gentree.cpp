@@ -884,6 +884,28 @@ bool GenTreeCall::IsPure(Compiler* compiler) const
            compiler->s_helperCallProperties.IsPure(compiler->eeGetHelperNum(gtCallMethHnd));
 }
 
+//-------------------------------------------------------------------------
+// ClearGuardedDevirtualizationCandidate:
+//    Drops the guarded devirtualization candidacy of this call, restoring
+//    the stub address of virtual stub calls (which shares storage with the
+//    candidate info).
+//
+void GenTreeCall::ClearGuardedDevirtualizationCandidate()
+{
+    assert(IsGuardedDevirtualizationCandidate());
+
+    if (IsVirtualStub())
+    {
+        gtStubCallStubAddr = gtGuardedDevirtualizationCandidateInfo->stubAddr;
+    }
+    else
+    {
+        gtInlineCandidateInfo = nullptr;
+    }
+
+    gtCallMoreFlags &= ~GTF_CALL_M_GUARDED_DEVIRT;
+}
+
 //-------------------------------------------------------------------------
 // HasSideEffects:
 //    Returns true if this call has any side effects. All non-helpers are considered to have side-effects. Only helpers
@@ -16143,11 +16165,18 @@ CORINFO_CLASS_HANDLE Compiler::gtGetClassHandle(GenTree* tree, bool* isExact, bo
 
             if (fieldHnd != nullptr)
             {
-                CORINFO_CLASS_HANDLE fieldClass   = nullptr;
-                CorInfoType          fieldCorType = info.compCompHnd->getFieldType(fieldHnd, &fieldClass);
-                if (fieldCorType == CORINFO_TYPE_CLASS)
+                if (obj->gtField.gtFldObj == nullptr)
+                {
+                    objClass = gtGetStaticFieldClassHandle(fieldHnd, isExact, isNonNull);
+                }
+                else
                 {
-                    objClass = fieldClass;
+                    CORINFO_CLASS_HANDLE fieldClass   = nullptr;
+                    CorInfoType          fieldCorType = info.compCompHnd->getFieldType(fieldHnd, &fieldClass);
+                    if (fieldCorType == CORINFO_TYPE_CLASS)
+                    {
+                        objClass = fieldClass;
+                    }
                 }
             }
 
@@ -16324,13 +16353,7 @@ CORINFO_CLASS_HANDLE Compiler::gtGetClassHandle(GenTree* tree, bool* isExact, bo
                                 fieldSeq = fieldSeq->m_next;
                             }
 
-                            CORINFO_FIELD_HANDLE fieldHnd     = fieldSeq->m_fieldHnd;
-                            CORINFO_CLASS_HANDLE fieldClass   = nullptr;
-                            CorInfoType          fieldCorType = info.compCompHnd->getFieldType(fieldHnd, &fieldClass);
-                            if (fieldCorType == CORINFO_TYPE_CLASS)
-                            {
-                                objClass = fieldClass;
-                            }
+                            objClass = gtGetStaticFieldClassHandle(fieldSeq->m_fieldHnd, isExact, isNonNull);
                         }
                     }
                 }
@@ -16513,6 +16536,49 @@ CORINFO_CLASS_HANDLE Compiler::gtGetArrayElementClassHandle(GenTree* array)
     return nullptr;
 }
 
+//------------------------------------------------------------------------
+// gtGetStaticFieldClassHandle: find class handle for a ref type static field
+//
+// Arguments:
+//    fieldHnd -- handle for the static field
+//    isExact -- [OUT] true if the returned class is exact
+//    isNonNull -- [OUT] true if the field is known to be non-null
+//
+// Return Value:
+//    nullptr if the field is not of ref type, otherwise the class handle.
+//
+// Notes:
+//    If the field is readonly and its class has already been initialized,
+//    the runtime can tell us the exact type of the object it refers to.
+//    This is common for tier1 rejits, where the class constructor has
+//    usually run by the time the method is recompiled, and enables
+//    devirtualization of calls made through such fields.
+
+CORINFO_CLASS_HANDLE Compiler::gtGetStaticFieldClassHandle(CORINFO_FIELD_HANDLE fieldHnd, bool* isExact, bool* isNonNull)
+{
+    CORINFO_CLASS_HANDLE fieldClass   = nullptr;
+    CorInfoType          fieldCorType = info.compCompHnd->getFieldType(fieldHnd, &fieldClass);
+
+    if (fieldCorType != CORINFO_TYPE_CLASS)
+    {
+        return nullptr;
+    }
+
+    bool                 isSpeculative = true;
+    CORINFO_CLASS_HANDLE currentClass  = info.compCompHnd->getStaticFieldCurrentClass(fieldHnd, &isSpeculative);
+
+    if ((currentClass != nullptr) && !isSpeculative)
+    {
+        JITDUMP("Static readonly field %s currently refers to an instance of %s\n", eeGetFieldName(fieldHnd),
+                eeGetClassName(currentClass));
+        *isExact   = true;
+        *isNonNull = true;
+        return currentClass;
+    }
+
+    return fieldClass;
+}
+
 //------------------------------------------------------------------------
 // gtIsGCStaticBaseHelperCall: true if tree is fetching the gc static base
 //    for a subsequent static field access
@@ -146,6 +146,7 @@ enum gtCallTypes : BYTE
 struct BasicBlock;
 
 struct InlineCandidateInfo;
+struct GuardedDevirtualizationCandidateInfo;
 
 typedef unsigned short AssertionIndex;
 
@@ -3539,6 +3540,9 @@ struct GenTreeCall final : public GenTree
                                                     // the comma result is unused.
 #define GTF_CALL_M_DEVIRTUALIZED         0x00040000 // GT_CALL -- this call was devirtualized
 #define GTF_CALL_M_UNBOXED               0x00080000 // GT_CALL -- this call was optimized to use the unboxed entry point
+#define GTF_CALL_M_GUARDED_DEVIRT        0x00100000 // GT_CALL -- this call is a candidate for guarded devirtualization
+#define GTF_CALL_M_SUPPRESS_GC_TRANSITION 0x00200000 // GT_CALL -- inline pinvoke that does not transition to preemptive
+                                                     //            mode and does not use the InlinedCallFrame
 
     // clang-format on
 
@@ -3627,6 +3631,18 @@ struct GenTreeCall final : public GenTree
         return (gtCallMoreFlags & GTF_CALL_M_PINVOKE) != 0;
     }
 
+    // Returns true if this is an inline pinvoke that the VM has flagged as CORINFO_FLG_SUPPRESS_GC_TRANSITION.
+    bool IsSuppressGCTransition() const
+    {
+        return (gtCallMoreFlags & GTF_CALL_M_SUPPRESS_GC_TRANSITION) != 0;
+    }
+
+    // Returns true if this is an inline pinvoke that needs the InlinedCallFrame and the GC transition.
+    bool IsUnmanagedWithGCTransition() const
+    {
+        return IsUnmanaged() && !IsSuppressGCTransition();
+    }
+
     // Note that the distinction of whether tail prefixed or an implicit tail call
     // is maintained on a call node till fgMorphCall() after which it will be
     // either a tail call (i.e. IsTailCall() is true) or a non-tail call.
@@ -3755,6 +3771,18 @@ struct GenTreeCall final : public GenTree
         return (gtCallMoreFlags & GTF_CALL_M_UNBOXED) != 0;
     }
 
+    bool IsGuardedDevirtualizationCandidate() const
+    {
+        return (gtCallMoreFlags & GTF_CALL_M_GUARDED_DEVIRT) != 0;
+    }
+
+    void SetGuardedDevirtualizationCandidate()
+    {
+        gtCallMoreFlags |= GTF_CALL_M_GUARDED_DEVIRT;
+    }
+
+    void ClearGuardedDevirtualizationCandidate();
+
     unsigned gtCallMoreFlags; // in addition to gtFlags
 
     unsigned char gtCallType : 3;   // value from the gtCallTypes enumeration
@@ -3767,6 +3795,11 @@ struct GenTreeCall final : public GenTree
         GenTree* gtCallCookie;
         // gtInlineCandidateInfo is only used when inlining methods
         InlineCandidateInfo*   gtInlineCandidateInfo;
+
+        // gtGuardedDevirtualizationCandidateInfo is only used for GTF_CALL_M_GUARDED_DEVIRT calls; it
+        // aliases gtInlineCandidateInfo once the call also becomes an inline candidate
+        GuardedDevirtualizationCandidateInfo* gtGuardedDevirtualizationCandidateInfo;
+
         void*                  gtStubCallStubAddr;              // GTF_CALL_VIRT_STUB - these are never inlined
         CORINFO_GENERIC_HANDLE compileTimeHelperArgumentHandle; // Used to track type handle argument of dynamic helpers
         void*                  gtDirectCallAddress; // Used to pass direct call address between lower and codegen
@@ -1950,6 +1950,9 @@ GenTree* Compiler::getRuntimeContextTree(CORINFO_RUNTIME_LOOKUP_KIND kind)
       2b. pLookup->testForNull == true : Dereference the instantiation-specific handle.
           If it is non-NULL, it is the handle required. Else, call a helper
           to lookup the handle.
+      2c. pLookup->sizeOffset != CORINFO_NO_SIZE_CHECK : As 2b, but the dictionary may
+          be too small to hold the slot, so only dereference the slot if its offset is
+          below the size stored in the dictionary, else call the helper.
  */
 
 GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken,
@@ -1990,7 +1993,8 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
                                    nullptr DEBUGARG("impRuntimeLookup slot"));
     }
 
-    GenTree* indOffTree = nullptr;
+    GenTree* indOffTree    = nullptr;
+    GenTree* lastIndOfTree = nullptr;
 
     // Applied repeated indirections
     for (WORD i = 0; i < pRuntimeLookup->indirections; i++)
@@ -2001,11 +2005,18 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
                                       nullptr DEBUGARG("impRuntimeLookup indirectOffset"));
         }
 
+        // The dictionary pointer loaded by the last indirection is replaced when the dictionary grows
+        bool isLastIndirectionWithSizeCheck =
+            (i == pRuntimeLookup->indirections - 1) && (pRuntimeLookup->sizeOffset != CORINFO_NO_SIZE_CHECK);
+
         if (i != 0)
         {
             slotPtrTree = gtNewOperNode(GT_IND, TYP_I_IMPL, slotPtrTree);
             slotPtrTree->gtFlags |= GTF_IND_NONFAULTING;
-            slotPtrTree->gtFlags |= GTF_IND_INVARIANT;
+            if (!isLastIndirectionWithSizeCheck)
+            {
+                slotPtrTree->gtFlags |= GTF_IND_INVARIANT;
+            }
         }
 
         if ((i == 1 && pRuntimeLookup->indirectFirstOffset) || (i == 2 && pRuntimeLookup->indirectSecondOffset))
@@ -2013,6 +2024,12 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
             slotPtrTree = gtNewOperNode(GT_ADD, TYP_I_IMPL, indOffTree, slotPtrTree);
         }
 
+        if (isLastIndirectionWithSizeCheck)
+        {
+            lastIndOfTree = impCloneExpr(slotPtrTree, &slotPtrTree, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL,
+                                         nullptr DEBUGARG("impRuntimeLookup dictionary"));
+        }
+
         if (pRuntimeLookup->offsets[i] != 0)
         {
             slotPtrTree =
@@ -2023,6 +2040,9 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
     // No null test required
     if (!pRuntimeLookup->testForNull)
     {
+        // Dictionaries only grow for slots that are tested for null
+        assert(pRuntimeLookup->sizeOffset == CORINFO_NO_SIZE_CHECK);
+
         if (pRuntimeLookup->indirections == 0)
         {
             return slotPtrTree;
@@ -2072,8 +2092,35 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
     GenTree* handle = gtNewOperNode(GT_IND, TYP_I_IMPL, slotPtrTree);
     handle->gtFlags |= GTF_IND_NONFAULTING;
 
-    GenTree* handleCopy = impCloneExpr(handle, &handle, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL,
-                                       nullptr DEBUGARG("impRuntimeLookup typehandle"));
+    GenTree* handleCopy;
+    if (pRuntimeLookup->sizeOffset != CORINFO_NO_SIZE_CHECK)
+    {
+        assert(lastIndOfTree != nullptr);
+
+        // The slot may lie beyond the end of a dictionary that was allocated before the layout grew, so
+        // treat it as empty unless its offset is below the size stored in the dictionary:
+        //   handle = (dictionary[sizeOffset] > slotOffset) ? *slot : 0
+        GenTree* sizeValue = gtNewOperNode(GT_ADD, TYP_I_IMPL, lastIndOfTree,
+                                           gtNewIconNode(pRuntimeLookup->sizeOffset, TYP_I_IMPL));
+        sizeValue = gtNewOperNode(GT_IND, TYP_I_IMPL, sizeValue);
+        sizeValue->gtFlags |= GTF_IND_NONFAULTING;
+
+        GenTree* slotOffset = gtNewIconNode(pRuntimeLookup->offsets[pRuntimeLookup->indirections - 1], TYP_I_IMPL);
+        GenTree* sizeCheck  = gtNewOperNode(GT_GT, TYP_INT, sizeValue, slotOffset);
+
+        GenTree* sizeColon  = new (this, GT_COLON) GenTreeColon(TYP_I_IMPL, handle, gtNewIconNode(0, TYP_I_IMPL));
+        GenTree* sizeQmark  = gtNewQmarkNode(TYP_I_IMPL, sizeCheck, sizeColon);
+        unsigned handleTemp = lvaGrabTemp(true DEBUGARG("impRuntimeLookup size check"));
+        impAssignTempGen(handleTemp, sizeQmark, (unsigned)CHECK_SPILL_NONE);
+
+        handle     = gtNewLclvNode(handleTemp, TYP_I_IMPL);
+        handleCopy = gtNewLclvNode(handleTemp, TYP_I_IMPL);
+    }
+    else
+    {
+        handleCopy = impCloneExpr(handle, &handle, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL,
+                                  nullptr DEBUGARG("impRuntimeLookup typehandle"));
+    }
 
     // Call to helper
     GenTree* argNode = gtNewIconEmbHndNode(pRuntimeLookup->signature, nullptr, GTF_ICON_TOKEN_HDL, compileTimeHandle);
@@ -6051,7 +6098,8 @@ bool Compiler::impCanPInvokeInlineCallSite(BasicBlock* block)
 //   Also sets GTF_CALL_UNMANAGED on call for inline pinvokes if the
 //   call passes a combination of legality and profitabilty checks.
 //
-//   If GTF_CALL_UNMANAGED is set, increments info.compCallUnmanaged
+//   If GTF_CALL_UNMANAGED is set, increments info.compCallUnmanaged, unless
+//   the call also suppresses the GC transition.
 
 void Compiler::impCheckForPInvokeCall(
     GenTreeCall* call, CORINFO_METHOD_HANDLE methHnd, CORINFO_SIG_INFO* sig, unsigned mflags, BasicBlock* block)
@@ -6139,7 +6187,19 @@ void Compiler::impCheckForPInvokeCall(
     JITLOG((LL_INFO1000000, "\nInline a CALLI PINVOKE call from method %s", info.compFullName));
 
     call->gtFlags |= GTF_CALL_UNMANAGED;
-    info.compCallUnmanaged++;
+
+    if ((mflags & CORINFO_FLG_SUPPRESS_GC_TRANSITION) != 0)
+    {
+        // The call needs neither the InlinedCallFrame nor the transition code around it, so it does
+        // not count as an unmanaged call of the method. The thread stays in cooperative mode for the
+        // duration of the call, so it is not a GC safe point either: loops around it must be made
+        // fully interruptible or get a GC poll.
+        call->gtCallMoreFlags |= (GTF_CALL_M_SUPPRESS_GC_TRANSITION | GTF_CALL_M_NOGCCHECK);
+    }
+    else
+    {
+        info.compCallUnmanaged++;
+    }
 
     // AMD64 convention is same for native and managed
     if (unmanagedCallConv == CORINFO_UNMANAGED_CALLCONV_C)
@@ -7919,8 +7979,9 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
             assert(obj->gtType == TYP_REF);
 
             // See if we can devirtualize.
+            const bool isLateDevirtualization = false;
             impDevirtualizeCall(call->AsCall(), &callInfo->hMethod, &callInfo->methodFlags, &callInfo->contextHandle,
-                                &exactContextHnd);
+                                &exactContextHnd, isLateDevirtualization);
         }
 
         if (impIsThis(obj))
@@ -8263,7 +8324,13 @@ DONE_CALL:
                 impAppendTree(call, (unsigned)CHECK_SPILL_ALL, impCurStmtOffs);
 
                 // TODO: Still using the widened type.
-                call = gtNewInlineCandidateReturnExpr(call, genActualType(callRetTyp));
+                GenTree* retExpr = gtNewInlineCandidateReturnExpr(call, genActualType(callRetTyp));
+
+                // Link the retExpr to the call so if necessary we can manipulate it later.
+                call->AsCall()->gtInlineCandidateInfo->retExpr = retExpr;
+
+                // Propagate retExpr as the placeholder for the call.
+                call = retExpr;
             }
             else
             {
@@ -14733,7 +14800,37 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 const bool canExpandInline    = (helper == CORINFO_HELP_UNBOX);
                 const bool shouldExpandInline = !(compCurBB->isRunRarely() || opts.compDbgCode || opts.MinOpts());
 
-                if (canExpandInline && shouldExpandInline)
+                // If we're unboxing a box of the same type that has not been
+                // stored anywhere, we can unbox from a local copy of the value
+                // instead, and avoid both the allocation and the type check.
+                //
+                // The adjacent box; unbox.any case is handled when importing
+                // the box, but this also catches unboxes of box values that
+                // reach here via inlinee arguments or other stack shuffling.
+                GenTree* unboxedCopy = nullptr;
+
+                if (canExpandInline && !opts.compDbgCode && !opts.MinOpts() && op1->IsBoxedValue())
+                {
+                    GenTree* boxTemp = op1->AsBox()->BoxOp();
+                    assert(boxTemp->IsLocal());
+                    CORINFO_CLASS_HANDLE boxClass = lvaTable[boxTemp->AsLclVarCommon()->GetLclNum()].lvClassHnd;
+
+                    if ((boxClass != nullptr) &&
+                        (info.compCompHnd->compareTypesForEquality(boxClass, resolvedToken.hClass) ==
+                         TypeCompareState::Must))
+                    {
+                        JITDUMP("\n %s of BOX [%06u] of the same type, trying to unbox from a local copy\n",
+                                opcode == CEE_UNBOX ? "UNBOX" : "UNBOX.ANY", dspTreeID(op1));
+                        unboxedCopy = gtTryRemoveBoxUpstreamEffects(op1, BR_MAKE_LOCAL_COPY);
+                    }
+                }
+
+                if (unboxedCopy != nullptr)
+                {
+                    JITDUMP(" Success! unboxing from local copy\n");
+                    op1 = unboxedCopy;
+                }
+                else if (canExpandInline && shouldExpandInline)
                 {
                     JITDUMP("\n Importing %s as inline sequence\n", opcode == CEE_UNBOX ? "UNBOX" : "UNBOX.ANY");
                     // we are doing normal unboxing
@@ -18056,6 +18153,11 @@ void Compiler::impCheckCanInline(GenTree*               call,
             pInfo->exactContextHnd = pParam->exactContextHnd;
             pInfo->ilCallerHandle  = pParam->pThis->info.compMethodHnd;
             pInfo->initClassResult = initClassResult;
+            pInfo->retExpr         = nullptr;
+
+            pInfo->guardedClassHandle  = nullptr;
+            pInfo->guardedMethodHandle = nullptr;
+            pInfo->stubAddr            = nullptr;
 
             *(pParam->ppInlineCandidateInfo) = pInfo;
 
@@ -19002,11 +19104,47 @@ BOOL Compiler::impInlineIsGuaranteedThisDerefBeforeAnySideEffects(GenTree*    ad
 //    something that is inherent to the method being called, the
 //    method may be marked as "noinline" to short-circuit any
 //    future assessments of calls to this method.
+//
+//    Guarded devirtualization candidates are only worth guarding if the
+//    guarded method can be inlined, so if callNode is such a candidate
+//    and does not become an inline candidate, the guard is dropped.
 
 void Compiler::impMarkInlineCandidate(GenTree*               callNode,
                                       CORINFO_CONTEXT_HANDLE exactContextHnd,
                                       bool                   exactContextNeedsRuntimeLookup,
                                       CORINFO_CALL_INFO*     callInfo)
+{
+    GenTreeCall* call = callNode->AsCall();
+
+    impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
+
+    if (call->IsGuardedDevirtualizationCandidate() && !call->IsInlineCandidate())
+    {
+        JITDUMP("Guarded method for call [%06u] is not inlineable, dropping guarded devirtualization\n",
+                dspTreeID(call));
+        call->ClearGuardedDevirtualizationCandidate();
+    }
+}
+
+//------------------------------------------------------------------------
+// impMarkInlineCandidateHelper: determine if this call can be subsequently
+//     inlined
+//
+// Arguments:
+//    call -- call under scrutiny
+//    exactContextHnd -- context handle for inlining
+//    exactContextNeedsRuntimeLookup -- true if context required runtime lookup
+//    callInfo -- call info from VM
+//
+// Notes:
+//    See impMarkInlineCandidate. For guarded devirtualization candidates
+//    the guarded method, rather than the method the call invokes, is
+//    assessed for inlining.
+
+void Compiler::impMarkInlineCandidateHelper(GenTreeCall*           call,
+                                            CORINFO_CONTEXT_HANDLE exactContextHnd,
+                                            bool                   exactContextNeedsRuntimeLookup,
+                                            CORINFO_CALL_INFO*     callInfo)
 {
     // Let the strategy know there's another call
     impInlineRoot()->m_inlineStrategy->NoteCall();
@@ -19031,7 +19169,6 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
         return;
     }
 
-    GenTreeCall* call = callNode->AsCall();
     InlineResult inlineResult(this, call, nullptr, "impMarkInlineCandidate");
 
     // Don't inline if not optimizing root method
@@ -19066,7 +19203,8 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
         return;
     }
 
-    if (call->IsVirtual())
+    // Virtual calls can only be inlined via guarded devirtualization.
+    if (call->IsVirtual() && !call->IsGuardedDevirtualizationCandidate())
     {
         inlineResult.NoteFatal(InlineObservation::CALLSITE_IS_NOT_DIRECT);
         return;
@@ -19094,8 +19232,17 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
     CORINFO_METHOD_HANDLE fncHandle = call->gtCallMethHnd;
     unsigned              methAttr;
 
+    if (call->IsGuardedDevirtualizationCandidate())
+    {
+        // The guarded method's class is known not to be shared, so the
+        // method itself provides the exact context.
+        fncHandle                      = call->gtGuardedDevirtualizationCandidateInfo->guardedMethodHandle;
+        methAttr                       = info.compCompHnd->getMethodAttribs(fncHandle);
+        exactContextHnd                = MAKE_METHODCONTEXT(fncHandle);
+        exactContextNeedsRuntimeLookup = false;
+    }
     // Reuse method flags from the original callInfo if possible
-    if (fncHandle == callInfo->hMethod)
+    else if (fncHandle == callInfo->hMethod)
     {
         methAttr = callInfo->methodFlags;
     }
@@ -19201,13 +19348,33 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
         return;
     }
 
-    // The old value should be NULL
-    assert(call->gtInlineCandidateInfo == nullptr);
-
     // The new value should not be NULL.
     assert(inlineCandidateInfo != nullptr);
     inlineCandidateInfo->exactContextNeedsRuntimeLookup = exactContextNeedsRuntimeLookup;
 
+    if (call->IsGuardedDevirtualizationCandidate())
+    {
+        // The same-this restriction can't be honored once the guard
+        // copies 'this' to a new temp.
+        if ((inlineCandidateInfo->dwRestrictions & INLINE_SAME_THIS) != 0)
+        {
+            inlineResult.NoteFatal(InlineObservation::CALLSITE_REQUIRES_SAME_THIS);
+            return;
+        }
+
+        // Carry over the guarded devirtualization info, as the inline
+        // candidate info replaces it in the call.
+        GuardedDevirtualizationCandidateInfo* guardedInfo = call->gtGuardedDevirtualizationCandidateInfo;
+        inlineCandidateInfo->guardedClassHandle           = guardedInfo->guardedClassHandle;
+        inlineCandidateInfo->guardedMethodHandle          = guardedInfo->guardedMethodHandle;
+        inlineCandidateInfo->stubAddr                     = guardedInfo->stubAddr;
+    }
+    else
+    {
+        // The old value should be NULL
+        assert(call->gtInlineCandidateInfo == nullptr);
+    }
+
     call->gtInlineCandidateInfo = inlineCandidateInfo;
 
     // Mark the call node as inline candidate.
@@ -19343,6 +19510,7 @@ bool Compiler::IsMathIntrinsic(GenTree* tree)
 //     methodFlags -- [IN/OUT] flags for the method to call. Updated iff call devirtualized.
 //     contextHandle -- [IN/OUT] context handle for the call. Updated iff call devirtualized.
 //     exactContextHnd -- [OUT] updated context handle iff call devirtualized
+//     isLateDevirtualization -- if devirtualization is happening after importation
 //
 // Notes:
 //     Virtual calls in IL will always "invoke" the base class method.
@@ -19367,11 +19535,16 @@ bool Compiler::IsMathIntrinsic(GenTree* tree)
 //     to instead make a local copy. If that is doable, the call is
 //     updated to invoke the unboxed entry on the local copy.
 //
+//     When the type of 'this' is not known exactly and neither the class
+//     nor the method is final, the call may instead become a guarded
+//     devirtualization candidate (see addGuardedDevirtualizationCandidate).
+//
 void Compiler::impDevirtualizeCall(GenTreeCall*            call,
                                    CORINFO_METHOD_HANDLE*  method,
                                    unsigned*               methodFlags,
                                    CORINFO_CONTEXT_HANDLE* contextHandle,
-                                   CORINFO_CONTEXT_HANDLE* exactContextHandle)
+                                   CORINFO_CONTEXT_HANDLE* exactContextHandle,
+                                   bool                    isLateDevirtualization)
 {
     assert(call != nullptr);
     assert(method != nullptr);
@@ -19603,15 +19776,15 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     {
         // Type is not exact, and neither class or method is final.
         //
-        // We could speculatively devirtualize, but there's no
-        // reason to believe the derived method is the one that
-        // is likely to be invoked.
-        //
-        // If there's currently no further overriding (that is, at
-        // the time of jitting, objClass has no subclasses that
-        // override this method), then perhaps we'd be willing to
-        // make a bet...?
+        // We can't devirtualize outright, but we can guess that the
+        // declared type of 'this' is its exact type and guard the
+        // direct call with a method table check.
         JITDUMP("    Class not final or exact, method not final, no devirtualization\n");
+
+        if (!isLateDevirtualization)
+        {
+            addGuardedDevirtualizationCandidate(call, derivedMethod, objClass, objClassAttribs);
+        }
         return;
     }
 
@@ -19619,6 +19792,11 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     if (isInterface && !isExact && !objClassIsFinal)
     {
         JITDUMP("    Class not final or exact for interface, no devirtualization\n");
+
+        if (!isLateDevirtualization)
+        {
+            addGuardedDevirtualizationCandidate(call, derivedMethod, objClass, objClassAttribs);
+        }
         return;
     }
 
@@ -19959,3 +20137,119 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
     SpillRetExprHelper helper(this);
     helper.StoreRetExprResultsInArgs(call);
 }
+
+//------------------------------------------------------------------------
+// addGuardedDevirtualizationCandidate: potentially mark the call as a guarded
+//    devirtualization candidate
+//
+// Arguments:
+//    call - potential guarded devirtualization candidate
+//    methodHandle - method that will be invoked if the class test succeeds
+//    classHandle - class that will be tested for at runtime
+//    classAttr - attributes of the class
+//
+// Notes:
+//    Call sites in inlinees, prejitted or size-optimized code, and in rarely
+//    run blocks are not marked as candidates.
+//
+//    As part of marking the candidate, the code spills GT_RET_EXPRs anywhere
+//    in the call's operands, because the call is cloned as part of guarded
+//    devirtualization and these IR nodes can't be cloned.
+//
+void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
+                                                   CORINFO_METHOD_HANDLE methodHandle,
+                                                   CORINFO_CLASS_HANDLE  classHandle,
+                                                   unsigned              classAttr)
+{
+    if (JitConfig.JitEnableGuardedDevirtualization() == 0)
+    {
+        return;
+    }
+
+    // Only guard calls in the root method; the guard's control flow
+    // would otherwise have to be threaded through the inlinee.
+    if (compIsForInlining())
+    {
+        JITDUMP("NOT guarded devirt candidate -- inlinee\n");
+        return;
+    }
+
+    // Class and method handles may not be embeddable across version
+    // bubbles when prejitting.
+    if (opts.IsReadyToRun())
+    {
+        JITDUMP("NOT guarded devirt candidate -- prejitting\n");
+        return;
+    }
+
+    // Bail when optimizing for size or in rarely run code.
+    if (compCodeOpt() == SMALL_CODE)
+    {
+        JITDUMP("NOT guarded devirt candidate -- optimizing for size\n");
+        return;
+    }
+
+    if (compCurBB->isRunRarely())
+    {
+        JITDUMP("NOT guarded devirt candidate -- rare call site\n");
+        return;
+    }
+
+    if (call->gtCallType != CT_USER_FUNC)
+    {
+        JITDUMP("NOT guarded devirt candidate -- not a user function call\n");
+        return;
+    }
+
+    // The method table test can only detect exact instances of a class
+    // that can be instantiated, and does not work for shared generics.
+    if ((classAttr & (CORINFO_FLG_ABSTRACT | CORINFO_FLG_VALUECLASS | CORINFO_FLG_SHAREDINST)) != 0)
+    {
+        JITDUMP("NOT guarded devirt candidate -- class can't be tested exactly\n");
+        return;
+    }
+
+    // Struct returns and struct args complicate the cloning of the call;
+    // leave those alone for now.
+    if (varTypeIsStruct(call->TypeGet()))
+    {
+        JITDUMP("NOT guarded devirt candidate -- struct return\n");
+        return;
+    }
+
+    for (GenTreeArgList* args = call->gtCallArgs; args != nullptr; args = args->Rest())
+    {
+        if (varTypeIsStruct(args->Current()->TypeGet()))
+        {
+            JITDUMP("NOT guarded devirt candidate -- struct arg\n");
+            return;
+        }
+    }
+
+    JITDUMP("Marking call [%06u] as guarded devirtualization candidate\n", dspTreeID(call));
+
+    setMethodHasGuardedDevirtualization();
+    call->SetGuardedDevirtualizationCandidate();
+
+    // Spill off any GT_RET_EXPR subtrees so we can clone the call.
+    SpillRetExprHelper helper(this);
+    helper.StoreRetExprResultsInArgs(call);
+
+    GuardedDevirtualizationCandidateInfo* pInfo = new (this, CMK_Inlining) GuardedDevirtualizationCandidateInfo;
+
+    pInfo->guardedMethodHandle = methodHandle;
+    pInfo->guardedClassHandle  = classHandle;
+
+    // Save off the stub address since it shares a union with the candidate info.
+    if (call->IsVirtualStub())
+    {
+        JITDUMP("Saving stub addr %p in candidate info\n", dspPtr(call->gtStubCallStubAddr));
+        pInfo->stubAddr = call->gtStubCallStubAddr;
+    }
+    else
+    {
+        pInfo->stubAddr = nullptr;
+    }
+
+    call->gtGuardedDevirtualizationCandidateInfo = pInfo;
+}
@@ -599,8 +599,13 @@ InlineResult::InlineResult(Compiler* compiler, GenTreeCall* call, GenTreeStmt* s
     // handle for the "immediate" caller here.
     m_Caller = compiler->info.compMethodHnd;
 
-    // Get method handle for callee, if known
-    if (m_Call->gtCall.gtCallType == CT_USER_FUNC)
+    // Get method handle for callee, if known. Guarded devirtualization
+    // candidates are assessed against the method they are guarded to invoke.
+    if (m_Call->IsGuardedDevirtualizationCandidate())
+    {
+        m_Callee = m_Call->gtGuardedDevirtualizationCandidateInfo->guardedMethodHandle;
+    }
+    else if (m_Call->gtCall.gtCallType == CT_USER_FUNC)
     {
         m_Callee = m_Call->gtCall.gtCallMethHnd;
     }
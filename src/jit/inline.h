@@ -494,10 +494,24 @@ private:
     bool                  m_Reported;
 };
 
+// GuardedDevirtualizationCandidateInfo provides information about
+// a potential target of a virtual call: the class 'this' is guessed
+// to be, and the method that class would invoke.
+
+struct GuardedDevirtualizationCandidateInfo
+{
+    CORINFO_CLASS_HANDLE  guardedClassHandle;
+    CORINFO_METHOD_HANDLE guardedMethodHandle;
+    void*                 stubAddr; // saved stub address of a virtual stub call, which shares storage with this info
+};
+
 // InlineCandidateInfo provides basic information about a particular
 // inline candidate.
+//
+// It is a superset of GuardedDevirtualizationCandidateInfo so that a
+// guarded devirtualization candidate can also be an inline candidate.
 
-struct InlineCandidateInfo
+struct InlineCandidateInfo : public GuardedDevirtualizationCandidateInfo
 {
     DWORD                  dwRestrictions;
     CORINFO_METHOD_INFO    methInfo;
@@ -509,6 +523,7 @@ struct InlineCandidateInfo
     CORINFO_CONTEXT_HANDLE exactContextHnd;
     bool                   exactContextNeedsRuntimeLookup;
     CorInfoInitClassResult initClassResult;
+    GenTree*               retExpr; // the GT_RET_EXPR placeholder for the call's result, if any
 };
 
 // InlArgInfo describes inline candidate argument properties.
@@ -586,12 +586,44 @@ void DefaultPolicy::NoteInt(InlineObservation obs, int value)
             assert(m_CallsiteFrequency != InlineCallsiteFrequency::UNUSED);
             break;
 
+        case InlineObservation::CALLSITE_WEIGHT:
+            m_CallsiteWeight = static_cast<unsigned>(value);
+            break;
+
         default:
             // Ignore all other information
             break;
     }
 }
 
+//------------------------------------------------------------------------
+// DetermineProfileBonus: determine extra benefit multiplier for a call
+// site that profile data shows to be hot
+//
+// Notes:
+//    Scales with how many times the call site runs per call of the root
+//    method, up to JitInlineMaxProfileBonus. Sites that run at most once
+//    per call get no bonus. Cold sites are already classified as RARE.
+
+double DefaultPolicy::DetermineProfileBonus()
+{
+    BasicBlock* entryBlock = m_RootCompiler->fgFirstBB;
+
+    if ((entryBlock == nullptr) || !entryBlock->hasProfileWeight() || (entryBlock->bbWeight == BB_ZERO_WEIGHT) ||
+        (m_CallsiteWeight <= entryBlock->bbWeight))
+    {
+        return 0.0;
+    }
+
+    const double ratio    = (double)m_CallsiteWeight / entryBlock->bbWeight;
+    const double maxBonus = (double)JitConfig.JitInlineMaxProfileBonus();
+    const double bonus    = (ratio - 1.0 < maxBonus) ? ratio - 1.0 : maxBonus;
+
+    JITDUMP("\nInline candidate callsite runs %g times per call.  Multiplier increased by %g.", ratio, bonus);
+
+    return bonus;
+}
+
 //------------------------------------------------------------------------
 // DetermineMultiplier: determine benefit multiplier for this inline
 //
@@ -680,6 +712,7 @@ double DefaultPolicy::DetermineMultiplier()
         case InlineCallsiteFrequency::WARM:
             multiplier += 2.0;
             JITDUMP("\nInline candidate callsite is warm.  Multiplier increased to %g.", multiplier);
+            multiplier += DetermineProfileBonus();
             break;
         case InlineCallsiteFrequency::LOOP:
             multiplier += 3.0;
@@ -1259,6 +1292,7 @@ void DiscretionaryPolicy::NoteInt(InlineObservation obs, int value)
 
         case InlineObservation::CALLSITE_WEIGHT:
             m_CallSiteWeight = static_cast<unsigned>(value);
+            DefaultPolicy::NoteInt(obs, value);
             break;
 
         default:
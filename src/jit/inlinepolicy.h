@@ -89,6 +89,7 @@ public:
         , m_Multiplier(0.0)
         , m_CodeSize(0)
         , m_CallsiteFrequency(InlineCallsiteFrequency::UNUSED)
+        , m_CallsiteWeight(0)
         , m_InstructionCount(0)
         , m_LoadStoreCount(0)
         , m_ArgFeedsTest(0)
@@ -145,6 +146,7 @@ protected:
 
     // Helper methods
     double DetermineMultiplier();
+    double DetermineProfileBonus();
     int    DetermineNativeSizeEstimate();
     int DetermineCallsiteNativeSizeEstimate(CORINFO_METHOD_INFO* methodInfo);
 
@@ -154,6 +156,7 @@ protected:
     double                  m_Multiplier;
     unsigned                m_CodeSize;
     InlineCallsiteFrequency m_CallsiteFrequency;
+    unsigned                m_CallsiteWeight;
     unsigned                m_InstructionCount;
     unsigned                m_LoadStoreCount;
     unsigned                m_ArgFeedsTest;
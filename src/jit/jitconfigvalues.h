@@ -283,6 +283,20 @@ CONFIG_INTEGER(DisplayMemStats, W("JitMemStats"), 0) // Display JIT memory usage
 CONFIG_INTEGER(JitAggressiveInlining, W("JitAggressiveInlining"), 0) // Aggressive inlining of all methods
 CONFIG_INTEGER(JitELTHookEnabled, W("JitELTHookEnabled"), 0)         // If 1, emit Enter/Leave/TailCall callbacks
 CONFIG_INTEGER(JitInlineSIMDMultiplier, W("JitInlineSIMDMultiplier"), 3)
+CONFIG_INTEGER(JitInlineMaxProfileBonus, W("JitInlineMaxProfileBonus"), 3) // Max multiplier boost for call sites
+                                                                           // that profile data shows to be hot
+CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0) // Allocate non-escaping objects
+                                                                            // on the stack
+CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualization"), 0) // Guard virtual calls
+                                                                                          // with a class check
+
+// Alignment of hot inner loops (see Compiler::optIdentifyLoopsForAlignment). JitAlignHotLoopBoundary is 16 or 32,
+// JitAlignHotLoopMinWeight is relative to the weight of the method entry, and JitAlignHotLoopMaxPadding (at most
+// 15 bytes) bounds the padding spent on any one loop.
+CONFIG_INTEGER(JitAlignHotLoops, W("JitAlignHotLoops"), 1)
+CONFIG_INTEGER(JitAlignHotLoopBoundary, W("JitAlignHotLoopBoundary"), 32)
+CONFIG_INTEGER(JitAlignHotLoopMinWeight, W("JitAlignHotLoopMinWeight"), 4)
+CONFIG_INTEGER(JitAlignHotLoopMaxPadding, W("JitAlignHotLoopMaxPadding"), 15)
 
 #if defined(FEATURE_ENABLE_NO_RANGE_CHECKS)
 CONFIG_INTEGER(JitNoRngChks, W("JitNoRngChks"), 0) // If 1, don't generate range checks
@@ -307,6 +321,24 @@ CONFIG_INTEGER(JitTelemetry, W("JitTelemetry"), 1) // If non-zero, gather JIT te
 CONFIG_INTEGER(JitVNMapSelBudget, W("JitVNMapSelBudget"), DEFAULT_MAP_SELECT_BUDGET)
 
 CONFIG_INTEGER(TailCallLoopOpt, W("TailCallLoopOpt"), 1) // Convert recursive tail calls to loops
+CONFIG_INTEGER(JitPartialUnroll, W("JitPartialUnroll"), 1) // Unroll small counted loops with non-constant trip
+                                                          // counts, leaving a remainder loop
+
+// Percentage of a profiled switch's executions a single case must receive before lowering tests for it
+// ahead of the jump table. 0 disables the transformation.
+CONFIG_INTEGER(JitSwitchPeelPercent, W("JitSwitchPeelPercent"), 80)
+
+// When non-zero, CSE promotion estimates the register pressure a new CSE temp would face and
+// uses the conservative costs for candidates that are unlikely to get a register.
+CONFIG_INTEGER(JitCSERegPressure, W("JitCSERegPressure"), 1)
+
+// When non-zero, blocks that throw via identical calls to methods that do not return are merged.
+CONFIG_INTEGER(JitEnableTailMergeThrows, W("JitEnableTailMergeThrows"), 1)
+
+// Tier0 explicitly (and quickly) jits methods with loops only when this is set. Otherwise such methods are
+// switched to optimized code up front, since they may never return to have their call counted.
+CONFIG_INTEGER(TC_QuickJitForLoops, W("TC_QuickJitForLoops"), 0)
+
 CONFIG_METHODSET(AltJit, W("AltJit"))         // Enables AltJit and selectively limits it to the specified methods.
 CONFIG_METHODSET(AltJitNgen, W("AltJitNgen")) // Enables AltJit for NGEN and selectively limits it
                                               // to the specified methods.
@@ -747,6 +747,16 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
     }
     else
     {
+        // If profile data shows that one case dominates, test for it before the switch so the common
+        // path takes a well predicted conditional branch instead of an indirect jump.
+        BasicBlock* peeledSwitchBB =
+            TryPeelDominantSwitchCase(jumpTab, jumpCnt, afterDefaultCondBlock, tempLclNum, tempLclType);
+
+        if (peeledSwitchBB != nullptr)
+        {
+            afterDefaultCondBlock = peeledSwitchBB;
+        }
+
         // At this point the default case has already been handled and we need to generate a jump
         // table based switch or a bit test based switch at the end of afterDefaultCondBlock. Both
         // switch variants need the switch value so create the necessary LclVar node here.
@@ -790,6 +800,117 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
     return next;
 }
 
+//------------------------------------------------------------------------
+// TryPeelDominantSwitchCase: Attempts to test for the hottest case of a switch ahead of the switch itself.
+//
+// Arguments:
+//    jumpTable - The jump table
+//    jumpCount - The number of blocks in the jump table
+//    bbSwitch - The switch block
+//    switchLclNum - The local that holds the switch value
+//    switchLclType - The type of the switch value local
+//
+// Return Value:
+//    The block that now ends with the switch if a case was peeled, nullptr otherwise.
+//
+// Notes:
+//    This is only done when profile data is available and a single case value accounts for at least
+//    JitSwitchPeelPercent of the switch's executions. bbSwitch becomes a BBJ_COND that branches to the
+//    dominant case's target and falls through into a new block containing the switch. The jump table
+//    entry for the peeled case is left alone; it is simply never taken at run time.
+//
+//    The default case must already have been handled.
+//
+BasicBlock* Lowering::TryPeelDominantSwitchCase(BasicBlock* jumpTable[],
+                                                unsigned    jumpCount,
+                                                BasicBlock* bbSwitch,
+                                                unsigned    switchLclNum,
+                                                var_types   switchLclType)
+{
+    assert(bbSwitch->bbJumpKind == BBJ_SWITCH);
+
+    const unsigned peelPercent = JitConfig.JitSwitchPeelPercent();
+
+    if ((peelPercent == 0) || (peelPercent > 100) || !comp->fgHaveProfileData() || !bbSwitch->hasProfileWeight())
+    {
+        return nullptr;
+    }
+
+    const BasicBlock::weight_t switchWeight = bbSwitch->bbWeight;
+
+    if (switchWeight == 0)
+    {
+        return nullptr;
+    }
+
+    unsigned             hotCase   = UINT_MAX;
+    BasicBlock*          hotTarget = nullptr;
+    BasicBlock::weight_t hotWeight = 0;
+    flowList*            hotEdge   = nullptr;
+
+    // The last entry is the default case, which has been handled already.
+    for (unsigned i = 0; i < jumpCount - 1; i++)
+    {
+        BasicBlock* target = jumpTable[i];
+        flowList*   edge   = comp->fgGetPredForBlock(target, bbSwitch);
+        assert(edge != nullptr);
+
+        // Only a target reached through a single case value can be peeled with a single compare.
+        if (edge->flDupCount != 1)
+        {
+            continue;
+        }
+
+        // Prefer the edge weight if we have it. Otherwise the target's weight is only usable
+        // if the switch is its sole predecessor.
+        BasicBlock::weight_t weight;
+
+        if (comp->fgHaveValidEdgeWeights)
+        {
+            weight = edge->flEdgeWeightMin;
+        }
+        else if ((target->bbRefs == 1) && target->hasProfileWeight())
+        {
+            weight = target->bbWeight;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (weight > hotWeight)
+        {
+            hotCase   = i;
+            hotTarget = target;
+            hotWeight = weight;
+            hotEdge   = edge;
+        }
+    }
+
+    if ((hotTarget == nullptr) || ((UINT64)hotWeight * 100 < (UINT64)switchWeight * peelPercent))
+    {
+        return nullptr;
+    }
+
+    JITDUMP("Lowering switch " FMT_BB ": peeling dominant case %u (weight %u of %u) to " FMT_BB "\n",
+            bbSwitch->bbNum, hotCase, hotWeight, switchWeight, hotTarget->bbNum);
+
+    BasicBlock* newSwitchBB = comp->fgSplitBlockAtEnd(bbSwitch);
+
+    bbSwitch->bbJumpKind = BBJ_COND;
+    bbSwitch->bbJumpDest = hotTarget;
+    comp->fgAddRefPred(hotTarget, bbSwitch, hotEdge);
+
+    newSwitchBB->setBBProfileWeight((switchWeight > hotWeight) ? (switchWeight - hotWeight) : 0);
+
+    GenTree* caseCond = comp->gtNewOperNode(GT_EQ, TYP_INT, comp->gtNewLclvNode(switchLclNum, switchLclType),
+                                            comp->gtNewIconNode(hotCase, genActualType(switchLclType)));
+    GenTree* caseJump = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, caseCond);
+    LIR::AsRange(bbSwitch).InsertAtEnd(LIR::SeqTree(comp, caseJump));
+
+    return newSwitchBB;
+}
+
 //------------------------------------------------------------------------
 // TryLowerSwitchToBitTest: Attempts to transform a jump table switch into a bit test.
 //
@@ -1967,15 +2088,6 @@ void Lowering::LowerFastTailCall(GenTreeCall* call)
         firstPutArgStk = putargs.Bottom();
     }
 
-    // If we have a putarg_stk node, also count the number of non-standard args the
-    // call node has.  Note that while determining whether a tail call can be fast
-    // tail called, we don't count non-standard args (passed in R10 or R11) since they
-    // don't contribute to outgoing arg space.  These non-standard args are not
-    // accounted in caller's arg count but accounted in callee's arg count after
-    // fgMorphArgs(). Therefore, exclude callee's non-standard args while mapping
-    // callee's stack arg num to corresponding caller's stack arg num.
-    unsigned calleeNonStandardArgCount = call->GetNonStandardAddedArgCount(comp);
-
     // Say Caller(a, b, c, d, e) fast tail calls Callee(e, d, c, b, a)
     // i.e. passes its arguments in reverse to Callee. During call site
     // setup, after computing argument side effects, stack args are setup
@@ -2002,20 +2114,37 @@ void Lowering::LowerFastTailCall(GenTreeCall* call)
 
         assert(putArgStkNode->OperGet() == GT_PUTARG_STK);
 
-        // Get the caller arg num corresponding to this callee arg.
-        // Note that these two args share the same stack slot. Therefore,
-        // if there are further uses of corresponding caller arg, we need
+        // Get the caller arg whose stack slot this callee arg is stored to.
+        // Therefore, if there are further uses of that caller arg, we need
         // to move it to a temp and use the temp in this call tree.
         //
-        // Note that Caller is guaranteed to have a param corresponding to
-        // this Callee's arg since fast tail call mechanism counts the
+        // Note that Caller is guaranteed to have a param occupying the slot
+        // of this Callee's arg since fast tail call mechanism counts the
         // stack slots required for both Caller and Callee for passing params
         // and allow fast tail call only if stack slots required by Caller >=
-        // Callee.
-        fgArgTabEntry* argTabEntry = comp->gtArgEntryByNode(call, putArgStkNode);
-        assert(argTabEntry);
-        unsigned callerArgNum = argTabEntry->argNum - calleeNonStandardArgCount;
-        noway_assert(callerArgNum < comp->info.compArgsCount);
+        // Callee. The args are matched by stack offset rather than by arg
+        // number, since on ABIs that only give stack slots to the args that
+        // don't fit in registers, the Callee may have more args than the
+        // Caller and they need not line up.
+        unsigned calleeArgOffs =
+            putArgStkNode->AsPutArgStk()->getArgOffset() - (INIT_ARG_STACK_SLOT * TARGET_POINTER_SIZE);
+        unsigned callerArgNum = BAD_VAR_NUM;
+        for (unsigned argNum = 0; argNum < comp->info.compArgsCount; argNum++)
+        {
+            LclVarDsc* argDsc = comp->lvaTable + argNum;
+            if (argDsc->lvIsRegArg || (argDsc->lvArgStackOffs > calleeArgOffs))
+            {
+                continue;
+            }
+
+            // The params are laid out contiguously, so the slot belongs to the one
+            // with the highest offset that doesn't exceed it.
+            if ((callerArgNum == BAD_VAR_NUM) || (argDsc->lvArgStackOffs > comp->lvaTable[callerArgNum].lvArgStackOffs))
+            {
+                callerArgNum = argNum;
+            }
+        }
+        noway_assert(callerArgNum != BAD_VAR_NUM);
 
         unsigned   callerArgLclNum = callerArgNum;
         LclVarDsc* callerArgDsc    = comp->lvaTable + callerArgLclNum;
@@ -3837,17 +3966,24 @@ GenTree* Lowering::LowerNonvirtPinvokeCall(GenTreeCall* call)
     GenTree* result = nullptr;
     void*    addr   = nullptr;
 
+    // A call that suppresses the GC transition is made like a regular call to the native target,
+    // there is no frame to set up and no GC mode to switch.
+    const bool suppressGCTransition = call->IsSuppressGCTransition();
+
     // assert we have seen one of these
-    noway_assert(comp->info.compCallUnmanaged != 0);
+    noway_assert(suppressGCTransition || (comp->info.compCallUnmanaged != 0));
 
-    // All code generated by this function must not contain the randomly-inserted NOPs
-    // that we insert to inhibit JIT spraying in partial trust scenarios.
-    // The PINVOKE_PROLOG op signals this to the code generator/emitter.
+    if (!suppressGCTransition)
+    {
+        // All code generated by this function must not contain the randomly-inserted NOPs
+        // that we insert to inhibit JIT spraying in partial trust scenarios.
+        // The PINVOKE_PROLOG op signals this to the code generator/emitter.
 
-    GenTree* prolog = new (comp, GT_NOP) GenTree(GT_PINVOKE_PROLOG, TYP_VOID);
-    BlockRange().InsertBefore(call, prolog);
+        GenTree* prolog = new (comp, GT_NOP) GenTree(GT_PINVOKE_PROLOG, TYP_VOID);
+        BlockRange().InsertBefore(call, prolog);
 
-    InsertPInvokeCallProlog(call);
+        InsertPInvokeCallProlog(call);
+    }
 
     if (call->gtCallType != CT_INDIRECT)
     {
@@ -3890,7 +4026,10 @@ GenTree* Lowering::LowerNonvirtPinvokeCall(GenTreeCall* call)
         }
     }
 
-    InsertPInvokeCallEpilog(call);
+    if (!suppressGCTransition)
+    {
+        InsertPInvokeCallEpilog(call);
+    }
 
     return result;
 }
@@ -284,6 +284,11 @@ private:
     GenTree* LowerSwitch(GenTree* node);
     bool TryLowerSwitchToBitTest(
         BasicBlock* jumpTable[], unsigned jumpCount, unsigned targetCount, BasicBlock* bbSwitch, GenTree* switchValue);
+    BasicBlock* TryPeelDominantSwitchCase(BasicBlock* jumpTable[],
+                                          unsigned    jumpCount,
+                                          BasicBlock* bbSwitch,
+                                          unsigned    switchLclNum,
+                                          var_types   switchLclType);
 
     void LowerCast(GenTree* node);
 
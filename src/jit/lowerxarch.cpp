@@ -184,15 +184,23 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
         //    in our framework assemblies are actually <= INITBLK_UNROLL_LIMIT bytes size, so this is the
         //    preferred code sequence for the vast majority of cases.
 
+        // c) If AVX is available and the fill byte is zero, unroll up to INITBLK_UNROLL_LIMIT_AVX
+        //    bytes using 32-byte stores.
+        unsigned unrollLimit = INITBLK_UNROLL_LIMIT;
+        if (comp->canUseVexEncoding() && initVal->IsCnsIntOrI() && ((initVal->gtIntCon.gtIconVal & 0xFF) == 0))
+        {
+            unrollLimit = INITBLK_UNROLL_LIMIT_AVX;
+        }
+
         // This threshold will decide from using the helper or let the JIT decide to inline
         // a code sequence of its choice.
-        unsigned helperThreshold = max(INITBLK_STOS_LIMIT, INITBLK_UNROLL_LIMIT);
+        unsigned helperThreshold = max(max(INITBLK_STOS_LIMIT, INITBLK_UNROLL_LIMIT), unrollLimit);
 
         // TODO-X86-CQ: Investigate whether a helper call would be beneficial on x86
         if (size != 0 && size <= helperThreshold)
         {
             // Always favor unrolling vs rep stos.
-            if (size <= INITBLK_UNROLL_LIMIT && initVal->IsCnsIntOrI())
+            if (size <= unrollLimit && initVal->IsCnsIntOrI())
             {
                 // The fill value of an initblk is interpreted to hold a
                 // value of (unsigned int8) however a constant of any size
@@ -220,7 +228,9 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
                 initVal->gtIntCon.gtIconVal = 0x01010101 * fill;
 #endif // !_TARGET_AMD64_
 
-                if ((fill == 0) && ((size & 0xf) == 0))
+                // The zero fill doesn't need a register if we only emit SIMD stores; the 32-byte
+                // sequence handles any remainder with an overlapping store.
+                if ((fill == 0) && (((size & 0xf) == 0) || comp->canUseYmmBlockUnroll(blkNode)))
                 {
                     MakeSrcContained(blkNode, source);
                 }
@@ -335,9 +345,13 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
             // In case of a CpBlk with a constant size and less than CPBLK_MOVS_LIMIT size
             // we can use rep movs to generate code instead of the helper call.
 
+            // When AVX is available the unrolled copy uses 32-byte moves, so it remains profitable
+            // for larger buffers.
+            unsigned unrollLimit = comp->canUseVexEncoding() ? CPBLK_UNROLL_LIMIT_AVX : CPBLK_UNROLL_LIMIT;
+
             // This threshold will decide between using the helper or let the JIT decide to inline
             // a code sequence of its choice.
-            unsigned helperThreshold = max(CPBLK_MOVS_LIMIT, CPBLK_UNROLL_LIMIT);
+            unsigned helperThreshold = max(CPBLK_MOVS_LIMIT, unrollLimit);
 
             // TODO-X86-CQ: Investigate whether a helper call would be beneficial on x86
             if ((size != 0) && (size <= helperThreshold))
@@ -345,7 +359,7 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
                 // If we have a buffer between XMM_REGSIZE_BYTES and CPBLK_UNROLL_LIMIT bytes, we'll use SSE2.
                 // Structs and buffer with sizes <= CPBLK_UNROLL_LIMIT bytes are occurring in more than 95% of
                 // our framework assemblies, so this is the main code generation scheme we'll use.
-                if (size <= CPBLK_UNROLL_LIMIT)
+                if (size <= unrollLimit)
                 {
                     blkNode->gtBlkOpKind = GenTreeBlk::BlkOpKindUnroll;
 
@@ -796,6 +796,7 @@ void LinearScan::setBlockSequence()
         blockInfo[block->bbNum].copyRegCount       = 0;
         blockInfo[block->bbNum].resolutionMovCount = 0;
         blockInfo[block->bbNum].splitEdgeCount     = 0;
+        blockInfo[block->bbNum].rematCount         = 0;
 #endif // TRACK_LSRA_STATS
 
         if (block->GetUniquePred(compiler) == nullptr)
@@ -6219,6 +6220,104 @@ void LinearScan::insertCopyOrReload(BasicBlock* block, GenTree* tree, unsigned m
     }
 }
 
+//------------------------------------------------------------------------
+// isRematerializableSpill: Determine whether a spilled tree temp can be
+//   recomputed at its use instead of being stored to and reloaded from a spill temp.
+//
+// Arguments:
+//    refPosition       - The RefPosition to consider.
+//
+// Return Value:
+//    True if "refPosition" is a spilled def of a constant or local address
+//    whose only use is reloaded into a register.
+//
+// Notes:
+//    Uses that didn't get a register read the value directly from the spill
+//    temp, so those still require the spill.
+//
+bool LinearScan::isRematerializableSpill(RefPosition* refPosition)
+{
+    if ((refPosition == nullptr) || (refPosition->refType != RefTypeDef) || !refPosition->spillAfter ||
+        !refPosition->isIntervalRef() || refPosition->getInterval()->isLocalVar)
+    {
+        return false;
+    }
+
+    GenTree* treeNode = refPosition->treeNode;
+    if ((treeNode == nullptr) || !treeNode->OperIs(GT_CNS_INT, GT_CNS_DBL, GT_LCL_VAR_ADDR, GT_LCL_FLD_ADDR))
+    {
+        return false;
+    }
+
+#ifndef _TARGET_64BIT_
+    // The high half of a decomposed long add or subtract consumes the carry of the low
+    // half, which materializing a zero (as "xor reg, reg") immediately before it would clobber.
+    if (treeNode->IsIntegralConst(0))
+    {
+        return false;
+    }
+#endif // !_TARGET_64BIT_
+
+#ifdef _TARGET_ARMARCH_
+    // Floating point constants may need internal integer registers to be materialized.
+    // Those were only known to be free at the original def, not at the use. This check
+    // runs before the internal registers are recorded in gtRsvdRegs, so it has to be
+    // made on the oper rather than on the registers.
+    if (treeNode->OperIs(GT_CNS_DBL))
+    {
+        return false;
+    }
+#endif // _TARGET_ARMARCH_
+
+    RefPosition* useRefPosition = refPosition->nextRefPosition;
+    return (useRefPosition != nullptr) && (useRefPosition->refType == RefTypeUse) && useRefPosition->reload &&
+           (useRefPosition->assignedReg() != REG_NA) && (useRefPosition->nextRefPosition == nullptr);
+}
+
+//------------------------------------------------------------------------
+// insertRematerialization: Recompute a spilled constant or local address
+//   immediately before its use, rather than spilling it and reloading it.
+//
+// Arguments:
+//    block             - basic block containing "tree".
+//    tree              - The spilled node; it is left in place as an unused value.
+//    refPosition       - The spilled def RefPosition of "tree".
+//
+// Notes:
+//    The original node is kept, rather than removed, because later constant
+//    nodes may have been allocated to reuse the value it leaves in its register.
+//
+void LinearScan::insertRematerialization(BasicBlock* block, GenTree* tree, RefPosition* refPosition)
+{
+    assert(isRematerializableSpill(refPosition));
+
+    LIR::Range& blockRange = LIR::AsRange(block);
+
+    LIR::Use treeUse;
+    bool     foundUse = blockRange.TryGetUse(tree, &treeUse);
+    assert(foundUse);
+
+    GenTree* parent = treeUse.User();
+
+    // The clone is placed at the use, where any internal registers of the original
+    // might hold live values.
+    assert(tree->gtRsvdRegs == RBM_NONE);
+
+    GenTree* newNode = compiler->gtCloneExpr(tree);
+    SetLsraAdded(newNode);
+    newNode->ResetReuseRegVal();
+    newNode->gtRegNum = refPosition->nextRefPosition->assignedReg();
+
+    JITDUMP("Rematerializing t%d as t%d in %s before its use by t%d\n", tree->gtTreeID, newNode->gtTreeID,
+            getRegName(newNode->gtRegNum), parent->gtTreeID);
+
+    blockRange.InsertBefore(parent, newNode);
+    treeUse.ReplaceWith(compiler, newNode);
+    tree->SetUnusedValue();
+
+    INTRACK_STATS(updateLsraStat(LSRA_STAT_REMAT, block->bbNum));
+}
+
 #if FEATURE_PARTIAL_SIMD_CALLEE_SAVE
 //------------------------------------------------------------------------
 // insertUpperVectorSaveAndReload: Insert code to save and restore the upper half of a vector that lives
@@ -6390,6 +6489,13 @@ void LinearScan::updateMaxSpill(RefPosition* refPosition)
         Interval* interval = refPosition->getInterval();
         if (!interval->isLocalVar)
         {
+            // Values that are recomputed at their use don't need a spill temp.
+            RefPosition* defRefPosition = RefTypeIsDef(refType) ? refPosition : interval->firstRefPosition;
+            if (isRematerializableSpill(defRefPosition))
+            {
+                return;
+            }
+
             // The tmp allocation logic 'normalizes' types to a small number of
             // types that need distinct stack locations from each other.
             // Those types are currently gc refs, byrefs, <= 4 byte non-GC items,
@@ -6723,6 +6829,13 @@ void LinearScan::resolveRegisters()
                     resolveLocalRef(block, treeNode, currentRefPosition);
                 }
 
+                // Constants and local addresses that would be spilled are instead
+                // recomputed immediately before their use.
+                else if (isRematerializableSpill(currentRefPosition))
+                {
+                    insertRematerialization(block, treeNode, currentRefPosition);
+                }
+
                 // Mark spill locations on temps
                 // (local vars are handled in resolveLocalRef, above)
                 // Note that the tree node will be changed from GTF_SPILL to GTF_SPILLED
@@ -8318,6 +8431,10 @@ void LinearScan::updateLsraStat(LsraStat stat, unsigned bbNum)
             ++(blockInfo[bbNum].splitEdgeCount);
             break;
 
+        case LSRA_STAT_REMAT:
+            ++(blockInfo[bbNum].rematCount);
+            break;
+
         default:
             break;
     }
@@ -8335,9 +8452,11 @@ void LinearScan::dumpLsraStats(FILE* file)
     unsigned sumCopyRegCount       = 0;
     unsigned sumResolutionMovCount = 0;
     unsigned sumSplitEdgeCount     = 0;
+    unsigned sumRematCount         = 0;
     UINT64   wtdSpillCount         = 0;
     UINT64   wtdCopyRegCount       = 0;
     UINT64   wtdResolutionMovCount = 0;
+    UINT64   wtdRematCount         = 0;
 
     fprintf(file, "----------\n");
     fprintf(file, "LSRA Stats");
@@ -8369,22 +8488,26 @@ void LinearScan::dumpLsraStats(FILE* file)
         unsigned copyRegCount       = blockInfo[block->bbNum].copyRegCount;
         unsigned resolutionMovCount = blockInfo[block->bbNum].resolutionMovCount;
         unsigned splitEdgeCount     = blockInfo[block->bbNum].splitEdgeCount;
+        unsigned rematCount         = blockInfo[block->bbNum].rematCount;
 
-        if (spillCount != 0 || copyRegCount != 0 || resolutionMovCount != 0 || splitEdgeCount != 0)
+        if (spillCount != 0 || copyRegCount != 0 || resolutionMovCount != 0 || splitEdgeCount != 0 ||
+            rematCount != 0)
         {
             fprintf(file, FMT_BB " [%8d]: ", block->bbNum, block->bbWeight);
-            fprintf(file, "SpillCount = %d, ResolutionMovs = %d, SplitEdges = %d, CopyReg = %d\n", spillCount,
-                    resolutionMovCount, splitEdgeCount, copyRegCount);
+            fprintf(file, "SpillCount = %d, ResolutionMovs = %d, SplitEdges = %d, CopyReg = %d, Remat = %d\n",
+                    spillCount, resolutionMovCount, splitEdgeCount, copyRegCount, rematCount);
         }
 
         sumSpillCount += spillCount;
         sumCopyRegCount += copyRegCount;
         sumResolutionMovCount += resolutionMovCount;
         sumSplitEdgeCount += splitEdgeCount;
+        sumRematCount += rematCount;
 
         wtdSpillCount += (UINT64)spillCount * block->bbWeight;
         wtdCopyRegCount += (UINT64)copyRegCount * block->bbWeight;
         wtdResolutionMovCount += (UINT64)resolutionMovCount * block->bbWeight;
+        wtdRematCount += (UINT64)rematCount * block->bbWeight;
     }
 
     fprintf(file, "Total Tracked Vars:  %d\n", compiler->lvaTrackedCount);
@@ -8395,6 +8518,30 @@ void LinearScan::dumpLsraStats(FILE* file)
     fprintf(file, "Total CopyReg Count: %d   Weighted: %I64u\n", sumCopyRegCount, wtdCopyRegCount);
     fprintf(file, "Total ResolutionMov Count: %d    Weighted: %I64u\n", sumResolutionMovCount, wtdResolutionMovCount);
     fprintf(file, "Total number of split edges: %d\n", sumSplitEdgeCount);
+    fprintf(file, "Total Remat Count: %d    Weighted: %I64u\n", sumRematCount, wtdRematCount);
+
+    // Report how many of the CSE temps that were register candidates got spilled, so that
+    // the CSE promotion heuristic can be tuned against the allocator.
+    unsigned cseCandidateCount = 0;
+    unsigned cseSpillCount     = 0;
+    UINT64   wtdCseSpillCount  = 0;
+    for (unsigned varIndex = 0; varIndex < compiler->lvaTrackedCount; varIndex++)
+    {
+        LclVarDsc* varDsc = &compiler->lvaTable[compiler->lvaTrackedToVarNum[varIndex]];
+        if (!varDsc->lvIsCSE || !isCandidateVar(varDsc))
+        {
+            continue;
+        }
+        Interval* interval = getIntervalForLocalVar(varIndex);
+        cseCandidateCount++;
+        if (interval->isSpilled)
+        {
+            cseSpillCount++;
+            wtdCseSpillCount += varDsc->lvRefCntWtd();
+        }
+    }
+    fprintf(file, "Total CSE Reg Cand Vars: %d    Spilled: %d    Weighted RefCnt Spilled: %I64u\n", cseCandidateCount,
+            cseSpillCount, wtdCseSpillCount);
 
     // compute total number of spill temps created
     unsigned numSpillTemps = 0;
@@ -400,6 +400,10 @@ struct LsraBlockInfo
 
     // Number of critical edges from this block that are split.
     unsigned splitEdgeCount;
+
+    // Number of spilled tree temps in this basic block that were recomputed
+    // at their use instead of being reloaded from a spill temp.
+    unsigned rematCount;
 #endif // TRACK_LSRA_STATS
 };
 
@@ -653,6 +657,11 @@ public:
     // than the one it was spilled from
     void insertCopyOrReload(BasicBlock* block, GenTree* tree, unsigned multiRegIdx, RefPosition* refPosition);
 
+    // Tree temps defined by constants or local addresses are cheaper to recompute
+    // at their use than to spill and reload
+    bool isRematerializableSpill(RefPosition* refPosition);
+    void insertRematerialization(BasicBlock* block, GenTree* tree, RefPosition* refPosition);
+
 #if FEATURE_PARTIAL_SIMD_CALLEE_SAVE
     // Insert code to save and restore the upper half of a vector that lives
     // in a callee-save register at the point of a call (the upper half is
@@ -1331,7 +1340,7 @@ private:
 
 #if TRACK_LSRA_STATS
     enum LsraStat{
-        LSRA_STAT_SPILL, LSRA_STAT_COPY_REG, LSRA_STAT_RESOLUTION_MOV, LSRA_STAT_SPLIT_EDGE,
+        LSRA_STAT_SPILL, LSRA_STAT_COPY_REG, LSRA_STAT_RESOLUTION_MOV, LSRA_STAT_SPLIT_EDGE, LSRA_STAT_REMAT,
     };
 
     unsigned regCandidateVarCount;
@@ -1283,7 +1283,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                     // Reserve an XMM register to fill it with a pack of 16 init value constants.
                     buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
                     // use XMM register to fill with constants, it's AVX instruction and set the flag
-                    SetContainsAVXFlags();
+                    SetContainsAVXFlags(true, compiler->canUseYmmBlockUnroll(blkNode) ? YMM_REGSIZE_BYTES : 0);
                 }
 #ifdef _TARGET_X86_
                 if ((size & 1) != 0)
@@ -1349,12 +1349,16 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
             switch (blkNode->gtBlkOpKind)
             {
                 case GenTreeBlk::BlkOpKindUnroll:
+                {
+                    // When copying with 32-byte moves, the remainder is handled by an overlapping move.
+                    bool useYmm = compiler->canUseYmmBlockUnroll(blkNode);
+
                     // If we have a remainder smaller than XMM_REGSIZE_BYTES, we need an integer temp reg.
                     //
                     // x86 specific note: if the size is odd, the last copy operation would be of size 1 byte.
                     // But on x86 only RBM_BYTE_REGS could be used as byte registers.  Therefore, exclude
                     // RBM_NON_BYTE_REGS from internal candidates.
-                    if ((size & (XMM_REGSIZE_BYTES - 1)) != 0)
+                    if (!useYmm && ((size & (XMM_REGSIZE_BYTES - 1)) != 0))
                     {
                         regMaskTP regMask = allRegs(TYP_INT);
 
@@ -1375,9 +1379,10 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                         buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
                         // Uses XMM reg for load and store and hence check to see whether AVX instructions
                         // are used for codegen, set ContainsAVX flag
-                        SetContainsAVXFlags();
+                        SetContainsAVXFlags(true, useYmm ? YMM_REGSIZE_BYTES : 0);
                     }
                     break;
+                }
 
                 case GenTreeBlk::BlkOpKindRepInstr:
                     // rep stos has the following register requirements:
@@ -7201,20 +7201,9 @@ bool Compiler::fgCanFastTailCall(GenTreeCall* callee)
         return false;
     }
 
-    // TODO-AMD64-Unix
-    // TODO-ARM64
-    //
-    // LowerFastTailCall currently assumes nCalleeArgs <= nCallerArgs. This is
-    // not true in many cases on x64 linux, remove this pessimization when
-    // LowerFastTailCall is fixed. See https://github.com/dotnet/coreclr/issues/12468
-    // for more information.
-    if (hasStackArgs && (nCalleeArgs > nCallerArgs))
-    {
-        reportFastTailCallDecision("Will not fastTailCall hasStackArgs && (nCalleeArgs > nCallerArgs)", callerStackSize,
-                                   calleeStackSize);
-        return false;
-    }
-
+    // Unlike x64 Windows, only the args that don't fit in registers get stack slots, so
+    // the callee may have more args than the caller and still fit in its incoming arg
+    // area. LowerFastTailCall matches the stack args to the caller's params by offset.
     if (calleeStackSize > callerStackSize)
     {
         reportFastTailCallDecision("Will not fastTailCall calleeStackSize > callerStackSize", callerStackSize,
@@ -16733,6 +16722,16 @@ void Compiler::fgMorph()
     // Transform each GT_ALLOCOBJ node into either an allocation helper call or
     // local variable allocation on the stack.
     ObjectAllocator objectAllocator(this); // PHASE_ALLOCATE_OBJECTS
+
+// TODO-ObjectStackAllocation: Enable the optimization for architectures using
+// JIT32_GCENCODER (i.e., x86).
+#ifndef JIT32_GCENCODER
+    if (JitConfig.JitObjectStackAllocation() && !opts.MinOpts() && !opts.compDbgCode)
+    {
+        objectAllocator.EnableObjectStackAllocation();
+    }
+#endif // JIT32_GCENCODER
+
     objectAllocator.Run();
 
     /* Add any internal blocks/trees we may need */
@@ -22,6 +22,7 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 // DoPhase: Run analysis (if object stack allocation is enabled) and then
 //          morph each GT_ALLOCOBJ node either into an allocation helper
 //          call or stack allocation.
+//
 // Notes:
 //    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set.
 void ObjectAllocator::DoPhase()
@@ -33,35 +34,313 @@ void ObjectAllocator::DoPhase()
 
     if (IsObjectStackAllocationEnabled())
     {
+        JITDUMP("enabled, analyzing...\n");
         DoAnalysis();
     }
+    else
+    {
+        JITDUMP("disabled, punting\n");
+    }
 
-    MorphAllocObjNodes();
+    const bool didStackAllocate = MorphAllocObjNodes();
+
+    if (didStackAllocate)
+    {
+        ComputeStackObjectPointers(&m_bitVecTraits);
+        RewriteUses();
+    }
+}
+
+//------------------------------------------------------------------------------
+// MarkLclVarAsEscaping : Mark local variable as escaping.
+//
+//
+// Arguments:
+//    lclNum  - Escaping pointing local variable number
+
+void ObjectAllocator::MarkLclVarAsEscaping(unsigned int lclNum)
+{
+    BitVecOps::AddElemD(&m_bitVecTraits, m_EscapingPointers, lclNum);
+}
+
+//------------------------------------------------------------------------------
+// MarkLclVarAsPossiblyStackPointing : Mark local variable as possibly pointing
+//                                     to a stack-allocated object.
+//
+//
+// Arguments:
+//    lclNum  - Possibly stack-object-pointing local variable number
+
+void ObjectAllocator::MarkLclVarAsPossiblyStackPointing(unsigned int lclNum)
+{
+    BitVecOps::AddElemD(&m_bitVecTraits, m_PossiblyStackPointingPointers, lclNum);
+}
+
+//------------------------------------------------------------------------------
+// MarkLclVarAsDefinitelyStackPointing : Mark local variable as definitely pointing
+//                                       to a stack-allocated object.
+//
+//
+// Arguments:
+//    lclNum  - Definitely stack-object-pointing local variable number
+
+void ObjectAllocator::MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum)
+{
+    BitVecOps::AddElemD(&m_bitVecTraits, m_DefinitelyStackPointingPointers, lclNum);
+}
+
+//------------------------------------------------------------------------------
+// AddConnGraphEdge : Record that the source local variable may point to the same set of objects
+//                    as the set pointed to by target local variable.
+//
+// Arguments:
+//    sourceLclNum  - Local variable number of the edge source
+//    targetLclNum  - Local variable number of the edge target
+
+void ObjectAllocator::AddConnGraphEdge(unsigned int sourceLclNum, unsigned int targetLclNum)
+{
+    BitVecOps::AddElemD(&m_bitVecTraits, m_ConnGraphAdjacencyMatrix[sourceLclNum], targetLclNum);
 }
 
 //------------------------------------------------------------------------
 // DoAnalysis: Walk over basic blocks of the method and detect all local
 //             variables that can be allocated on the stack.
 //
-// Assumptions:
-//    Must be run after the dominators have been computed (we need this
-//    information to detect loops).
+// Notes:
+//    This runs right after inlining, before the flow graph is fully built,
+//    so loops are detected conservatively via BBF_BACKWARD_JUMP when the
+//    allocation sites are examined.
 void ObjectAllocator::DoAnalysis()
 {
     assert(m_IsObjectStackAllocationEnabled);
-    assert(comp->fgDomsComputed);
-    // TODO-ObjectStackAllocation
-    NYI("DoAnalysis");
+    assert(!m_AnalysisDone);
+
+    const unsigned int lclCount = BitVecTraits::GetSize(&m_bitVecTraits);
+
+    m_EscapingPointers                = BitVecOps::MakeEmpty(&m_bitVecTraits);
+    m_PossiblyStackPointingPointers   = BitVecOps::MakeEmpty(&m_bitVecTraits);
+    m_DefinitelyStackPointingPointers = BitVecOps::MakeEmpty(&m_bitVecTraits);
+
+    if (lclCount > 0)
+    {
+        m_ConnGraphAdjacencyMatrix = comp->getAllocator(CMK_ObjectAllocator).allocate<BitSetShortLongRep>(lclCount);
+        m_LclDefCount              = comp->getAllocator(CMK_ObjectAllocator).allocate<unsigned>(lclCount);
+
+        for (unsigned int lclNum = 0; lclNum < lclCount; ++lclNum)
+        {
+            m_ConnGraphAdjacencyMatrix[lclNum] = BitVecOps::MakeEmpty(&m_bitVecTraits);
+            m_LclDefCount[lclNum]              = 0;
+        }
+
+        MarkEscapingVarsAndBuildConnGraph();
+        ComputeEscapingNodes(&m_bitVecTraits, m_EscapingPointers);
+    }
+
+    m_AnalysisDone = true;
+}
+
+//------------------------------------------------------------------------------
+// MarkEscapingVarsAndBuildConnGraph : Walk the trees of the method and mark any ref/byref/i_impl
+//                                     local variables that may escape. Build a connection graph
+//                                     for ref/by_ref/i_impl local variables.
+//
+// Notes:
+//     The connection graph has an edge from local variable s to local variable t if s may point
+//     to the objects t points to at some point in the method. It's a simplified version
+//     of the graph described in this paper:
+//     https://www.cc.gatech.edu/~harrold/6340/cs6340_fall2009/Readings/choi99escape.pdf
+//     We currently don't have field edges and the edges we do have are always "may point to" edges.
+//     Locals that are address-exposed, have their address taken, are parameters or are accessed
+//     other than through a plain GT_LCL_VAR are conservatively marked as escaping.
+
+void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
+{
+    class BuildConnGraphVisitor final : public GenTreeVisitor<BuildConnGraphVisitor>
+    {
+        ObjectAllocator* m_allocator;
+
+    public:
+        enum
+        {
+            DoPreOrder    = true,
+            DoLclVarsOnly = true,
+            ComputeStack  = true,
+        };
+
+        BuildConnGraphVisitor(ObjectAllocator* allocator)
+            : GenTreeVisitor<BuildConnGraphVisitor>(allocator->comp), m_allocator(allocator)
+        {
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* tree = *use;
+            assert(tree != nullptr);
+            assert(tree->IsLocal());
+
+            const unsigned int lclNum = tree->AsLclVarCommon()->GetLclNum();
+
+            if (tree->OperGet() != GT_LCL_VAR)
+            {
+                // Partial or address-taking accesses are not tracked.
+                m_allocator->MarkLclVarAsEscaping(lclNum);
+                return Compiler::fgWalkResult::WALK_CONTINUE;
+            }
+
+            const var_types type = tree->TypeGet();
+            if ((type == TYP_REF) || (type == TYP_BYREF) || (type == TYP_I_IMPL))
+            {
+                assert(tree == m_ancestors.Top());
+
+                if ((user != nullptr) && (user->OperGet() == GT_ASG) && (user->gtGetOp1() == tree))
+                {
+                    m_allocator->m_LclDefCount[lclNum]++;
+                }
+
+                if (m_allocator->CanLclVarEscapeViaParentStack(&m_ancestors, lclNum))
+                {
+                    if (!m_allocator->CanLclVarEscape(lclNum))
+                    {
+                        JITDUMP("V%02u first escapes via [%06u]\n", lclNum, m_compiler->dspTreeID(tree));
+                    }
+                    m_allocator->MarkLclVarAsEscaping(lclNum);
+                }
+            }
+
+            return Compiler::fgWalkResult::WALK_CONTINUE;
+        }
+    };
+
+    const unsigned int lclCount = BitVecTraits::GetSize(&m_bitVecTraits);
+
+    for (unsigned int lclNum = 0; lclNum < lclCount; ++lclNum)
+    {
+        LclVarDsc* const lclVarDsc = comp->lvaTable + lclNum;
+        const var_types  type      = lclVarDsc->TypeGet();
+
+        if ((type != TYP_REF) && (type != TYP_I_IMPL) && (type != TYP_BYREF))
+        {
+            // Only pointer-sized locals participate in the connection graph.
+            MarkLclVarAsEscaping(lclNum);
+        }
+        else if (lclVarDsc->lvAddrExposed || lclVarDsc->lvHasLdAddrOp || lclVarDsc->lvIsParam)
+        {
+            JITDUMP("   V%02u is address exposed or a parameter\n", lclNum);
+            MarkLclVarAsEscaping(lclNum);
+        }
+    }
+
+    BasicBlock* block;
+
+    foreach_block(comp, block)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt; stmt = stmt->gtNextStmt)
+        {
+            BuildConnGraphVisitor buildConnGraphVisitor(this);
+            buildConnGraphVisitor.WalkTree(&stmt->gtStmtExpr, nullptr);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// ComputeEscapingNodes : Given an initial set of escaping nodes, update it to contain the full set
+//                        of escaping nodes by computing nodes reachable from the given set.
+//
+// Arguments:
+//    bitVecTraits              - Bit vector traits
+//    escapingNodes  [in/out]   - Initial set of escaping nodes
+
+void ObjectAllocator::ComputeEscapingNodes(BitVecTraits* bitVecTraits, BitVec& escapingNodes)
+{
+    BitVec escapingNodesToProcess = BitVecOps::MakeCopy(bitVecTraits, escapingNodes);
+    BitVec newEscapingNodes       = BitVecOps::UninitVal();
+
+    unsigned int lclNum;
+
+    bool doOneMoreIteration = true;
+    while (doOneMoreIteration)
+    {
+        BitVecOps::Iter iterator(bitVecTraits, escapingNodesToProcess);
+        doOneMoreIteration = false;
+
+        while (iterator.NextElem(&lclNum))
+        {
+            doOneMoreIteration = true;
+
+            // newEscapingNodes         = adjacentNodes[lclNum]
+            BitVecOps::Assign(bitVecTraits, newEscapingNodes, m_ConnGraphAdjacencyMatrix[lclNum]);
+            // newEscapingNodes         = newEscapingNodes \ escapingNodes
+            BitVecOps::DiffD(bitVecTraits, newEscapingNodes, escapingNodes);
+            // escapingNodesToProcess   = escapingNodesToProcess U newEscapingNodes
+            BitVecOps::UnionD(bitVecTraits, escapingNodesToProcess, newEscapingNodes);
+            // escapingNodes = escapingNodes U newEscapingNodes
+            BitVecOps::UnionD(bitVecTraits, escapingNodes, newEscapingNodes);
+            // escapingNodesToProcess   = escapingNodesToProcess \ { lclNum }
+            BitVecOps::RemoveElemD(bitVecTraits, escapingNodesToProcess, lclNum);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// ComputeStackObjectPointers : Given an initial set of possibly stack-pointing nodes,
+//                              and an initial set of definitely stack-pointing nodes,
+//                              update both sets by computing nodes reachable from the
+//                              given set in the reverse connection graph.
+//
+// Arguments:
+//    bitVecTraits                    - Bit vector traits
+
+void ObjectAllocator::ComputeStackObjectPointers(BitVecTraits* bitVecTraits)
+{
+    const unsigned int lclCount = BitVecTraits::GetSize(bitVecTraits);
+
+    bool changed = true;
+
+    while (changed)
+    {
+        changed = false;
+        for (unsigned int lclNum = 0; lclNum < lclCount; ++lclNum)
+        {
+            const var_types type = comp->lvaTable[lclNum].TypeGet();
+
+            if ((type == TYP_REF) || (type == TYP_I_IMPL) || (type == TYP_BYREF))
+            {
+                if (!MayLclVarPointToStack(lclNum) &&
+                    !BitVecOps::IsEmptyIntersection(bitVecTraits, m_PossiblyStackPointingPointers,
+                                                    m_ConnGraphAdjacencyMatrix[lclNum]))
+                {
+                    // We discovered a new pointer that may point to the stack.
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+#ifdef DEBUG
+    if (comp->verbose)
+    {
+        printf("Definitely stack-pointing locals: %s\n",
+               BitVecOps::ToString(bitVecTraits, m_DefinitelyStackPointingPointers));
+        printf("Possibly stack-pointing locals: %s\n",
+               BitVecOps::ToString(bitVecTraits, m_PossiblyStackPointingPointers));
+    }
+#endif // DEBUG
 }
 
 //------------------------------------------------------------------------
 // MorphAllocObjNodes: Morph each GT_ALLOCOBJ node either into an
 //                     allocation helper call or stack allocation.
 //
+// Returns:
+//    true if any allocation was done as a stack allocation.
+//
 // Notes:
 //    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ set.
-void ObjectAllocator::MorphAllocObjNodes()
+bool ObjectAllocator::MorphAllocObjNodes()
 {
+    bool didStackAllocate = false;
+
     BasicBlock* block;
 
     foreach_block(comp, block)
@@ -109,21 +388,37 @@ void ObjectAllocator::MorphAllocObjNodes()
                 assert(op2 != nullptr);
                 assert(op2->OperGet() == GT_ALLOCOBJ);
 
-                GenTreeAllocObj* asAllocObj = op2->AsAllocObj();
-                unsigned int     lclNum     = op1->AsLclVar()->GetLclNum();
+                GenTreeAllocObj*     asAllocObj = op2->AsAllocObj();
+                unsigned int         lclNum     = op1->AsLclVar()->GetLclNum();
+                CORINFO_CLASS_HANDLE clsHnd     = asAllocObj->gtAllocObjClsHnd;
 
-                if (IsObjectStackAllocationEnabled() && CanAllocateLclVarOnStack(lclNum))
+                // Allocations in loops are left on the heap: the stack slot would be
+                // reused by every iteration while earlier objects may still be live.
+                if (IsObjectStackAllocationEnabled() && ((block->bbFlags & BBF_BACKWARD_JUMP) == 0) &&
+                    CanAllocateLclVarOnStack(lclNum, clsHnd))
                 {
-                    op2 = MorphAllocObjNodeIntoStackAlloc(asAllocObj, block, stmt);
+                    JITDUMP("Allocating local variable V%02u on the stack\n", lclNum);
+
+                    const unsigned int stackLclNum = MorphAllocObjNodeIntoStackAlloc(asAllocObj, block, stmt);
+                    m_HeapLocalToStackLocalMap.Set(lclNum, stackLclNum);
+                    stmtExpr->gtBashToNOP();
+                    MarkLclVarAsDefinitelyStackPointing(lclNum);
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    didStackAllocate = true;
                 }
                 else
                 {
+                    if (IsObjectStackAllocationEnabled())
+                    {
+                        JITDUMP("Allocating local variable V%02u on the heap\n", lclNum);
+                    }
+
                     op2 = MorphAllocObjNodeIntoHelperCall(asAllocObj);
-                }
 
-                // Propagate flags of op2 to its parent.
-                stmtExpr->gtOp.gtOp2 = op2;
-                stmtExpr->gtFlags |= op2->gtFlags & GTF_ALL_EFFECT;
+                    // Propagate flags of op2 to its parent.
+                    stmtExpr->gtOp.gtOp2 = op2;
+                    stmtExpr->gtFlags |= op2->gtFlags & GTF_ALL_EFFECT;
+                }
             }
 #ifdef DEBUG
             else
@@ -135,6 +430,8 @@ void ObjectAllocator::MorphAllocObjNodes()
 #endif // DEBUG
         }
     }
+
+    return didStackAllocate;
 }
 
 //------------------------------------------------------------------------
@@ -166,27 +463,389 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
 // MorphAllocObjNodeIntoStackAlloc: Morph a GT_ALLOCOBJ node into stack
 //                                  allocation.
 // Arguments:
-//    allocObj - GT_ALLOCOBJ that will be replaced by helper call.
+//    allocObj - GT_ALLOCOBJ that will be replaced by a stack allocation
 //    block    - a basic block where allocObj is
 //    stmt     - a statement where allocObj is
 //
 // Return Value:
-//    Address of tree doing stack allocation (can be the same as allocObj).
+//    local num for the new stack allocated local
 //
 // Notes:
-//    Must update parents flags after this.
 //    This function can insert additional statements before stmt.
-GenTree* ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj,
-                                                          BasicBlock*      block,
-                                                          GenTreeStmt*     stmt)
+unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj,
+                                                              BasicBlock*      block,
+                                                              GenTreeStmt*     stmt)
 {
     assert(allocObj != nullptr);
     assert(m_AnalysisDone);
 
-    // TODO-StackAllocation
-    NYI("MorphAllocObjIntoStackAlloc");
+    const bool         shortLifetime = false;
+    const unsigned int lclNum = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphAllocObjNodeIntoStackAlloc temp"));
+    const bool         unsafeValueClsCheck = true;
+    comp->lvaSetStruct(lclNum, allocObj->gtAllocObjClsHnd, unsafeValueClsCheck);
+
+    // Uses of the object are rewritten to take the address of this local.
+    comp->lvaSetVarAddrExposed(lclNum);
+
+    // Initialize the object memory if necessary.
+    if (comp->fgStructTempNeedsExplicitZeroInit(comp->lvaTable + lclNum, block))
+    {
+        const unsigned int structSize = comp->lvaTable[lclNum].lvSize();
+
+        //------------------------------------------------------------------------
+        // *  GT_STMT   void  (top level)
+        // |  /--*  GT_CNS_INT  int    0
+        // \--*  GT_ASG    struct (init)
+        //    \--*  GT_LCL_VAR  struct
+        //------------------------------------------------------------------------
+
+        GenTree* tree = comp->gtNewLclvNode(lclNum, TYP_STRUCT);
+        tree          = comp->gtNewBlkOpNode(tree,                  // Dest
+                                    comp->gtNewIconNode(0), // Value
+                                    structSize,             // Size
+                                    false,                  // isVolatile
+                                    false);                 // not copyBlock
+
+        GenTreeStmt* newStmt = comp->gtNewStmt(tree);
+        comp->fgInsertStmtBefore(block, stmt, newStmt);
+    }
+
+    //------------------------------------------------------------------------
+    // *  GT_STMT   void  (top level)
+    // |  /--*  GT_CNS_INT(h)  long
+    // \--*  GT_ASG    long
+    //    \--*  GT_LCL_FLD    long
+    //------------------------------------------------------------------------
+
+    // Initialize the method table pointer.
+    GenTree* tree = comp->gtNewLclFldNode(lclNum, TYP_I_IMPL, 0);
+    tree          = comp->gtNewAssignNode(tree, allocObj->gtGetOp1());
+
+    GenTreeStmt* newStmt = comp->gtNewStmt(tree);
+    comp->fgInsertStmtBefore(block, stmt, newStmt);
+
+    return lclNum;
+}
+
+//------------------------------------------------------------------------
+// CanLclVarEscapeViaParentStack: Check if the local variable escapes via the given parent stack.
+//                                Update the connection graph as necessary.
+//
+// Arguments:
+//    parentStack     - Parent stack of the current visit
+//    lclNum          - Local variable number
+//
+// Return Value:
+//    true if the local can escape via the parent stack; false otherwise
+//
+// Notes:
+//    The method currently treats all locals assigned to a field as escaping.
+//    The can potentially be tracked by special field edges in the connection graph.
+
+bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum)
+{
+    assert(parentStack != nullptr);
+    int parentIndex = 1;
+
+    bool keepChecking                  = true;
+    bool canLclVarEscapeViaParentStack = true;
+
+    while (keepChecking)
+    {
+        if (parentStack->Height() <= parentIndex)
+        {
+            // The value is not used.
+            canLclVarEscapeViaParentStack = false;
+            break;
+        }
+
+        canLclVarEscapeViaParentStack = true;
+        GenTree* tree                 = parentStack->Index(parentIndex - 1);
+        GenTree* parent               = parentStack->Index(parentIndex);
+        keepChecking                  = false;
+
+        switch (parent->OperGet())
+        {
+            case GT_ASG:
+            {
+                // Use the following conservative behavior for GT_ASG parent node:
+                //   Consider local variable to be escaping if
+                //   1. lclVar appears on the rhs of a GT_ASG node
+                //                      AND
+                //   2. The lhs of the GT_ASG is not another lclVar that is tracked
+
+                GenTree* op1 = parent->AsOp()->gtGetOp1();
+
+                if (op1 == tree)
+                {
+                    // Definitions are counted separately.
+                    canLclVarEscapeViaParentStack = (tree->OperGet() != GT_LCL_VAR);
+                }
+                else if (op1->OperGet() == GT_LCL_VAR)
+                {
+                    const unsigned int dstLclNum = op1->AsLclVarCommon()->GetLclNum();
+
+                    // Locals created by this phase are not tracked.
+                    if (dstLclNum < BitVecTraits::GetSize(&m_bitVecTraits))
+                    {
+                        // Add an edge to the connection graph. If the destination
+                        // escapes, ComputeEscapingNodes will mark this local as well.
+                        AddConnGraphEdge(dstLclNum, lclNum);
+                        canLclVarEscapeViaParentStack = false;
+                    }
+                }
+                break;
+            }
+
+            case GT_EQ:
+            case GT_NE:
+                canLclVarEscapeViaParentStack = false;
+                break;
+
+            case GT_COMMA:
+                if (parent->AsOp()->gtGetOp1() == tree)
+                {
+                    // Left child of GT_COMMA, it will be discarded
+                    canLclVarEscapeViaParentStack = false;
+                    break;
+                }
+                __fallthrough;
+            case GT_COLON:
+            case GT_QMARK:
+            case GT_ADD:
+                // Check whether the local escapes via its grandparent.
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
+            case GT_FIELD:
+            case GT_IND:
+            {
+                int grandParentIndex = parentIndex + 1;
+                if ((parentStack->Height() > grandParentIndex) &&
+                    (parentStack->Index(grandParentIndex)->OperGet() == GT_ADDR))
+                {
+                    // Check if the address of the field/ind escapes.
+                    parentIndex += 2;
+                    keepChecking = true;
+                }
+                else
+                {
+                    // Address of the field/ind is not taken so the local doesn't escape.
+                    canLclVarEscapeViaParentStack = false;
+                }
+                break;
+            }
+
+            default:
+                // Calls, returns, stores to memory and everything else are
+                // conservatively treated as escaping.
+                break;
+        }
+    }
+
+    return canLclVarEscapeViaParentStack;
+}
+
+//------------------------------------------------------------------------
+// UpdateAncestorTypes: Update types of some ancestor nodes of a possibly-stack-pointing
+//                      tree from TYP_REF to TYP_BYREF or TYP_I_IMPL.
+//
+// Arguments:
+//    tree            - Possibly-stack-pointing tree
+//    parentStack     - Parent stack of the possibly-stack-pointing tree
+//    newType         - New type of the possibly-stack-pointing tree
+//
+// Notes:
+//    This method must be kept in sync with CanLclVarEscapeViaParentStack: only
+//    the parents that method accepts as non-escaping can be seen here.
+
+void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType)
+{
+    assert(newType == TYP_BYREF || newType == TYP_I_IMPL);
+    assert(parentStack != nullptr);
+    int parentIndex = 1;
+
+    bool keepChecking = true;
+
+    while (keepChecking && (parentStack->Height() > parentIndex))
+    {
+        GenTree* parent = parentStack->Index(parentIndex);
+        keepChecking    = false;
 
-    return allocObj;
+        switch (parent->OperGet())
+        {
+            case GT_ASG:
+                if (parent->TypeGet() == TYP_REF)
+                {
+                    GenTree* op1 = parent->AsOp()->gtGetOp1();
+
+                    if (op1 == tree)
+                    {
+                        parent->ChangeType(newType);
+                    }
+                    else
+                    {
+                        // The use is copied to another tracked local, which has been
+                        // retyped already.
+                        assert(op1->OperGet() == GT_LCL_VAR);
+                        parent->ChangeType(comp->lvaTable[op1->AsLclVarCommon()->GetLclNum()].TypeGet());
+                    }
+                }
+                break;
+
+            case GT_EQ:
+            case GT_NE:
+                break;
+
+            case GT_COMMA:
+                if (parent->AsOp()->gtGetOp1() == tree)
+                {
+                    // Left child of GT_COMMA, it will be discarded
+                    break;
+                }
+                if (parent->TypeGet() == TYP_REF)
+                {
+                    parent->ChangeType(newType);
+                }
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
+            case GT_COLON:
+            case GT_QMARK:
+            case GT_ADD:
+                // The other operand may still be a heap reference, so these
+                // must be reported as byrefs even if this operand is TYP_I_IMPL.
+                newType = TYP_BYREF;
+                if (parent->TypeGet() == TYP_REF)
+                {
+                    parent->ChangeType(newType);
+                }
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
+            case GT_FIELD:
+            case GT_IND:
+            {
+                if (newType == TYP_BYREF)
+                {
+                    // This ensures that a checked write barrier is used when writing
+                    // to this field/indirection (it can be inside a stack-allocated object).
+                    parent->gtFlags |= GTF_IND_TGTANYWHERE;
+                }
+
+                int grandParentIndex = parentIndex + 1;
+                if ((parentStack->Height() > grandParentIndex) &&
+                    (parentStack->Index(grandParentIndex)->OperGet() == GT_ADDR))
+                {
+                    GenTree* grandParent = parentStack->Index(grandParentIndex);
+                    if (grandParent->TypeGet() == TYP_REF)
+                    {
+                        grandParent->ChangeType(newType);
+                    }
+                    parentIndex += 2;
+                    keepChecking = true;
+                }
+                break;
+            }
+
+            default:
+                unreached();
+        }
+
+        if (keepChecking)
+        {
+            tree = parentStack->Index(parentIndex - 1);
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// RewriteUses: Find uses of the newobj temp for stack-allocated
+//              objects and replace with address of the stack local.
+//              Retype the remaining possibly-stack-pointing locals to TYP_BYREF.
+
+void ObjectAllocator::RewriteUses()
+{
+    class RewriteUsesVisitor final : public GenTreeVisitor<RewriteUsesVisitor>
+    {
+        ObjectAllocator* m_allocator;
+
+    public:
+        enum
+        {
+            DoPreOrder    = true,
+            DoLclVarsOnly = true,
+            ComputeStack  = true,
+        };
+
+        RewriteUsesVisitor(ObjectAllocator* allocator)
+            : GenTreeVisitor<RewriteUsesVisitor>(allocator->comp), m_allocator(allocator)
+        {
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* tree = *use;
+            assert(tree != nullptr);
+            assert(tree->IsLocal());
+
+            const unsigned int lclNum    = tree->AsLclVarCommon()->GetLclNum();
+            unsigned int       newLclNum = BAD_VAR_NUM;
+
+            if ((lclNum < BitVecTraits::GetSize(&m_allocator->m_bitVecTraits)) &&
+                m_allocator->MayLclVarPointToStack(lclNum))
+            {
+                var_types newType;
+                if (m_allocator->m_HeapLocalToStackLocalMap.Lookup(lclNum, &newLclNum))
+                {
+                    newType = TYP_I_IMPL;
+                    tree =
+                        m_compiler->gtNewOperNode(GT_ADDR, newType, m_compiler->gtNewLclvNode(newLclNum, TYP_STRUCT));
+                    *use = tree;
+                }
+                else
+                {
+                    newType = m_compiler->lvaTable[lclNum].TypeGet();
+                    assert((newType == TYP_BYREF) || (newType == TYP_I_IMPL));
+                    if (tree->TypeGet() == TYP_REF)
+                    {
+                        tree->ChangeType(newType);
+                    }
+                }
+
+                m_allocator->UpdateAncestorTypes(tree, &m_ancestors, newType);
+            }
+
+            return Compiler::fgWalkResult::WALK_CONTINUE;
+        }
+    };
+
+    // Objects held in possibly-stack-pointing locals must no longer be reported
+    // as object references; interior-pointer reporting tolerates stack addresses.
+    const unsigned int lclCount = BitVecTraits::GetSize(&m_bitVecTraits);
+    for (unsigned int lclNum = 0; lclNum < lclCount; ++lclNum)
+    {
+        LclVarDsc* const lclVarDsc = comp->lvaTable + lclNum;
+        if (MayLclVarPointToStack(lclNum) && !DoesLclVarPointToStack(lclNum) && (lclVarDsc->TypeGet() == TYP_REF))
+        {
+            JITDUMP("Retyping V%02u from TYP_REF to TYP_BYREF\n", lclNum);
+            lclVarDsc->lvType = TYP_BYREF;
+        }
+    }
+
+    BasicBlock* block;
+
+    foreach_block(comp, block)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt; stmt = stmt->gtNextStmt)
+        {
+            RewriteUsesVisitor rewriteUsesVisitor(this);
+            rewriteUsesVisitor.WalkTree(&stmt->gtStmtExpr, nullptr);
+        }
+    }
 }
 
 #ifdef DEBUG
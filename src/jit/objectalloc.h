@@ -21,10 +21,25 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
 class ObjectAllocator final : public Phase
 {
+    typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, unsigned> LocalToLocalMap;
+
     //===============================================================================
     // Data members
-    bool m_IsObjectStackAllocationEnabled;
-    bool m_AnalysisDone;
+    bool         m_IsObjectStackAllocationEnabled;
+    bool         m_AnalysisDone;
+    BitVecTraits m_bitVecTraits;
+    BitVec       m_EscapingPointers;
+    // We keep the set of possibly-stack-pointing pointers as a superset of the set of
+    // definitely-stack-pointing pointers. All definitely-stack-pointing pointers are in both sets.
+    BitVec          m_PossiblyStackPointingPointers;
+    BitVec          m_DefinitelyStackPointingPointers;
+    LocalToLocalMap m_HeapLocalToStackLocalMap;
+    BitSetShortLongRep* m_ConnGraphAdjacencyMatrix;
+    unsigned*           m_LclDefCount;
+
+    // Objects larger than this are always allocated on the heap.
+    static const unsigned s_StackAllocMaxSize = 0x2000U;
+
     //===============================================================================
     // Methods
 public:
@@ -36,11 +51,24 @@ protected:
     virtual void DoPhase() override;
 
 private:
-    bool CanAllocateLclVarOnStack(unsigned int lclNum) const;
+    bool CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool CanLclVarEscape(unsigned int lclNum);
+    void MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
+    void MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
+    bool MayLclVarPointToStack(unsigned int lclNum);
+    bool DoesLclVarPointToStack(unsigned int lclNum);
     void     DoAnalysis();
-    void     MorphAllocObjNodes();
+    void     MarkLclVarAsEscaping(unsigned int lclNum);
+    void     MarkEscapingVarsAndBuildConnGraph();
+    void     AddConnGraphEdge(unsigned int sourceLclNum, unsigned int targetLclNum);
+    void     ComputeEscapingNodes(BitVecTraits* bitVecTraits, BitVec& escapingNodes);
+    void     ComputeStackObjectPointers(BitVecTraits* bitVecTraits);
+    bool     MorphAllocObjNodes();
+    void     RewriteUses();
     GenTree* MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
-    GenTree* MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, GenTreeStmt* stmt);
+    unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, GenTreeStmt* stmt);
+    bool CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum);
+    void UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType);
 #ifdef DEBUG
     static Compiler::fgWalkResult AssertWhenAllocObjFoundVisitor(GenTree** pTree, Compiler::fgWalkData* data);
 #endif // DEBUG
@@ -52,10 +80,18 @@ inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     : Phase(comp, "Allocate Objects", PHASE_ALLOCATE_OBJECTS)
     , m_IsObjectStackAllocationEnabled(false)
     , m_AnalysisDone(false)
+    , m_bitVecTraits(comp->lvaCount, comp)
+    , m_HeapLocalToStackLocalMap(comp->getAllocator(CMK_ObjectAllocator))
+    , m_ConnGraphAdjacencyMatrix(nullptr)
+    , m_LclDefCount(nullptr)
 {
     // Disable checks since this phase runs before fgComputePreds phase.
     // Checks are not expected to pass before fgComputePreds.
     doChecks = false;
+
+    m_EscapingPointers                = BitVecOps::UninitVal();
+    m_PossiblyStackPointingPointers   = BitVecOps::UninitVal();
+    m_DefinitelyStackPointingPointers = BitVecOps::UninitVal();
 }
 
 inline bool ObjectAllocator::IsObjectStackAllocationEnabled() const
@@ -69,15 +105,101 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 }
 
 //------------------------------------------------------------------------
-// CanAllocateLclVarOnStack: Returns true iff local variable can not
-//                           potentially escape from the method and
-//                           can be allocated on the stack.
-inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum) const
+// CanAllocateLclVarOnStack: Returns true iff local variable can be
+//                           allocated on the stack.
+//
+// Arguments:
+//    lclNum   - Local variable number
+//    clsHnd   - Class handle of the variable class
+//
+// Return Value:
+//    Returns true iff local variable can be allocated on the stack.
+//
+// Notes:
+//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
+{
+    assert(m_AnalysisDone);
+
+    DWORD classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+
+    if ((classAttribs & CORINFO_FLG_CONTAINS_GC_PTR) != 0)
+    {
+        // TODO-ObjectStackAllocation: enable stack allocation of objects with gc fields
+        return false;
+    }
+
+    if ((classAttribs & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        // TODO-ObjectStackAllocation: enable stack allocation of boxed structs
+        return false;
+    }
+
+    if (!comp->info.compCompHnd->canAllocateOnStack(clsHnd))
+    {
+        return false;
+    }
+
+    const unsigned int classSize = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+
+    if (classSize > s_StackAllocMaxSize)
+    {
+        return false;
+    }
+
+    // The allocation must be the only definition of the local, otherwise uses
+    // could observe either the stack or the heap object.
+    if (m_LclDefCount[lclNum] != 1)
+    {
+        return false;
+    }
+
+    return !CanLclVarEscape(lclNum);
+}
+
+//------------------------------------------------------------------------
+// CanLclVarEscape:          Returns true iff local variable can
+//                           potentially escape from the method
+//
+// Arguments:
+//    lclNum   - Local variable number
+//
+// Return Value:
+//    Returns true iff local variable can potentially escape from the method
+inline bool ObjectAllocator::CanLclVarEscape(unsigned int lclNum)
+{
+    return BitVecOps::IsMember(&m_bitVecTraits, m_EscapingPointers, lclNum);
+}
+
+//------------------------------------------------------------------------
+// MayLclVarPointToStack:          Returns true iff local variable can
+//                                 potentially point to a stack-allocated object
+//
+// Arguments:
+//    lclNum   - Local variable number
+//
+// Return Value:
+//    Returns true iff local variable can potentially point to a stack-allocated object
+inline bool ObjectAllocator::MayLclVarPointToStack(unsigned int lclNum)
+{
+    assert(m_AnalysisDone);
+    return BitVecOps::IsMember(&m_bitVecTraits, m_PossiblyStackPointingPointers, lclNum);
+}
+
+//------------------------------------------------------------------------
+// DoesLclVarPointToStack:         Returns true iff local variable definitely
+//                                 points to a stack-allocated object (or is null)
+//
+// Arguments:
+//    lclNum   - Local variable number
+//
+// Return Value:
+//    Returns true iff local variable definitely points to a stack-allocated object
+//    (or is null)
+inline bool ObjectAllocator::DoesLclVarPointToStack(unsigned int lclNum)
 {
     assert(m_AnalysisDone);
-    // TODO-ObjectStackAllocation
-    NYI("CanAllocateLclVarOnStack");
-    return false;
+    return BitVecOps::IsMember(&m_bitVecTraits, m_DefinitelyStackPointingPointers, lclNum);
 }
 
 //===============================================================================
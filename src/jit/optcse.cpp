@@ -1271,6 +1271,14 @@ class CSE_Heuristic
     Compiler::codeOptimize codeOptKind;
     Compiler::CSEdsc**     sortTab;
     size_t                 sortSiz;
+
+    // The CSE temps introduced so far, recorded for the register pressure estimate.
+    struct PromotedCSE
+    {
+        unsigned refCnt;
+        bool     isFloat;
+    };
+    ArrayStack<PromotedCSE>* m_promotedCSEs;
 #ifdef DEBUG
     CLRRandom m_cseRNG;
     unsigned  m_bias;
@@ -1305,6 +1313,7 @@ public:
         hugeFrame        = false;
         sortTab          = nullptr;
         sortSiz          = 0;
+        m_promotedCSEs   = new (m_pCompiler, CMK_CSE) ArrayStack<PromotedCSE>(m_pCompiler->getAllocator(CMK_CSE));
 
 #ifdef _TARGET_XARCH_
         if (m_pCompiler->compLongUsed)
@@ -1677,6 +1686,86 @@ public:
     }
 #endif
 
+    // Estimate the number of register candidates of the same register class that we expect
+    // the register allocator to prefer over a new CSE temp with the weighted ref count
+    // "cseRefCnt": the enregisterable LclVars and the CSE temps introduced so far that are
+    // referenced at least as often.
+    //
+    unsigned EstimateRegPressure(unsigned cseRefCnt, bool isFloat)
+    {
+        unsigned pressure = 0;
+
+        for (unsigned sortNum = 0; sortNum < m_pCompiler->lvaTrackedCount; sortNum++)
+        {
+            LclVarDsc* varDsc = m_pCompiler->lvaRefSorted[sortNum];
+
+            // lvaRefSorted is sorted by decreasing weighted ref count.
+            if (varDsc->lvRefCntWtd() < cseRefCnt)
+            {
+                break;
+            }
+            if (varDsc->lvDoNotEnregister || (varTypeIsFloating(varDsc->TypeGet()) != isFloat))
+            {
+                continue;
+            }
+            pressure++;
+        }
+
+        for (int i = 0; i < m_promotedCSEs->Height(); i++)
+        {
+            PromotedCSE& promoted = m_promotedCSEs->IndexRef(i);
+            if ((promoted.refCnt >= cseRefCnt) && (promoted.isFloat == isFloat))
+            {
+                pressure++;
+            }
+        }
+
+        return pressure;
+    }
+
+    // Returns true if the register pressure estimate says that a CSE temp for this candidate
+    // is unlikely to be given a register, so that it will be spilled at its defs and reloaded
+    // at its uses.
+    //
+    bool IsLikelySpilled(CSE_Candidate* candidate, unsigned cseRefCnt)
+    {
+        if (JitConfig.JitCSERegPressure() == 0)
+        {
+            return false;
+        }
+
+        bool     isFloat = varTypeIsFloating(candidate->Expr()->TypeGet());
+        unsigned regAvail;
+
+        if (isFloat)
+        {
+            regAvail = CNT_CALLEE_SAVED_FLOAT;
+            if (candidate->LiveAcrossCall() == 0)
+            {
+                regAvail += CNT_CALLEE_TRASH_FLOAT;
+            }
+        }
+        else
+        {
+            regAvail = CNT_CALLEE_ENREG;
+            if (candidate->LiveAcrossCall() == 0)
+            {
+                regAvail += CNT_CALLEE_TRASH;
+            }
+        }
+
+        unsigned pressure = EstimateRegPressure(cseRefCnt, isFloat);
+
+#ifdef DEBUG
+        if (m_pCompiler->verbose)
+        {
+            printf("CSE register pressure estimate is %u, with %u registers available\n", pressure, regAvail);
+        }
+#endif
+
+        return pressure >= regAvail;
+    }
+
     // Given a CSE candidate decide whether it passes or fails the profitability heuristic
     // return true if we believe that it is profitable to promote this candidate to a CSE
     //
@@ -1826,7 +1915,10 @@ public:
         }
         else // not SMALL_CODE ...
         {
-            if (cseRefCnt >= aggressiveRefCnt)
+            // A CSE temp that we expect to be spilled is only worth it under the conservative costs.
+            bool likelySpilled = IsLikelySpilled(candidate, cseRefCnt);
+
+            if (!likelySpilled && (cseRefCnt >= aggressiveRefCnt))
             {
 #ifdef DEBUG
                 if (m_pCompiler->verbose)
@@ -1837,7 +1929,7 @@ public:
                 cse_def_cost = 1;
                 cse_use_cost = 1;
             }
-            else if (cseRefCnt >= moderateRefCnt)
+            else if (!likelySpilled && (cseRefCnt >= moderateRefCnt))
             {
 
                 if (candidate->LiveAcrossCall() == 0)
@@ -2012,6 +2104,7 @@ public:
 
         // Record that we created a new LclVar for use as a CSE temp
         m_addCSEcount++;
+        m_promotedCSEs->Push({cseRefCnt, varTypeIsFloating(cseLclVarTyp)});
         m_pCompiler->optCSEcount++;
 
         //  Walk all references to this CSE, adding an assignment
@@ -3920,6 +3920,18 @@ void Compiler::optUnrollLoops()
     DONE_LOOP:;
     }
 
+    // Loops that could not be fully unrolled may still be worth partially unrolling.
+    if (JitConfig.JitPartialUnroll() != 0)
+    {
+        for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+        {
+            if (optPartiallyUnrollLoop(lnum))
+            {
+                change = true;
+            }
+        }
+    }
+
     if (change)
     {
         fgUpdateChangedFlowGraph();
@@ -3933,6 +3945,384 @@ void Compiler::optUnrollLoops()
 #pragma warning(pop)
 #endif
 
+//------------------------------------------------------------------------
+// optPartiallyUnrollLoop: Unroll a small counted loop whose trip count is
+//    not known at compile time.
+//
+// Arguments:
+//    lnum - the loop to unroll
+//
+// Return Value:
+//    true if the loop was unrolled (and the flow graph changed).
+//
+// Notes:
+//    Only single block do-while loops of the form
+//
+//        do { body; i += c; } while (i < limit);   (or i <= limit)
+//
+//    are handled, where 'limit' is a constant, an invariant local or the
+//    length of an invariant array. With K the unroll factor and
+//    'limitK' = limit - (K-1)*c, the loop becomes
+//
+//        if (!(i < limitK)) goto REMAINDER;
+//    MAIN:
+//        do { body; i += c; ... K times ... } while (i < limitK);
+//        if (!(i < limit)) goto EXIT;
+//    REMAINDER:
+//        do { body; i += c; } while (i < limit);
+//    EXIT:
+//
+//    The main loop only starts an unrolled iteration when all K copies of
+//    the body would have run in the original loop, so the tests between the
+//    copies can be dropped. The original loop is left untouched as the
+//    remainder loop. The loop table entry is retargeted to the main loop,
+//    which is where the time goes.
+//
+//    Loop cloning runs first, so the body of a cloned fast path loop no
+//    longer has range checks for the unroller to duplicate. The restriction
+//    that keeps the full unroller away from cloned loops does not apply here,
+//    as the iterator value on entry is not needed.
+
+bool Compiler::optPartiallyUnrollLoop(unsigned lnum)
+{
+    const unsigned UNROLL_FACTOR = 4;
+
+    static const int UNROLL_LIMIT_SZ[COUNT_OPT_CODE + 1] = {
+        150, // BLENDED_CODE
+        0,   // SMALL_CODE
+        300, // FAST_CODE
+        0    // COUNT_OPT_CODE
+    };
+
+    int unrollLimitSz = UNROLL_LIMIT_SZ[compCodeOpt()];
+
+    if (unrollLimitSz == 0)
+    {
+        return false;
+    }
+
+    LoopDsc& loop = optLoopTable[lnum];
+
+    const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ITER;
+
+    if (((loop.lpFlags & requiredFlags) != requiredFlags) || ((loop.lpFlags & LPFLG_REMOVED) != 0))
+    {
+        return false;
+    }
+
+    if ((loop.lpFlags & (LPFLG_CONST_LIMIT | LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT)) == 0)
+    {
+        return false;
+    }
+
+    BasicBlock* head  = loop.lpHead;
+    BasicBlock* block = loop.lpTop;
+
+    // The loop must be a single block that branches back to itself, entered by falling
+    // out of the head.
+    if ((loop.lpFirst != block) || (loop.lpEntry != block) || (loop.lpBottom != block) ||
+        (block->bbJumpKind != BBJ_COND) || (block->bbJumpDest != block) || (head->bbNext != block))
+    {
+        return false;
+    }
+
+    if ((head->bbJumpKind != BBJ_NONE) && ((head->bbJumpKind != BBJ_COND) || (head->bbJumpDest == block)))
+    {
+        return false;
+    }
+
+    if (block->isRunRarely() || !BasicBlock::sameEHRegion(head, block) || bbIsTryBeg(block) ||
+        bbIsHandlerBeg(block))
+    {
+        return false;
+    }
+
+    // The new blocks go in front of the loop; that has to keep them inside the enclosing loops.
+    for (unsigned char parent = loop.lpParent; parent != BasicBlock::NOT_IN_LOOP;
+         parent               = optLoopTable[parent].lpParent)
+    {
+        LoopDsc& outer = optLoopTable[parent];
+        if ((outer.lpFirst == block) || (outer.lpTop == block) || (outer.lpEntry == block) ||
+            (outer.lpExit == block))
+        {
+            return false;
+        }
+    }
+
+    // Check the iterator: "i = i + c", with c > 0 and no overflow check.
+    unsigned lvar = loop.lpIterVar();
+
+    if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterTree->gtOp.gtOp2->gtOverflow()) ||
+        (loop.lpIterOperType() != TYP_INT))
+    {
+        return false;
+    }
+
+    int iterInc = loop.lpIterConst();
+
+    if ((iterInc <= 0) || (iterInc > 1024))
+    {
+        return false;
+    }
+
+    if (lvaTable[lvar].lvAddrExposed || lvaTable[lvar].lvIsStructField || (lvaTable[lvar].TypeGet() != TYP_INT))
+    {
+        return false;
+    }
+
+    // Check the test, which must be the last statement of the block: "i < limit" or "i <= limit".
+    GenTreeStmt* testStmt = block->lastStmt();
+    GenTree*     test     = testStmt->gtStmtExpr;
+
+    if ((test->gtOper != GT_JTRUE) || (test->gtGetOp1() != loop.lpTestTree))
+    {
+        return false;
+    }
+
+    genTreeOps testOper = loop.lpTestOper();
+
+    if (((testOper != GT_LT) && (testOper != GT_LE)) || ((loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0))
+    {
+        return false;
+    }
+
+    GenTree* limit       = loop.lpLimit();
+    int      limitAdjust = (int)(UNROLL_FACTOR - 1) * iterInc;
+
+    if ((loop.lpFlags & LPFLG_CONST_LIMIT) != 0)
+    {
+        if (loop.lpConstLimit() < INT_MIN + limitAdjust)
+        {
+            return false;
+        }
+    }
+    else if ((loop.lpFlags & LPFLG_ARRLEN_LIMIT) != 0)
+    {
+        // The unrolled loop's guard evaluates the limit ahead of the loop; make sure
+        // it is the same array every time, and that evaluating it early can't fault
+        // where the original loop wouldn't have (a zero trip test has already done so).
+        GenTree* arrRef = limit->gtArrLen.ArrRef();
+
+        if ((arrRef->gtOper != GT_LCL_VAR) || optIsVarAssigned(block, block, nullptr, arrRef->AsLclVarCommon()->GetLclNum()))
+        {
+            return false;
+        }
+
+        if (((limit->gtFlags & GTF_EXCEPT) != 0) && ((loop.lpTestTree->gtFlags & GTF_RELOP_ZTT) == 0))
+        {
+            return false;
+        }
+    }
+    else
+    {
+#ifndef _TARGET_64BIT_
+        // "limit - (K-1)*c" can underflow for an arbitrary local; we compute it as a long,
+        // which is only cheap on 64 bit targets.
+        return false;
+#endif
+    }
+
+    // Estimate the size of the body and clone it up front, as gtCloneExpr doesn't handle everything.
+    ClrSafeInt<unsigned> loopCostSz;
+    unsigned             bodyStmtCount = 0;
+
+    for (GenTreeStmt* stmt = block->firstStmt(); stmt != testStmt; stmt = stmt->gtNextStmt)
+    {
+        gtSetStmtInfo(stmt);
+        loopCostSz += stmt->gtCostSz;
+        bodyStmtCount++;
+    }
+
+    ClrSafeInt<unsigned> unrollCostSz = loopCostSz * ClrSafeInt<unsigned>(UNROLL_FACTOR - 1);
+
+    if ((bodyStmtCount == 0) || unrollCostSz.IsOverflow() || (unrollCostSz.Value() > (unsigned)unrollLimitSz))
+    {
+        return false;
+    }
+
+    ArrayStack<GenTreeStmt*> clones(getAllocator(CMK_LoopOpt));
+
+    for (unsigned iter = 0; iter < UNROLL_FACTOR; iter++)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt != testStmt; stmt = stmt->gtNextStmt)
+        {
+            GenTree* clone = gtCloneExpr(stmt->gtStmtExpr);
+
+            if (clone == nullptr)
+            {
+                return false;
+            }
+
+            clones.Push(fgNewStmtFromTree(clone, stmt->gtStmtILoffsx));
+        }
+    }
+
+    JITDUMP("\nPartially unrolling loop L%02u (" FMT_BB ") over V%02u by %u, unrollCostSz = %u\n", lnum,
+            block->bbNum, lvar, UNROLL_FACTOR, unrollCostSz.Value());
+
+    // Builds "i <oper> limit - (K-1)*c", or "i <oper> limit" when not adjusting.
+    auto makeTest = [&](genTreeOps oper, bool adjust) -> GenTree* {
+        GenTree* iterOp  = gtNewLclvNode(lvar, TYP_INT);
+        GenTree* limitOp = gtCloneExpr(limit);
+
+        if (adjust)
+        {
+            if ((loop.lpFlags & LPFLG_CONST_LIMIT) != 0)
+            {
+                limitOp = gtNewIconNode(loop.lpConstLimit() - limitAdjust);
+            }
+#ifdef _TARGET_64BIT_
+            else if ((loop.lpFlags & LPFLG_VAR_LIMIT) != 0)
+            {
+                iterOp  = gtNewCastNode(TYP_LONG, iterOp, false, TYP_LONG);
+                limitOp = gtNewCastNode(TYP_LONG, limitOp, false, TYP_LONG);
+                limitOp = gtNewOperNode(GT_SUB, TYP_LONG, limitOp, gtNewLconNode(limitAdjust));
+            }
+#endif
+            else
+            {
+                limitOp = gtNewOperNode(GT_SUB, TYP_INT, limitOp, gtNewIconNode(limitAdjust));
+            }
+        }
+
+        return gtNewOperNode(GT_JTRUE, TYP_VOID, gtNewOperNode(oper, TYP_INT, iterOp, limitOp));
+    };
+
+    BasicBlock* exit = block->bbNext;
+
+    // "if (!(i < limitK)) goto REMAINDER", falling into the main loop.
+    BasicBlock* mainGuard = fgNewBBbefore(BBJ_COND, block, /* extendRegion */ true);
+    mainGuard->inheritWeight(head);
+    mainGuard->bbNatLoopNum = loop.lpParent;
+    mainGuard->bbJumpDest   = block;
+
+    // The main loop, with the body repeated UNROLL_FACTOR times.
+    BasicBlock* mainLoop = fgNewBBbefore(BBJ_COND, block, /* extendRegion */ true);
+    mainLoop->inheritWeight(block);
+    mainLoop->bbNatLoopNum = lnum;
+    mainLoop->bbJumpDest   = mainLoop;
+    mainLoop->bbFlags |= BBF_JMP_TARGET | BBF_HAS_LABEL | BBF_LOOP_HEAD |
+                         (block->bbFlags & (BBF_NEEDS_GCPOLL | BBF_GC_SAFE_POINT | BBF_HAS_IDX_LEN |
+                                            BBF_HAS_NEWARRAY | BBF_HAS_NEWOBJ | BBF_HAS_NULLCHECK | BBF_HAS_VTABREF));
+
+    // "if (!(i < limit)) goto EXIT", falling into the remainder loop.
+    BasicBlock* remainderGuard = fgNewBBbefore(BBJ_COND, block, /* extendRegion */ true);
+    remainderGuard->inheritWeight(head);
+    remainderGuard->bbNatLoopNum = loop.lpParent;
+    remainderGuard->bbJumpDest   = exit;
+    exit->bbFlags |= BBF_JMP_TARGET | BBF_HAS_LABEL;
+
+    for (int i = 0; i < clones.Height(); i++)
+    {
+        fgInsertStmtAtEnd(mainLoop, clones.Index(i));
+    }
+
+    GenTreeStmt* stmt;
+
+    stmt = fgNewStmtFromTree(makeTest(GenTree::ReverseRelop(testOper), true), testStmt->gtStmtILoffsx);
+    fgInsertStmtAtEnd(mainGuard, stmt);
+    fgMorphBlockStmt(mainGuard, stmt DEBUGARG("Partial unroll guard"));
+
+    stmt = fgNewStmtFromTree(makeTest(testOper, true), testStmt->gtStmtILoffsx);
+    fgInsertStmtAtEnd(mainLoop, stmt);
+    fgMorphBlockStmt(mainLoop, stmt DEBUGARG("Partial unroll test"));
+
+    stmt = fgNewStmtFromTree(makeTest(GenTree::ReverseRelop(testOper), false), testStmt->gtStmtILoffsx);
+    fgInsertStmtAtEnd(remainderGuard, stmt);
+    fgMorphBlockStmt(remainderGuard, stmt DEBUGARG("Partial unroll remainder guard"));
+
+    // The remainder loop runs fewer than UNROLL_FACTOR times per entry and is no longer
+    // tracked in the loop table.
+    block->inheritWeight(head);
+    block->modifyBBWeight(block->bbWeight * (UNROLL_FACTOR - 1));
+    block->bbNatLoopNum = loop.lpParent;
+
+    // The iterator assignment and test now occur several times in the loop.
+    loop.lpFlags &= ~(LPFLG_ITER | LPFLG_CONST | LPFLG_VAR_INIT | LPFLG_CONST_INIT | LPFLG_CONST_LIMIT |
+                      LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT | LPFLG_SIMD_LIMIT | LPFLG_HAS_PREHEAD | LPFLG_ASGVARS_YES |
+                      LPFLG_ASGVARS_INC);
+    loop.lpFlags |= LPFLG_ONE_EXIT | LPFLG_DONT_UNROLL;
+    loop.lpFirst = loop.lpTop = loop.lpEntry = loop.lpBottom = loop.lpExit = mainLoop;
+    loop.lpExitCnt = 1;
+    optUpdateLoopHead(lnum, head, mainGuard);
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optIdentifyLoopsForAlignment: Mark the top block of each hot innermost loop
+//    with BBF_LOOP_ALIGN, so that codegen pads the code in front of it out to
+//    an alignment boundary.
+//
+// Notes:
+//    Tight loops are sensitive to where their top lands relative to the 32 byte
+//    fetch and decoded uop cache windows, so unrelated changes elsewhere in the
+//    method can shift their performance around. Only loops without nested loops
+//    whose top is expected to run at least JitAlignHotLoopMinWeight times per call
+//    of the method are aligned; the padding spent on any one loop is bounded by
+//    JitAlignHotLoopMaxPadding (see emitter::emitLoopAlign).
+//
+//    Must run after loop unrolling, as unrolled loops are no longer loops.
+
+void Compiler::optIdentifyLoopsForAlignment()
+{
+#ifdef _TARGET_XARCH_
+    if (JitConfig.JitAlignHotLoops() == 0)
+    {
+        return;
+    }
+
+    // The emitter can only align against final code addresses, which prejitted
+    // code does not know. When the VM asks for all loops to be aligned there is
+    // nothing more to do here either.
+    if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_RELOC) || codeGen->genAlignLoops ||
+        (compCodeOpt() == SMALL_CODE))
+    {
+        return;
+    }
+
+    const BasicBlock::weight_t calledCount = max(fgCalledCount, (BasicBlock::weight_t)BB_UNITY_WEIGHT);
+    const BasicBlock::weight_t minWeight   = JitConfig.JitAlignHotLoopMinWeight() * calledCount;
+
+    for (unsigned loopInd = 0; loopInd < optLoopCount; loopInd++)
+    {
+        LoopDsc& loop = optLoopTable[loopInd];
+
+        if ((loop.lpFlags & LPFLG_REMOVED) != 0)
+        {
+            continue;
+        }
+
+        bool hasChildLoop = false;
+        for (unsigned char child = loop.lpChild; child != BasicBlock::NOT_IN_LOOP;
+             child               = optLoopTable[child].lpSibling)
+        {
+            if ((optLoopTable[child].lpFlags & LPFLG_REMOVED) == 0)
+            {
+                hasChildLoop = true;
+                break;
+            }
+        }
+
+        if (hasChildLoop)
+        {
+            continue;
+        }
+
+        BasicBlock* top = loop.lpTop;
+
+        if (top->isRunRarely() || (top->bbWeight < minWeight))
+        {
+            continue;
+        }
+
+        JITDUMP("Marking " FMT_BB " (weight=%s), the top of inner loop L%02u, for alignment\n", top->bbNum,
+                refCntWtd2str(top->bbWeight), loopInd);
+        top->bbFlags |= BBF_LOOP_ALIGN;
+    }
+#endif // _TARGET_XARCH_
+}
+
 /*****************************************************************************
  *
  *  Return false if there is a code path from 'topBB' to 'botBB' that might
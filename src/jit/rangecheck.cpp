@@ -320,6 +320,25 @@ void RangeCheck::Widen(BasicBlock* block, GenTree* tree, Range* pRange)
             *pRange = GetRange(block, tree, true DEBUGARG(0));
         }
     }
+
+    // Try to deduce the upper bound of a down-counting induction variable, like the "i"
+    // in "for (i = a.len - 1; i >= 0; i--)". The lower bound must already be known (it
+    // typically comes from the loop exit test); the upper bound is then the largest value
+    // flowing in from outside of the loop.
+    if (range.UpperLimit().IsDependent() && !range.LowerLimit().IsDependent() && !range.LowerLimit().IsUnknown())
+    {
+        bool decreasing = IsMonotonicallyDecreasing(tree, false);
+        JITDUMP("IsMonotonicallyDecreasing %d", decreasing);
+        if (decreasing)
+        {
+            // The monotonic merge ignores the dependent limits on both ends, so the lower
+            // limit it computes is only the initial value. Keep the one we already proved.
+            Limit lowerLimit = range.LowerLimit();
+            GetRangeMap()->RemoveAll();
+            *pRange        = GetRange(block, tree, true DEBUGARG(0));
+            pRange->lLimit = lowerLimit;
+        }
+    }
 }
 
 bool RangeCheck::IsBinOpMonotonicallyIncreasing(GenTreeOp* binop)
@@ -424,6 +443,108 @@ bool RangeCheck::IsMonotonicallyIncreasing(GenTree* expr, bool rejectNegativeCon
     return false;
 }
 
+bool RangeCheck::IsBinOpMonotonicallyDecreasing(GenTreeOp* binop)
+{
+    assert(binop->OperIs(GT_ADD));
+
+    GenTree* op1 = binop->gtGetOp1();
+    GenTree* op2 = binop->gtGetOp2();
+
+    JITDUMP("[RangeCheck::IsBinOpMonotonicallyDecreasing] [%06d], [%06d]\n", Compiler::dspTreeID(op1),
+            Compiler::dspTreeID(op2));
+    // Check if we have a var + const, where morph has already turned "var - const" into "var + (-const)".
+    if (op2->OperGet() == GT_LCL_VAR)
+    {
+        jitstd::swap(op1, op2);
+    }
+    if (op1->OperGet() != GT_LCL_VAR)
+    {
+        JITDUMP("Not monotonic because op1 is not lclVar.\n");
+        return false;
+    }
+    switch (op2->OperGet())
+    {
+        case GT_LCL_VAR:
+            // When adding two local variables, we also must ensure that any constant is non-positive.
+            return IsMonotonicallyDecreasing(op1, true) && IsMonotonicallyDecreasing(op2, true);
+
+        case GT_CNS_INT:
+            return (op2->AsIntConCommon()->IconValue() <= 0) && IsMonotonicallyDecreasing(op1, false);
+
+        default:
+            JITDUMP("Not monotonic because expression is not recognized.\n");
+            return false;
+    }
+}
+
+// The parameter rejectPositiveConst is true when we are adding two local vars (see above)
+bool RangeCheck::IsMonotonicallyDecreasing(GenTree* expr, bool rejectPositiveConst)
+{
+    JITDUMP("[RangeCheck::IsMonotonicallyDecreasing] [%06d]\n", Compiler::dspTreeID(expr));
+
+    // Add hashtable entry for expr.
+    bool alreadyPresent = m_pSearchPath->Set(expr, nullptr);
+    if (alreadyPresent)
+    {
+        return true;
+    }
+
+    // Remove hashtable entry for expr when we exit the present scope.
+    auto                                         code = [this, expr] { m_pSearchPath->Remove(expr); };
+    jitstd::utility::scoped_code<decltype(code)> finally(code);
+
+    if (m_pSearchPath->GetCount() > MAX_SEARCH_DEPTH)
+    {
+        return false;
+    }
+
+    // If expr is constant, then it is not part of the dependency
+    // loop which has to decrease monotonically.
+    ValueNum vn = expr->gtVNPair.GetConservative();
+    if (m_pCompiler->vnStore->IsVNInt32Constant(vn))
+    {
+        if (rejectPositiveConst)
+        {
+            int cons = m_pCompiler->vnStore->ConstantValue<int>(vn);
+            return (cons <= 0);
+        }
+        else
+        {
+            return true;
+        }
+    }
+    // If the rhs expr is local, then try to find the def of the local.
+    else if (expr->IsLocal())
+    {
+        BasicBlock* asgBlock;
+        GenTreeOp*  asg = GetSsaDefAsg(expr->AsLclVarCommon(), &asgBlock);
+        return (asg != nullptr) && IsMonotonicallyDecreasing(asg->gtGetOp2(), rejectPositiveConst);
+    }
+    else if (expr->OperGet() == GT_ADD)
+    {
+        return IsBinOpMonotonicallyDecreasing(expr->AsOp());
+    }
+    else if (expr->OperGet() == GT_PHI)
+    {
+        for (GenTreeArgList* args = expr->gtOp.gtOp1->AsArgList(); args != nullptr; args = args->Rest())
+        {
+            // If the arg is already in the path, skip.
+            if (m_pSearchPath->Lookup(args->Current()))
+            {
+                continue;
+            }
+            if (!IsMonotonicallyDecreasing(args->Current(), rejectPositiveConst))
+            {
+                JITDUMP("Phi argument not monotonic\n");
+                return false;
+            }
+        }
+        return true;
+    }
+    JITDUMP("Unknown tree type\n");
+    return false;
+}
+
 // Given a lclvar use, try to find the lclvar's defining assignment and its containing block.
 GenTreeOp* RangeCheck::GetSsaDefAsg(GenTreeLclVarCommon* lclUse, BasicBlock** asgBlock)
 {
@@ -524,6 +524,14 @@ public:
     //
     bool IsMonotonicallyIncreasing(GenTree* tree, bool rejectNegativeConst);
 
+    // Is the binary operation decreasing the value.
+    bool IsBinOpMonotonicallyDecreasing(GenTreeOp* binop);
+
+    // Given an "expr" trace its rhs and their definitions to check if all the assignments
+    // are monotonically decreasing.
+    //
+    bool IsMonotonicallyDecreasing(GenTree* tree, bool rejectPositiveConst);
+
     // We allocate a budget to avoid walking long UD chains. When traversing each link in the UD
     // chain, we decrement the budget. When the budget hits 0, then no more range check optimization
     // will be applied for the currently compiled method.
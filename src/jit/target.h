@@ -224,6 +224,9 @@ typedef unsigned char   regNumberSmall;
                                            //       on pre-Ivy Bridge hardware.
                                            // threshold to stop generating rep movs and switch to the helper call.
   #define INITBLK_UNROLL_LIMIT     128     // Upper bound to let the code generator to loop unroll InitBlk.
+  #define CPBLK_UNROLL_LIMIT_AVX   256     // Upper bound to loop unroll CpBlk using 32-byte moves when AVX is available.
+  #define INITBLK_UNROLL_LIMIT_AVX 256     // Upper bound to loop unroll a zeroing InitBlk using 32-byte stores when AVX
+                                           // is available.
   #define CPOBJ_NONGC_SLOTS_LIMIT  4       // For CpObj code generation, this is the the threshold of the number 
                                            // of contiguous non-gc slots that trigger generating rep movsq instead of 
                                            // sequences of movsq instructions
@@ -507,6 +510,9 @@ typedef unsigned char   regNumberSmall;
                                            //       on pre-Ivy Bridge hardware.
                                            // threshold to stop generating rep movs and switch to the helper call.
   #define INITBLK_UNROLL_LIMIT     128     // Upper bound to let the code generator to loop unroll InitBlk.
+  #define CPBLK_UNROLL_LIMIT_AVX   256     // Upper bound to loop unroll CpBlk using 32-byte moves when AVX is available.
+  #define INITBLK_UNROLL_LIMIT_AVX 256     // Upper bound to loop unroll a zeroing InitBlk using 32-byte stores when AVX
+                                           // is available.
   #define CPOBJ_NONGC_SLOTS_LIMIT  4       // For CpObj code generation, this is the the threshold of the number 
                                            // of contiguous non-gc slots that trigger generating rep movsq instead of 
                                            // sequences of movsq instructions
@@ -61,6 +61,7 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pTypeDefNameMap(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -76,6 +77,9 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    if (m_pTypeDefNameMap)
+        delete[] m_pTypeDefNameMap;
+    m_pTypeDefNameMap = 0;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -1964,12 +1968,9 @@ MDInternalRO::FindTypeDef(
     if (szTypeDefNamespace == NULL)
         szTypeDefNamespace = "";
     
-    // Do a linear search
     ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
-    TypeDefRec * pTypeDefRec;
     LPCUTF8      szName;
     LPCUTF8      szNamespace;
-    DWORD        dwFlags;
     
     // Get TypeDef of the tkEnclosingClass passed in
     if (TypeFromToken(tkEnclosingClass) == mdtTypeRef)
@@ -1991,55 +1992,172 @@ MDInternalRO::FindTypeDef(
         _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
     }
     
-    // Search for the TypeDef
-    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+#ifndef DACCESS_COMPILE
+    // Lazy initialization of m_pTypeDefNameMap
+    if ((cTypeDefRecs > 10) && (m_pTypeDefNameMap == NULL))
     {
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
-        
-        dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
-        
-        if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
-        {
-            // If the class is not Nested and EnclosingClass passed in is not nil
-            continue;
-        }
-        else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+        NewHolder<CTypeDefNameMap> pTypeDefNameMap = new (nothrow) CTypeDefNameMap[cTypeDefRecs];
+        if (pTypeDefNameMap != NULL)
         {
-            // If the class is nested and EnclosingClass passed is nil
-            continue;
-        }
-        else if (!IsNilToken(tkEnclosingClass))
-        {
-            _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
-            
-            RID              iNestedClassRec;
-            NestedClassRec * pNestedClassRec;
-            mdTypeDef        tkEnclosingClassTmp;
+            TypeDefRec * pTypeDefRec;
+
+            // Fill the table in TypeDef order.
+            for (ULONG i = 1; i <= cTypeDefRecs; i++)
+            {
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+                pTypeDefNameMap[i-1].m_ulNameHash = HashStringA(szName);
+                pTypeDefNameMap[i-1].m_ridTypeDef = i;
+            }
+            // Sort to name hash order.
+            CTypeDefNameMapSorter sorter(pTypeDefNameMap, cTypeDefRecs);
+            sorter.Sort();
             
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(i, &iNestedClassRec));
-            if (InvalidRid(iNestedClassRec))
-                continue;
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
-            tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
-            if (tkEnclosingClass != tkEnclosingClassTmp)
-                continue;
+            if (InterlockedCompareExchangeT<CTypeDefNameMap *>(
+                &m_pTypeDefNameMap, pTypeDefNameMap, NULL) == NULL)
+            {   // The exchange did happen, supress of the allocated map
+                pTypeDefNameMap.SuppressRelease();
+            }
         }
-        
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
-        if (strcmp(szTypeDefName, szName) == 0)
+    }
+#endif //!DACCESS_COMPILE
+
+    BOOL fMatch;
+
+    // Use m_pTypeDefNameMap if it has been built.
+    if (m_pTypeDefNameMap != NULL)
+    {
+        CTypeDefNameMapSearcher searcher(m_pTypeDefNameMap, cTypeDefRecs);
+        CTypeDefNameMap target;
+        target.m_ulNameHash = HashStringA(szTypeDefName);
+        const CTypeDefNameMap * pMatched = searcher.Find(&target);
+        if (pMatched == NULL)
+            return CLDB_E_RECORD_NOTFOUND;
+
+        // Back up to the first entry with this hash, then try them in TypeDef order.
+        while ((pMatched > m_pTypeDefNameMap) && (pMatched[-1].m_ulNameHash == target.m_ulNameHash))
+            pMatched--;
+
+        for (; (pMatched < m_pTypeDefNameMap + cTypeDefRecs) && (pMatched->m_ulNameHash == target.m_ulNameHash); pMatched++)
         {
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
-            if (strcmp(szTypeDefNamespace, szNamespace) == 0)
+            IfFailRet(IsMatchingTypeDef(pMatched->m_ridTypeDef, szTypeDefNamespace, szTypeDefName, tkEnclosingClass, &fMatch));
+            if (fMatch)
             {
-                *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+                *ptkTypeDef = TokenFromRid(pMatched->m_ridTypeDef, mdtTypeDef);
                 return S_OK;
             }
         }
+        // Cannot find the TypeDef by name
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+
+    // Do a linear search
+    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+    {
+        IfFailRet(IsMatchingTypeDef(i, szTypeDefNamespace, szTypeDefName, tkEnclosingClass, &fMatch));
+        if (fMatch)
+        {
+            *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+            return S_OK;
+        }
     }
     // Cannot find the TypeDef by name
     return CLDB_E_RECORD_NOTFOUND;
 } // MDInternalRO::FindTypeDef
 
+//*****************************************************************************
+// Check whether a TypeDef has the given name, namespace and enclosing class
+//*****************************************************************************
+__checkReturn 
+HRESULT 
+MDInternalRO::IsMatchingTypeDef(
+    RID         ridTypeDef,         // [IN] TypeDef to check.
+    LPCSTR      szTypeDefNamespace, // [IN] Namespace for the TypeDef.
+    LPCSTR      szTypeDefName,      // [IN] Name of the TypeDef.
+    mdToken     tkEnclosingClass,   // [IN] TypeDef of enclosing class, or nil.
+    BOOL      * pfMatch)            // [OUT] TRUE if the TypeDef matches.
+{
+    HRESULT      hr = S_OK;
+    TypeDefRec * pTypeDefRec;
+    LPCUTF8      szName;
+    LPCUTF8      szNamespace;
+    DWORD        dwFlags;
+
+    *pfMatch = FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(ridTypeDef, &pTypeDefRec));
+    
+    dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+    
+    if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+    {
+        // If the class is not Nested and EnclosingClass passed in is not nil
+        return S_OK;
+    }
+    else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+    {
+        // If the class is nested and EnclosingClass passed is nil
+        return S_OK;
+    }
+    
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+    if (strcmp(szTypeDefName, szName) != 0)
+        return S_OK;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+    if (strcmp(szTypeDefNamespace, szNamespace) != 0)
+        return S_OK;
+
+    if (!IsNilToken(tkEnclosingClass))
+    {
+        _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
+        
+        RID              iNestedClassRec;
+        NestedClassRec * pNestedClassRec;
+        mdTypeDef        tkEnclosingClassTmp;
+        
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(ridTypeDef, &iNestedClassRec));
+        if (InvalidRid(iNestedClassRec))
+            return S_OK;
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
+        tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
+        if (tkEnclosingClass != tkEnclosingClassTmp)
+            return S_OK;
+    }
+
+    *pfMatch = TRUE;
+    return S_OK;
+} // MDInternalRO::IsMatchingTypeDef
+
+int MDInternalRO::CTypeDefNameMapSearcher::Compare(
+    const CTypeDefNameMap *psFirst, 
+    const CTypeDefNameMap *psSecond)
+{
+    if (psFirst->m_ulNameHash < psSecond->m_ulNameHash)
+        return -1;
+    if (psFirst->m_ulNameHash > psSecond->m_ulNameHash)
+        return 1;
+    return 0;
+} // MDInternalRO::CTypeDefNameMapSearcher::Compare
+
+#ifndef DACCESS_COMPILE
+int MDInternalRO::CTypeDefNameMapSorter::Compare(
+    CTypeDefNameMap *psFirst, 
+    CTypeDefNameMap *psSecond)
+{
+    if (psFirst->m_ulNameHash < psSecond->m_ulNameHash)
+        return -1;
+    if (psFirst->m_ulNameHash > psSecond->m_ulNameHash)
+        return 1;
+    // Keep TypeDef order for equal hashes, so the first matching TypeDef is found as before.
+    if (psFirst->m_ridTypeDef < psSecond->m_ridTypeDef)
+        return -1;
+    if (psFirst->m_ridTypeDef > psSecond->m_ridTypeDef)
+        return 1;
+    return 0;
+} // MDInternalRO::CTypeDefNameMapSorter::Compare
+#endif //!DACCESS_COMPILE
+
 //*****************************************************************************
 // Given a memberref, return a pointer to memberref's name and signature
 //*****************************************************************************
@@ -824,6 +824,37 @@ private:
         virtual int Compare(const CMethodSemanticsMap *psFirst, const CMethodSemanticsMap *psSecond);
     };
 
+    struct CTypeDefNameMap
+    {
+        ULONG           m_ulNameHash;       // Hash of the TypeDef name.
+        RID             m_ridTypeDef;       // RID of the TypeDef record.
+    };
+    CTypeDefNameMap *m_pTypeDefNameMap;     // Possible array of TypeDefs, ordered by name hash.
+
+#ifndef DACCESS_COMPILE
+    class CTypeDefNameMapSorter : public CQuickSort<CTypeDefNameMap>
+    {
+    public:
+         CTypeDefNameMapSorter(CTypeDefNameMap *pBase, int iCount) : CQuickSort<CTypeDefNameMap>(pBase, iCount) {}
+         virtual int Compare(CTypeDefNameMap *psFirst, CTypeDefNameMap *psSecond);
+    };
+#endif //!DACCESS_COMPILE
+
+    class CTypeDefNameMapSearcher : public CBinarySearch<CTypeDefNameMap>
+    {
+    public:
+        CTypeDefNameMapSearcher(const CTypeDefNameMap *pBase, int iCount) : CBinarySearch<CTypeDefNameMap>(pBase, iCount) {}
+        virtual int Compare(const CTypeDefNameMap *psFirst, const CTypeDefNameMap *psSecond);
+    };
+
+    __checkReturn 
+    HRESULT IsMatchingTypeDef(
+        RID         ridTypeDef,
+        LPCSTR      szTypeDefNamespace,
+        LPCSTR      szTypeDefName,
+        mdToken     tkEnclosingClass,
+        BOOL      * pfMatch);
+
     static BOOL CompareSignatures(PCCOR_SIGNATURE pvFirstSigBlob, DWORD cbFirstSigBlob,
                                   PCCOR_SIGNATURE pvSecondSigBlob, DWORD cbSecondSigBlob,
                                   void* SigARguments);
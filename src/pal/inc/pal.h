@@ -2526,6 +2526,16 @@ CreateFileMappingW(
 #define FILE_MAP_ALL_ACCESS SECTION_ALL_ACCESS
 #define FILE_MAP_COPY       SECTION_QUERY
 
+// PAL-specific hints that can be combined with the access passed to MapViewOfFile(Ex).
+// They only affect how the view is faulted in and are ignored where the platform has no
+// equivalent.
+#define FILE_MAP_PAL_PREFAULT    0x01000000 // fault in the whole view up front
+#define FILE_MAP_PAL_SEQUENTIAL  0x02000000 // the view will be read sequentially
+#define FILE_MAP_PAL_RANDOM      0x04000000 // the view will be accessed randomly
+#define FILE_MAP_PAL_HUGE_PAGES  0x08000000 // back the view with huge pages if possible
+#define FILE_MAP_PAL_HINTS       (FILE_MAP_PAL_PREFAULT | FILE_MAP_PAL_SEQUENTIAL | \
+                                  FILE_MAP_PAL_RANDOM | FILE_MAP_PAL_HUGE_PAGES)
+
 PALIMPORT
 HANDLE
 PALAPI
@@ -599,14 +599,17 @@ static void inject_activation_handler(int code, siginfo_t *siginfo, void *contex
 
         native_context_t *ucontext = (native_context_t *)context;
 
-        CONTEXT winContext;
-        CONTEXTFromNativeContext(
-            ucontext, 
-            &winContext, 
-            CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
-
-        if (g_safeActivationCheckFunction(CONTEXTGetPC(&winContext), /* checkingCurrentThread */ TRUE))
+        // The safety check only needs the PC, so read it straight from the native
+        // context and only build the full windows context when the activation
+        // function is actually going to run
+        if (g_safeActivationCheckFunction((SIZE_T)GetNativeContextPC(ucontext), /* checkingCurrentThread */ TRUE))
         {
+            CONTEXT winContext;
+            CONTEXTFromNativeContext(
+                ucontext, 
+                &winContext, 
+                CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
+
             g_activationFunction(&winContext);
             // Activation function may have modified the context, so update it.
             CONTEXTToNativeContext(&winContext, ucontext);
@@ -741,7 +741,7 @@ namespace CorUnix
 
     inline CPalThread *GetCurrentPalThread()
     {
-        return reinterpret_cast<CPalThread*>(pthread_getspecific(thObjKey));
+        return t_pCurrentPalThread;
     }
 
     inline CPalThread *InternalGetCurrentThread()
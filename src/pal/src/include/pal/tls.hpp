@@ -58,6 +58,15 @@ namespace CorUnix
 
     extern pthread_key_t thObjKey;
 
+    //
+    // Native TLS copy of the thObjKey value, kept in sync with it wherever the
+    // key is set. thObjKey is still needed for its destructor, which runs
+    // InternalEndCurrentThread on thread exit, but lookups read this copy instead
+    // of calling pthread_getspecific.
+    //
+
+    extern __thread CPalThread *t_pCurrentPalThread;
+
     CPalThread *InternalGetCurrentThread();
 }
 
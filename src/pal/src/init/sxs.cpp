@@ -131,6 +131,7 @@ AllocatePalThread(CPalThread **ppThread)
     if (NO_ERROR != palError)
     {
         pthread_setspecific(thObjKey, NULL);
+        t_pCurrentPalThread = NULL;
         pThread->ReleaseThreadReference();
         goto exit;
     }
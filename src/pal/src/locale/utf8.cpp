@@ -2859,6 +2859,69 @@ public:
 };
 
 
+////////////////////////////////////////////////////////////////////////////
+//
+//  IsAsciiBytes / IsAsciiChars
+//
+//  Test a whole string for ASCII a machine word at a time. Most strings the
+//  runtime converts (paths, environment variables, metadata names) are pure
+//  ASCII, and those convert one to one without the encoder's count pass.
+//
+////////////////////////////////////////////////////////////////////////////
+
+static bool IsAsciiBytes(const BYTE* pSrc, int count)
+{
+    const size_t highBits = (size_t)0x8080808080808080ULL;
+    int i = 0;
+
+    for (; i + (int)sizeof(size_t) <= count; i += sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, pSrc + i, sizeof(word));
+        if ((word & highBits) != 0)
+        {
+            return false;
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        if (pSrc[i] >= 0x80)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool IsAsciiChars(const WCHAR* pSrc, int count)
+{
+    const size_t highBits = (size_t)0xFF80FF80FF80FF80ULL;
+    const int charsPerWord = sizeof(size_t) / sizeof(WCHAR);
+    int i = 0;
+
+    for (; i + charsPerWord <= count; i += charsPerWord)
+    {
+        size_t word;
+        memcpy(&word, pSrc + i, sizeof(word));
+        if ((word & highBits) != 0)
+        {
+            return false;
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        if (pSrc[i] >= 0x80)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //
 //  UTF8ToUnicode
@@ -2875,6 +2938,24 @@ int UTF8ToUnicode(
     DWORD dwFlags
     )
 {
+    if (cchSrc >= 0 && IsAsciiBytes((const BYTE*)lpSrcStr, cchSrc))
+    {
+        if (cchDest)
+        {
+            if (cchSrc > cchDest)
+            {
+                SetLastError(ERROR_INSUFFICIENT_BUFFER);
+                return 0;
+            }
+
+            for (int i = 0; i < cchSrc; i++)
+            {
+                lpDestStr[i] = (WCHAR)(BYTE)lpSrcStr[i];
+            }
+        }
+        return cchSrc;
+    }
+
     int ret;
     UTF8Encoding enc(dwFlags & MB_ERR_INVALID_CHARS);
     try {
@@ -2916,6 +2997,24 @@ int UnicodeToUTF8(
     LPSTR lpDestStr,
     int cchDest)
 {
+    if (cchSrc >= 0 && IsAsciiChars((const WCHAR*)lpSrcStr, cchSrc))
+    {
+        if (cchDest)
+        {
+            if (cchSrc > cchDest)
+            {
+                SetLastError(ERROR_INSUFFICIENT_BUFFER);
+                return 0;
+            }
+
+            for (int i = 0; i < cchSrc; i++)
+            {
+                lpDestStr[i] = (char)lpSrcStr[i];
+            }
+        }
+        return cchSrc;
+    }
+
     int ret;
     UTF8Encoding enc(false);
     try{
@@ -71,6 +71,8 @@ static BOOL MAPIsRequestPermissible( DWORD, CFileProcessLocalData * );
 static BOOL MAPContainsInvalidFlags( DWORD );
 static DWORD MAPConvertProtectToAccess( DWORD );
 static INT MAPFileMapToMmapFlags( DWORD );
+static INT MAPViewHintsToMmapFlags( DWORD );
+static void MAPApplyViewHints( LPVOID, SIZE_T, DWORD );
 static DWORD MAPMmapProtToAccessFlags( int prot );
 #if ONE_SHARED_MAPPING_PER_FILEREGION_PER_PROCESS
 static NativeMapHolder * NewNativeMapHolder(CPalThread *pThread, LPVOID address, SIZE_T size, 
@@ -1094,6 +1096,9 @@ CorUnix::InternalMapViewOfFile(
     PMAPPED_VIEW_LIST pReusedMapping = NULL;
 #endif
     LPVOID pvBaseAddress = NULL;
+    DWORD dwViewHints = dwDesiredAccess & FILE_MAP_PAL_HINTS;
+
+    dwDesiredAccess &= ~FILE_MAP_PAL_HINTS;
 
     /* Sanity checks */
     if ( MAPContainsInvalidFlags( dwDesiredAccess ) )
@@ -1171,7 +1176,7 @@ CorUnix::InternalMapViewOfFile(
 
     if (FILE_MAP_COPY == dwDesiredAccess)
     {
-        int flags = MAP_PRIVATE;
+        int flags = MAP_PRIVATE | MAPViewHintsToMmapFlags(dwViewHints);
 
 #if !HAVE_MMAP_DEV_ZERO
         if (pProcessLocalData->UnixFd == -1)
@@ -1193,7 +1198,7 @@ CorUnix::InternalMapViewOfFile(
         INT prot = MAPFileMapToMmapFlags(dwDesiredAccess);
         if (prot != -1)
         {
-            int flags = MAP_SHARED;
+            int flags = MAP_SHARED | MAPViewHintsToMmapFlags(dwViewHints);
 
 #if !HAVE_MMAP_DEV_ZERO
             if (pProcessLocalData->UnixFd == -1)
@@ -1370,6 +1375,12 @@ InternalMapViewOfFileLeaveCriticalSection:
 
     InternalLeaveCriticalSection(pThread, &mapping_critsec);
 
+    // The hints are advisory, so apply them outside the lock and ignore failures
+    if (NO_ERROR == palError && 0 != dwViewHints)
+    {
+        MAPApplyViewHints(pvBaseAddress, dwNumberOfBytesToMap, dwViewHints);
+    }
+
 InternalMapViewOfFileExit:
 
     if (NULL != pProcessLocalDataLock)
@@ -1683,6 +1694,58 @@ static INT MAPFileMapToMmapFlags( DWORD flags )
     return -1;
 }
 
+/*++
+Function :
+    MAPViewHintsToMmapFlags
+
+    Converts the FILE_MAP_PAL_* hints to the mmap flags that implement them.
+--*/
+static INT MAPViewHintsToMmapFlags( DWORD dwViewHints )
+{
+    INT flags = 0;
+
+#ifdef MAP_POPULATE
+    if ( dwViewHints & FILE_MAP_PAL_PREFAULT )
+    {
+        flags |= MAP_POPULATE;
+    }
+#endif
+
+    return flags;
+}
+
+/*++
+Function :
+    MAPApplyViewHints
+
+    Passes the FILE_MAP_PAL_* access pattern hints for a new view to madvise.
+--*/
+static void MAPApplyViewHints( LPVOID lpAddress, SIZE_T size, DWORD dwViewHints )
+{
+    if ( dwViewHints & FILE_MAP_PAL_SEQUENTIAL )
+    {
+        posix_madvise( lpAddress, size, POSIX_MADV_SEQUENTIAL );
+    }
+    else if ( dwViewHints & FILE_MAP_PAL_RANDOM )
+    {
+        posix_madvise( lpAddress, size, POSIX_MADV_RANDOM );
+    }
+
+#ifndef MAP_POPULATE
+    if ( dwViewHints & FILE_MAP_PAL_PREFAULT )
+    {
+        posix_madvise( lpAddress, size, POSIX_MADV_WILLNEED );
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    if ( dwViewHints & FILE_MAP_PAL_HUGE_PAGES )
+    {
+        madvise( lpAddress, size, MADV_HUGEPAGE );
+    }
+#endif
+}
+
 /*++
 Function :
     MAPMmapProtToAccessFlags
@@ -52,6 +52,11 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entry most recently found or inserted. Lookups and inserts start their walk
+// from it when the address is above it, since callers tend to work through one
+// reservation at a time. Protected by virtual_critsec like the list itself.
+static PCMI pVirtualMemoryHint;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -172,6 +177,7 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    pVirtualMemoryHint = NULL;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -209,6 +215,7 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pVirtualMemoryHint = NULL;
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
@@ -479,7 +486,15 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
     
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
-    pEntry = pVirtualMemory;
+    /* The list is sorted, so the walk can start at the hint if the address is not below it. */
+    if ( pVirtualMemoryHint && pVirtualMemoryHint->startBoundary <= address )
+    {
+        pEntry = pVirtualMemoryHint;
+    }
+    else
+    {
+        pEntry = pVirtualMemory;
+    }
     
     while( pEntry )
     {
@@ -496,6 +511,11 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
         
         pEntry = pEntry->pNext;
     }
+
+    if ( pEntry )
+    {
+        pVirtualMemoryHint = pEntry;
+    }
     return pEntry;
 }
 
@@ -518,6 +538,11 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    if ( pMemoryToBeReleased == pVirtualMemoryHint )
+    {
+        pVirtualMemoryHint = pMemoryToBeReleased->pPrevious;
+    }
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -774,6 +799,11 @@ static BOOL VIRTUALStoreAllocationInfo(
     }
     
     pMemInfo = pVirtualMemory;
+    if (pVirtualMemoryHint && pVirtualMemoryHint->startBoundary < startBoundary)
+    {
+        /* Everything before the hint is below the new entry as well */
+        pMemInfo = pVirtualMemoryHint;
+    }
 
     if (pMemInfo && pMemInfo->startBoundary < startBoundary)
     {
@@ -808,6 +838,8 @@ static BOOL VIRTUALStoreAllocationInfo(
         pVirtualMemory = pNewEntry ;
     }
 
+    pVirtualMemoryHint = pNewEntry;
+
 #ifdef DEBUG
     VerifyRightEntry(pNewEntry);
     VerifyLeftEntry(pNewEntry);
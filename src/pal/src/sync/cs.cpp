@@ -23,6 +23,14 @@
 #include <sched.h>
 #include <pthread.h>
 
+#if defined(__linux__)
+// Contended waits and wakeups go through a futex on the CS predicate rather than
+// the native mutex and condition
+#define PALCS_FUTEX_WAIT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // __linux__
+
 using namespace CorUnix;
 
 //
@@ -1235,6 +1243,26 @@ namespace CorUnix
 
         CS_TRACE("Trying to go to sleep [CS=%p]\n", pPalCriticalSection);
 
+#ifdef PALCS_FUTEX_WAIT
+        CS_TRACE("Actually Going to sleep [CS=%p]\n", pPalCriticalSection);
+
+        // Consume the predicate, sleeping for as long as it is not set
+        while (0 == InterlockedExchange((LONG *)&pPalCriticalSection->csndNativeData.iPredicate, 0))
+        {
+            iRet = (int)syscall(SYS_futex, &pPalCriticalSection->csndNativeData.iPredicate,
+                                FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+
+            CS_TRACE("Woken up from futex [pred=%d]!\n",
+                           pPalCriticalSection->csndNativeData.iPredicate);
+            if (-1 == iRet && EAGAIN != errno && EINTR != errno)
+            {
+                ASSERT("Failed waiting on futex in CS %p [errno=%d]\n",
+                       pPalCriticalSection, errno);
+                palErr = ERROR_INTERNAL_ERROR;
+                goto PCDAW_exit;
+            }
+        }
+#else // PALCS_FUTEX_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&pPalCriticalSection->csndNativeData.mutex);
         if (0 != iRet)
@@ -1274,6 +1302,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             goto PCDAW_exit;
         }
+#endif // PALCS_FUTEX_WAIT
         
     PCDAW_exit:
         
@@ -1296,6 +1325,24 @@ namespace CorUnix
         _ASSERT_MSG(PalCsFullyInitialized == pPalCriticalSection->cisInitState,
                     "Trying to wake up a waiter on CS not fully initialized\n");
 
+#ifdef PALCS_FUTEX_WAIT
+        // Set the predicate
+        InterlockedExchange((LONG *)&pPalCriticalSection->csndNativeData.iPredicate, 1);
+
+        CS_TRACE("Signaling futex/predicate [pred=%d]!\n",
+                 pPalCriticalSection->csndNativeData.iPredicate);
+
+        // Wake up one waiter, if any is asleep
+        iRet = (int)syscall(SYS_futex, &pPalCriticalSection->csndNativeData.iPredicate,
+                            FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        if (-1 == iRet)
+        {
+            ASSERT("Failed waking futex in CS %p [errno=%d]\n",
+                   pPalCriticalSection, errno);
+            palErr = ERROR_INTERNAL_ERROR;
+            goto PCWUW_exit;
+        }
+#else // PALCS_FUTEX_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&pPalCriticalSection->csndNativeData.mutex);
         if (0 != iRet)
@@ -1328,6 +1375,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             goto PCWUW_exit;
         }
+#endif // PALCS_FUTEX_WAIT
 
     PCWUW_exit:
         return palErr;
@@ -41,6 +41,25 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 
 #include <algorithm>
 
+// On Linux, threads block on and are woken through a futex on their wait predicate
+// instead of the pthread condition, so a native wait takes no mutex on the waiting
+// side and a wakeup is a single futex syscall.
+#if defined(__linux__)
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+// GetAbsoluteTimeout returns a CLOCK_MONOTONIC time when the condition can use it,
+// which is also the default clock of FUTEX_WAIT_BITSET
+#if HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+#define SYNCHMGR_FUTEX_CLOCK_FLAGS 0
+#else
+#define SYNCHMGR_FUTEX_CLOCK_FLAGS FUTEX_CLOCK_REALTIME
+#endif
+#else
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 0
+#endif // __linux__
+
 const int CorUnix::CThreadSynchronizationInfo::PendingSignalingsArraySize;
 
 // We use the synchronization manager's worker thread to handle
@@ -462,6 +481,35 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Consume the predicate if it is set, otherwise sleep until it may have been.
+        // As with the condition below, a predicate set after a timeout is left in
+        // place for the next wait.
+        while (FALSE == InterlockedExchange((LONG *)&ptnwdNativeWaitData->iPred, FALSE))
+        {
+            iRet = (int)syscall(SYS_futex, &ptnwdNativeWaitData->iPred,
+                                FUTEX_WAIT_BITSET_PRIVATE | SYNCHMGR_FUTEX_CLOCK_FLAGS,
+                                FALSE, (INFINITE == dwTimeout) ? NULL : &tsAbsTmo,
+                                NULL, FUTEX_BITSET_MATCH_ANY);
+            if (-1 == iRet)
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+                else if (EAGAIN != errno && EINTR != errno)
+                {
+                    ERROR("futex wait failed [errno=%d (%s)]\n", errno, strerror(errno));
+                    iWaitRet = errno;
+                    palErr = ERROR_INTERNAL_ERROR;
+                    break;
+                }
+            }
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -532,6 +580,7 @@ namespace CorUnix
         }
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         if (0 == iWaitRet)
         {
@@ -2459,6 +2508,21 @@ namespace CorUnix
             return ERROR_INTERNAL_ERROR;
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // The waiter does not take the mutex, so publish the wakeup reason and
+        // index along with the predicate. The mutex is still held so that the
+        // native wait lock keeps serializing signaling with thread suspension.
+        InterlockedExchange((LONG *)&ptnwdNativeWaitData->iPred, TRUE);
+
+        iRet = (int)syscall(SYS_futex, &ptnwdNativeWaitData->iPred,
+                            FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        if (-1 == iRet)
+        {
+            ERROR("futex wake failed [errno=%d (%s)]\n", errno, strerror(errno));
+            palErr = ERROR_INTERNAL_ERROR;
+            // Continue in order to unlock the mutex anyway
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Set the predicate
         ptnwdNativeWaitData->iPred = TRUE;
 
@@ -2472,6 +2536,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             // Continue in order to unlock the mutex anyway
         }
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         // Unlock the mutex
         iRet = pthread_mutex_unlock(&ptnwdNativeWaitData->mutex);
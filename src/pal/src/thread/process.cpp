@@ -159,6 +159,7 @@ char* g_argvCreateDump[8] = { nullptr };
 // (through pthread_setspecific)
 //
 pthread_key_t CorUnix::thObjKey;
+__thread CPalThread *CorUnix::t_pCurrentPalThread = NULL;
 
 #define PROCESS_PELOADER_FILENAME  "clix"
 
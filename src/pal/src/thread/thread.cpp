@@ -170,6 +170,7 @@ static void InternalEndCurrentThreadWrapper(void *arg)
     // that the current thread is known to this PAL, and that pThread
     // actually is the current PAL thread, put it back in TLS temporarily.
     pthread_setspecific(thObjKey, pThread);
+    t_pCurrentPalThread = pThread;
     (void)PAL_Enter(PAL_BoundaryTop);
     
     /* Call entry point functions of every attached modules to
@@ -186,6 +187,7 @@ static void InternalEndCurrentThreadWrapper(void *arg)
     // in InternalEndCurrentThread.
     InternalEndCurrentThread(pThread);
     pthread_setspecific(thObjKey, NULL);
+    t_pCurrentPalThread = NULL;
 }
 
 /*++
@@ -220,6 +220,10 @@ CThreadTLSInfo::InitializePostCreate(
         ASSERT("Unable to set the thread object key's value\n");
         palError = ERROR_INTERNAL_ERROR;
     }
+    else
+    {
+        t_pCurrentPalThread = pThread;
+    }
 
     return palError;
 }
@@ -1121,6 +1121,13 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
         {
             return FALSE;
         }
+
+#ifdef _WIN64
+        if (m_dwReserveBlockSize < LOADERHEAP_MAX_RESERVE_BLOCK_SIZE)
+        {
+            m_dwReserveBlockSize = min(2 * (DWORD)dwSizeToReserve, (DWORD)LOADERHEAP_MAX_RESERVE_BLOCK_SIZE);
+        }
+#endif
     }
 
     // When the user passes in the reserved memory, the commit size is 0 and is adjusted to be the sizeof(LoaderHeap). 
@@ -2844,6 +2844,14 @@ ErrExit:
 
 #endif // _DEBUG
 
+// DWORDs of a JIT nibble map that point back at the start of a method have no method starts in them
+static DWORD ReadCodeTableDword(DWORD dword)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+    return IS_NIBBLE_POINTER(dword) ? 0 : dword;
+}
+
 //
 //  MethodSectionIterator class is used to iterate hot (or) cold method section in an ngen image.
 //  Also used to iterate over jitted methods in the code heap
@@ -2863,7 +2871,7 @@ MethodSectionIterator::MethodSectionIterator(const void *code, SIZE_T codeSize,
 
     if (m_codeTable < m_codeTableEnd)
     {
-        m_dword = *m_codeTable++;
+        m_dword = ReadCodeTableDword(*m_codeTable++);
         m_index = 0;
     }
     else
@@ -2894,7 +2902,7 @@ BOOL MethodSectionIterator::Next()
 
         if (m_codeTable < m_codeTableEnd)
         {
-            m_dword = *m_codeTable++;
+            m_dword = ReadCodeTableDword(*m_codeTable++);
             m_index = 0;
         }
     }
@@ -1262,7 +1262,71 @@ found:
 }
 
 //******************************************************************************
-// Returns the number of processors that a process has been configured to run on
+// Returns in pCpuLimit how many processors worth of CPU time the process may use, rounded up, if
+// its CPU time is limited. That is the CPU quota of the process's cgroup on Unix and the CPU rate
+// cap of the job object the process runs in on Windows.
+//******************************************************************************
+BOOL GetCurrentProcessCpuLimit(DWORD* pCpuLimit)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        SO_TOLERANT;
+        CANNOT_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+#ifdef FEATURE_PAL
+    UINT cpuLimit;
+
+    if (!PAL_GetCpuLimit(&cpuLimit))
+        return FALSE;
+
+    *pCpuLimit = cpuLimit;
+    return TRUE;
+#else // FEATURE_PAL
+    JOBOBJECT_CPU_RATE_CONTROL_INFORMATION cpuRateControl;
+
+    if (!QueryInformationJobObject(NULL, JobObjectCpuRateControlInformation, &cpuRateControl,
+                                   sizeof(cpuRateControl), NULL))
+        return FALSE;
+
+    const DWORD HardCapEnabled = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_HARD_CAP;
+    const DWORD MinMaxRateEnabled = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_MIN_MAX_RATE;
+
+    DWORD maxRate;
+    if ((cpuRateControl.ControlFlags & HardCapEnabled) == HardCapEnabled)
+        maxRate = cpuRateControl.CpuRate;
+    else if ((cpuRateControl.ControlFlags & MinMaxRateEnabled) == MinMaxRateEnabled)
+        maxRate = cpuRateControl.MaxRate;
+    else
+        return FALSE;
+
+    // The rate is in hundredths of a percent of the time of all the processors of the machine
+    const DWORD MaximumCpuRate = 10000;
+    if (maxRate == 0 || maxRate >= MaximumCpuRate)
+        return FALSE;
+
+    DWORD totalCpuCount;
+    if (CPUGroupInfo::CanEnableGCCPUGroups())
+    {
+        totalCpuCount = CPUGroupInfo::GetNumActiveProcessors();
+    }
+    else
+    {
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        totalCpuCount = systemInfo.dwNumberOfProcessors;
+    }
+
+    *pCpuLimit = max((DWORD)1, (maxRate * totalCpuCount + MaximumCpuRate - 1) / MaximumCpuRate);
+    return TRUE;
+#endif // FEATURE_PAL
+}
+
+//******************************************************************************
+// Returns the number of processors that a process has been configured to run on,
+// taking its CPU time limit into account
 //******************************************************************************
 int GetCurrentProcessCpuCount()
 {
@@ -1307,12 +1371,10 @@ int GetCurrentProcessCpuCount()
             count = 64;
     }
 
-#ifdef FEATURE_PAL
-    uint32_t cpuLimit;
+    DWORD cpuLimit;
 
-    if (PAL_GetCpuLimit(&cpuLimit) && cpuLimit < count)
+    if (GetCurrentProcessCpuLimit(&cpuLimit) && cpuLimit < (DWORD)count)
         count = cpuLimit;
-#endif
 
     cCPUs = count;
 
@@ -85,7 +85,7 @@ SpinConstants g_SpinConstants = {
 
 inline void InitializeSpinConstants_NoHost()
 {
-    g_SpinConstants.dwMaximumDuration = max(2, g_SystemInfo.dwNumberOfProcessors) * 20000;
+    g_SpinConstants.dwMaximumDuration = max(2, GetCurrentProcessCpuCount()) * 20000;
 }
 
 #else //!SELF_NO_HOST || CROSSGEN_COMPILE
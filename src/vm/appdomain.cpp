@@ -8489,18 +8489,21 @@ void    DomainLocalModule::AllocateDynamicClass(MethodTable *pMT)
 
         if (pMT->Collectible() && (dwStaticBytes != 0))
         {
-            GCX_COOP();
-            OBJECTREF nongcStaticsArray = NULL;
-            GCPROTECT_BEGIN(nongcStaticsArray);
+            LoaderHeap * pLoaderAllocator = GetDomainFile()->GetLoaderAllocator()->GetHighFrequencyHeap();
+            SIZE_T nonGCStaticsSize = DynamicEntry::GetOffsetOfDataBlob() + dwStaticBytes;
+            PTR_BYTE pNonGCStatics;
+
 #ifdef FEATURE_64BIT_ALIGNMENT
             // Allocate memory with extra alignment only if it is really necessary
             if (dwStaticBytes >= MAX_PRIMITIVE_FIELD_SIZE)
-                nongcStaticsArray = AllocatePrimitiveArray(ELEMENT_TYPE_I8, (dwStaticBytes + (sizeof(CLR_I8)-1)) / (sizeof(CLR_I8)));
+                pNonGCStatics = (PTR_BYTE)(void*)pLoaderAllocator->AllocAlignedMem(nonGCStaticsSize, MAX_PRIMITIVE_FIELD_SIZE);
             else
 #endif
-                nongcStaticsArray = AllocatePrimitiveArray(ELEMENT_TYPE_U1, dwStaticBytes);
-            ((CollectibleDynamicEntry *)pDynamicStatics)->m_hNonGCStatics = GetDomainFile()->GetModule()->GetLoaderAllocator()->AllocateHandle(nongcStaticsArray);
-            GCPROTECT_END();
+                pNonGCStatics = (PTR_BYTE)(void*)pLoaderAllocator->AllocMem(S_SIZE_T(nonGCStaticsSize));
+
+            // Note: Memory allocated on loader heap is zero filled
+
+            ((CollectibleDynamicEntry *)pDynamicStatics)->m_pNonGCStatics = pNonGCStatics;
         }
         if (dwNumHandleStatics > 0)
         {
@@ -149,15 +149,7 @@ struct DomainLocalModule
         DomainLocalModule::PTR_DynamicEntry pDynamicEntry = dac_cast<DomainLocalModule::PTR_DynamicEntry>((DomainLocalModule::DynamicEntry*)(dynamicClassInfo)->m_pDynamicEntry.Load()); \
         if (((dynamicClassInfo)->m_dwFlags) & ClassInitFlags::COLLECTIBLE_FLAG) \
         {\
-            if ((dac_cast<DomainLocalModule::PTR_CollectibleDynamicEntry>(pDynamicEntry))->m_hNonGCStatics != 0) \
-            { \
-                U1ARRAYREF objArray;\
-                objArray = (U1ARRAYREF)pLoaderAllocator->GetHandleValueFastCannotFailType2( \
-                                            (dac_cast<DomainLocalModule::PTR_CollectibleDynamicEntry>(pDynamicEntry))->m_hNonGCStatics);\
-                *(pNonGCStatics) = dac_cast<PTR_BYTE>(PTR_READ( \
-                        PTR_TO_TADDR(OBJECTREFToObject( objArray )) + sizeof(ArrayBase) - DomainLocalModule::DynamicEntry::GetOffsetOfDataBlob(), \
-                            objArray->GetNumComponents() * (DWORD)objArray->GetComponentSize() + DomainLocalModule::DynamicEntry::GetOffsetOfDataBlob())); \
-            } else (*pNonGCStatics) = NULL; \
+            *(pNonGCStatics) = (dac_cast<DomainLocalModule::PTR_CollectibleDynamicEntry>(pDynamicEntry))->m_pNonGCStatics;\
         }\
         else\
         {\
@@ -174,7 +166,11 @@ struct DomainLocalModule
     struct CollectibleDynamicEntry : public DynamicEntry
     {
         LOADERHANDLE    m_hGCStatics;
-        LOADERHANDLE    m_hNonGCStatics;
+        // The non-GC statics hold no object references, so they live on the loader heap of
+        // the LoaderAllocator, which frees them on unload. This keeps their address stable
+        // and avoids a handle lookup on every access. Laid out like a NormalDynamicEntry:
+        // the fields start GetOffsetOfDataBlob() bytes in. NULL if the class has none.
+        PTR_BYTE        m_pNonGCStatics;
     };
     typedef DPTR(CollectibleDynamicEntry) PTR_CollectibleDynamicEntry;
 
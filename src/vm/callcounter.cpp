@@ -17,12 +17,117 @@
 #ifdef FEATURE_TIERED_COMPILATION
 
 CallCounter::CallCounter()
+    : m_pTable(NULL)
 {
     LIMITED_METHOD_CONTRACT;
 
     m_lock.Init(LOCK_TYPE_DEFAULT);
 }
 
+CallCounter::~CallCounter()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Every entry is in the newest table, older tables only share them
+    CallCounterTable* pTable = m_pTable;
+    if (pTable != NULL)
+    {
+        for (COUNT_T i = 0; i < pTable->size; i++)
+        {
+            delete pTable->entries[i];
+        }
+    }
+
+    while (pTable != NULL)
+    {
+        CallCounterTable* pPrevious = pTable->pPrevious;
+        delete [] pTable->entries;
+        delete pTable;
+        pTable = pPrevious;
+    }
+}
+
+// Searches the table for the entry of a method. This may run concurrently with
+// AddEntry on other threads, so a NULL result is not final until rechecked under
+// the lock.
+CallCounterEntry* CallCounter::LookupEntry(CallCounterTable* pTable, const MethodDesc* pMethodDesc)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pTable == NULL)
+    {
+        return NULL;
+    }
+
+    // The table is never full, so the search always reaches an empty slot
+    COUNT_T mask = pTable->size - 1;
+    for (COUNT_T i = (COUNT_T)((size_t)pMethodDesc >> 3) & mask; ; i = (i + 1) & mask)
+    {
+        CallCounterEntry* pEntry = VolatileLoad(&pTable->entries[i]);
+        if (pEntry == NULL || pEntry->pMethod == pMethodDesc)
+        {
+            return pEntry;
+        }
+    }
+}
+
+void CallCounter::InsertEntry(CallCounterTable* pTable, CallCounterEntry* pEntry)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pTable->count < pTable->size);
+
+    COUNT_T mask = pTable->size - 1;
+    COUNT_T i = (COUNT_T)((size_t)pEntry->pMethod >> 3) & mask;
+    while (pTable->entries[i] != NULL)
+    {
+        i = (i + 1) & mask;
+    }
+
+    // Publishes the initialized entry to lock-free readers
+    VolatileStore(&pTable->entries[i], pEntry);
+    pTable->count++;
+}
+
+// Adds an entry for a method that has no entry yet. Must be called while holding m_lock.
+CallCounterEntry* CallCounter::AddEntry(const MethodDesc* pMethodDesc)
+{
+    STANDARD_VM_CONTRACT;
+    _ASSERTE(m_lock.OwnedByCurrentThread());
+
+    NewHolder<CallCounterEntry> pNewEntry = new CallCounterEntry(pMethodDesc);
+
+    CallCounterTable* pTable = m_pTable;
+
+    // Keep the table at most 3/4 full
+    if (pTable == NULL || (pTable->count + 1) * 4 > pTable->size * 3)
+    {
+        COUNT_T newSize = (pTable == NULL) ? 64 : pTable->size * 2;
+        NewArrayHolder<CallCounterEntry*> pNewEntries = new CallCounterEntry*[newSize];
+        memset(pNewEntries, 0, newSize * sizeof(CallCounterEntry*));
+        CallCounterTable* pNewTable = new CallCounterTable(pNewEntries, newSize, pTable);
+        pNewEntries.SuppressRelease();
+
+        if (pTable != NULL)
+        {
+            for (COUNT_T i = 0; i < pTable->size; i++)
+            {
+                if (pTable->entries[i] != NULL)
+                {
+                    InsertEntry(pNewTable, pTable->entries[i]);
+                }
+            }
+        }
+
+        // Readers still searching the old table are fine, it stays alive and
+        // already contains every entry except the one being added
+        VolatileStore(&m_pTable, pNewTable);
+        pTable = pNewTable;
+    }
+
+    InsertEntry(pTable, pNewEntry);
+    return pNewEntry.Extract();
+}
+
 // This is called by the prestub each time the method is invoked in a particular
 // AppDomain (the AppDomain for which AppDomain.GetCallCounter() == this). These
 // calls continue until we backpatch the prestub to avoid future calls. This allows
@@ -45,44 +150,34 @@ void CallCounter::OnMethodCalled(
     _ASSERTE(shouldStopCountingCallsRef != nullptr);
     _ASSERTE(wasPromotedToTier1Ref != nullptr);
 
-    // PERF: This as a simple to implement, but not so performant, call counter
-    // Currently this is only called until we reach a fixed call count and then
-    // disabled. Its likely we'll want to improve this at some point but
-    // its not as bad as you might expect. Allocating a counter inline in the
-    // MethodDesc or at some location computable from the MethodDesc should
-    // eliminate 1 pointer per-method (the MethodDesc* key) and the CPU
-    // overhead to acquire the lock/search the dictionary. Depending on where it
-    // is we may also be able to reduce it to 1 byte counter without wasting the
-    // following bytes for alignment. Further work to inline the OnMethodCalled
-    // callback directly into the jitted code would eliminate CPU overhead of 
-    // leaving the prestub unpatched, but may not be good overall as it increases
-    // the size of the jitted code.
-
-
-    TieredCompilationManager* pCallCounterSink = NULL;
-    int callCount;
+    // PERF: Only the first call to a method takes the lock, to add its entry. Later
+    // calls find the entry without locking and count with an interlocked increment.
+    // Further work to inline the OnMethodCalled callback directly into the jitted
+    // code would eliminate CPU overhead of leaving the prestub unpatched, but may
+    // not be good overall as it increases the size of the jitted code.
+
+    CallCounterEntry* pEntry = LookupEntry(VolatileLoad(&m_pTable), pMethodDesc);
+    if (pEntry == NULL)
     {
-        //Be careful if you convert to something fully lock/interlocked-free that
-        //you correctly handle what happens when some N simultaneous calls don't
-        //all increment the counter. The slight drift is probably neglible for tuning
-        //but TieredCompilationManager::OnMethodCalled() doesn't expect multiple calls
-        //each claiming to be exactly the threshhold call count needed to trigger
-        //optimization.
         SpinLockHolder holder(&m_lock);
-        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        pEntry = LookupEntry(m_pTable, pMethodDesc);
         if (pEntry == NULL)
         {
-            callCount = 1;
-            m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCount));
-        }
-        else
-        {
-            pEntry->callCount++;
-            callCount = pEntry->callCount;
+            pEntry = AddEntry(pMethodDesc);
         }
     }
 
-    pTieredCompilationManager->OnMethodCalled(pMethodDesc, callCount, shouldStopCountingCallsRef, wasPromotedToTier1Ref);
+    // TieredCompilationManager::OnMethodCalled() doesn't expect multiple calls each
+    // claiming to be exactly the threshhold call count needed to trigger optimization,
+    // so every caller must observe a distinct count.
+    int callCount = (int)InterlockedIncrement(&pEntry->callCount);
+
+    pTieredCompilationManager->OnMethodCalled(
+        pMethodDesc,
+        callCount,
+        pEntry->firstCallTickCount,
+        shouldStopCountingCallsRef,
+        wasPromotedToTier1Ref);
 }
 
 #endif // FEATURE_TIERED_COMPILATION
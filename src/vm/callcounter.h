@@ -13,50 +13,33 @@
 #ifdef FEATURE_TIERED_COMPILATION
 
 // One entry in our dictionary mapping methods to the number of times they
-// have been invoked
+// have been invoked. Entries are never moved or freed while the CallCounter
+// is alive, so the count can be updated without holding any lock.
 struct CallCounterEntry
 {
-    CallCounterEntry() {}
-    CallCounterEntry(const MethodDesc* m, const int c)
-        : pMethod(m), callCount(c) {}
+    CallCounterEntry(const MethodDesc* m)
+        : pMethod(m), callCount(0), firstCallTickCount(GetTickCount()) {}
 
     const MethodDesc* pMethod;
-    int callCount;
+    LONG callCount;
+    DWORD firstCallTickCount;
 };
 
-class CallCounterHashTraits : public DefaultSHashTraits<CallCounterEntry>
+// An open addressed table of entries, probed linearly. Once a table is published
+// the only change made to it is filling an empty slot, so it can be searched without
+// the lock. When it fills up it is replaced by a larger copy, and the old table is
+// kept alive (linked through pPrevious) for readers that may still be searching it.
+struct CallCounterTable
 {
-public:
-    typedef typename DefaultSHashTraits<CallCounterEntry>::element_t element_t;
-    typedef typename DefaultSHashTraits<CallCounterEntry>::count_t count_t;
-
-    typedef const MethodDesc* key_t;
-
-    static key_t GetKey(element_t e)
-    {
-        LIMITED_METHOD_CONTRACT;
-        return e.pMethod;
-    }
-    static BOOL Equals(key_t k1, key_t k2)
-    {
-        LIMITED_METHOD_CONTRACT;
-        return k1 == k2;
-    }
-    static count_t Hash(key_t k)
-    {
-        LIMITED_METHOD_CONTRACT;
-        return (count_t)(size_t)k;
-    }
+    CallCounterTable(CallCounterEntry** e, COUNT_T s, CallCounterTable* p)
+        : entries(e), size(s), count(0), pPrevious(p) {}
 
-    static const element_t Null() { LIMITED_METHOD_CONTRACT; return element_t(NULL, 0); }
-    static const element_t Deleted() { LIMITED_METHOD_CONTRACT; return element_t((const MethodDesc*)-1, 0); }
-    static bool IsNull(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.pMethod == NULL; }
-    static bool IsDeleted(const element_t &e) { return e.pMethod == (const MethodDesc*)-1; }
+    CallCounterEntry** entries;
+    COUNT_T size;  // always a power of 2
+    COUNT_T count;
+    CallCounterTable* pPrevious;
 };
 
-typedef SHash<NoRemoveSHashTraits<CallCounterHashTraits>> CallCounterHash;
-
-
 // This is a per-appdomain cache of call counts for all code in that AppDomain.
 // Each method invocation should trigger a call to OnMethodCalled (until it is disabled per-method)
 // and the CallCounter will forward the call to the TieredCompilationManager including the
@@ -68,15 +51,21 @@ public:
     CallCounter() {}
 #else
     CallCounter();
+    ~CallCounter();
 #endif
 
     void OnMethodCalled(MethodDesc* pMethodDesc, TieredCompilationManager *pTieredCompilationManager, BOOL* shouldStopCountingCallsRef, BOOL* wasPromotedToTier1Ref);
 
 private:
+    static CallCounterEntry* LookupEntry(CallCounterTable* pTable, const MethodDesc* pMethodDesc);
+    static void InsertEntry(CallCounterTable* pTable, CallCounterEntry* pEntry);
+    CallCounterEntry* AddEntry(const MethodDesc* pMethodDesc);
+
+    // Read without the lock, only replaced while holding it
+    CallCounterTable* volatile m_pTable;
 
-    // fields protected by lock
+    // Serializes adding entries
     SpinLock m_lock;
-    CallCounterHash m_methodToCallCount;
 };
 
 #endif // FEATURE_TIERED_COMPILATION
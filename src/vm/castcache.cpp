@@ -0,0 +1,94 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: CastCache.CPP
+//
+// ===========================================================================
+
+
+
+#include "common.h"
+#include "castcache.h"
+
+CastCache::Entry CastCache::s_entries[CastCache::CacheSize];
+
+TypeHandle::CastResult CastCache::TryGet(TypeHandle source, TypeHandle target)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    TADDR sourceAddr = source.AsTAddr();
+    TADDR targetAddr = target.AsTAddr();
+    Entry* pEntry = &s_entries[GetIndex(sourceAddr, targetAddr)];
+
+    DWORD version = pEntry->version;
+    if ((version & 1) != 0)
+    {
+        return TypeHandle::MaybeCast;
+    }
+
+    // The loads are ordered, so if the version is unchanged after them the fields
+    // were not being written while we read them
+    TADDR entrySource = VolatileLoad(&pEntry->source);
+    TADDR entryTargetAndResult = VolatileLoad(&pEntry->targetAndResult);
+    if (pEntry->version != version ||
+        entrySource != sourceAddr ||
+        (entryTargetAndResult & ~CanCastBit) != targetAddr)
+    {
+        return TypeHandle::MaybeCast;
+    }
+
+    return (entryTargetAndResult & CanCastBit) != 0 ? TypeHandle::CanCast : TypeHandle::CannotCast;
+}
+
+void CastCache::TryAdd(TypeHandle source, TypeHandle target, BOOL canCast)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    TADDR sourceAddr = source.AsTAddr();
+    TADDR targetAddr = target.AsTAddr();
+    _ASSERTE((targetAddr & CanCastBit) == 0);
+    Entry* pEntry = &s_entries[GetIndex(sourceAddr, targetAddr)];
+
+    DWORD version = pEntry->version;
+    if ((version & 1) != 0 ||
+        (DWORD)InterlockedCompareExchange((LONG*)pEntry->version.GetPointer(), version + 1, version) != version)
+    {
+        // Another thread is writing this entry, let it win
+        return;
+    }
+
+    SetEntry(pEntry, version, sourceAddr, targetAddr | (canCast ? CanCastBit : 0));
+}
+
+void CastCache::Flush()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (DWORD i = 0; i < CacheSize; i++)
+    {
+        Entry* pEntry = &s_entries[i];
+        while (true)
+        {
+            DWORD version = pEntry->version;
+            if ((version & 1) == 0 &&
+                (DWORD)InterlockedCompareExchange((LONG*)pEntry->version.GetPointer(), version + 1, version) == version)
+            {
+                SetEntry(pEntry, version, NULL, NULL);
+                break;
+            }
+            YieldProcessor();
+        }
+    }
+}
+
+// Called once the entry has been claimed by moving its version from 'version' to 'version + 1'
+void CastCache::SetEntry(Entry* pEntry, DWORD version, TADDR source, TADDR targetAndResult)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pEntry->version == version + 1);
+
+    pEntry->source = source;
+    pEntry->targetAndResult = targetAndResult;
+    pEntry->version = version + 2;
+}
@@ -0,0 +1,58 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: CastCache.h
+//
+// ===========================================================================
+
+
+#ifndef CAST_CACHE_H
+#define CAST_CACHE_H
+
+// A fixed size, process wide cache of TypeHandle::CanCastTo results, keyed by the
+// source and target type handles. It is consulted before the interface map, parent
+// chain and variance walks of the slow cast paths.
+//
+// Entries are direct mapped and protected by a per-entry version that is odd while
+// the entry is being written, so lookups never take a lock and an insert that races
+// with another insert into the same entry is simply dropped. The cache only ever
+// holds pairs of live types, so it only needs to be flushed when types are unloaded.
+class CastCache
+{
+public:
+    // Returns CanCast or CannotCast if the result for this pair is cached, MaybeCast otherwise
+    static TypeHandle::CastResult TryGet(TypeHandle source, TypeHandle target);
+
+    static void TryAdd(TypeHandle source, TypeHandle target, BOOL canCast);
+
+    // Removes all entries. Called when a collectible loader allocator is unloaded.
+    static void Flush();
+
+private:
+    struct Entry
+    {
+        Volatile<DWORD> version;
+        TADDR source;
+        // The target type handle, with the cast result in the low bit
+        TADDR targetAndResult;
+    };
+
+    static const DWORD CacheSize = 4096;
+    static const TADDR CanCastBit = 1;
+
+    static Entry s_entries[CacheSize];
+
+    static DWORD GetIndex(TADDR source, TADDR target)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        size_t hash = (source >> 3) + (target >> 3) * 31;
+        hash ^= hash >> 12;
+        return (DWORD)hash & (CacheSize - 1);
+    }
+
+    static void SetEntry(Entry* pEntry, DWORD version, TADDR source, TADDR targetAndResult);
+};
+
+#endif // CAST_CACHE_H
@@ -220,6 +220,7 @@
 #include "perfmap.h"
 #endif
 
+#include "runtimecounters.h"
 #include "eventpipe.h"
 
 #ifndef FEATURE_PAL
@@ -677,6 +678,9 @@ void EEStartupHelper(COINITIEE fFlags)
         InitThreadManager();
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "Returned successfully from InitThreadManager");
 
+        // Register the runtime counters before the event pipe can sample them.
+        RuntimeCounters::Initialize();
+
 #ifdef FEATURE_PERFTRACING
         // Initialize the event pipe.
         EventPipe::Initialize();
@@ -856,6 +860,8 @@ void EEStartupHelper(COINITIEE fFlags)
 
         GCInterface::m_MemoryPressureLock.Init(CrstGCMemoryPressure);
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: garbage collector and handle manager created");
+
 #endif // CROSSGEN_COMPILE
 
         // Setup the domains. Threads are started in a default domain.
@@ -874,6 +880,8 @@ void EEStartupHelper(COINITIEE fFlags)
 
         JitHost::Init();
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: domains and execution manager attached");
+
 #ifndef CROSSGEN_COMPILE
 
 #ifndef FEATURE_PAL      
@@ -905,6 +913,8 @@ void EEStartupHelper(COINITIEE fFlags)
         IfFailGo(hr);
 #endif // PROFILING_SUPPORTED
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: debugger and profiler initialized");
+
         InitializeExceptionHandling();
 
         //
@@ -968,6 +978,8 @@ void EEStartupHelper(COINITIEE fFlags)
         // Now we really have fully initialized the garbage collector
         SetGarbageCollectorFullyInitialized();
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: JIT helpers set up and GC heap initialized");
+
 #ifdef DEBUGGING_SUPPORTED
         // Make a call to publish the DefaultDomain for the debugger
         // This should be done before assemblies/modules are loaded into it (i.e. SystemDomain::Init)
@@ -982,6 +994,8 @@ void EEStartupHelper(COINITIEE fFlags)
 
         SystemDomain::System()->Init();
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: system domain initialized and CoreLib loaded");
+
 #ifdef PROFILING_SUPPORTED
         // <TODO>This is to compensate for the DefaultDomain workaround contained in
         // SystemDomain::Attach in which the first user domain is created before profiling
@@ -997,6 +1011,8 @@ void EEStartupHelper(COINITIEE fFlags)
 
         SystemDomain::System()->DefaultDomain()->SetupSharedStatics();
 
+        STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "EEStartup: system assemblies loaded into the default domain");
+
 #ifdef _DEBUG
         APIThreadStress::SetThreadStressCount(g_pConfig->GetAPIThreadStressCount());
 #endif
@@ -53,6 +53,15 @@ private:
     unsigned            m_dFrameCount;      // current frame in stack trace
     unsigned            m_cDynamicMethodItems; // number of items in the Dynamic Method array
     unsigned            m_dCurrentDynamicIndex; // index of the next location where the resolver object will be stored
+    unsigned            m_cSavedFrames;     // frames saved to the throwable since the throw, see code:EEConfig::ExceptionStackTraceMaxFrames
+
+    // for the ExceptionDispatchTiming event
+    LARGE_INTEGER       m_dispatchStartTimeStamp; // when the exception was thrown, zero if the dispatch isn't timed
+    LONGLONG            m_stackTraceTicks;      // time spent building the stack trace since the throw
+    unsigned            m_cFramesWalked;        // frames appended since the throw
+    MethodDesc*         m_pThrowingMethod;      // first frame appended since the throw
+
+    void SaveStackTraceWorker(BOOL bAllowAllocMem, OBJECTHANDLE hThrowable, BOOL bReplaceStack, BOOL bSkipLastElement);
 
 public:
     void Init();
@@ -64,6 +73,10 @@ public:
     BOOL AppendElement(BOOL bAllowAllocMem, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf);
 
     void GetLeafFrameInfo(StackTraceElement* pStackTraceElement);
+
+    // Called when an exception is thrown or rethrown, and when it is caught
+    void StartDispatchTiming();
+    void EndDispatchTiming();
 };
 
 
@@ -2559,7 +2559,10 @@ ClassLoader::~ClassLoader()
 
     FreeModules();
 
-    m_UnresolvedClassLock.Destroy();
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_HASH_BUCKETS; i++)
+    {
+        m_UnresolvedClassLocks[i].Destroy();
+    }
     m_AvailableClassLock.Destroy();
     m_AvailableTypesLock.Destroy();
 }
@@ -2619,7 +2622,10 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
                                                           UNRESOLVED_CLASS_HASH_BUCKETS, 
                                                           pamTracker);
 
-    m_UnresolvedClassLock.Init(CrstUnresolvedClassLock);
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_HASH_BUCKETS; i++)
+    {
+        m_UnresolvedClassLocks[i].Init(CrstUnresolvedClassLock);
+    }
 
     // This lock is taken within the classloader whenever we have to enter a
     // type in one of the modules governed by the loader.
@@ -4013,8 +4019,11 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(TypeKey *pTypeKey,
         SString name;
         TypeString::AppendTypeKeyDebug(name, pTypeKey);
         LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: LoadTypeHandleForTypeKey for type %S to level %s\n", name.GetUnicode(), classLoadLevelName[targetLevel]));
-        CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLock);
-        m_pUnresolvedClassHash->Dump();
+        for (DWORD i = 0; i < UNRESOLVED_CLASS_HASH_BUCKETS; i++)
+        {
+            CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLocks[i]);
+            m_pUnresolvedClassHash->Dump(i);
+        }
     }
 #endif
 
@@ -4132,6 +4141,17 @@ public:
     }
 };
 
+//---------------------------------------------------------------------------------------
+// 
+// Returns the lock that protects the bucket of m_pUnresolvedClassHash the key hashes to
+CrstBase *
+ClassLoader::GetUnresolvedClassLock(TypeKey *pKey)
+{
+    WRAPPER_NO_CONTRACT;
+
+    return &m_UnresolvedClassLocks[pKey->ComputeHash() % UNRESOLVED_CLASS_HASH_BUCKETS];
+}
+
 //---------------------------------------------------------------------------------------
 // 
 TypeHandle 
@@ -4168,7 +4188,7 @@ ClassLoader::LoadTypeHandleForTypeKey_Body(
     }
 
     ReleaseHolder<PendingTypeLoadEntry> pLoadingEntry;
-    CrstHolderWithState unresolvedClassLockHolder(&m_UnresolvedClassLock, false);
+    CrstHolderWithState unresolvedClassLockHolder(GetUnresolvedClassLock(pTypeKey), false);
 
 retry:
     unresolvedClassLockHolder.Acquire();    
@@ -4301,7 +4321,7 @@ retry:
         COMPlusThrowOM();
     }
 
-    // Leave the global lock, so that other threads may now start waiting on our class's lock
+    // Leave the bucket lock, so that other threads may now start waiting on our class's lock
     unresolvedClassLockHolder.Release();
 
     EX_TRY
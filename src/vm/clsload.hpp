@@ -537,9 +537,14 @@ class ClassLoader
     friend class COMModule;
 
 private:
+    CrstBase *GetUnresolvedClassLock(TypeKey *pKey);
+
     // Classes for which load is in progress
     PendingTypeLoadTable  * m_pUnresolvedClassHash;
-    CrstExplicitInit        m_UnresolvedClassLock;
+
+    // One lock per bucket of m_pUnresolvedClassHash, so that loads of types that hash to
+    // different buckets do not serialize on each other
+    CrstExplicitInit        m_UnresolvedClassLocks[UNRESOLVED_CLASS_HASH_BUCKETS];
 
     // Protects addition of elements to module's m_pAvailableClasses.
     // (indeed thus protects addition of elements to any m_pAvailableClasses in any
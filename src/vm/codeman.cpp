@@ -1339,7 +1339,13 @@ void EEJitManager::SetCpuInfo()
     //   CORJIT_FLAG_USE_AVX2 if the following feature bit is set (input EAX of 0x07 and input ECX of 0):
     //      CORJIT_FLAG_USE_AVX
     //      AVX2      - EBX bit 5    (buffer[4]  & 0x20)
-    //   CORJIT_FLAG_USE_AVX_512 is not currently set, but defined so that it can be used in future without
+    //   CORJIT_FLAG_USE_AVX_512 if the following feature bits are set (input EAX of 0x07 and input ECX of 0),
+    //   and avx512StateSupport returns 1:
+    //      CORJIT_FLAG_USE_AVX2
+    //      XGETBV    - XCR0[7:5]    111b
+    //      AVX512F   - EBX bit 16   (buffer[6]  & 0x01)
+    //      AVX512BW  - EBX bit 30   (buffer[7]  & 0x40)
+    //      AVX512VL  - EBX bit 31   (buffer[7]  & 0x80)
     //   CORJIT_FLAG_USE_AES
     //      CORJIT_FLAG_USE_SSE2
     //      AES       - ECX bit 25   (buffer[11] & 0x01)
@@ -1352,7 +1358,6 @@ void EEJitManager::SetCpuInfo()
     //      BMI2 - EBX bit 8         (buffer[5]  & 0x01)
     //   CORJIT_FLAG_USE_LZCNT if the following feature bits are set (input EAX of 80000001H)
     //      LZCNT - ECX bit 5        (buffer[8]  & 0x20)
-    // synchronously updating VM and JIT.
 
     unsigned char buffer[16];
     DWORD maxCpuId = getcpuid(0, buffer);
@@ -1420,6 +1425,13 @@ void EEJitManager::SetCpuInfo()
                                         if ((buffer[4] & 0x20) != 0)        // AVX2
                                         {
                                             CPUCompileFlags.Set(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX2);
+
+                                            if (((buffer[6] & 0x01) != 0) &&        // AVX512F
+                                                ((buffer[7] & 0xC0) == 0xC0) &&     // AVX512BW & AVX512VL
+                                                (avx512StateSupport() == 1))
+                                            {
+                                                CPUCompileFlags.Set(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX_512);
+                                            }
                                         }
                                     }
                                 }
@@ -1439,6 +1451,7 @@ void EEJitManager::SetCpuInfo()
             if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SIMD16ByteOnly) != 0)
             {
                 CPUCompileFlags.Clear(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX2);
+                CPUCompileFlags.Clear(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX_512);
             }
         }
 
@@ -2589,6 +2602,12 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
     }
 #endif
 
+    // The JIT pads hot loops to 32-byte boundaries relative to the method start
+    if ((flag & CORJIT_ALLOCMEM_FLG_32BYTE_ALIGN) != 0)
+    {
+        alignment = max(alignment, 32);
+    }
+
     //
     // Compute header layout
     //
@@ -2668,7 +2687,7 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
         *pModuleBase = (TADDR)pCodeHeap;
 #endif
 
-        NibbleMapSet(pCodeHeap, pCode, TRUE);
+        NibbleMapSet(pCodeHeap, pCode, blockSize);
     }
 
     RETURN(pCodeHdr);
@@ -2960,7 +2979,7 @@ JumpStubBlockHeader *  EEJitManager::allocJumpStubBlock(MethodDesc* pMD, DWORD n
         CodeHeader * pCodeHdr = (CodeHeader *) (mem - sizeof(CodeHeader));
         pCodeHdr->SetStubCodeBlockKind(STUB_CODE_BLOCK_JUMPSTUB);
 
-        NibbleMapSet(pCodeHeap, mem, TRUE);
+        NibbleMapSet(pCodeHeap, mem, blockSize);
 
         pBlock = (JumpStubBlockHeader *)mem;
 
@@ -3013,7 +3032,7 @@ void * EEJitManager::allocCodeFragmentBlock(size_t blockSize, unsigned alignment
         CodeHeader * pCodeHdr = (CodeHeader *) (mem - sizeof(CodeHeader));
         pCodeHdr->SetStubCodeBlockKind(kind);
 
-        NibbleMapSet(pCodeHeap, (TADDR)mem, TRUE);
+        NibbleMapSet(pCodeHeap, (TADDR)mem, blockSize);
 
         // Record the jump stub reservation
         pCodeHeap->reserveForJumpStubs += requestInfo.getReserveForJumpStubs();
@@ -3233,7 +3252,7 @@ void EEJitManager::RemoveJitData (CodeHeader * pCHdr, size_t GCinfo_len, size_t
         if (pHp == NULL)
             return;
 
-        NibbleMapSet(pHp, (TADDR)(pCHdr + 1), FALSE);
+        NibbleMapDelete(pHp, (TADDR)(pCHdr + 1));
     }
 
     // Backout the GCInfo  
@@ -3395,7 +3414,7 @@ void EEJitManager::FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart)
     // so pCodeHeap can only be a HostCodeHeap.
 
     // clean up the NibbleMap
-    NibbleMapSet(pCodeHeap->m_pHeapList, (TADDR)codeStart, FALSE);
+    NibbleMapDelete(pCodeHeap->m_pHeapList, (TADDR)codeStart);
 
     // The caller of this method doesn't call HostCodeHeap->FreeMemForCode
     // directly because the operation should be protected by m_CodeHeapCritSec.
@@ -3786,7 +3805,15 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
     // get DWORD and shift down our nibble
 
     PREFIX_ASSUME(pMap != NULL);
-    tmp = VolatileLoadWithoutBarrier<DWORD>(pMap) >> POS2SHIFTCOUNT(startPos);
+    tmp = VolatileLoadWithoutBarrier<DWORD>(pMap);
+
+    // The whole DWORD is inside a method, it holds the distance to the method start
+    if (IS_NIBBLE_POINTER(tmp))
+    {
+        return base + POS2MAPDWORDADDR(startPos) - DECODE_NIBBLE_POINTER(tmp);
+    }
+
+    tmp = tmp >> POS2SHIFTCOUNT(startPos);
 
     if ((tmp & NIBBLE_MASK) && ((tmp & NIBBLE_MASK) <= offset) )
     {
@@ -3828,6 +3855,11 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
     if (((INT_PTR)startPos) < 0)
         return NULL;
 
+    if (IS_NIBBLE_POINTER(tmp))
+    {
+        return base + POS2MAPDWORDADDR(startPos) - DECODE_NIBBLE_POINTER(tmp);
+    }
+
     // Find the nibble with the header in the DWORD
 
     while (startPos && !(tmp & NIBBLE_MASK))
@@ -3843,7 +3875,7 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 }
 
 #if !defined(DACCESS_COMPILE)
-void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet) 
+void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -3859,22 +3891,69 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
     size_t delta = pCode - pHp->mapBase;
 
     size_t pos  = ADDR2POS(delta); 
-    DWORD value = bSet?ADDR2OFFS(delta):0;
+    DWORD value = ADDR2OFFS(delta) << POS2SHIFTCOUNT(pos);
 
     DWORD index = (DWORD) (pos >> LOG2_NIBBLES_PER_DWORD);
-    DWORD mask  = ~((DWORD) HIGHEST_NIBBLE_MASK >> ((pos & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE));
-
-    value = value << POS2SHIFTCOUNT(pos);
+    DWORD mask  = POS2MASK(pos);
 
     PTR_DWORD pMap = pHp->pHdrMap;
 
     // assert that we don't overwrite an existing offset
-    // (it's a reset or it is empty)
-    _ASSERTE(!value || !((*(pMap+index))& ~mask));
+    _ASSERTE(!IS_NIBBLE_POINTER(*(pMap+index)) && !((*(pMap+index))& ~mask));
+
+    // Point the DWORDs that lie entirely inside the code back at its start. Nothing can look
+    // them up before the code is published, and a method too large to encode is found by
+    // scanning backwards as before.
+    if (codeSize <= MAX_NIBBLE_POINTER_DISTANCE)
+    {
+        size_t dwordStart = (size_t)(index + 1) << LOG2_BYTES_PER_MAP_DWORD;
+        size_t codeEnd = delta + codeSize;
+
+        for (DWORD i = index + 1; dwordStart + BYTES_PER_MAP_DWORD <= codeEnd; i++, dwordStart += BYTES_PER_MAP_DWORD)
+        {
+            _ASSERTE(*(pMap+i) == 0);
+            *(pMap+i) = ENCODE_NIBBLE_POINTER(dwordStart - delta);
+        }
+    }
 
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
 }
+
+void EEJitManager::NibbleMapDelete(HeapList * pHp, TADDR pCode)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    _ASSERTE(m_CodeHeapCritSec.OwnedByCurrentThread());
+
+    _ASSERTE(pCode >= pHp->mapBase);
+
+    size_t delta = pCode - pHp->mapBase;
+
+    size_t pos  = ADDR2POS(delta); 
+
+    DWORD index = (DWORD) (pos >> LOG2_NIBBLES_PER_DWORD);
+    DWORD mask  = POS2MASK(pos);
+
+    PTR_DWORD pMap = pHp->pHdrMap;
+
+    *(pMap+index) = (*(pMap+index))&mask;
+
+    // Clear the DWORDs that NibbleMapSet pointed at this code. They all lie below endAddress,
+    // so the walk stops at the first DWORD that does not point here without leaving the map.
+    size_t dwordStart = (size_t)(index + 1) << LOG2_BYTES_PER_MAP_DWORD;
+    for (DWORD i = index + 1;
+         pHp->mapBase + dwordStart < pHp->endAddress &&
+             IS_NIBBLE_POINTER(*(pMap+i)) &&
+             DECODE_NIBBLE_POINTER(*(pMap+i)) == dwordStart - delta;
+         i++, dwordStart += BYTES_PER_MAP_DWORD)
+    {
+        *(pMap+i) = 0;
+    }
+}
 #endif // !DACCESS_COMPILE
 
 #if defined(WIN64EXCEPTIONS)
@@ -4496,7 +4575,7 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
     // Unless we are on an MP system with many cpus
     // where this sort of caching actually diminishes scaling during server GC
     // due to many processors writing to a common location
-    if (g_SystemInfo.dwNumberOfProcessors < 4 || !GCHeapUtilities::IsServerHeap() || !GCHeapUtilities::IsGCInProgress())
+    if (GetCurrentProcessCpuCount() < 4 || !GCHeapUtilities::IsServerHeap() || !GCHeapUtilities::IsGCInProgress())
         pHead->pLastUsed = pLast;
 #endif
 
@@ -64,6 +64,34 @@ static INT64 s_JitPitchLastTick = 0;
 
 static bool s_JitPitchInitialized = false;
 
+// The pitching knobs are consulted for every jitted method, so they are read once
+static bool s_JitPitchConfigLoaded = false;
+static bool s_JitPitchEnabled = false;
+static DWORD s_JitPitchMemThreshold = 0;
+static DWORD s_JitPitchMethodSizeThreshold = 0;
+static DWORD s_JitPitchTimeInterval = 0;
+static DWORD s_JitPitchPrintStat = 0;
+static DWORD s_JitPitchMinVal = 0;
+static DWORD s_JitPitchMaxVal = 0;
+
+static bool IsJitPitchingEnabled()
+{
+    if (!s_JitPitchConfigLoaded)
+    {
+        s_JitPitchMemThreshold = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMemThreshold);
+        s_JitPitchMethodSizeThreshold = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMethodSizeThreshold);
+        s_JitPitchTimeInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchTimeInterval);
+        s_JitPitchPrintStat = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchPrintStat);
+        s_JitPitchMinVal = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMinVal);
+        s_JitPitchMaxVal = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMaxVal);
+        s_JitPitchEnabled = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchEnabled) != 0) &&
+                            (s_JitPitchMemThreshold != 0);
+        // Racing threads compute the same values, so publishing them twice is benign
+        VolatileStore(&s_JitPitchConfigLoaded, true);
+    }
+    return s_JitPitchEnabled;
+}
+
 
 static BOOL IsOwnerOfRWLock(LPVOID lock)
 {
@@ -140,8 +168,7 @@ static COUNT_T GetFullHash(MethodDesc* pMD)
 
 bool MethodDesc::IsPitchable()
 {
-    if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchEnabled) == 0) ||
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMemThreshold) == 0))
+    if (!IsJitPitchingEnabled())
         return FALSE;
 
     InitializeJitPitching();
@@ -232,7 +259,7 @@ static void LookupOrCreateInPitchingCandidate(MethodDesc* pMD, ULONG sizeOfCode)
         s_pPitchingCandidateMethods->InsertValue(key, (LPVOID)pMD);
         s_pPitchingCandidateSizes->InsertValue(key, (LPVOID)((ULONGLONG)(sizeOfCode << 1)));
 #ifdef _DEBUG
-        if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchPrintStat) != 0)
+        if (s_JitPitchPrintStat != 0)
         {
             SString className, methodName, methodSig;
             pMD->GetMethodInfo(className, methodName, methodSig);
@@ -368,11 +395,11 @@ void MethodDesc::PitchNativeCode()
 
     ++s_PitchedMethodCounter;
 
-    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMinVal) > s_PitchedMethodCounter)
+    if (s_JitPitchMinVal > s_PitchedMethodCounter)
     {
         return;
     }
-    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMaxVal) < s_PitchedMethodCounter)
+    if (s_JitPitchMaxVal < s_PitchedMethodCounter)
     {
         return;
     }
@@ -427,7 +454,7 @@ void MethodDesc::PitchNativeCode()
             s_pPitchingCandidateSizes->DeleteValue(key, (LPVOID)pitchedBytes);
     }
 
-    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchPrintStat) != 0)
+    if (s_JitPitchPrintStat != 0)
     {
         SString className, methodName, methodSig;
         GetMethodInfo(className, methodName, methodSig);
@@ -445,14 +472,13 @@ void MethodDesc::PitchNativeCode()
 
 EXTERN_C void CheckStacksAndPitch()
 {
-    if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchEnabled) != 0) &&
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMemThreshold) != 0) &&
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchTimeInterval) == 0 ||
-         ((::GetTickCount64() - s_JitPitchLastTick) > CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchTimeInterval))))
+    if (IsJitPitchingEnabled() &&
+        (s_JitPitchTimeInterval == 0 ||
+         ((::GetTickCount64() - s_JitPitchLastTick) > s_JitPitchTimeInterval)))
     {
         SimpleReadLockHolder srlh(s_totalNCSizeLock);
 
-        if ((s_totalNCSize - s_jitPitchedBytes) > CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMemThreshold) &&
+        if ((s_totalNCSize - s_jitPitchedBytes) > s_JitPitchMemThreshold &&
             s_pPitchingCandidateMethods != nullptr)
         {
             EX_TRY
@@ -502,7 +528,7 @@ EXTERN_C void CheckStacksAndPitch()
 
 EXTERN_C void SavePitchingCandidate(MethodDesc* pMD, ULONG sizeOfCode)
 {
-    if (pMD && pMD->IsPitchable() && CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMethodSizeThreshold) < sizeOfCode)
+    if (pMD && pMD->IsPitchable() && s_JitPitchMethodSizeThreshold < sizeOfCode)
     {
         LookupOrCreateInPitchingCandidate(pMD, sizeOfCode);
     }
@@ -510,7 +536,7 @@ EXTERN_C void SavePitchingCandidate(MethodDesc* pMD, ULONG sizeOfCode)
     {
         SimpleWriteLockHolder swlh(s_totalNCSizeLock);
         s_totalNCSize += sizeOfCode;
-        if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchPrintStat) != 0)
+        if (s_JitPitchPrintStat != 0)
             printf("jitted %lu (bytes) pitched %lu (bytes)\n", s_totalNCSize, s_jitPitchedBytes);
     }
 }
@@ -63,6 +63,7 @@ NativeCodeVersionNode::NativeCodeVersionNode(
     m_id(id),
 #ifdef FEATURE_TIERED_COMPILATION
     m_optTier(optimizationTier),
+    m_pProfileData(NULL),
 #endif
     m_flags(0)
 {}
@@ -152,6 +153,36 @@ NativeCodeVersion::OptimizationTier NativeCodeVersionNode::GetOptimizationTier()
     LIMITED_METHOD_DAC_CONTRACT;
     return m_optTier;
 }
+
+CORBBTPROF_METHOD_HEADER* NativeCodeVersionNode::GetProfileData() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    _ASSERTE(LockOwnedByCurrentThread());
+    return m_pProfileData;
+}
+
+BOOL NativeCodeVersionNode::IsJitSwitchedToOptimized() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    _ASSERTE(LockOwnedByCurrentThread());
+    return (m_flags & JitSwitchedToOptimizedFlag) != 0;
+}
+
+#ifndef DACCESS_COMPILE
+void NativeCodeVersionNode::SetProfileData(CORBBTPROF_METHOD_HEADER* pProfileData)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(LockOwnedByCurrentThread());
+    m_pProfileData = pProfileData;
+}
+
+void NativeCodeVersionNode::SetJitSwitchedToOptimized()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(LockOwnedByCurrentThread());
+    m_flags |= JitSwitchedToOptimizedFlag;
+}
+#endif
 #endif // FEATURE_TIERED_COMPILATION
 
 NativeCodeVersion::NativeCodeVersion() :
@@ -339,6 +370,90 @@ NativeCodeVersion::OptimizationTier NativeCodeVersion::GetOptimizationTier() con
         return TieredCompilationManager::GetInitialOptimizationTier(GetMethodDesc());
     }
 }
+
+CORBBTPROF_METHOD_HEADER* NativeCodeVersion::GetProfileData() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    if (m_storageKind == StorageKind::Explicit)
+    {
+        return AsNode()->GetProfileData();
+    }
+    else
+    {
+        PTR_MethodDescVersioningState pMethodVersioningState = GetMethodDescVersioningState();
+        if (pMethodVersioningState == NULL)
+        {
+            return NULL;
+        }
+        return pMethodVersioningState->GetDefaultVersionProfileData();
+    }
+}
+
+#ifndef DACCESS_COMPILE
+HRESULT NativeCodeVersion::SetProfileData(CORBBTPROF_METHOD_HEADER* pProfileData)
+{
+    LIMITED_METHOD_CONTRACT;
+    if (m_storageKind == StorageKind::Explicit)
+    {
+        AsNode()->SetProfileData(pProfileData);
+    }
+    else
+    {
+        // The default version keeps its data in the versioning state, which
+        // may not exist yet if the method has only ever had one version
+        MethodDesc* pMethodDesc = GetMethodDesc();
+        MethodDescVersioningState* pMethodVersioningState = NULL;
+        HRESULT hr = pMethodDesc->GetCodeVersionManager()->GetOrCreateMethodDescVersioningState(pMethodDesc, &pMethodVersioningState);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
+        pMethodVersioningState->SetDefaultVersionProfileData(pProfileData);
+    }
+    return S_OK;
+}
+#endif
+
+BOOL NativeCodeVersion::IsJitSwitchedToOptimized() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    if (m_storageKind == StorageKind::Explicit)
+    {
+        return AsNode()->IsJitSwitchedToOptimized();
+    }
+    else
+    {
+        PTR_MethodDescVersioningState pMethodVersioningState = GetMethodDescVersioningState();
+        if (pMethodVersioningState == NULL)
+        {
+            return FALSE;
+        }
+        return pMethodVersioningState->IsDefaultVersionJitSwitchedToOptimized();
+    }
+}
+
+#ifndef DACCESS_COMPILE
+HRESULT NativeCodeVersion::SetJitSwitchedToOptimized()
+{
+    LIMITED_METHOD_CONTRACT;
+    if (m_storageKind == StorageKind::Explicit)
+    {
+        AsNode()->SetJitSwitchedToOptimized();
+    }
+    else
+    {
+        MethodDesc* pMethodDesc = GetMethodDesc();
+        MethodDescVersioningState* pMethodVersioningState = NULL;
+        HRESULT hr = pMethodDesc->GetCodeVersionManager()->GetOrCreateMethodDescVersioningState(pMethodDesc, &pMethodVersioningState);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
+        pMethodVersioningState->SetDefaultVersionJitSwitchedToOptimized();
+    }
+    return S_OK;
+}
+#endif
 #endif
 
 PTR_NativeCodeVersionNode NativeCodeVersion::AsNode() const
@@ -1054,6 +1169,9 @@ MethodDescVersioningState::MethodDescVersioningState(PTR_MethodDesc pMethodDesc)
     m_flags(IsDefaultVersionActiveChildFlag),
     m_nextId(1),
     m_pFirstVersionNode(dac_cast<PTR_NativeCodeVersionNode>(nullptr))
+#ifdef FEATURE_TIERED_COMPILATION
+    , m_pDefaultVersionProfileData(NULL)
+#endif
 {
     LIMITED_METHOD_DAC_CONTRACT;
 #ifdef FEATURE_JUMPSTAMP
@@ -1652,7 +1770,37 @@ void MethodDescVersioningState::SetDefaultVersionActiveChildFlag(BOOL isActive)
         m_flags &= ~IsDefaultVersionActiveChildFlag;
     }
 }
+#endif
+
+#ifdef FEATURE_TIERED_COMPILATION
+CORBBTPROF_METHOD_HEADER* MethodDescVersioningState::GetDefaultVersionProfileData() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    return m_pDefaultVersionProfileData;
+}
+
+BOOL MethodDescVersioningState::IsDefaultVersionJitSwitchedToOptimized() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    return (m_flags & IsDefaultVersionJitSwitchedToOptimizedFlag) != 0;
+}
 
+#ifndef DACCESS_COMPILE
+void MethodDescVersioningState::SetDefaultVersionProfileData(CORBBTPROF_METHOD_HEADER* pProfileData)
+{
+    LIMITED_METHOD_CONTRACT;
+    m_pDefaultVersionProfileData = pProfileData;
+}
+
+void MethodDescVersioningState::SetDefaultVersionJitSwitchedToOptimized()
+{
+    LIMITED_METHOD_CONTRACT;
+    m_flags |= IsDefaultVersionJitSwitchedToOptimizedFlag;
+}
+#endif
+#endif // FEATURE_TIERED_COMPILATION
+
+#ifndef DACCESS_COMPILE
 void MethodDescVersioningState::LinkNativeCodeVersionNode(NativeCodeVersionNode* pNativeCodeVersionNode)
 {
     LIMITED_METHOD_CONTRACT;
@@ -12,6 +12,7 @@
 
 class NativeCodeVersion;
 class ILCodeVersion;
+struct CORBBTPROF_METHOD_HEADER;
 typedef DWORD NativeCodeVersionId;
 
 #ifdef FEATURE_CODE_VERSIONING
@@ -71,6 +72,12 @@ public:
     };
 #ifdef FEATURE_TIERED_COMPILATION
     OptimizationTier GetOptimizationTier() const;
+    CORBBTPROF_METHOD_HEADER* GetProfileData() const;
+    BOOL IsJitSwitchedToOptimized() const;
+#ifndef DACCESS_COMPILE
+    HRESULT SetProfileData(CORBBTPROF_METHOD_HEADER* pProfileData);
+    HRESULT SetJitSwitchedToOptimized();
+#endif
 #endif // FEATURE_TIERED_COMPILATION
     bool operator==(const NativeCodeVersion & rhs) const;
     bool operator!=(const NativeCodeVersion & rhs) const;
@@ -237,6 +244,12 @@ public:
 #endif
 #ifdef FEATURE_TIERED_COMPILATION
     NativeCodeVersion::OptimizationTier GetOptimizationTier() const;
+    CORBBTPROF_METHOD_HEADER* GetProfileData() const;
+    BOOL IsJitSwitchedToOptimized() const;
+#ifndef DACCESS_COMPILE
+    void SetProfileData(CORBBTPROF_METHOD_HEADER* pProfileData);
+    void SetJitSwitchedToOptimized();
+#endif
 #endif
 
 private:
@@ -251,11 +264,15 @@ private:
     NativeCodeVersionId m_id;
 #ifdef FEATURE_TIERED_COMPILATION
     NativeCodeVersion::OptimizationTier m_optTier;
+    // Basic block counts collected by this version's instrumented code, if any
+    CORBBTPROF_METHOD_HEADER* m_pProfileData;
 #endif
 
     enum NativeCodeVersionNodeFlags
     {
-        IsActiveChildFlag = 1
+        IsActiveChildFlag = 1,
+        // The tier0 jit request for this version produced optimized code instead
+        JitSwitchedToOptimizedFlag = 2
     };
     DWORD m_flags;
 };
@@ -439,6 +456,14 @@ public:
 #ifndef DACCESS_COMPILE
     void SetDefaultVersionActiveChildFlag(BOOL isActive);
 #endif
+#ifdef FEATURE_TIERED_COMPILATION
+    CORBBTPROF_METHOD_HEADER* GetDefaultVersionProfileData() const;
+    BOOL IsDefaultVersionJitSwitchedToOptimized() const;
+#ifndef DACCESS_COMPILE
+    void SetDefaultVersionProfileData(CORBBTPROF_METHOD_HEADER* pProfileData);
+    void SetDefaultVersionJitSwitchedToOptimized();
+#endif
+#endif
 
 private:
 #if !defined(DACCESS_COMPILE) && defined(FEATURE_JUMPSTAMP)
@@ -450,11 +475,15 @@ private:
     enum MethodDescVersioningStateFlags
     {
         JumpStampMask = 0x3,
-        IsDefaultVersionActiveChildFlag = 0x4
+        IsDefaultVersionActiveChildFlag = 0x4,
+        IsDefaultVersionJitSwitchedToOptimizedFlag = 0x8
     };
     BYTE m_flags;
     NativeCodeVersionId m_nextId;
     PTR_NativeCodeVersionNode m_pFirstVersionNode;
+#ifdef FEATURE_TIERED_COMPILATION
+    CORBBTPROF_METHOD_HEADER* m_pDefaultVersionProfileData;
+#endif
 
 
     // The originally JITted code that was overwritten with the jmp stamp.
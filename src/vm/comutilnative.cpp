@@ -1243,6 +1243,25 @@ FCIMPL0(INT64, GCInterface::GetAllocatedBytesForCurrentThread)
 }
 FCIMPLEND
 
+/*===============================SetAllocationQuantumHint===============================
+**Action: Asks the GC to hand out bigger allocation contexts to the current thread so it
+**        refills its allocation context less often. The GC caps the size and still starts
+**        a GC when the gen0 budget is used up.
+**Returns: None
+**Arguments: quantum - requested allocation context size in bytes, 0 restores the default
+**Exceptions: None
+==============================================================================*/
+FCIMPL1(void, GCInterface::SetAllocationQuantumHint, UINT32 quantum)
+{
+    FCALL_CONTRACT;
+
+    if (GCHeapUtilities::UseThreadAllocationContexts())
+    {
+        GetThread()->GetAllocContext()->alloc_quantum_hint = quantum;
+    }
+}
+FCIMPLEND
+
 /*==============================SuppressFinalize================================
 **Action: Indicate that an object's finalizer should not be run by the system
 **Arguments: Object of interest
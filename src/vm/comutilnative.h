@@ -140,6 +140,8 @@ public:
     
     static FCDECL0(INT64,    GetAllocatedBytesForCurrentThread);
 
+    static FCDECL1(void,    SetAllocationQuantumHint, UINT32 quantum);
+
     static 
     int QCALLTYPE StartNoGCRegion(INT64 totalSize, BOOL lohSizeKnown, INT64 lohSize, BOOL disallowFullBlockingGC);
 
@@ -16,6 +16,7 @@
 #include "field.h"
 #include "excep.h"
 #include "comwaithandle.h"
+#include "win32threadpool.h"
 
 
 //-----------------------------------------------------------------------------
@@ -190,6 +191,8 @@ FCIMPL4(INT32, WaitHandleNative::CorWaitOneNative, SafeHandle* safeWaitHandleUNS
     handles[0] = sh->GetHandle();
     _ASSERTE(exitContext == NULL || targetContext == defaultContext);
     {
+        ThreadpoolMgr::BlockingWaitHolder blockingWaitHolder(pThread, timeout);
+
         // Support for pause/resume (FXFREEZE)
         while(true)
         {
@@ -262,6 +265,8 @@ FCIMPL4(INT32, WaitHandleNative::CorWaitMultipleNative, Object* waitObjectsUNSAF
     _ASSERTE(defaultContext);
     _ASSERTE(exitContext == NULL || targetContext == defaultContext);
     {
+        ThreadpoolMgr::BlockingWaitHolder blockingWaitHolder(pThread, timeout);
+
         // Support for pause/resume (FXFREEZE)
         while(true)
         {
@@ -326,6 +331,7 @@ FCIMPL5(INT32, WaitHandleNative::CorSignalAndWaitOneNative, SafeHandle* safeWait
     handles[1] = shWait->GetHandle();
     _ASSERTE(exitContext == NULL || targetContext == defaultContext);
     {
+        ThreadpoolMgr::BlockingWaitHolder blockingWaitHolder(pThread, timeout);
         res = pThread->DoSignalAndWait(handles,timeout,TRUE /*alertable*/);
     }
 
@@ -921,6 +921,38 @@ HRESULT CorHost2::CreateDelegate(
     return _CreateDelegate(appDomainID, wszAssemblyName, wszClassName, wszMethodName, fnPtr);
 }
 
+// The host signals that its startup work is done. Tiered compilation stops delaying
+// tier 1 promotion for new tier 0 activity from this point on.
+HRESULT CorHost2::NotifyStartupComplete(DWORD dwAppDomainId)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        ENTRY_POINT;  // This is called by a host.
+    }
+    CONTRACTL_END;
+
+    // This is currently supported in default domain only
+    if (dwAppDomainId != DefaultADID)
+        return HOST_E_INVALIDOPERATION;
+
+    // No point going further if the runtime is not running...
+    if (!IsRuntimeActive() || !m_fStarted)
+    {
+        return HOST_E_CLRNOTAVAILABLE;
+    }
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (g_pConfig->TieredCompilation())
+    {
+        SystemDomain::GetCurrentDomain()->GetTieredCompilationManager()->OnStartupComplete();
+    }
+#endif
+
+    return S_OK;
+}
+
 HRESULT CorHost2::Authenticate(ULONGLONG authKey)
 {
     CONTRACTL
@@ -28,7 +28,7 @@ Volatile<LONG> g_ShutdownCrstUsageCount = 0;
 //-----------------------------------------------------------------
 // Initialize critical section
 //-----------------------------------------------------------------
-VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
+VOID CrstBase::InitWorker(CrstType crstType, CrstFlags flags)
 {
     CONTRACTL {
         THROWS;
@@ -47,6 +47,7 @@ VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
 
     SetFlags(flags);
     SetCrstInitialized();
+    m_crstType = crstType;
 
 #ifdef _DEBUG
     DebugInit(crstType, flags);
@@ -310,7 +311,18 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
         }
     }
 
-    UnsafeEnterCriticalSection(&m_criticalsection);
+    // Contention is only sampled on locks that are entered in preemptive mode, the others are
+    // taken on paths that writing the event can run into.
+    if ((pThread != NULL) &&
+        ((m_dwFlags & (CRST_UNSAFE_ANYMODE | CRST_UNSAFE_COOPGC | CRST_GC_NOTRIGGER_WHEN_TAKEN | CRST_DEBUGGER_THREAD)) == 0) &&
+        ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ContentionSample))
+    {
+        EnterAndSampleContention();
+    }
+    else
+    {
+        UnsafeEnterCriticalSection(&m_criticalsection);
+    }
 
 #ifdef _DEBUG
     PostEnter();
@@ -324,6 +336,34 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
     }
 }
 
+void CrstBase::EnterAndSampleContention()
+{
+    STATIC_CONTRACT_NOTHROW;
+    STATIC_CONTRACT_GC_NOTRIGGER;
+
+    if (UnsafeTryEnterCriticalSection(&m_criticalsection))
+    {
+        return;
+    }
+
+    if (!ETW::ContentionLog::ShouldSampleContention())
+    {
+        UnsafeEnterCriticalSection(&m_criticalsection);
+        return;
+    }
+
+    // The owner can release the lock before it is read here, the sample then reports the next
+    // owner or none.
+    UINT64 ownerThreadID = (UINT64)(SIZE_T)m_criticalsection.OwningThread;
+
+    LARGE_INTEGER contentionStartTicks;
+    QueryPerformanceCounter(&contentionStartTicks);
+
+    UnsafeEnterCriticalSection(&m_criticalsection);
+
+    ETW::ContentionLog::SendContentionSample(ETW::ContentionLog::ContentionStructs::NativeContention, this, (UINT32)m_crstType, ownerThreadID, contentionStartTicks);
+}
+
 //-----------------------------------------------------------------
 // Release the lock.
 //-----------------------------------------------------------------
@@ -587,7 +627,6 @@ void CrstBase::DebugInit(CrstType crstType, CrstFlags flags)
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_crstType = crstType;
     m_tag = GetCrstName(crstType);
     m_crstlevel = GetCrstLevel(crstType);
     m_holderthreadid.Clear();
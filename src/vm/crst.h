@@ -289,7 +289,10 @@ public:
 
 protected:    
 
-    VOID InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags);
+    VOID InitWorker(CrstType crstType, CrstFlags flags);
+
+    // Enters the lock, timing the wait for a ContentionSample event if it is contended.
+    void EnterAndSampleContention();
 
 #ifdef _DEBUG
     void DebugInit(CrstType crstType, CrstFlags flags);
@@ -311,9 +314,9 @@ protected:
         // rest of the flags are CrstFlags
     } CrstReservedFlags;
     DWORD               m_dwFlags;            // Re-entrancy and same level
+    CrstType            m_crstType;         // Type enum (should have a descriptive name for debugging)
 #ifdef _DEBUG
     UINT                m_entercount;       // # of unmatched Enters.
-    CrstType            m_crstType;         // Type enum (should have a descriptive name for debugging)
     const char         *m_tag;              // Stringized form of the tag for easy debugging
     int                 m_crstlevel;        // what level is the crst in?
     EEThreadId          m_holderthreadid;   // current holder (or NULL)
@@ -438,8 +441,7 @@ public:
     {
         WRAPPER_NO_CONTRACT;
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     //-----------------------------------------------------------------
@@ -478,8 +480,7 @@ public:
 
         _ASSERTE((flags & CRST_INITIALIZED) == 0);
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     bool InitNoThrow(CrstType crstType, CrstFlags flags = CRST_DEFAULT)
@@ -494,8 +495,7 @@ public:
 
         EX_TRY
         {
-            // throw away the debug-only parameter in retail
-            InitWorker(INDEBUG_COMMA(crstType) flags);
+            InitWorker(crstType, flags);
             fSuccess = true;
         }
         EX_CATCH
@@ -0,0 +1,94 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: DispatchSlotCache.CPP
+//
+// ===========================================================================
+
+
+
+#include "common.h"
+#include "dispatchslotcache.h"
+
+DispatchSlotCache::Entry DispatchSlotCache::s_entries[DispatchSlotCache::CacheSize];
+
+PCODE DispatchSlotCache::TryGet(MethodTable* pMT, UINT32 typeID, UINT32 slotNumber)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    TADDR mtAddr = dac_cast<TADDR>(pMT);
+    Entry* pEntry = &s_entries[GetIndex(mtAddr, typeID, slotNumber)];
+
+    DWORD version = pEntry->version;
+    if ((version & 1) != 0)
+    {
+        return NULL;
+    }
+
+    // The loads are ordered, so if the version is unchanged after them the fields
+    // were not being written while we read them
+    TADDR entryMT = VolatileLoad(&pEntry->pMT);
+    UINT64 entryKey = VolatileLoad(&pEntry->key);
+    PCODE entryTarget = VolatileLoad(&pEntry->target);
+    if (pEntry->version != version ||
+        entryMT != mtAddr ||
+        entryKey != GetKey(typeID, slotNumber))
+    {
+        return NULL;
+    }
+
+    return entryTarget;
+}
+
+void DispatchSlotCache::TryAdd(MethodTable* pMT, UINT32 typeID, UINT32 slotNumber, PCODE target)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(target != NULL);
+
+    TADDR mtAddr = dac_cast<TADDR>(pMT);
+    Entry* pEntry = &s_entries[GetIndex(mtAddr, typeID, slotNumber)];
+
+    DWORD version = pEntry->version;
+    if ((version & 1) != 0 ||
+        (DWORD)InterlockedCompareExchange((LONG*)pEntry->version.GetPointer(), version + 1, version) != version)
+    {
+        // Another thread is writing this entry, let it win
+        return;
+    }
+
+    SetEntry(pEntry, version, mtAddr, GetKey(typeID, slotNumber), target);
+}
+
+void DispatchSlotCache::Flush()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (DWORD i = 0; i < CacheSize; i++)
+    {
+        Entry* pEntry = &s_entries[i];
+        while (true)
+        {
+            DWORD version = pEntry->version;
+            if ((version & 1) == 0 &&
+                (DWORD)InterlockedCompareExchange((LONG*)pEntry->version.GetPointer(), version + 1, version) == version)
+            {
+                SetEntry(pEntry, version, NULL, 0, NULL);
+                break;
+            }
+            YieldProcessor();
+        }
+    }
+}
+
+// Called once the entry has been claimed by moving its version from 'version' to 'version + 1'
+void DispatchSlotCache::SetEntry(Entry* pEntry, DWORD version, TADDR pMT, UINT64 key, PCODE target)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pEntry->version == version + 1);
+
+    pEntry->pMT = pMT;
+    pEntry->key = key;
+    pEntry->target = target;
+    pEntry->version = version + 2;
+}
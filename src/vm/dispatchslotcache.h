@@ -0,0 +1,67 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: DispatchSlotCache.h
+//
+// ===========================================================================
+
+
+#ifndef DISPATCH_SLOT_CACHE_H
+#define DISPATCH_SLOT_CACHE_H
+
+// A fixed size, process wide cache of MethodTable::FindDispatchSlot results, keyed by
+// the dispatching type and the interface type ID and slot number. It saves the dispatch
+// map walk over the parent chain for types that implement many interfaces, which is
+// what resolve stub misses, GetMethodDescForInterfaceMethod and default interface
+// method resolution otherwise pay on every lookup.
+//
+// Entries use the same versioning scheme as CastCache: lookups take no lock and an
+// insert that races with another insert into the same entry is dropped. Only non-null
+// targets of live types are stored, so the cache is flushed when types are unloaded.
+class DispatchSlotCache
+{
+public:
+    // Types with fewer interfaces than this are cheap enough to walk every time
+    static const DWORD MinInterfaces = 8;
+
+    // Returns the cached target, or NULL if there is none
+    static PCODE TryGet(MethodTable* pMT, UINT32 typeID, UINT32 slotNumber);
+
+    static void TryAdd(MethodTable* pMT, UINT32 typeID, UINT32 slotNumber, PCODE target);
+
+    // Removes all entries. Called when a collectible loader allocator is unloaded.
+    static void Flush();
+
+private:
+    struct Entry
+    {
+        Volatile<DWORD> version;
+        TADDR pMT;
+        UINT64 key;
+        PCODE target;
+    };
+
+    static const DWORD CacheSize = 2048;
+
+    static Entry s_entries[CacheSize];
+
+    static UINT64 GetKey(UINT32 typeID, UINT32 slotNumber)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return ((UINT64)typeID << 32) | slotNumber;
+    }
+
+    static DWORD GetIndex(TADDR pMT, UINT32 typeID, UINT32 slotNumber)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        size_t hash = (pMT >> 3) + (size_t)typeID * 31 + (size_t)slotNumber * 17;
+        hash ^= hash >> 11;
+        return (DWORD)hash & (CacheSize - 1);
+    }
+
+    static void SetEntry(Entry* pEntry, DWORD version, TADDR pMT, UINT64 key, PCODE target);
+};
+
+#endif // DISPATCH_SLOT_CACHE_H
@@ -5405,12 +5405,28 @@ PCODE NDirect::GetStubForILStub(NDirectMethodDesc* pNMD, MethodDesc** ppStubMD,
     // pStubMD, if provided, must be preimplemented.
     CONSISTENCY_CHECK( (*ppStubMD == NULL) || (*ppStubMD)->IsPreImplemented() );
 
+    // Only the stub for the default flags is cached on the MethodDesc, the NGen and
+    // vararg paths never get here with both conditions true.
+    bool fUseCachedStub = ((dwStubFlags & ~NDIRECTSTUB_FL_FOR_NUMPARAMBYTES) == 0);
+
+    if (NULL == *ppStubMD && fUseCachedStub)
+    {
+        *ppStubMD = pNMD->GetCachedILStubMD();
+    }
+
     if (NULL == *ppStubMD)
     {
         PInvokeStaticSigInfo sigInfo;
         NDirect::PopulateNDirectMethodDesc(pNMD, &sigInfo, /* throwOnError = */ !SF_IsForNumParamBytes(dwStubFlags));
 
         *ppStubMD = NDirect::GetILStubMethodDesc(pNMD, &sigInfo, dwStubFlags);
+
+        // The IL of the stub has been generated by now, so it can no longer be removed
+        // from the ILStubCache by a failing creator.
+        if (*ppStubMD != NULL && fUseCachedStub && (*ppStubMD)->IsILStub())
+        {
+            pNMD->SetCachedILStubMD(*ppStubMD);
+        }
     }
 
     if (SF_IsForNumParamBytes(dwStubFlags))
@@ -886,6 +886,7 @@ void LCGMethodResolver::Reset()
     m_pJumpStubCache        = NULL;
     m_next                  = NULL;
     m_Code                  = NULL;
+    m_pResolvedTokens       = NULL;
 }
 
 //
@@ -982,6 +983,12 @@ void LCGMethodResolver::Destroy(BOOL fDomainUnload)
     m_jitMetaHeap.Delete();
     m_jitTempData.Delete();
 
+    if (m_pResolvedTokens != NULL)
+    {
+        delete[] m_pResolvedTokens;
+        m_pResolvedTokens = NULL;
+    }
+
 
     // Per-appdomain resources has been reclaimed already if the appdomain is being unloaded. Do not try to
     // release them again.
@@ -1306,6 +1313,9 @@ void LCGMethodResolver::ResolveToken(mdToken token, TypeHandle * pTH, MethodDesc
 {
     STANDARD_VM_CONTRACT;
 
+    if (TryGetResolvedToken(token, pTH, ppMD, ppFD))
+        return;
+
     GCX_COOP();
 
     PREPARE_SIMPLE_VIRTUAL_CALLSITE(METHOD__RESOLVER__RESOLVE_TOKEN, ObjectFromHandle(m_managedResolver));
@@ -1330,6 +1340,62 @@ void LCGMethodResolver::ResolveToken(mdToken token, TypeHandle * pTH, MethodDesc
     }
 
     _ASSERTE(!pTH->IsNull());
+
+    AddResolvedToken(token, *pTH, *ppMD, *ppFD);
+}
+
+BOOL LCGMethodResolver::TryGetResolvedToken(mdToken token, TypeHandle * pTH, MethodDesc ** ppMD, FieldDesc ** ppFD)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ResolvedToken * pResolvedTokens = VolatileLoad(&m_pResolvedTokens);
+    DWORD rid = RidFromToken(token);
+    if (pResolvedTokens == NULL || rid >= ResolvedTokenCacheSize)
+        return FALSE;
+
+    // The token is published last, so the other fields are valid once it matches
+    ResolvedToken * pEntry = &pResolvedTokens[rid];
+    if (pEntry->token != token)
+        return FALSE;
+
+    *pTH = pEntry->th;
+    *ppMD = pEntry->pMD;
+    *ppFD = pEntry->pFD;
+    return TRUE;
+}
+
+void LCGMethodResolver::AddResolvedToken(mdToken token, TypeHandle th, MethodDesc * pMD, FieldDesc * pFD)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    DWORD rid = RidFromToken(token);
+    if (rid >= ResolvedTokenCacheSize || token == ResolvedTokenBusy)
+        return;
+
+    if (VolatileLoad(&m_pResolvedTokens) == NULL)
+    {
+        ResolvedToken * pNew = new (nothrow) ResolvedToken[ResolvedTokenCacheSize];
+        if (pNew == NULL)
+            return;
+        ZeroMemory(pNew, sizeof(ResolvedToken) * ResolvedTokenCacheSize);
+
+        if (InterlockedCompareExchangeT(&m_pResolvedTokens, pNew, (ResolvedToken *)NULL) != NULL)
+            delete[] pNew;
+    }
+
+    // Claim the empty entry. If another thread got there first it is storing the same result.
+    ResolvedToken * pEntry = &m_pResolvedTokens[rid];
+    if (InterlockedCompareExchange((LONG *)pEntry->token.GetPointer(), (LONG)ResolvedTokenBusy, 0) != 0)
+        return;
+
+    pEntry->th = th;
+    pEntry->pMD = pMD;
+    pEntry->pFD = pFD;
+    pEntry->token = token;
 }
 
 //---------------------------------------------------------------------------------------
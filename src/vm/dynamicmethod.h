@@ -148,6 +148,23 @@ private:
         IndCellList * pNext;
     };
 
+    // Results of ResolveToken, indexed by the RID of the token. The managed resolver hands
+    // out tokens with consecutive RIDs, so the JIT and the interpreter asking for the same
+    // token again can skip the call into managed code. Each entry is filled at most once.
+    struct ResolvedToken
+    {
+        Volatile<mdToken> token;
+        TypeHandle th;
+        MethodDesc * pMD;
+        FieldDesc * pFD;
+    };
+
+    static const DWORD ResolvedTokenCacheSize = 256;
+    static const mdToken ResolvedTokenBusy = (mdToken)-1;
+
+    BOOL TryGetResolvedToken(mdToken token, TypeHandle * pTH, MethodDesc ** ppMD, FieldDesc ** ppFD);
+    void AddResolvedToken(mdToken token, TypeHandle th, MethodDesc * pMD, FieldDesc * pFD);
+
     DynamicMethodDesc* m_pDynamicMethod;
     OBJECTHANDLE m_managedResolver;
     BYTE *m_Code;
@@ -164,6 +181,7 @@ private:
     DynamicStringLiteral* m_DynamicStringLiterals;
     IndCellList * m_UsedIndCellList;    // list to keep track of all the indirection cells used by the jitted code
     ExecutionManager::JumpStubCache * m_pJumpStubCache;
+    ResolvedToken * m_pResolvedTokens;  // lazily allocated, ResolvedTokenCacheSize entries
 };  // class LCGMethodResolver
 
 //---------------------------------------------------------------------------------------
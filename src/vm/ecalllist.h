@@ -828,6 +828,7 @@ FCFuncStart(gGCInterfaceFuncs)
     FCFuncElement("_ReRegisterForFinalize", GCInterface::ReRegisterForFinalize)
     
     FCFuncElement("_GetAllocatedBytesForCurrentThread", GCInterface::GetAllocatedBytesForCurrentThread)
+    FCFuncElement("_SetAllocationQuantumHint", GCInterface::SetAllocationQuantumHint)
 FCFuncEnd()
 
 FCFuncStart(gMemoryFailPointFuncs)
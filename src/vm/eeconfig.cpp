@@ -218,10 +218,12 @@ HRESULT EEConfig::Init()
     fJitAlignLoops = false;
     fAddRejitNops = false;
     fJitMinOpts = false;
+    dwJitPhaseStatsSampleInterval = 1;
     fPInvokeRestoreEsp = (DWORD)-1;
 
     fLegacyNullReferenceExceptionPolicy = false;
     fLegacyUnhandledExceptionPolicy = false;
+    dwExceptionStackTraceMaxFrames = 0;
     fLegacyComHierarchyVisibility = false;
     fLegacyComVTableLayout = false;
     fNewComVTableLayout = false;
@@ -377,6 +379,10 @@ HRESULT EEConfig::Init()
     fTieredCompilation_OptimizeTier0 = false;
     tieredCompilation_tier1CallCountThreshold = 1;
     tieredCompilation_tier1CallCountingDelayMs = 0;
+    tieredCompilation_tier1CallCountingMaxDelayMs = 0;
+    tieredCompilation_tier1DelayActivityThreshold = 1;
+    tieredCompilation_backgroundWorkerCount = 1;
+    fTieredPGO = false;
 #endif
     
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
@@ -1022,6 +1028,9 @@ HRESULT EEConfig::sync()
     fJitMinOpts = (GetConfigDWORD_DontUse_(CLRConfig::UNSUPPORTED_JITMinOpts, fJitMinOpts) == 1);
     iJitOptimizeType      =  GetConfigDWORD_DontUse_(CLRConfig::EXTERNAL_JitOptimizeType, iJitOptimizeType);
     if (iJitOptimizeType > OPT_RANDOM)     iJitOptimizeType = OPT_DEFAULT;
+    dwJitPhaseStatsSampleInterval = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitPhaseStatsSampleInterval);
+
+    dwExceptionStackTraceMaxFrames = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ExceptionStackTraceMaxFrames);
 
 #ifdef FEATURE_REJIT
     fAddRejitNops = (GetConfigDWORD_DontUse_(CLRConfig::UNSUPPORTED_AddRejitNops, fAddRejitNops) != 0);
@@ -1262,6 +1271,24 @@ HRESULT EEConfig::sync()
             }
         }
     }
+
+    tieredCompilation_tier1CallCountingMaxDelayMs =
+        CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredCompilation_Tier1CallCountingMaxDelayMs);
+    tieredCompilation_tier1DelayActivityThreshold =
+        CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredCompilation_Tier1DelayActivityThreshold);
+    if (tieredCompilation_tier1DelayActivityThreshold < 1)
+    {
+        tieredCompilation_tier1DelayActivityThreshold = 1;
+    }
+
+    tieredCompilation_backgroundWorkerCount =
+        CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredCompilation_BackgroundWorkerCount);
+    if (tieredCompilation_backgroundWorkerCount < 1)
+    {
+        tieredCompilation_backgroundWorkerCount = 1;
+    }
+
+    fTieredPGO = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO) != 0;
 #endif
 
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
@@ -281,6 +281,7 @@ public:
     bool          JitAlignLoops(void)               const {LIMITED_METHOD_CONTRACT;  return fJitAlignLoops; }
     bool          AddRejitNops(void)                const {LIMITED_METHOD_DAC_CONTRACT;  return fAddRejitNops; }
     bool          JitMinOpts(void)                  const {LIMITED_METHOD_CONTRACT;  return fJitMinOpts; }
+    DWORD         JitPhaseStatsSampleInterval(void) const {LIMITED_METHOD_CONTRACT;  return dwJitPhaseStatsSampleInterval; }
     
     // Tiered Compilation config
 #if defined(FEATURE_TIERED_COMPILATION)
@@ -289,6 +290,10 @@ public:
     bool          TieredCompilation_OptimizeTier0() const {LIMITED_METHOD_CONTRACT; return fTieredCompilation_OptimizeTier0; }
     DWORD         TieredCompilation_Tier1CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_tier1CallCountThreshold; }
     DWORD         TieredCompilation_Tier1CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_tier1CallCountingDelayMs; }
+    DWORD         TieredCompilation_Tier1CallCountingMaxDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_tier1CallCountingMaxDelayMs; }
+    DWORD         TieredCompilation_Tier1DelayActivityThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_tier1DelayActivityThreshold; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_backgroundWorkerCount; }
+    bool          TieredPGO(void)                   const {LIMITED_METHOD_CONTRACT;  return fTieredPGO; }
 #endif
 
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
@@ -321,6 +326,9 @@ public:
     bool LegacyNullReferenceExceptionPolicy(void)   const {LIMITED_METHOD_CONTRACT;  return fLegacyNullReferenceExceptionPolicy; }
     bool LegacyUnhandledExceptionPolicy(void)       const {LIMITED_METHOD_CONTRACT;  return fLegacyUnhandledExceptionPolicy; }
 
+    // Maximum number of frames recorded in an exception's stack trace, 0 if there is no limit
+    DWORD ExceptionStackTraceMaxFrames(void)        const {LIMITED_METHOD_CONTRACT;  return dwExceptionStackTraceMaxFrames; }
+
     bool LegacyComHierarchyVisibility(void)         const {LIMITED_METHOD_CONTRACT;  return fLegacyComHierarchyVisibility; }
     bool LegacyComVTableLayout(void)                const {LIMITED_METHOD_CONTRACT;  return fLegacyComVTableLayout; }
     bool NewComVTableLayout(void)                   const {LIMITED_METHOD_CONTRACT;  return fNewComVTableLayout; }
@@ -855,12 +863,15 @@ private: //----------------------------------------------------------------
     bool fJitMinOpts;          // Enable MinOpts for all jitted methods
 
     unsigned iJitOptimizeType; // 0=Blended,1=SmallCode,2=FastCode,              default is 0=Blended
+    DWORD dwJitPhaseStatsSampleInterval; // Report JIT phase stats for every Nth method, default is 1
     
     unsigned fPInvokeRestoreEsp;  // -1=Default, 0=Never, Else=Always
 
     bool fLegacyNullReferenceExceptionPolicy; // Old AV's as NullRef behavior
     bool fLegacyUnhandledExceptionPolicy;     // Old unhandled exception policy (many are swallowed)
 
+    DWORD dwExceptionStackTraceMaxFrames;
+
 #ifdef FEATURE_CORRUPTING_EXCEPTIONS
     bool fLegacyCorruptedStateExceptionsPolicy;
 #endif // FEATURE_CORRUPTING_EXCEPTIONS
@@ -1108,6 +1119,10 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_OptimizeTier0;
     DWORD tieredCompilation_tier1CallCountThreshold;
     DWORD tieredCompilation_tier1CallCountingDelayMs;
+    DWORD tieredCompilation_tier1CallCountingMaxDelayMs;
+    DWORD tieredCompilation_tier1DelayActivityThreshold;
+    DWORD tieredCompilation_backgroundWorkerCount;
+    bool fTieredPGO;
 #endif
 
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
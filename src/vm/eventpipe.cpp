@@ -16,6 +16,7 @@
 #include "eventpipejsonfile.h"
 #include "eventtracebase.h"
 #include "sampleprofiler.h"
+#include "runtimecounters.h"
 #include "win32threadpool.h"
 
 #ifdef FEATURE_PAL
@@ -34,7 +35,8 @@ EventPipeFile* EventPipe::s_pFile = NULL;
 EventPipeEventSource* EventPipe::s_pEventSource = NULL;
 LPCWSTR EventPipe::s_pCommandLine = NULL;
 unsigned long EventPipe::s_nextFileIndex;
-HANDLE EventPipe::s_fileSwitchTimerHandle = NULL;
+DWORD EventPipe::s_flushPeriodMS = 0;
+HANDLE EventPipe::s_fileTimerHandle = NULL;
 ULONGLONG EventPipe::s_lastFileSwitchTime = 0;
 
 #ifdef FEATURE_PAL
@@ -313,6 +315,9 @@ EventPipeSessionID EventPipe::Enable(LPCWSTR strOutputPath, EventPipeSession *pS
     // Initialize the last file switch time.
     s_lastFileSwitchTime = CLRGetTickCount64();
 
+    // Periodic flushing only applies to sessions that write a file.
+    s_flushPeriodMS = (strOutputPath != NULL) ? CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeFlushPeriodMs) : 0;
+
     // Create the event pipe file.
     // A NULL output path means that we should not write the results to a file.
     // This is used in the EventListener streaming case.
@@ -341,10 +346,13 @@ EventPipeSessionID EventPipe::Enable(LPCWSTR strOutputPath, EventPipeSession *pS
     // Enable the sample profiler
     SampleProfiler::Enable();
 
-    // Enable the file switch timer if needed.
-    if(s_pSession->GetMultiFileTraceLengthInSeconds() > 0)
+    // Enable the runtime counters
+    RuntimeCounters::EnableSampling();
+
+    // Enable the file timer if needed.
+    if(s_pSession->GetMultiFileTraceLengthInSeconds() > 0 || s_flushPeriodMS > 0)
     {
-        CreateFileSwitchTimer();
+        CreateFileTimer();
     }
 
     // Return the session ID.
@@ -379,6 +387,9 @@ void EventPipe::Disable(EventPipeSessionID id)
         // Disable the profiler.
         SampleProfiler::Disable();
 
+        // Stop sampling the runtime counters.
+        RuntimeCounters::DisableSampling();
+
         // Log the process information event.
         s_pEventSource->SendProcessInfo(s_pCommandLine);
 
@@ -392,8 +403,8 @@ void EventPipe::Disable(EventPipeSessionID id)
         s_pConfig->DeleteSession(s_pSession);
         s_pSession = NULL;
 
-        // Delete the file switch timer.
-        DeleteFileSwitchTimer();
+        // Delete the file timer.
+        DeleteFileTimer();
 
         // Flush all write buffers to make sure that all threads see the change.
         FlushProcessWriteBuffers();
@@ -437,6 +448,7 @@ void EventPipe::Disable(EventPipeSessionID id)
         }
 
         // De-allocate buffers.
+        s_pBufferManager->ReportAndResetLostEvents();
         s_pBufferManager->DeAllocateBuffers();
 
         // Delete deferred providers.
@@ -445,7 +457,7 @@ void EventPipe::Disable(EventPipeSessionID id)
     }
 }
 
-void EventPipe::CreateFileSwitchTimer()
+void EventPipe::CreateFileTimer()
 {
     CONTRACTL
     {
@@ -463,19 +475,26 @@ void EventPipe::CreateFileSwitchTimer()
     }
     timerContextHolder->TimerId = 0;
 
+    // The timer checks for file switches every FileSwitchTimerPeriodMS, or more often when it also flushes.
+    DWORD timerPeriodMS = FileSwitchTimerPeriodMS;
+    if(s_flushPeriodMS > 0 && s_flushPeriodMS < timerPeriodMS)
+    {
+        timerPeriodMS = s_flushPeriodMS;
+    }
+
     bool success = false;
-    _ASSERTE(s_fileSwitchTimerHandle == NULL);
+    _ASSERTE(s_fileTimerHandle == NULL);
     EX_TRY
     {
         if (ThreadpoolMgr::CreateTimerQueueTimer(
-                &s_fileSwitchTimerHandle,
-                SwitchToNextFileTimerCallback,
+                &s_fileTimerHandle,
+                FileTimerCallback,
                 timerContextHolder,
-                FileSwitchTimerPeriodMS,
-                FileSwitchTimerPeriodMS,
+                timerPeriodMS,
+                timerPeriodMS,
                 0 /* flags */))
         {
-            _ASSERTE(s_fileSwitchTimerHandle != NULL);
+            _ASSERTE(s_fileTimerHandle != NULL);
             success = true;
         }
     }
@@ -485,14 +504,14 @@ void EventPipe::CreateFileSwitchTimer()
     EX_END_CATCH(RethrowTerminalExceptions);
     if (!success)
     {
-        _ASSERTE(s_fileSwitchTimerHandle == NULL);
+        _ASSERTE(s_fileTimerHandle == NULL);
         return;
     }
 
     timerContextHolder.SuppressRelease(); // the timer context is automatically deleted by the timer infrastructure
 }
 
-void EventPipe::DeleteFileSwitchTimer()
+void EventPipe::DeleteFileTimer()
 {
     CONTRACTL
     {
@@ -503,13 +522,13 @@ void EventPipe::DeleteFileSwitchTimer()
     }
     CONTRACTL_END
 
-    if((s_fileSwitchTimerHandle != NULL) && (ThreadpoolMgr::DeleteTimerQueueTimer(s_fileSwitchTimerHandle, NULL)))
+    if((s_fileTimerHandle != NULL) && (ThreadpoolMgr::DeleteTimerQueueTimer(s_fileTimerHandle, NULL)))
     {
-        s_fileSwitchTimerHandle = NULL;
+        s_fileTimerHandle = NULL;
     }
 }
 
-void WINAPI EventPipe::SwitchToNextFileTimerCallback(PVOID parameter, BOOLEAN timerFired)
+void WINAPI EventPipe::FileTimerCallback(PVOID parameter, BOOLEAN timerFired)
 {
     CONTRACTL
     {
@@ -524,20 +543,30 @@ void WINAPI EventPipe::SwitchToNextFileTimerCallback(PVOID parameter, BOOLEAN ti
     // Take the lock control lock to make sure that tracing isn't disabled during this operation.
     CrstHolder _crst(GetLock());
 
-    // Make sure that we should actually switch files.
+    // Make sure that there is a file to switch or flush.
+    if(!Enabled() || s_pSession->GetSessionType() != EventPipeSessionType::File || s_pFile == NULL)
+    {
+        return;
+    }
+
     UINT64 multiFileTraceLengthInSeconds = s_pSession->GetMultiFileTraceLengthInSeconds();
-    if(!Enabled() || s_pSession->GetSessionType() != EventPipeSessionType::File || multiFileTraceLengthInSeconds == 0)
+    if(multiFileTraceLengthInSeconds == 0 && s_flushPeriodMS == 0)
     {
         return;
     }
 
     GCX_PREEMP();
 
-    if(CLRGetTickCount64() > (s_lastFileSwitchTime + (multiFileTraceLengthInSeconds * 1000)))
+    if(multiFileTraceLengthInSeconds > 0 &&
+       CLRGetTickCount64() > (s_lastFileSwitchTime + (multiFileTraceLengthInSeconds * 1000)))
     {
         SwitchToNextFile();
         s_lastFileSwitchTime = CLRGetTickCount64();
     }
+    else if(s_flushPeriodMS > 0)
+    {
+        FlushToFile();
+    }
 
 }
 
@@ -575,6 +604,28 @@ void EventPipe::SwitchToNextFile()
     s_pFile = pFile;
 }
 
+void EventPipe::FlushToFile()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        PRECONDITION(s_pFile != NULL);
+        PRECONDITION(GetLock()->OwnedByCurrentThread());
+    }
+    CONTRACTL_END
+
+    // Like SwitchToNextFile, only events before the current time stamp are written, so threads
+    // that are writing events now are not waited for.
+    LARGE_INTEGER stopTimeStamp;
+    QueryPerformanceCounter(&stopTimeStamp);
+    s_pBufferManager->WriteAllBuffersToFile(s_pFile, stopTimeStamp);
+
+    // Push out the partially filled block too, so a reader of the file sees all events up to now.
+    s_pFile->Flush();
+}
+
 void EventPipe::GetNextFilePath(EventPipeSession *pSession, SString &nextTraceFilePath)
 {
     CONTRACTL
@@ -293,18 +293,22 @@ class EventPipe
         // Enable the specified EventPipe session.
         static EventPipeSessionID Enable(LPCWSTR strOutputPath, EventPipeSession *pSession);
 
-        static void CreateFileSwitchTimer();
+        static void CreateFileTimer();
 
-        static void DeleteFileSwitchTimer();
+        static void DeleteFileTimer();
 
         // Performs one polling operation to determine if it is necessary to switch to a new file.
-        // If the polling operation decides it is time, it will perform the switch.
+        // If the polling operation decides it is time, it will perform the switch, otherwise it
+        // flushes the buffered events to the current file if periodic flushing is enabled.
         // Called directly from the timer when the timer is triggered.
-        static void WINAPI SwitchToNextFileTimerCallback(PVOID parameter, BOOLEAN timerFired);
+        static void WINAPI FileTimerCallback(PVOID parameter, BOOLEAN timerFired);
 
         // If event pipe has been configured to write multiple files, switch to the next file.
         static void SwitchToNextFile();
 
+        // Write the events buffered so far to the current file, leaving the file open.
+        static void FlushToFile();
+
         // Generate the file path for the next trace file.
         // This is used when event pipe has been configured to create multiple trace files with a specified maximum length of time.
         static void GetNextFilePath(EventPipeSession *pSession, SString &nextTraceFilePath);
@@ -330,7 +334,8 @@ class EventPipe
         static EventPipeEventSource *s_pEventSource;
         static LPCWSTR s_pCommandLine;
         const static DWORD FileSwitchTimerPeriodMS = 1000;
-        static HANDLE s_fileSwitchTimerHandle;
+        static DWORD s_flushPeriodMS;
+        static HANDLE s_fileTimerHandle;
         static ULONGLONG s_lastFileSwitchTime;
 };
 
@@ -26,6 +26,12 @@ class EventPipeBlock : public FastSerializableObject
 
         void Clear();
 
+        bool IsEmpty() const
+        {
+            LIMITED_METHOD_CONTRACT;
+            return m_pWritePointer == m_pBlock;
+        }
+
         const char* GetTypeName()
         {
             LIMITED_METHOD_CONTRACT;
@@ -23,13 +23,13 @@ EventPipeBufferManager::EventPipeBufferManager()
     m_pPerThreadBufferList = new SList<SListElem<EventPipeBufferList*>>();
     m_sizeOfAllBuffers = 0;
     m_lock.Init(LOCK_TYPE_DEFAULT);
+    m_numBuffersStolen = 0;
+    m_numEventsDropped = 0;
 
 #ifdef _DEBUG
     m_numBuffersAllocated = 0;
-    m_numBuffersStolen = 0;
     m_numBuffersLeaked = 0;
     m_numEventsStored = 0;
-    m_numEventsDropped = 0;
     m_numEventsWritten = 0;
 #endif // _DEBUG
 }
@@ -89,96 +89,97 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeSessio
     }
     CONTRACTL_END;
 
-    // Allocating a buffer requires us to take the lock.
-    SpinLockHolder _slh(&m_lock);
+    // The lock is only held to make the policy decision and to update the lists and the accounting.
+    // Allocating (and zeroing) the new buffer and freeing a stolen one happen outside of it, so that
+    // threads switching buffers at the same time do not wait on each other's heap operations.
 
-    // Determine if the requesting thread has at least one buffer.
-    // If not, we guarantee that each thread gets at least one (to prevent thrashing when the circular buffer size is too small).
-    bool allocateNewBuffer = false;
+    // A thread's buffer list is published together with its first buffer, so that nobody ever sees an
+    // empty list.  Allocate it up front if this thread doesn't have one yet.
     EventPipeBufferList *pThreadBufferList = pThread->GetEventPipeBufferList();
+    NewHolder<EventPipeBufferList> pNewThreadBufferList = NULL;
+    NewHolder<SListElem<EventPipeBufferList*>> pNewElem = NULL;
     if(pThreadBufferList == NULL)
     {
-        pThreadBufferList = new (nothrow) EventPipeBufferList(this);
-        if (pThreadBufferList == NULL)
+        pNewThreadBufferList = new (nothrow) EventPipeBufferList(this);
+        if (pNewThreadBufferList == NULL)
         {
             return NULL;
         }
 
-        SListElem<EventPipeBufferList*> *pElem = new (nothrow) SListElem<EventPipeBufferList*>(pThreadBufferList);
-        if (pElem == NULL)
+        pNewElem = new (nothrow) SListElem<EventPipeBufferList*>(pNewThreadBufferList);
+        if (pNewElem == NULL)
         {
             return NULL;
         }
-
-        m_pPerThreadBufferList->InsertTail(pElem);
-        pThread->SetEventPipeBufferList(pThreadBufferList);
-        allocateNewBuffer = true;
     }
 
-    // Determine if policy allows us to allocate another buffer, or if we need to steal one
-    // from another thread.
-    if(!allocateNewBuffer)
+    EventPipeBuffer *pStolenBuffer = NULL;
+    unsigned int bufferSize = 0;
     {
-        EventPipeConfiguration *pConfig = EventPipe::GetConfiguration();
-        if(pConfig == NULL)
-        {
-            return NULL;
-        }
+        SpinLockHolder _slh(&m_lock);
 
-        size_t circularBufferSizeInBytes = pConfig->GetCircularBufferSize();
-        if(m_sizeOfAllBuffers < circularBufferSizeInBytes)
+        // Determine if the requesting thread has at least one buffer.
+        // If not, we guarantee that each thread gets at least one (to prevent thrashing when the circular buffer size is too small).
+        bool allocateNewBuffer = (pThreadBufferList == NULL);
+
+        // Determine if policy allows us to allocate another buffer, or if we need to steal one
+        // from another thread.
+        if(!allocateNewBuffer)
         {
-            // We don't worry about the fact that a new buffer could put us over the circular buffer size.
-            // This is OK, and we won't do it again if we actually go over.
-            allocateNewBuffer = true;
-        }
-    }
+            EventPipeConfiguration *pConfig = EventPipe::GetConfiguration();
+            if(pConfig == NULL)
+            {
+                return NULL;
+            }
 
-    // Only steal buffers from other threads if the session being written to is a
-    // file-based session.  Streaming sessions will simply drop events.
-    // TODO: Add dropped events telemetry here.
-    EventPipeBuffer *pNewBuffer = NULL;
-    if(!allocateNewBuffer && (session.GetSessionType() == EventPipeSessionType::File))
-    {
-        // We can't allocate a new buffer.
-        // Find the oldest buffer, de-allocate it, and re-purpose it for this thread.
+            size_t circularBufferSizeInBytes = pConfig->GetCircularBufferSize();
+            if(m_sizeOfAllBuffers < circularBufferSizeInBytes)
+            {
+                // We don't worry about the fact that a new buffer could put us over the circular buffer size.
+                // This is OK, and we won't do it again if we actually go over.
+                allocateNewBuffer = true;
+            }
+        }
 
-        // Find the thread that contains the oldest stealable buffer, and get its list of buffers.
-        EventPipeBufferList *pListToStealFrom = FindThreadToStealFrom();
-        if(pListToStealFrom != NULL)
+        // Only steal buffers from other threads if the session being written to is a
+        // file-based session.  Streaming sessions will simply drop events.
+        if(!allocateNewBuffer && (session.GetSessionType() == EventPipeSessionType::File))
         {
-            // Assert that the buffer we're stealing is not the only buffer in the list.
-            // This invariant is enforced by FindThreadToStealFrom.
-            _ASSERTE((pListToStealFrom->GetHead() != NULL) && (pListToStealFrom->GetHead()->GetNext() != NULL));
+            // We can't allocate a new buffer.
+            // Find the oldest buffer, de-allocate it, and re-purpose it for this thread.
 
-            // Remove the oldest buffer from the list.
-            pNewBuffer = pListToStealFrom->GetAndRemoveHead();
+            // Find the thread that contains the oldest stealable buffer, and get its list of buffers.
+            EventPipeBufferList *pListToStealFrom = FindThreadToStealFrom();
+            if(pListToStealFrom != NULL)
+            {
+                // Assert that the buffer we're stealing is not the only buffer in the list.
+                // This invariant is enforced by FindThreadToStealFrom.
+                _ASSERTE((pListToStealFrom->GetHead() != NULL) && (pListToStealFrom->GetHead()->GetNext() != NULL));
 
-            // De-allocate the buffer.  We do this because buffers are variable sized
-            // based on how much volume is coming from the thread.
-            DeAllocateBuffer(pNewBuffer);
-            pNewBuffer = NULL;
-
-            // Set that we want to allocate a new buffer.
-            allocateNewBuffer = true;
+                // Remove the oldest buffer from the list.  It is unreachable once it is off the list,
+                // so it is freed after the lock is released.  We don't reuse it because buffers are
+                // variable sized based on how much volume is coming from the thread.
+                pStolenBuffer = pListToStealFrom->GetAndRemoveHead();
+                m_sizeOfAllBuffers -= pStolenBuffer->GetSize();
+                m_numBuffersStolen++;
 
 #ifdef _DEBUG
-            m_numBuffersStolen++;
+                m_numBuffersAllocated--;
 #endif // _DEBUG
+            }
 
-        }
-        else
-        {
-            // This only happens when # of threads == # of buffers.
+            // If there was nothing to steal, # of threads == # of buffers.
             // We'll allocate one more buffer, and then this won't happen again.
             allocateNewBuffer = true;
         }
-    }
 
-    if(allocateNewBuffer)
-    {
+        if(!allocateNewBuffer)
+        {
+            return NULL;
+        }
+
         // Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
-        unsigned int sizeMultiplier = pThreadBufferList->GetCount() + 1;
+        unsigned int sizeMultiplier = (pThreadBufferList != NULL ? pThreadBufferList->GetCount() : 0) + 1;
 
         // Pick the base buffer size based.  Debug builds have a smaller size to stress the allocate/steal path more.
         unsigned int baseBufferSize =
@@ -187,7 +188,7 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeSessio
 #else
             100 * 1024; // 100K
 #endif
-        unsigned int bufferSize = baseBufferSize * sizeMultiplier;
+        bufferSize = baseBufferSize * sizeMultiplier;
 
         // Make sure that buffer size >= request size so that the buffer size does not
         // determine the max event size.
@@ -203,38 +204,52 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeSessio
             bufferSize = maxBufferSize;
         }
 
-        // EX_TRY is used here as opposed to new (nothrow) because
-        // the constructor also allocates a private buffer, which
-        // could throw, and cannot be easily checked
-        EX_TRY
-        {
-            pNewBuffer = new EventPipeBuffer(bufferSize);
-        }
-        EX_CATCH
-        {
-            pNewBuffer = NULL;
-        }
-        EX_END_CATCH(SwallowAllExceptions);
+        // Account for the buffer now so that other threads make their decisions based on it.
+        m_sizeOfAllBuffers += bufferSize;
+    }
 
-        if (pNewBuffer == NULL)
-        {
-            return NULL;
-        }
+    if(pStolenBuffer != NULL)
+    {
+        delete(pStolenBuffer);
+    }
+
+    // EX_TRY is used here as opposed to new (nothrow) because
+    // the constructor also allocates a private buffer, which
+    // could throw, and cannot be easily checked
+    EventPipeBuffer *pNewBuffer = NULL;
+    EX_TRY
+    {
+        pNewBuffer = new EventPipeBuffer(bufferSize);
+    }
+    EX_CATCH
+    {
+        pNewBuffer = NULL;
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    SpinLockHolder _slh(&m_lock);
+
+    if (pNewBuffer == NULL)
+    {
+        m_sizeOfAllBuffers -= bufferSize;
+        return NULL;
+    }
 
-        m_sizeOfAllBuffers += bufferSize;
 #ifdef _DEBUG
-        m_numBuffersAllocated++;
+    m_numBuffersAllocated++;
 #endif // _DEBUG
-    }
 
-    // Set the buffer on the thread.
-    if(pNewBuffer != NULL)
+    // Publish the new thread buffer list.
+    if(pThreadBufferList == NULL)
     {
-        pThreadBufferList->InsertTail(pNewBuffer);
-        return pNewBuffer;
+        pThreadBufferList = pNewThreadBufferList.Extract();
+        m_pPerThreadBufferList->InsertTail(pNewElem.Extract());
+        pThread->SetEventPipeBufferList(pThreadBufferList);
     }
 
-    return NULL;
+    // Set the buffer on the thread.
+    pThreadBufferList->InsertTail(pNewBuffer);
+    return pNewBuffer;
 }
 
 EventPipeBufferList* EventPipeBufferManager::FindThreadToStealFrom()
@@ -388,14 +403,14 @@ bool EventPipeBufferManager::WriteEvent(Thread *pThread, EventPipeSession &sessi
     // Mark that the thread is no longer writing an event.
      pThread->SetEventWriteInProgress(false);
 
-#ifdef _DEBUG
-    if(!allocNewBuffer)
+    if(allocNewBuffer)
     {
-        InterlockedIncrement(&m_numEventsStored);
+        InterlockedIncrement(&m_numEventsDropped);
     }
+#ifdef _DEBUG
     else
     {
-        InterlockedIncrement(&m_numEventsDropped);
+        InterlockedIncrement(&m_numEventsStored);
     }
 #endif // _DEBUG
     return !allocNewBuffer;
@@ -531,6 +546,20 @@ EventPipeEventInstance* EventPipeBufferManager::GetNextEvent()
     }
 }
 
+void EventPipeBufferManager::ReportAndResetLostEvents()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if(m_numEventsDropped != 0 || m_numBuffersStolen != 0)
+    {
+        STRESS_LOG2(LF_ALWAYS, LL_ALWAYS, "EventPipe session lost events: %d dropped, %u buffers stolen\n",
+            (LONG)m_numEventsDropped, m_numBuffersStolen);
+    }
+
+    m_numEventsDropped = 0;
+    m_numBuffersStolen = 0;
+}
+
 void EventPipeBufferManager::DeAllocateBuffers()
 {
     CONTRACTL
@@ -37,13 +37,16 @@ private:
     // Lock to protect access to the per-thread buffer list and total allocation size.
     SpinLock m_lock;
 
+    // Events lost during the current session, either dropped because no buffer was available or
+    // discarded with a buffer stolen by another thread.  Only updated on those slow paths.
+    unsigned int m_numBuffersStolen;
+    Volatile<LONG> m_numEventsDropped;
+
 #ifdef _DEBUG
     // For debugging purposes.
     unsigned int m_numBuffersAllocated;
-    unsigned int m_numBuffersStolen;
     unsigned int m_numBuffersLeaked;
     Volatile<LONG> m_numEventsStored;
-    Volatile<LONG> m_numEventsDropped;
     LONG m_numEventsWritten;
 #endif // _DEBUG
 
@@ -83,6 +86,9 @@ public:
     // to free their buffer for a very long time.
     void DeAllocateBuffers();
 
+    // Log how many events and buffers the session lost to the stress log, and reset the counts for the next session.
+    void ReportAndResetLostEvents();
+
     // Get next event.  This is used to dispatch events to EventListener.
     EventPipeEventInstance* GetNextEvent();
 
@@ -132,6 +132,26 @@ void EventPipeFile::WriteEnd()
     m_pSerializer->WriteTag(FastSerializerTags::NullReference); 
 }
 
+void EventPipeFile::Flush()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (m_pBlock->IsEmpty())
+    {
+        return;
+    }
+
+    m_pSerializer->WriteObject(m_pBlock);
+
+    m_pBlock->Clear();
+}
+
 void EventPipeFile::WriteToBlock(EventPipeEventInstance &instance, unsigned int metadataId)
 {
     CONTRACTL
@@ -25,6 +25,9 @@ class EventPipeFile : public FastSerializableObject
 
         void WriteEnd();
 
+        // Write the current block to the stream even if it is not full.
+        void Flush();
+
         const char* GetTypeName()
         {
             LIMITED_METHOD_CONTRACT;
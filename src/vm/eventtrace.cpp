@@ -4158,6 +4158,8 @@ void InitializeEventTracing()
 
     g_nClrInstanceId = GetRuntimeId() & 0x0000FFFF; // This will give us duplicate ClrInstanceId after UINT16_MAX
 
+    ETW::ContentionLog::InitializeSampling();
+
     // Any classes that need some initialization to happen after we've registered the
     // providers can do so now
     ETW::TypeSystemLog::PostRegistrationInit();
@@ -4660,7 +4662,7 @@ VOID ETW::ExceptionLog::ExceptionCatchBegin(MethodDesc * pMethodDesc, PVOID pEnt
 
     EX_TRY
     {
-        SString methodName;
+        StackSString methodName;
         pMethodDesc->GetFullMethodInfo(methodName);
 
         FireEtwExceptionCatchStart((uint64_t)pEntryEIP,
@@ -4700,7 +4702,7 @@ VOID ETW::ExceptionLog::ExceptionFinallyBegin(MethodDesc * pMethodDesc, PVOID pE
 
     EX_TRY
     {
-        SString methodName;
+        StackSString methodName;
         pMethodDesc->GetFullMethodInfo(methodName);
      
         FireEtwExceptionFinallyStart((uint64_t)pEntryEIP,
@@ -4740,7 +4742,7 @@ VOID ETW::ExceptionLog::ExceptionFilterBegin(MethodDesc * pMethodDesc, PVOID pEn
 
     EX_TRY
     {
-        SString methodName;
+        StackSString methodName;
         pMethodDesc->GetFullMethodInfo(methodName);
 
         FireEtwExceptionFilterStart((uint64_t)pEntryEIP,
@@ -4766,6 +4768,53 @@ VOID ETW::ExceptionLog::ExceptionFilterEnd()
     FireEtwExceptionFilterStop();
 }
 
+// The ContentionSample events allowed per second, and the second that is being counted
+static DWORD s_contentionSamplesPerSecond = 0;
+static Volatile<DWORD> s_contentionSampleWindowStart = 0;
+static Volatile<LONG> s_contentionSamplesInWindow = 0;
+
+VOID ETW::ContentionLog::InitializeSampling()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    s_contentionSamplesPerSecond = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ETW_ContentionSamplesPerSecond);
+}
+
+BOOL ETW::ContentionLog::ShouldSampleContention()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ContentionSample))
+    {
+        return FALSE;
+    }
+
+    DWORD now = GetTickCount();
+    DWORD windowStart = s_contentionSampleWindowStart;
+    if (now - windowStart >= 1000)
+    {
+        // Start counting a new second.  Only the thread that moves the window resets the count.
+        if ((DWORD)FastInterlockCompareExchange((LONG *)s_contentionSampleWindowStart.GetPointer(), now, windowStart) == windowStart)
+        {
+            s_contentionSamplesInWindow = 0;
+        }
+    }
+
+    return (DWORD)FastInterlockIncrement(&s_contentionSamplesInWindow) <= s_contentionSamplesPerSecond;
+}
+
+VOID ETW::ContentionLog::SendContentionSample(ContentionStructs::ContentionFlags contentionFlags, PVOID pLock, UINT32 crstType, UINT64 ownerThreadID, LARGE_INTEGER contentionStartTicks)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LARGE_INTEGER contentionEndTicks, frequency;
+    QueryPerformanceCounter(&contentionEndTicks);
+    QueryPerformanceFrequency(&frequency);
+    double contentionDurationNs = (double)(contentionEndTicks.QuadPart - contentionStartTicks.QuadPart) * 1000000000 / frequency.QuadPart;
+
+    FireEtwContentionSample(contentionFlags, pLock, crstType, ownerThreadID, contentionDurationNs, GetClrInstanceId());
+}
+
 /****************************************************************************/
 /* This is called by the runtime when a domain is loaded */
 /****************************************************************************/
@@ -6225,7 +6274,7 @@ VOID ETW::MethodLog::SendMethodJitStartEvent(MethodDesc *pMethodDesc, SString *n
             ulMethodILSize = (ULONG)ILHeader.GetCodeSize();
         }
 
-        SString tNamespace, tMethodName, tMethodSignature;
+        StackSString tNamespace, tMethodName, tMethodSignature;
         if(!namespaceOrClassName|| !methodName|| !methodSignature || (methodName->IsEmpty() && namespaceOrClassName->IsEmpty() && methodSignature->IsEmpty()))
         {
             pMethodDesc->GetMethodInfo(tNamespace, tMethodName, tMethodSignature);
@@ -6376,7 +6425,7 @@ VOID ETW::MethodLog::SendMethodEvent(MethodDesc *pMethodDesc, DWORD dwEventOptio
         ulColdMethodSize = (ULONG)methodRegionInfo.coldSize; // methodRegionInfo.coldSize is size_t and info.MethodLoadInfo.MethodSize is 32 bit; will give incorrect values on a 64-bit machine
     }
 
-    SString tNamespace, tMethodName, tMethodSignature;
+    StackSString tNamespace, tMethodName, tMethodSignature;
 
     // if verbose method load info needed, only then 
     // find method name and signature and fire verbose method load info
@@ -6810,77 +6859,123 @@ VOID ETW::MethodLog::SendEventsForJitMethodsHelper(BaseDomain *pDomainFilter,
         GC_NOTRIGGER;
     } CONTRACTL_END;
 
-    EEJitManager::CodeHeapIterator heapIterator(pDomainFilter, pLoaderAllocatorFilter);
-    while (heapIterator.Next())
+    // Building the events looks up method names and signatures, and doing that while the
+    // iterator holds the code heap lock blocks every thread that needs to allocate code for
+    // the whole rundown. Methods that cannot be unloaded are only recorded under the lock and
+    // their events are sent after it is released. Collectible methods are only kept alive by
+    // the lock, so their events are still sent while it is held.
+    struct DeferredMethod
     {
-        MethodDesc * pMD = heapIterator.GetMethod();
-        if (pMD == NULL)
-            continue;
-
-        TADDR codeStart = heapIterator.GetMethodCode();
-
-        // Grab rejitID from the rejit manager. In some cases, such as collectible loader
-        // allocators, we don't support rejit so we need to short circuit the call.
-        // This also allows our caller to avoid having to pre-enter the rejit
-        // manager locks.
-        // see code:#TableLockHolder
-        ReJITID rejitID =
-            fGetReJitIDs ? ReJitManager::GetReJitIdNoLock(pMD, codeStart) : 0;
-
-        // There are small windows of time where the heap iterator may come across a
-        // codeStart that is not yet published to the MethodDesc. This may happen if
-        // we're JITting the method right now on another thread, and have not completed
-        // yet. Detect the race, and skip the method if appropriate. (If rejitID is
-        // nonzero, there is no race, as GetReJitIdNoLock will not return a nonzero
-        // rejitID if the codeStart has not yet been published for that rejitted version
-        // of the method.) This check also catches recompilations due to EnC, which we do
-        // not want to issue events for, in order to ensure xperf's assumption that
-        // MethodDesc* + ReJITID + extent (hot vs. cold) form a unique key for code
-        // ranges of methods
-        if ((rejitID == 0) && (codeStart != PCODEToPINSTR(pMD->GetNativeCode())))
-            continue;
+        MethodDesc *pMD;
+        TADDR codeStart;
+        ReJITID rejitID;
+    };
+    SArray<DeferredMethod> deferredMethods;
 
-        // When we're called to announce loads, then the methodload event itself must
-        // precede any supplemental events, so that the method load or method jitting
-        // event is the first event the profiler sees for that MethodID (and not, say,
-        // the MethodILToNativeMap event.)
-        if (fLoadOrDCStart)
+    {
+        EEJitManager::CodeHeapIterator heapIterator(pDomainFilter, pLoaderAllocatorFilter);
+        while (heapIterator.Next())
         {
-            if (fSendMethodEvent)
+            MethodDesc * pMD = heapIterator.GetMethod();
+            if (pMD == NULL)
+                continue;
+
+            TADDR codeStart = heapIterator.GetMethodCode();
+
+            // Grab rejitID from the rejit manager. In some cases, such as collectible loader
+            // allocators, we don't support rejit so we need to short circuit the call.
+            // This also allows our caller to avoid having to pre-enter the rejit
+            // manager locks.
+            // see code:#TableLockHolder
+            ReJITID rejitID =
+                fGetReJitIDs ? ReJitManager::GetReJitIdNoLock(pMD, codeStart) : 0;
+
+            // There are small windows of time where the heap iterator may come across a
+            // codeStart that is not yet published to the MethodDesc. This may happen if
+            // we're JITting the method right now on another thread, and have not completed
+            // yet. Detect the race, and skip the method if appropriate. (If rejitID is
+            // nonzero, there is no race, as GetReJitIdNoLock will not return a nonzero
+            // rejitID if the codeStart has not yet been published for that rejitted version
+            // of the method.) This check also catches recompilations due to EnC, which we do
+            // not want to issue events for, in order to ensure xperf's assumption that
+            // MethodDesc* + ReJITID + extent (hot vs. cold) form a unique key for code
+            // ranges of methods
+            if ((rejitID == 0) && (codeStart != PCODEToPINSTR(pMD->GetNativeCode())))
+                continue;
+
+            if (!pMD->GetLoaderAllocator()->IsCollectible())
             {
-                ETW::MethodLog::SendMethodEvent(
-                    pMD,
-                    dwEventOptions,
-                    TRUE,           // bIsJit
-                    NULL,           // namespaceOrClassName
-                    NULL,           // methodName
-                    NULL,           // methodSignature
-                    codeStart,
-                    rejitID);
+                DeferredMethod deferredMethod = { pMD, codeStart, rejitID };
+                deferredMethods.Append(deferredMethod);
+                continue;
             }
+
+            SendEventsForJitMethod(pMD, codeStart, rejitID, dwEventOptions, fLoadOrDCStart, fUnloadOrDCEnd, fSendMethodEvent, fSendILToNativeMapEvent);
         }
+    }
 
-        // Send any supplemental events requested for this MethodID
-        if (fSendILToNativeMapEvent)
-            ETW::MethodLog::SendMethodILToNativeMapEvent(pMD, dwEventOptions, codeStart, rejitID);
+    for (COUNT_T i = 0; i < deferredMethods.GetCount(); i++)
+    {
+        const DeferredMethod &deferredMethod = deferredMethods[i];
+        SendEventsForJitMethod(deferredMethod.pMD, deferredMethod.codeStart, deferredMethod.rejitID, dwEventOptions, fLoadOrDCStart, fUnloadOrDCEnd, fSendMethodEvent, fSendILToNativeMapEvent);
+    }
+}
 
-        // When we're called to announce unloads, then the methodunload event itself must
-        // come after any supplemental events, so that the method unload event is the
-        // last event the profiler sees for this MethodID
-        if (fUnloadOrDCEnd)
+// Called by ETW::MethodLog::SendEventsForJitMethodsHelper for each method it finds
+VOID ETW::MethodLog::SendEventsForJitMethod(MethodDesc *pMD,
+                                            TADDR codeStart,
+                                            ReJITID rejitID,
+                                            DWORD dwEventOptions,
+                                            BOOL fLoadOrDCStart,
+                                            BOOL fUnloadOrDCEnd,
+                                            BOOL fSendMethodEvent,
+                                            BOOL fSendILToNativeMapEvent)
+{
+    CONTRACTL{
+        THROWS;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    // When we're called to announce loads, then the methodload event itself must
+    // precede any supplemental events, so that the method load or method jitting
+    // event is the first event the profiler sees for that MethodID (and not, say,
+    // the MethodILToNativeMap event.)
+    if (fLoadOrDCStart)
+    {
+        if (fSendMethodEvent)
         {
-            if (fSendMethodEvent)
-            {
-                ETW::MethodLog::SendMethodEvent(
-                    pMD,
-                    dwEventOptions,
-                    TRUE,           // bIsJit
-                    NULL,           // namespaceOrClassName
-                    NULL,           // methodName
-                    NULL,           // methodSignature
-                    codeStart,
-                    rejitID);
-            }
+            ETW::MethodLog::SendMethodEvent(
+                pMD,
+                dwEventOptions,
+                TRUE,           // bIsJit
+                NULL,           // namespaceOrClassName
+                NULL,           // methodName
+                NULL,           // methodSignature
+                codeStart,
+                rejitID);
+        }
+    }
+
+    // Send any supplemental events requested for this MethodID
+    if (fSendILToNativeMapEvent)
+        ETW::MethodLog::SendMethodILToNativeMapEvent(pMD, dwEventOptions, codeStart, rejitID);
+
+    // When we're called to announce unloads, then the methodunload event itself must
+    // come after any supplemental events, so that the method unload event is the
+    // last event the profiler sees for this MethodID
+    if (fUnloadOrDCEnd)
+    {
+        if (fSendMethodEvent)
+        {
+            ETW::MethodLog::SendMethodEvent(
+                pMD,
+                dwEventOptions,
+                TRUE,           // bIsJit
+                NULL,           // namespaceOrClassName
+                NULL,           // methodName
+                NULL,           // methodSignature
+                codeStart,
+                rejitID);
         }
     }
 }
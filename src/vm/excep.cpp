@@ -2243,6 +2243,32 @@ void StackTraceInfo::SaveStackTrace(BOOL bAllowAllocMem, OBJECTHANDLE hThrowable
     }
     CONTRACTL_END;
 
+    if (m_dispatchStartTimeStamp.QuadPart == 0)
+    {
+        SaveStackTraceWorker(bAllowAllocMem, hThrowable, bReplaceStack, bSkipLastElement);
+        return;
+    }
+
+    LARGE_INTEGER startTimeStamp;
+    QueryPerformanceCounter(&startTimeStamp);
+
+    SaveStackTraceWorker(bAllowAllocMem, hThrowable, bReplaceStack, bSkipLastElement);
+
+    LARGE_INTEGER endTimeStamp;
+    QueryPerformanceCounter(&endTimeStamp);
+    m_stackTraceTicks += endTimeStamp.QuadPart - startTimeStamp.QuadPart;
+}
+
+void StackTraceInfo::SaveStackTraceWorker(BOOL bAllowAllocMem, OBJECTHANDLE hThrowable, BOOL bReplaceStack, BOOL bSkipLastElement)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
     // Do not save stacktrace to preallocated exception.  These are shared.
     if (CLRException::IsPreallocatedExceptionHandle(hThrowable))
     {
@@ -2264,6 +2290,26 @@ void StackTraceInfo::SaveStackTrace(BOOL bAllowAllocMem, OBJECTHANDLE hThrowable
     // if have bSkipLastElement, must also keep the stack
     _ASSERTE(! bSkipLastElement || ! bReplaceStack);
 
+    // Drop the frames past the configured depth. The frames closest to the throw are the ones kept.
+    if (bReplaceStack)
+    {
+        m_cSavedFrames = 0;
+    }
+
+    DWORD cMaxFrames = g_pConfig->ExceptionStackTraceMaxFrames();
+    if (cMaxFrames != 0)
+    {
+        if (m_cSavedFrames >= cMaxFrames)
+        {
+            m_dFrameCount = 0;
+        }
+        else if (m_dFrameCount > cMaxFrames - m_cSavedFrames)
+        {
+            m_dFrameCount = cMaxFrames - m_cSavedFrames;
+        }
+    }
+    m_cSavedFrames += m_dFrameCount;
+
     bool         fSuccess = false;
     MethodTable* pMT      = ObjectFromHandle(hThrowable)->GetTrueMethodTable();
 
@@ -3567,6 +3613,8 @@ void StackTraceInfo::Init()
     m_dFrameCount = 0;
     m_cDynamicMethodItems = 0;
     m_dCurrentDynamicIndex = 0;
+    m_cSavedFrames = 0;
+    m_dispatchStartTimeStamp.QuadPart = 0;
 }
 
 void StackTraceInfo::FreeStackTrace()
@@ -3662,6 +3710,19 @@ BOOL StackTraceInfo::AppendElement(BOOL bAllowAllocMem, UINT_PTR currentIP, UINT
     if (pFunc != NULL && pFunc->IsILStub())
         return FALSE;
 
+    LARGE_INTEGER startTimeStamp;
+    startTimeStamp.QuadPart = 0;
+    if (m_dispatchStartTimeStamp.QuadPart != 0)
+    {
+        QueryPerformanceCounter(&startTimeStamp);
+
+        if (m_pThrowingMethod == NULL)
+        {
+            m_pThrowingMethod = pFunc;
+        }
+        m_cFramesWalked++;
+    }
+
     // Save this function in the stack trace array, which we only build on the first pass. We'll try to expand the
     // stack trace array if we don't have enough room. Note that we only try to expand if we're allowed to allocate
     // memory (bAllowAllocMem).
@@ -3736,9 +3797,59 @@ BOOL StackTraceInfo::AppendElement(BOOL bAllowAllocMem, UINT_PTR currentIP, UINT
     }
 #endif // !FEATURE_PAL
 
+    if (startTimeStamp.QuadPart != 0)
+    {
+        LARGE_INTEGER endTimeStamp;
+        QueryPerformanceCounter(&endTimeStamp);
+        m_stackTraceTicks += endTimeStamp.QuadPart - startTimeStamp.QuadPart;
+    }
+
     return bRetVal;
 }
 
+void StackTraceInfo::StartDispatchTiming()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Only pay for the timestamps while someone is listening
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ExceptionDispatchTiming))
+    {
+        m_dispatchStartTimeStamp.QuadPart = 0;
+        return;
+    }
+
+    QueryPerformanceCounter(&m_dispatchStartTimeStamp);
+    m_stackTraceTicks = 0;
+    m_cFramesWalked = 0;
+    m_pThrowingMethod = NULL;
+}
+
+void StackTraceInfo::EndDispatchTiming()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_dispatchStartTimeStamp.QuadPart == 0)
+    {
+        return;
+    }
+
+    LARGE_INTEGER endTimeStamp;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&endTimeStamp);
+    QueryPerformanceFrequency(&frequency);
+
+    UINT64 throwToCatchMicroseconds = (UINT64)(endTimeStamp.QuadPart - m_dispatchStartTimeStamp.QuadPart) * 1000000 / frequency.QuadPart;
+    UINT64 stackTraceMicroseconds = (UINT64)m_stackTraceTicks * 1000000 / frequency.QuadPart;
+
+    FireEtwExceptionDispatchTiming(throwToCatchMicroseconds,
+                                   m_cFramesWalked,
+                                   stackTraceMicroseconds,
+                                   (UINT64)m_pThrowingMethod,
+                                   GetClrInstanceId());
+
+    m_dispatchStartTimeStamp.QuadPart = 0;
+}
+
 void StackTraceInfo::GetLeafFrameInfo(StackTraceElement* pStackTraceElement)
 {
     LIMITED_METHOD_CONTRACT;
@@ -16,6 +16,7 @@
 #include "perfcounters.h"
 #include "eventtrace.h"
 #include "virtualcallstub.h"
+#include "runtimecounters.h"
 
 #if defined(_TARGET_X86_)
 #define USE_CURRENT_CONTEXT_IN_FILTER
@@ -198,6 +199,7 @@ static inline void UpdatePerformanceMetrics(CrawlFrame *pcfThisFrame, BOOL bIsRe
 {
     WRAPPER_NO_CONTRACT;
     COUNTER_ONLY(GetPerfCounters().m_Excep.cThrown++);
+    RuntimeCounters::ExceptionCount.Increment();
 
     // Fire an exception thrown ETW event when an exception occurs
     ETW::ExceptionLog::ExceptionThrown(pcfThisFrame, bIsRethrownException, bIsNewException);
@@ -2270,6 +2272,8 @@ CLRUnwindStatus ExceptionTracker::ProcessExplicitFrame(
                 //
                 if (bSkipLastElement || bReplaceStack)
                 {
+                    m_StackTraceInfo.StartDispatchTiming();
+
                     GCX_COOP();
                     EEToProfilerExceptionInterfaceWrapper::ExceptionThrown(pThread);
                     UpdatePerformanceMetrics(pcfThisFrame, bSkipLastElement, bReplaceStack);
@@ -2567,6 +2571,8 @@ CLRUnwindStatus ExceptionTracker::ProcessManagedCallFrame(
         // 2) an exception is rethrown.
         if (fIsFirstPass && (bSkipLastElement || bReplaceStack))
         {
+            m_StackTraceInfo.StartDispatchTiming();
+
             GCX_COOP();
             EEToProfilerExceptionInterfaceWrapper::ExceptionThrown(pThread);
             UpdatePerformanceMetrics(pcfThisFrame, bSkipLastElement, bReplaceStack);
@@ -3386,6 +3392,7 @@ DWORD_PTR ExceptionTracker::CallHandler(
         ETW::ExceptionLog::ExceptionFinallyBegin(pMD, (PVOID)uHandlerStartPC);
         break;
     case EHFuncletType::Catch:
+        m_StackTraceInfo.EndDispatchTiming();
         ETW::ExceptionLog::ExceptionCatchBegin(pMD, (PVOID)uHandlerStartPC);
         break;
     }
@@ -4429,11 +4436,14 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
     memset(&dispatcherContext, 0, sizeof(DISPATCHER_CONTEXT));
     disposition = ExceptionContinueSearch;
 
+    // The code info of each frame is looked up once, by the managed-to-native boundary
+    // check at the end of the previous iteration
+    codeInfo.Init(GetIP(currentFrameContext));
+
     do
     {
         controlPc = GetIP(currentFrameContext);
-
-        codeInfo.Init(controlPc);
+        _ASSERTE(codeInfo.GetCodeAddress() == PCODEToPINSTR(controlPc));
 
         dispatcherContext.FunctionEntry = codeInfo.GetFunctionEntry();
         dispatcherContext.ControlPc = controlPc;
@@ -4506,7 +4516,8 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
         sp = (PVOID)GetSP(currentFrameContext);
 
         // Check whether we are crossing managed-to-native boundary
-        if (!ExecutionManager::IsManagedCode(controlPc))
+        codeInfo.Init(controlPc);
+        if (!codeInfo.IsValid())
         {
             // Return back to the UnwindManagedExceptionPass1 and let it unwind the native frames
             {
@@ -4583,9 +4594,13 @@ VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT
     memset(&dispatcherContext, 0, sizeof(DISPATCHER_CONTEXT));
     disposition = ExceptionContinueSearch;
 
+    // The code info of each frame is looked up once, by the managed-to-native boundary
+    // check at the end of the previous iteration
+    codeInfo.Init(controlPc);
+
     do
     {
-        codeInfo.Init(controlPc);
+        _ASSERTE(codeInfo.GetCodeAddress() == PCODEToPINSTR(controlPc));
         dispatcherContext.FunctionEntry = codeInfo.GetFunctionEntry();
         dispatcherContext.ControlPc = controlPc;
         dispatcherContext.ImageBase = codeInfo.GetModuleBase();
@@ -4656,7 +4671,8 @@ VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT
         }
 
         // Check whether we are crossing managed-to-native boundary
-        while (!ExecutionManager::IsManagedCode(controlPc))
+        codeInfo.Init(controlPc);
+        while (!codeInfo.IsValid())
         {
             UINT_PTR sp = GetSP(frameContext);
 
@@ -4702,6 +4718,8 @@ VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT
                 // The EXCEPTION_CONTINUE_EXECUTION is not supported and should never be returned by a filter
                 _ASSERTE(disposition == EXCEPTION_CONTINUE_SEARCH);
             }
+
+            codeInfo.Init(controlPc);
         }
 
     } while (Thread::IsAddressInCurrentStack((void*)GetSP(frameContext)));
@@ -36,6 +36,9 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+Volatile<ULONGLONG> FinalizerThread::s_cFinalizersRun = 0;
+Volatile<ULONGLONG> FinalizerThread::s_msFinalizerDrainTime = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
@@ -223,6 +226,7 @@ Object * FinalizerThread::FinalizeAllObjects(Object* fobj, int bitToCheck)
 
     FireEtwGCFinalizersBegin_V1(GetClrInstanceId());
 
+    ULONGLONG startTime = CLRGetTickCount64();
     unsigned int fcount = 0; 
     bool fTerminate = false;
 
@@ -267,10 +271,34 @@ Object * FinalizerThread::FinalizeAllObjects(Object* fobj, int bitToCheck)
         }
     }
     FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
-    
+
+    // Only the finalizer thread (or the shutdown path once it has stopped)
+    // drains the queue, so plain read-modify-write is enough here.
+    ULONGLONG elapsed = CLRGetTickCount64() - startTime;
+    s_cFinalizersRun = s_cFinalizersRun + fcount;
+    s_msFinalizerDrainTime = s_msFinalizerDrainTime + elapsed;
+
+    STRESS_LOG3(LF_GC, LL_INFO100, "Finalizer thread ran %d finalizers in %I64ums, %Id still queued\n",
+        fcount, elapsed, GetFinalizerQueueLength());
+
     return fobj;
 }
 
+// Number of objects the GC has found unreachable and queued for
+// finalization that the finalizer thread has not yet picked up.
+size_t FinalizerThread::GetFinalizerQueueLength()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    return GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+}
+
 
 #ifdef FEATURE_PROFAPI_ATTACH_DETACH
 
@@ -38,6 +38,12 @@ class FinalizerThread
 
     static HANDLE MHandles[kHandleCount];
 
+    // Running totals of finalizers run and of the time the finalizer thread
+    // spent draining the queue, so the drain rate can be compared against
+    // the number of objects still waiting (see GetFinalizerQueueLength).
+    static Volatile<ULONGLONG> s_cFinalizersRun;
+    static Volatile<ULONGLONG> s_msFinalizerDrainTime;
+
     static void WaitForFinalizerEvent (CLREvent *event);
 
     static BOOL FinalizerThreadWatchDogHelper();
@@ -67,6 +73,20 @@ public:
 
     static void FinalizerThreadWait(DWORD timeout = INFINITE);
 
+    static size_t GetFinalizerQueueLength();
+
+    static ULONGLONG GetFinalizersRun()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return s_cFinalizersRun;
+    }
+
+    static ULONGLONG GetFinalizerDrainTimeMs()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return s_msFinalizerDrainTime;
+    }
+
     // We wake up a wait for finaliation for two reasons:
     // if fFinalizer=TRUE, we have finished finalization.
     // if fFinalizer=FALSE, the timeout for finalization is changed, and AD unload helper thread is notified.
@@ -1096,8 +1096,8 @@ bool GCToEEInterface::GetIntConfigValue(const char* key, int64_t* value)
 
     if (CLRConfig::IsConfigOptionSpecified(configKey))
     {
-        CLRConfig::ConfigDWORDInfo info { configKey , 0, CLRConfig::EEConfig_default };
-        *value = CLRConfig::GetConfigValue(info);
+        // Read the full 64 bits, some settings (eg, GCHeapHardLimit) can be 4GB or more
+        *value = (int64_t)REGUTIL::GetConfigULONGLONG_DontUse_(configKey, 0);
         return true;
     }
 
@@ -95,7 +95,7 @@ public:
     {
         WRAPPER_NO_CONTRACT;
 
-        return IsServerHeap() && g_SystemInfo.dwNumberOfProcessors >= 2;
+        return IsServerHeap() && ::GetCurrentProcessCpuCount() >= 2;
     }
 
     // Waits until a GC is complete, if the heap has been initialized.
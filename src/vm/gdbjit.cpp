@@ -2529,8 +2529,78 @@ void NotifyGdb::MethodPrepared(MethodDesc* methodDescPtr)
     EX_END_CATCH(SwallowAllExceptions);
 }
 
+static bool IsListedModuleFile(const Module* mod)
+{
+    SString modName = mod->GetFile()->GetPath();
+    StackScratchBuffer scratch;
+    const char* szModName = modName.GetUTF8(scratch);
+    const char* szModuleFile = SplitFilename(szModName);
+
+    int length = MultiByteToWideChar(CP_UTF8, 0, szModuleFile, -1, NULL, 0);
+    if (length == 0)
+        return false;
+    NewArrayHolder<WCHAR> wszModuleFile = new WCHAR[length+1];
+    length = MultiByteToWideChar(CP_UTF8, 0, szModuleFile, -1, wszModuleFile, length);
+
+    if (length == 0)
+        return false;
+
+    // remove '.ni.dll' or '.ni.exe' suffix from wszModuleFile
+    LPWSTR pNIExt = const_cast<LPWSTR>(wcsstr(wszModuleFile, W(".ni.exe"))); // where '.ni.exe' start at 
+    if (!pNIExt)
+    {
+      pNIExt = const_cast<LPWSTR>(wcsstr(wszModuleFile, W(".ni.dll"))); // where '.ni.dll' start at 
+    }
+
+    if (pNIExt)
+    {
+      wcscpy(pNIExt, W(".dll"));
+    }
+
+    return isListedModule(wszModuleFile);
+}
+
+// Methods are usually jitted in runs from the same module, so remember the answer for the last one
+// instead of converting and comparing the module path for every method. Collectible modules are
+// never remembered: once one unloads, another module can be allocated at the same address.
+__declspec(thread) const Module* tls_lastCheckedModule = nullptr;
+__declspec(thread) bool tls_lastCheckedModuleListed = false;
+
+static bool IsListedModuleCached(const Module* mod)
+{
+    if (g_wszModuleNames == nullptr)
+        return false;
+
+    if (const_cast<Module*>(mod)->IsCollectible())
+        return IsListedModuleFile(mod);
+
+    if (mod != tls_lastCheckedModule)
+    {
+        tls_lastCheckedModuleListed = IsListedModuleFile(mod);
+        tls_lastCheckedModule = mod;
+    }
+    return tls_lastCheckedModuleListed;
+}
+
 void NotifyGdb::OnMethodPrepared(MethodDesc* methodDescPtr)
 {
+    /* Get module name */
+    const Module* mod = methodDescPtr->GetMethodTable()->GetModule();
+    bool bListedModule = IsListedModuleCached(mod);
+
+#if !defined(FEATURE_GDBJIT_SYMTAB)
+    // Without a symbol table the only other thing to emit is frame info; skip building an image
+    // that would never be registered
+    if (!bListedModule
+#ifdef FEATURE_GDBJIT_FRAME
+        && !g_pConfig->ShouldEmitDebugFrame()
+#endif
+        )
+    {
+        return;
+    }
+#endif
+
     PCODE pCode = methodDescPtr->GetNativeCode();
     if (pCode == NULL)
         return;
@@ -2546,22 +2616,6 @@ void NotifyGdb::OnMethodPrepared(MethodDesc* methodDescPtr)
 
     pCode = PCODEToPINSTR(pCode);
 
-    /* Get module name */
-    const Module* mod = methodDescPtr->GetMethodTable()->GetModule();
-    SString modName = mod->GetFile()->GetPath();
-    StackScratchBuffer scratch;
-    const char* szModName = modName.GetUTF8(scratch);
-    const char* szModuleFile = SplitFilename(szModName);
-
-    int length = MultiByteToWideChar(CP_UTF8, 0, szModuleFile, -1, NULL, 0);
-    if (length == 0)
-        return;
-    NewArrayHolder<WCHAR> wszModuleFile = new WCHAR[length+1];
-    length = MultiByteToWideChar(CP_UTF8, 0, szModuleFile, -1, wszModuleFile, length);
-
-    if (length == 0)
-        return;
-
     bool bNotify = false;
 
     Elf_Builder elfBuilder;
@@ -2576,19 +2630,7 @@ void NotifyGdb::OnMethodPrepared(MethodDesc* methodDescPtr)
     }
 #endif
 
-    // remove '.ni.dll' or '.ni.exe' suffix from wszModuleFile
-    LPWSTR pNIExt = const_cast<LPWSTR>(wcsstr(wszModuleFile, W(".ni.exe"))); // where '.ni.exe' start at 
-    if (!pNIExt)
-    {
-      pNIExt = const_cast<LPWSTR>(wcsstr(wszModuleFile, W(".ni.dll"))); // where '.ni.dll' start at 
-    }
-
-    if (pNIExt)
-    {
-      wcscpy(pNIExt, W(".dll"));
-    }
-
-    if (isListedModule(wszModuleFile))
+    if (bListedModule)
     {
         bool bEmitted = EmitDebugInfo(elfBuilder, methodDescPtr, pCode, codeSize);
         bNotify = bNotify || bEmitted;
@@ -68,6 +68,7 @@ DictionaryLayout::Allocate(
 
     // This is the number of slots excluding the type parameters
     pD->m_numSlots = numSlots;
+    pD->m_numInitialSlots = numSlots;
 
     RETURN pD;
 } // DictionaryLayout::Allocate
@@ -90,7 +91,7 @@ DictionaryLayout::GetFirstDictionaryBucketSize(
 
     DWORD bytes = numGenericArgs * sizeof(TypeHandle);
     if (pDictLayout != NULL)
-        bytes += pDictLayout->m_numSlots * sizeof(void*);
+        bytes += (pDictLayout->m_numSlots + 1) * sizeof(void*); // One extra slot for the size of the dictionary
 
     return bytes;
 }
@@ -102,17 +103,18 @@ DictionaryLayout::GetFirstDictionaryBucketSize(
 // required to get to its slot in the actual dictionary
 //
 // NOTE: We will currently never return more than one indirection. We don't
-// cascade dictionaries but we will record overflows in the dictionary layout
-// (and cascade that accordingly) so we can prepopulate the overflow hash in
-// reliability scenarios.
+// cascade dictionaries. When the JIT asks for a slot and the first bucket is full
+// we grow the layout (see ExpandDictionaryLayout), otherwise we record overflows in
+// the dictionary layout (and cascade that accordingly) so we can prepopulate the
+// overflow hash in reliability scenarios.
 //
 // Optimize the case of a token being !i (for class dictionaries) or !!i (for method dictionaries)
 // 
 /* static */
 BOOL 
-DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
-                                  DWORD                             numGenericArgs,
-                                  DictionaryLayout *                pDictLayout,
+DictionaryLayout::FindTokenWorker(MethodDesc *                      pMD,
+                                  MethodTable *                     pMT,
+                                  LoaderAllocator *                 pAllocator,
                                   CORINFO_RUNTIME_LOOKUP *          pResult,
                                   SigBuilder *                      pSigBuilder,
                                   BYTE *                            pSig,
@@ -124,19 +126,31 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
     CONTRACTL
     {
         STANDARD_VM_CHECK;
-        PRECONDITION(numGenericArgs > 0);
-        PRECONDITION(CheckPointer(pDictLayout));
+        PRECONDITION((pMD != NULL) != (pMT != NULL));
         PRECONDITION(CheckPointer(pSlotOut));
         PRECONDITION(CheckPointer(pSig));
         PRECONDITION((pSigBuilder == NULL && cbSig == -1) || (CheckPointer(pSigBuilder) && cbSig > 0));
     }
     CONTRACTL_END
 
-    BOOL isFirstBucket = TRUE;
+    DWORD numGenericArgs = (pMT != NULL) ? pMT->GetNumGenericArgs() : pMD->GetNumGenericMethodArgs();
+    _ASSERTE(numGenericArgs > 0);
+    _ASSERTE(FitsIn<WORD>(numGenericArgs + 1));
+
+    pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
+
+    DictionaryLayout * pDictLayout;
+    BOOL isFirstBucket;
+    WORD slot;
+
+RetryLayout:
+    pDictLayout = (pMT != NULL) ? pMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout();
+    _ASSERTE(CheckPointer(pDictLayout));
 
-    // First bucket also contains type parameters
-    _ASSERTE(FitsIn<WORD>(numGenericArgs));
-    WORD slot = static_cast<WORD>(numGenericArgs);
+    isFirstBucket = TRUE;
+
+    // First bucket also contains type parameters, followed by the size of the dictionary
+    slot = static_cast<WORD>(numGenericArgs + 1);
     for (;;)
     {
         for (DWORD iSlot = 0; iSlot < pDictLayout->m_numSlots; iSlot++)
@@ -185,6 +199,8 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
                     _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
                     pResult->indirections = static_cast<WORD>(nFirstOffset + 1);
                     pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
+                    if (iSlot >= pDictLayout->m_numInitialSlots)
+                        pResult->sizeOffset = static_cast<WORD>(numGenericArgs * sizeof(DictionaryEntry));
                     *pSlotOut = slot;
                     return TRUE;
                 }
@@ -198,6 +214,12 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
                     if (pDictLayout->m_slots[iSlot].m_signature != NULL)
                         goto RetryMatch;
 
+                    // The layout may have grown since we started looking. The copy would not see the slot
+                    // we claim in this one, so claim it in the current layout instead.
+                    if (isFirstBucket &&
+                        pDictLayout != ((pMT != NULL) ? pMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout()))
+                        goto RetryLayout;
+
                     PVOID pResultSignature = pSig;
 
                     if (pSigBuilder != NULL)
@@ -225,12 +247,29 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
                 _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
                 pResult->indirections = static_cast<WORD>(nFirstOffset + 1);
                 pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
+                if (iSlot >= pDictLayout->m_numInitialSlots)
+                    pResult->sizeOffset = static_cast<WORD>(numGenericArgs * sizeof(DictionaryEntry));
                 *pSlotOut = slot;
                 return TRUE;
             }
             slot++;
         }
 
+        // The first bucket is full. Code compiled by the JIT can check the size of the dictionary, so rather
+        // than spilling into the next bucket (which is only reachable through the hash) grow the layout and
+        // keep looking in the larger copy. The copy starts with the same slots, so rescan it from the start.
+        // We don't grow layouts while NGENing since they are trimmed and saved along with the dictionaries.
+        if (isFirstBucket && pSigBuilder != NULL && !IsCompilationProcess())
+        {
+            DictionaryLayout * pNewDictLayout = ExpandDictionaryLayout(pMD, pMT, pAllocator, pDictLayout, numGenericArgs);
+            if (pNewDictLayout != NULL)
+            {
+                pDictLayout = pNewDictLayout;
+                slot = static_cast<WORD>(numGenericArgs + 1);
+                continue;
+            }
+        }
+
         // If we've reached the end of the chain we need to allocate another bucket. Make the pointer update carefully to avoid
         // orphaning a bucket in a race. We leak the loser in such a race (since the allocation comes from the loader heap) but both
         // the race and the overflow should be very rare.
@@ -242,11 +281,63 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
     }
 } // DictionaryLayout::FindToken
 
+//---------------------------------------------------------------------------------------
+//
+// Publish a copy of the full layout with twice as many slots. Existing dictionaries keep
+// their size; they are replaced on demand by Dictionary::GetDictionaryWithSizeCheck.
+//
+/* static */
+DictionaryLayout *
+DictionaryLayout::ExpandDictionaryLayout(MethodDesc *       pMD,
+                                         MethodTable *      pMT,
+                                         LoaderAllocator *  pAllocator,
+                                         DictionaryLayout * pCurrentDictLayout,
+                                         DWORD              numGenericArgs)
+{
+    STANDARD_VM_CONTRACT;
+
+    BaseDomain::LockHolder lh(pAllocator->GetDomain());
+
+    // Another thread may have grown the layout already
+    DictionaryLayout * pDictLayout = (pMT != NULL) ? pMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout();
+    if (pDictLayout != pCurrentDictLayout)
+        return pDictLayout;
+
+    // Slot numbers (which include the instantiation and the size slot) have to fit in a WORD
+    DWORD maxSlots = 0xFFFF - (numGenericArgs + 1);
+    DWORD numSlots = pDictLayout->m_numSlots;
+    if (numSlots >= maxSlots)
+        return NULL;
+
+    DWORD newNumSlots = min(max(numSlots * 2, (DWORD)4), maxSlots);
+    DictionaryLayout * pNewDictLayout = Allocate(static_cast<WORD>(newNumSlots), pAllocator, NULL);
+
+    for (DWORD iSlot = 0; iSlot < numSlots; iSlot++)
+        pNewDictLayout->m_slots[iSlot] = pDictLayout->m_slots[iSlot];
+
+    pNewDictLayout->m_numInitialSlots = pDictLayout->m_numInitialSlots;
+    pNewDictLayout->m_pNext = pDictLayout->m_pNext;
+
+    // The slots have to be visible before the layout that describes them
+    MemoryBarrier();
+
+    if (pMT != NULL)
+    {
+        pMT->GetClass()->SetDictionaryLayout(pNewDictLayout);
+    }
+    else
+    {
+        pMD->AsInstantiatedMethodDesc()->IMD_SetDictionaryLayout(pNewDictLayout);
+    }
+
+    return pNewDictLayout;
+} // DictionaryLayout::ExpandDictionaryLayout
+
 /* static */
 BOOL 
-DictionaryLayout::FindToken(LoaderAllocator *               pAllocator, 
-                            DWORD                           numGenericArgs, 
-                            DictionaryLayout *              pDictLayout, 
+DictionaryLayout::FindToken(MethodDesc *                    pMD,
+                            MethodTable *                   pMT,
+                            LoaderAllocator *               pAllocator, 
                             CORINFO_RUNTIME_LOOKUP *        pResult, 
                             SigBuilder *                    pSigBuilder, 
                             int                             nFirstOffset, 
@@ -258,14 +349,14 @@ DictionaryLayout::FindToken(LoaderAllocator *               pAllocator,
     BYTE * pSig = (BYTE *)pSigBuilder->GetSignature(&cbSig);
 
     WORD slotDummy;
-    return FindTokenWorker(pAllocator, numGenericArgs, pDictLayout, pResult, pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, &slotDummy);
+    return FindTokenWorker(pMD, pMT, pAllocator, pResult, pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, &slotDummy);
 }
 
 /* static */
 BOOL 
-DictionaryLayout::FindToken(LoaderAllocator *               pAllocator,
-                            DWORD                           numGenericArgs, 
-                            DictionaryLayout *              pDictLayout, 
+DictionaryLayout::FindToken(MethodDesc *                    pMD,
+                            MethodTable *                   pMT,
+                            LoaderAllocator *               pAllocator,
                             CORINFO_RUNTIME_LOOKUP *        pResult, 
                             BYTE *                          signature,
                             int                             nFirstOffset,
@@ -274,7 +365,7 @@ DictionaryLayout::FindToken(LoaderAllocator *               pAllocator,
 {
     WRAPPER_NO_CONTRACT;
 
-    return FindTokenWorker(pAllocator, numGenericArgs, pDictLayout, pResult, NULL, signature, -1, nFirstOffset, signatureSource, pSlotOut);
+    return FindTokenWorker(pMD, pMT, pAllocator, pResult, NULL, signature, -1, nFirstOffset, signatureSource, pSlotOut);
 }
 
 #endif //!DACCESS_COMPILE
@@ -379,6 +470,10 @@ DictionaryLayout::Trim()
     _ASSERTE(FitsIn<WORD>(dwSlots));
     *EnsureWritablePages(&pDictLayout->m_numSlots) = static_cast<WORD>(dwSlots);
 
+    // The saved dictionaries are allocated with the trimmed size
+    if (pDictLayout == this)
+        *EnsureWritablePages(&pDictLayout->m_numInitialSlots) = static_cast<WORD>(dwSlots);
+
 }
 
 //---------------------------------------------------------------------------------------
@@ -443,9 +538,13 @@ Dictionary::Fixup(
     // Now traverse the remaining slots
     if (pDictLayout != NULL)
     {
+        // The layout may have been trimmed since the dictionary was allocated, so record the size it is saved with
+        *(DictionaryEntry *)image->GetImagePointer(AsPtr(), numGenericArgs * sizeof(DictionaryEntry)) =
+            (DictionaryEntry)(SIZE_T)DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pDictLayout);
+
         for (DWORD i = 0; i < pDictLayout->m_numSlots; i++)
         {
-            int slotOffset = (numGenericArgs + i) * sizeof(DictionaryEntry);
+            int slotOffset = (numGenericArgs + 1 + i) * sizeof(DictionaryEntry);
 
             // First check if we can simply hardbind to a prerestored object
             DictionaryEntryLayout *pLayout = pDictLayout->GetEntryLayout(i);
@@ -1193,14 +1292,71 @@ Dictionary::PopulateEntry(
 
         if ((slotIndex != 0) && !IsCompilationProcess())
         {
-            *EnsureWritablePages(pDictionary->GetSlotAddr(0, slotIndex)) = result;
-            *ppSlot = pDictionary->GetSlotAddr(0, slotIndex);
+            pDictionary = GetDictionaryWithSizeCheck(pMD, pMT, slotIndex);
+
+            DictionaryEntry * pSlot = (DictionaryEntry *)pDictionary->EntryAddr(slotIndex);
+            *EnsureWritablePages(pSlot) = result;
+            *ppSlot = pSlot;
         }
     }
 
     return result;
 } // Dictionary::PopulateEntry
 
+//---------------------------------------------------------------------------------------
+// 
+Dictionary * 
+Dictionary::GetDictionaryWithSizeCheck(
+    MethodDesc *  pMD, 
+    MethodTable * pMT, 
+    ULONG         slotIndex)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        PRECONDITION((pMD != NULL) != (pMT != NULL));
+    } CONTRACTL_END;
+
+    DWORD numGenericArgs = (pMT != NULL) ? pMT->GetNumGenericArgs() : pMD->GetNumGenericMethodArgs();
+    Dictionary * pDictionary = (pMT != NULL) ? pMT->GetDictionary() : pMD->GetMethodDictionary();
+
+    if (pDictionary->GetDictionarySize(numGenericArgs) > slotIndex * sizeof(DictionaryEntry))
+        return pDictionary;
+
+    LoaderAllocator * pAllocator = (pMT != NULL) ? pMT->GetLoaderAllocator() : pMD->GetLoaderAllocator();
+    BaseDomain::LockHolder lh(pAllocator->GetDomain());
+
+    // Another thread may have replaced the dictionary already
+    pDictionary = (pMT != NULL) ? pMT->GetDictionary() : pMD->GetMethodDictionary();
+    DWORD cbDictionary = pDictionary->GetDictionarySize(numGenericArgs);
+    if (cbDictionary > slotIndex * sizeof(DictionaryEntry))
+        return pDictionary;
+
+    // The slot was added when the layout grew. Copy the dictionary into one sized for the current layout.
+    // The old dictionary stays valid for code that already loaded it, it is just too small for the new slots.
+    DictionaryLayout * pDictLayout = (pMT != NULL) ? pMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout();
+    DWORD cbNewDictionary = DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pDictLayout);
+    _ASSERTE(cbNewDictionary > slotIndex * sizeof(DictionaryEntry));
+
+    Dictionary * pNewDictionary = (Dictionary *)(void *)pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(cbNewDictionary));
+    memcpy(pNewDictionary, pDictionary, cbDictionary);
+    pNewDictionary->SetDictionarySize(numGenericArgs, cbNewDictionary);
+
+    // The entries have to be visible before the dictionary is published
+    MemoryBarrier();
+
+    if (pMT != NULL)
+    {
+        EnsureWritablePages(pMT->GetPerInstInfo() + (pMT->GetNumDicts() - 1))->SetValueMaybeNull(pNewDictionary);
+    }
+    else
+    {
+        EnsureWritablePages(&pMD->AsInstantiatedMethodDesc()->m_pPerInstInfo)->SetValueMaybeNull(pNewDictionary);
+    }
+
+    return pNewDictionary;
+} // Dictionary::GetDictionaryWithSizeCheck
+
 //---------------------------------------------------------------------------------------
 // 
 void 
@@ -47,6 +47,12 @@
 // that is shared across compatible instantiations. For generic methods, the layout
 // is stored in the InstantiatedMethodDesc associated with the shared generic code itself.
 //
+// When the JIT needs a slot and the layout is full, the layout is replaced by a larger copy
+// of itself. Dictionaries allocated before that are too small for the new slots, so every
+// dictionary with a layout records its size in the slot that follows the instantiation. Code
+// looking up a slot beyond the initial size of the layout checks it, and the lookup helper
+// replaces a dictionary that is too small with a copy sized for the current layout.
+//
 
 class TypeHandleList;
 class Module;
@@ -107,12 +113,16 @@ private:
     // Number of non-type-argument slots in this bucket
     WORD m_numSlots;          
 
+    // Number of slots of the layout the first dictionaries were allocated with. Every
+    // dictionary has at least this many slots, so only slots beyond them need a size check.
+    WORD m_numInitialSlots;
+
     // m_numSlots of these
     DictionaryEntryLayout m_slots[1];
 
-    static BOOL FindTokenWorker(LoaderAllocator *pAllocator,
-                                DWORD numGenericArgs,
-                                DictionaryLayout *pDictLayout,
+    static BOOL FindTokenWorker(MethodDesc *pMD,
+                                MethodTable *pMT,
+                                LoaderAllocator *pAllocator,
                                 CORINFO_RUNTIME_LOOKUP *pResult,
                                 SigBuilder * pSigBuilder,
                                 BYTE * pSig,
@@ -121,26 +131,36 @@ private:
                                 DictionaryEntrySignatureSource signatureSource,
                                 WORD * pSlotOut);
 
+    // Replace the full layout of pMD or pMT (exactly one is non-NULL) by a larger copy. Returns the
+    // current layout, or NULL if it cannot grow any further.
+    static DictionaryLayout* ExpandDictionaryLayout(MethodDesc *pMD,
+                                                    MethodTable *pMT,
+                                                    LoaderAllocator *pAllocator,
+                                                    DictionaryLayout *pCurrentDictLayout,
+                                                    DWORD numGenericArgs);
+
      
 public:
     // Create an initial dictionary layout with a single bucket containing numSlots slots
     static DictionaryLayout* Allocate(WORD numSlots, LoaderAllocator *pAllocator, AllocMemTracker *pamTracker);
 
     // Bytes used for the first bucket of this dictionary, which might be stored inline in
-    // another structure (e.g. MethodTable)
+    // another structure (e.g. MethodTable). This includes the size slot if there is a layout.
     static DWORD GetFirstDictionaryBucketSize(DWORD numGenericArgs, PTR_DictionaryLayout pDictLayout);
 
-    static BOOL FindToken(LoaderAllocator *pAllocator,
-                          DWORD numGenericArgs,
-                          DictionaryLayout *pDictLayout,
+    // Find or add a slot for the signature in the layout of the dictionaries of pMD or pMT
+    // (exactly one is non-NULL). The JIT flavor grows the layout when it is full.
+    static BOOL FindToken(MethodDesc *pMD,
+                          MethodTable *pMT,
+                          LoaderAllocator *pAllocator,
                           CORINFO_RUNTIME_LOOKUP *pResult,
                           SigBuilder * pSigBuilder,
                           int nFirstOffset,
                           DictionaryEntrySignatureSource signatureSource);
 
-    static BOOL FindToken(LoaderAllocator * pAllocator,
-                          DWORD numGenericArgs,
-                          DictionaryLayout * pDictLayout,
+    static BOOL FindToken(MethodDesc * pMD,
+                          MethodTable * pMT,
+                          LoaderAllocator * pAllocator,
                           CORINFO_RUNTIME_LOOKUP * pResult,
                           BYTE * signature,
                           int nFirstOffset,
@@ -243,25 +263,26 @@ class Dictionary
         LIMITED_METHOD_CONTRACT; 
         return *GetFieldDescSlotAddr(numGenericArgs,i);
     }
+    // The layout slots follow the instantiation and the size slot
     inline TypeHandle *GetTypeHandleSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((TypeHandle *) &m_pEntries[numGenericArgs + i]);
+        return ((TypeHandle *) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline MethodDesc **GetMethodDescSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((MethodDesc **) &m_pEntries[numGenericArgs + i]);
+        return ((MethodDesc **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline FieldDesc **GetFieldDescSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((FieldDesc **) &m_pEntries[numGenericArgs + i]);
+        return ((FieldDesc **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline DictionaryEntry *GetSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((void **) &m_pEntries[numGenericArgs + i]);
+        return ((void **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline DictionaryEntry GetSlot(DWORD numGenericArgs, DWORD i) 
     { 
@@ -274,12 +295,29 @@ class Dictionary
         return GetSlot(numGenericArgs,i) == NULL;
     }
 
+    inline DWORD GetDictionarySize(DWORD numGenericArgs)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (DWORD)(SIZE_T)VolatileLoadWithoutBarrier(&m_pEntries[numGenericArgs]);
+    }
+
+    // Return the dictionary of pMD or pMT (exactly one is non-NULL), after replacing it by one
+    // sized for the current layout if it is too small to hold slotIndex
+    static Dictionary* GetDictionaryWithSizeCheck(MethodDesc * pMD, MethodTable * pMT, ULONG slotIndex);
+
 #endif // #ifndef DACCESS_COMPILE
 
   public:
 
 #ifndef DACCESS_COMPILE
 
+    // Record the size of a newly allocated dictionary that has a layout
+    inline void SetDictionarySize(DWORD numGenericArgs, DWORD cbDictionary)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_pEntries[numGenericArgs] = (DictionaryEntry)(SIZE_T)cbDictionary;
+    }
+
     static DictionaryEntry PopulateEntry(MethodDesc * pMD,
                                          MethodTable * pMT,
                                          LPVOID signature,
@@ -462,6 +462,9 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             pInstOrPerInstInfo = (TypeHandle *) (void*) amt.Track(pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(infoSize)));
             for (DWORD i = 0; i < methodInst.GetNumArgs(); i++)
                 pInstOrPerInstInfo[i] = methodInst[i];
+
+            if (pDL != NULL)
+                ((Dictionary *)pInstOrPerInstInfo)->SetDictionarySize(methodInst.GetNumArgs(), infoSize);
         }
 
         BOOL forComInterop = FALSE;
@@ -66,6 +66,13 @@ void HillClimbing::Initialize()
     m_accumulatedCompletionCount = 0;
     m_accumulatedSampleDuration = 0;
 
+    m_useQueueLatencyController = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_UseQueueLatencyController) != 0;
+    m_queueLatencyThresholdMs = max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_QueueLatencyThresholdMs));
+    m_queueLatencyStep = 0;
+    m_samplesWithoutBacklog = 0;
+    m_threadCountBeforeLastIncrease = 0;
+    m_throughputPerCpuBeforeLastIncrease = 0;
+
     m_samples = new double[m_samplesToMeasure];
     m_threadCounts = new double[m_samplesToMeasure];
 
@@ -344,6 +351,123 @@ int HillClimbing::Update(int currentThreadCount, double sampleDuration, int numC
 #endif //DACCESS_COMPILE
 }
 
+//
+// The queue latency controller is an alternative to the wave based search in Update, selected with
+// HillClimbing_UseQueueLatencyController. Short, high variance work items make the throughput samples too noisy for the
+// wave to be measured reliably, so instead of looking for the throughput optimum this reacts to two direct signals:
+//
+// - queueBacklogMs, how long the thread pool has had work waiting that no worker picked up. While it exceeds
+//   HillClimbing_QueueLatencyThresholdMs we add threads, doubling the step each sample (up to
+//   HillClimbing_MaxChangePerSample) so that we converge in a few samples rather than a few seconds.
+// - CPU utilization. Threads are never added while it is above CpuUtilizationHigh, since they would only compete for
+//   the CPU with the threads that are already running. If an increase reduced the throughput per unit of CPU by more
+//   than HillClimbing_Bias percent (e.g. due to contention), it is taken back.
+//
+// Once work stops waiting we remove a thread every wave period's worth of samples, so idle threads eventually retire.
+//
+int HillClimbing::UpdateForQueueLatency(int currentThreadCount, double sampleDuration, int numCompletions, DWORD queueBacklogMs, int* pNewSampleInterval)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef DACCESS_COMPILE
+    return 1;
+#else
+
+    //
+    // If someone changed the thread count without telling us, update our records accordingly.
+    // 
+    if (currentThreadCount != m_lastThreadCount)
+    {
+        ForceChange(currentThreadCount, Initializing);
+        m_threadCountBeforeLastIncrease = 0;
+    }
+
+    m_elapsedSinceLastChange += sampleDuration;
+    m_completionsSinceLastChange += numCompletions;
+    m_totalSamples++;
+
+    double throughput = (double)numCompletions / sampleDuration;
+    FireEtwThreadPoolWorkerThreadAdjustmentSample(throughput, GetClrInstanceId());
+
+    int cpuUtilization = ThreadpoolMgr::cpuUtilization;
+    double throughputPerCpu = throughput / max(cpuUtilization, 1);
+
+    int newThreadCount = currentThreadCount;
+
+    //
+    // Judge the last increase now that it has been in effect for a whole sample
+    //
+    bool lastIncreaseHurt = false;
+    if (m_threadCountBeforeLastIncrease != 0)
+    {
+        lastIncreaseHurt = throughputPerCpu < m_throughputPerCpuBeforeLastIncrease * (1.0 - m_targetThroughputRatio);
+        if (lastIncreaseHurt)
+            newThreadCount = m_threadCountBeforeLastIncrease;
+        m_threadCountBeforeLastIncrease = 0;
+    }
+
+    if (lastIncreaseHurt)
+    {
+        m_queueLatencyStep = 0;
+        m_samplesWithoutBacklog = 0;
+    }
+    else if (queueBacklogMs >= m_queueLatencyThresholdMs)
+    {
+        m_samplesWithoutBacklog = 0;
+
+        if (cpuUtilization <= CpuUtilizationHigh)
+        {
+            m_queueLatencyStep = min(max(m_queueLatencyStep * 2, 1), (int)m_maxChangePerSample);
+            newThreadCount = currentThreadCount + m_queueLatencyStep;
+            m_threadCountBeforeLastIncrease = currentThreadCount;
+            m_throughputPerCpuBeforeLastIncrease = throughputPerCpu;
+        }
+        else
+        {
+            m_queueLatencyStep = 0;
+        }
+    }
+    else
+    {
+        m_queueLatencyStep = 0;
+
+        if (++m_samplesWithoutBacklog >= m_wavePeriod)
+        {
+            m_samplesWithoutBacklog = 0;
+            newThreadCount = currentThreadCount - 1;
+        }
+    }
+
+    //
+    // Make sure the new thread count doesn't exceed the ThreadPool's limits
+    // 
+    newThreadCount = min(ThreadpoolMgr::MaxLimitTotalWorkerThreads, newThreadCount);
+    newThreadCount = max(ThreadpoolMgr::MinLimitTotalWorkerThreads, newThreadCount);
+    if (newThreadCount <= currentThreadCount)
+        m_threadCountBeforeLastIncrease = 0;
+
+    //
+    // Record the inputs to the decision
+    //
+    FireEtwThreadPoolWorkerThreadAdjustmentQueueLatencyStats(
+        sampleDuration, 
+        throughput, 
+        cpuUtilization, 
+        queueBacklogMs, 
+        throughputPerCpu, 
+        newThreadCount, 
+        GetClrInstanceId());
+
+    if (newThreadCount != currentThreadCount)
+        ChangeThreadCount(newThreadCount, QueueLatencyMove);
+
+    *pNewSampleInterval = m_currentSampleInterval; 
+
+    return newThreadCount;
+
+#endif //DACCESS_COMPILE
+}
+
 
 void HillClimbing::ForceChange(int newThreadCount, HillClimbingStateTransition transition)
 {
@@ -29,6 +29,8 @@ enum HillClimbingStateTransition
     Stabilizing,
     Starvation, //used by ThreadpoolMgr
     ThreadTimedOut, //used by ThreadpoolMgr
+    CooperativeBlocking, //used by ThreadpoolMgr
+    QueueLatencyMove,
     Undefined,
 };
 
@@ -67,6 +69,16 @@ private:
     int m_accumulatedCompletionCount;
     double m_accumulatedSampleDuration;
 
+    //
+    // State for the queue latency controller (see UpdateForQueueLatency)
+    //
+    bool m_useQueueLatencyController;
+    DWORD m_queueLatencyThresholdMs;
+    int m_queueLatencyStep;                     // size of the last increase, doubled while work keeps waiting
+    int m_samplesWithoutBacklog;
+    int m_threadCountBeforeLastIncrease;        // 0 if the last sample did not increase the thread count
+    double m_throughputPerCpuBeforeLastIncrease;
+
     void ChangeThreadCount(int newThreadCount, HillClimbingStateTransition transition);
     void LogTransition(int threadCount, double throughput, HillClimbingStateTransition transition);
 
@@ -75,6 +87,13 @@ private:
 public:
     void Initialize();
     int Update(int currentThreadCount, double sampleDuration, int numCompletions, int* pNewSampleInterval);
+    int UpdateForQueueLatency(int currentThreadCount, double sampleDuration, int numCompletions, DWORD queueBacklogMs, int* pNewSampleInterval);
+
+    bool UseQueueLatencyController() const
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_useQueueLatencyController;
+    }
     void ForceChange(int newThreadCount, HillClimbingStateTransition transition);
 };
 
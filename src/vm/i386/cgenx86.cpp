@@ -1386,6 +1386,27 @@ extern "C" DWORD __stdcall xmmYmmStateSupport()
     }
 }
 
+extern "C" DWORD __stdcall avx512StateSupport()
+{
+    // No CONTRACT
+    STATIC_CONTRACT_NOTHROW;
+    STATIC_CONTRACT_GC_NOTRIGGER;
+
+    __asm
+    {
+        mov     ecx, 0                  ; Specify xcr0
+        xgetbv                          ; result in EDX:EAX
+        and eax, 0E6H
+        cmp eax, 0E6H                   ; check OS has enabled XMM, YMM, opmask and ZMM state support
+        jne     not_supported
+        mov     eax, 1
+        jmp     done
+    not_supported:
+        mov     eax, 0
+    done:
+    }
+}
+
 #pragma warning(pop)
 
 #else // !FEATURE_PAL
@@ -1434,6 +1455,18 @@ extern "C" DWORD __stdcall xmmYmmStateSupport()
     return ((eax & 0x06) == 0x06) ? 1 : 0;
 }
 
+extern "C" DWORD __stdcall avx512StateSupport()
+{
+    DWORD eax;
+    __asm("  xgetbv\n" \
+        : "=a"(eax) /*output in eax*/\
+        : "c"(0) /*inputs - 0 in ecx*/\
+        : "edx" /* registers that are clobbered*/
+        );
+    // check OS has enabled XMM, YMM, opmask and ZMM state support
+    return ((eax & 0xE6) == 0xE6) ? 1 : 0;
+}
+
 #endif // !FEATURE_PAL
 
 void UMEntryThunkCode::Encode(BYTE* pTargetCode, void* pvSecretParam)
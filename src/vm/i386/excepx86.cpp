@@ -33,6 +33,7 @@
 
 #include "asmconstants.h"
 #include "virtualcallstub.h"
+#include "runtimecounters.h"
 
 #ifndef WIN64EXCEPTIONS
 MethodDesc * GetUserMethodForILStub(Thread * pThread, UINT_PTR uStubSP, MethodDesc * pILStubMD, Frame ** ppFrameOut);
@@ -2355,6 +2356,12 @@ StackWalkAction COMPlusThrowCallback(       // SWA value
         currentSP = 0; //Don't have an SP to get.
     }
     
+    // A new or rethrown exception starts a new dispatch
+    if (pData->bSkipLastElement || pData->bReplaceStack)
+    {
+        pExInfo->m_StackTraceInfo.StartDispatchTiming();
+    }
+
     if (!pFunc->IsILStub())
     {
         // Append the current frame to the stack trace and save the save trace to the managed Exception object.
@@ -2370,6 +2377,8 @@ StackWalkAction COMPlusThrowCallback(       // SWA value
         LOG((LF_EH, LL_INFO1000, "COMPlusThrowCallback: Skipping AppendElement/SaveStackTrace for IL stub MD %p\n", pFunc));
     }
 
+    RuntimeCounters::ExceptionCount.Increment();
+
     // Fire an exception thrown ETW event when an exception occurs
     ETW::ExceptionLog::ExceptionThrown(pCf, pData->bSkipLastElement, pData->bReplaceStack);
 
@@ -3274,6 +3283,7 @@ void ResumeAtJitEH(CrawlFrame* pCf,
     // that the handle for the current ExInfo has been freed has been delivered
     pExInfo->m_EHClauseInfo.SetManagedCodeEntered(TRUE);
 
+    pExInfo->m_StackTraceInfo.EndDispatchTiming();
     ETW::ExceptionLog::ExceptionCatchBegin(pCf->GetCodeInfo()->GetMethodDesc(), (PVOID)pCf->GetCodeInfo()->GetStartAddress());
 
     ResumeAtJitEHHelper(&context);
@@ -2573,8 +2573,10 @@ public:
 
 	enum
 	{
-		// If required buffer length > MAX_LOCAL_BUFFER_LENGTH, don't optimize by allocating memory on stack
-		MAX_LOCAL_BUFFER_LENGTH = MAX_PATH_FNAME + 1
+		// If required buffer length > MAX_LOCAL_BUFFER_LENGTH, don't optimize by allocating memory on stack.
+		// The buffer is sized for 3 bytes per UTF-16 code unit, so this keeps strings as long as
+		// the ANSI marshaler's on the stack.
+		MAX_LOCAL_BUFFER_LENGTH = (MAX_PATH_FNAME + 1) * 3
 	};
 
 	ILCUTF8Marshaler() :
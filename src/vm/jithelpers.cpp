@@ -2309,7 +2309,8 @@ TypeHandle::CastResult STDCALL ObjIsInstanceOfNoGC(Object *pObject, TypeHandle t
     if (Nullable::IsNullableForTypeNoGC(toTypeHnd, pMT))
         return TypeHandle::CanCast;
 
-    return pMT->CanCastToClassOrInterfaceNoGC(toTypeHnd.AsMethodTable());
+    // Goes through the cast cache
+    return TypeHandle(pMT).CanCastToNoGC(toTypeHnd);
 }
 
 BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd, BOOL throwCastException)
@@ -3833,11 +3834,10 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
     } CONTRACTL_END;
  
     MethodTable * pDeclaringMT = NULL;
+    ULONG dictionaryIndex = 0;
 
     if (pMT != NULL)
     {
-        ULONG dictionaryIndex = 0;
-
         if (pModule != NULL)
         {
 #ifdef _DEBUG
@@ -3892,6 +3892,17 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
     DictionaryEntry * pSlot;
     CORINFO_GENERIC_HANDLE result = (CORINFO_GENERIC_HANDLE)Dictionary::PopulateEntry(pMD, pDeclaringMT, signature, FALSE, &pSlot, dictionaryIndexAndSlot, pModule);
 
+    if (pSlot != NULL && pDeclaringMT != pMT)
+    {
+        // Derived types keep their own pointer to the dictionary of the declaring type. If the dictionary
+        // was replaced by a larger one to make room for the slot, point this type at it as well so that
+        // the next lookup through it does not fail the size check again.
+        MethodTable::PerInstInfoElem_t *pPerInstInfo = pMT->GetPerInstInfo() + dictionaryIndex;
+        Dictionary *pDictionary = pDeclaringMT->GetDictionary();
+        if (pPerInstInfo->GetValueMaybeNull() != pDictionary)
+            EnsureWritablePages(pPerInstInfo)->SetValueMaybeNull(pDictionary);
+    }
+
     if (pSlot == NULL)
     {
         // If we've overflowed the dictionary write the result to the cache.
@@ -1389,7 +1389,7 @@ static CorInfoHelpFunc getGenericStaticsHelper(FieldDesc * pField)
     return (CorInfoHelpFunc)helper;
 }
 
-CorInfoHelpFunc CEEInfo::getSharedStaticsHelper(FieldDesc * pField, MethodTable * pFieldMT)
+CorInfoHelpFunc CEEInfo::getSharedStaticsHelper(FieldDesc * pField, MethodTable * pFieldMT, BOOL fClassInited)
 {
     STANDARD_VM_CONTRACT;
 
@@ -1411,7 +1411,9 @@ CorInfoHelpFunc CEEInfo::getSharedStaticsHelper(FieldDesc * pField, MethodTable
         helper += delta;
     }
     else
-    if (!pFieldMT->HasClassConstructor() && !pFieldMT->HasBoxedRegularStatics())
+    if ((!pFieldMT->HasClassConstructor() && !pFieldMT->HasBoxedRegularStatics()) ||
+        // Once the class constructor has run, the helper has nothing left to trigger
+        fClassInited)
     {
         const int delta = CORINFO_HELP_GETSHARED_GCSTATIC_BASE_NOCTOR - CORINFO_HELP_GETSHARED_GCSTATIC_BASE;
 
@@ -1593,7 +1595,16 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
             {
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
-                pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
+                // If the class is already initialized, the NOCTOR flavor of the helper can be used,
+                // which lets the JIT hoist and CSE the static base like it does for classes without
+                // a constructor. Persisted code can run before the class is initialized.
+                BOOL fClassInited = FALSE;
+#ifndef CROSSGEN_COMPILE
+                if (!m_pMethodBeingCompiled->IsZapped() && !IsCompilingForNGen())
+                    fClassInited = pFieldMT->IsClassInited();
+#endif // !CROSSGEN_COMPILE
+
+                pResult->helper = getSharedStaticsHelper(pField, pFieldMT, fClassInited);
             }
             else
             {
@@ -1779,6 +1790,53 @@ bool CEEInfo::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return res;
 }
 
+/*********************************************************************/
+CORINFO_CLASS_HANDLE CEEInfo::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE fieldHnd, bool* pIsSpeculative)
+{
+    CONTRACTL {
+        SO_TOLERANT;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    CORINFO_CLASS_HANDLE result = NULL;
+    *pIsSpeculative = true;
+
+    JIT_TO_EE_TRANSITION();
+
+    FieldDesc* field = (FieldDesc*)fieldHnd;
+
+    // Only look at ref class typed statics that have a single, process wide location.
+    if (field->IsStatic() && field->IsObjRef() && !field->IsThreadStatic())
+    {
+        MethodTable* pEnclosingMT = field->GetEnclosingMethodTable();
+
+        // Don't look at the value before the class constructor has run: the storage
+        // may not exist yet, and the value is expected to change.
+        if (!pEnclosingMT->IsSharedByGenericInstantiations() && !pEnclosingMT->Collectible() &&
+            pEnclosingMT->IsClassInited())
+        {
+            GCX_COOP();
+
+            OBJECTREF fieldObj = field->GetStaticOBJECTREF();
+            VALIDATEOBJECTREF(fieldObj);
+
+            if (fieldObj != NULL)
+            {
+                result = (CORINFO_CLASS_HANDLE)fieldObj->GetMethodTable();
+
+                // An initonly static can't be reassigned once the class constructor has completed.
+                *pIsSpeculative = !IsFdInitOnly(field->GetAttributes());
+            }
+        }
+    }
+
+    EE_TO_JIT_TRANSITION();
+
+    return result;
+}
+
 //---------------------------------------------------------------------------------------
 // 
 void 
@@ -3074,6 +3132,7 @@ void CEEInfo::ComputeRuntimeLookupForSharedGenericToken(DictionaryEntryKind entr
 
     pResult->indirectFirstOffset = 0;
     pResult->indirectSecondOffset = 0;
+    pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
 
     // Unless we decide otherwise, just do the lookup via a helper function
     pResult->indirections = CORINFO_USEHELPER;
@@ -3510,7 +3569,7 @@ NoSpecialCase:
         _ASSERTE(pContextMD != NULL);
         _ASSERTE(pContextMD->HasMethodInstantiation());
 
-        if (DictionaryLayout::FindToken(pContextMD->GetLoaderAllocator(), pContextMD->GetNumGenericMethodArgs(), pContextMD->GetDictionaryLayout(), pResult, &sigBuilder, 1, signatureSource))
+        if (DictionaryLayout::FindToken(pContextMD, NULL, pContextMD->GetLoaderAllocator(), pResult, &sigBuilder, 1, signatureSource))
         {
             pResult->testForNull = 1;
             pResult->testForFixup = 0;
@@ -3528,7 +3587,7 @@ NoSpecialCase:
     // It's a class dictionary lookup (CORINFO_LOOKUP_CLASSPARAM or CORINFO_LOOKUP_THISOBJ)
     else
     {
-        if (DictionaryLayout::FindToken(pContextMT->GetLoaderAllocator(), pContextMT->GetNumGenericArgs(), pContextMT->GetClass()->GetDictionaryLayout(), pResult, &sigBuilder, 2, signatureSource))
+        if (DictionaryLayout::FindToken(NULL, pContextMT, pContextMT->GetLoaderAllocator(), pResult, &sigBuilder, 2, signatureSource))
         {
             pResult->testForNull = 1;
             pResult->testForFixup = 0;
@@ -6816,6 +6875,11 @@ DWORD CEEInfo::getMethodAttribsInternal (CORINFO_METHOD_HANDLE ftn)
     if (pMD->IsNDirect())
     {
         result |= CORINFO_FLG_PINVOKE;
+
+        if (pMD->HasSuppressGCTransitionAttribute())
+        {
+            result |= CORINFO_FLG_SUPPRESS_GC_TRANSITION;
+        }
     }
 
     if (IsMdRequireSecObject(attribs))
@@ -11867,6 +11931,44 @@ HRESULT CEEJitInfo::allocBBProfileBuffer (
 
     JIT_TO_EE_TRANSITION();
 
+#ifdef FEATURE_TIERED_COMPILATION
+    // Counts collected by tier0 code are kept with its code version, where
+    // the tier1 compile of the method looks for them (see getBBProfileData)
+    if (g_pConfig->TieredPGO() && !m_nativeCodeVersion.IsNull() &&
+        (m_nativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0))
+    {
+        if (m_ILHeader == NULL)
+        {
+            hr = E_NOTIMPL;
+        }
+        else
+        {
+            DWORD headerSize = sizeof(CORBBTPROF_METHOD_HEADER);
+            DWORD blockSize  = count * sizeof(CORBBTPROF_BLOCK_DATA);
+
+            CORBBTPROF_METHOD_HEADER * pProfileData = (CORBBTPROF_METHOD_HEADER *) (void *)
+                m_pMethodBeingCompiled->GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(headerSize) + S_SIZE_T(blockSize));
+
+            // Note: Memory allocated on the LowFrequencyHeap is zero filled
+            pProfileData->size          = headerSize + blockSize;
+            pProfileData->method.token  = m_pMethodBeingCompiled->GetMemberDef();
+            pProfileData->method.ILSize = m_ILHeader->GetCodeSize();
+            pProfileData->method.cBlock = count;
+
+            {
+                CodeVersionManager::TableLockHolder lock(m_pMethodBeingCompiled->GetCodeVersionManager());
+                hr = m_nativeCodeVersion.SetProfileData(pProfileData);
+            }
+
+            if (SUCCEEDED(hr))
+            {
+                *profileBuffer = (ICorJitInfo::ProfileBuffer *) &pProfileData->method.block[0];
+            }
+        }
+    }
+    else
+#endif // FEATURE_TIERED_COMPILATION
+    {
 #ifdef FEATURE_PREJIT
 
     // We need to know the code size. Typically we can get the code size
@@ -11892,14 +11994,16 @@ HRESULT CEEJitInfo::allocBBProfileBuffer (
     _ASSERTE(!"allocBBProfileBuffer not implemented on CEEJitInfo!");
     hr = E_NOTIMPL;
 #endif // !FEATURE_PREJIT
+    }
 
     EE_TO_JIT_TRANSITION();
     
     return hr;
 }
 
-// Consider implementing getBBProfileData on CEEJitInfo.  This will allow us
-// to use profile info in codegen for non zapped images.
+// The only profile data available to jitted code is the block counts
+// collected by instrumented tier0 code, which are handed to the tier1
+// compile of the same IL code version.
 HRESULT CEEJitInfo::getBBProfileData (
     CORINFO_METHOD_HANDLE         ftnHnd,
     ULONG *                       size,
@@ -11907,9 +12011,123 @@ HRESULT CEEJitInfo::getBBProfileData (
     ULONG *                       numRuns
     )
 {
-    LIMITED_METHOD_CONTRACT;
+    CONTRACTL {
+        SO_TOLERANT;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    HRESULT hr = E_FAIL;
+
+    JIT_TO_EE_TRANSITION();
+
+#ifdef FEATURE_TIERED_COMPILATION
+    CORBBTPROF_METHOD_HEADER * pProfileData = NULL;
+
+    if (g_pConfig->TieredPGO() && !m_nativeCodeVersion.IsNull() && (GetMethod(ftnHnd) == m_pMethodBeingCompiled))
+    {
+        CodeVersionManager::TableLockHolder lock(m_pMethodBeingCompiled->GetCodeVersionManager());
+        NativeCodeVersionCollection nativeVersions =
+            m_nativeCodeVersion.GetILCodeVersion().GetNativeCodeVersions(m_pMethodBeingCompiled);
+        for (NativeCodeVersionIterator cur = nativeVersions.Begin(), end = nativeVersions.End(); cur != end; cur++)
+        {
+            if (cur->GetOptimizationTier() == NativeCodeVersion::OptimizationTier0)
+            {
+                pProfileData = cur->GetProfileData();
+                if (pProfileData != NULL)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (pProfileData != NULL)
+    {
+        *size          = pProfileData->method.cBlock;
+        *profileBuffer = (ICorJitInfo::ProfileBuffer *) &pProfileData->method.block[0];
+        if (numRuns != NULL)
+        {
+            *numRuns = 1;
+        }
+        hr = S_OK;
+    }
+    else
+    {
+        *profileBuffer = NULL;
+        hr = E_FAIL;
+    }
+#else // FEATURE_TIERED_COMPILATION
     _ASSERTE(!"getBBProfileData not implemented on CEEJitInfo!");
-    return E_NOTIMPL;
+    hr = E_NOTIMPL;
+#endif // FEATURE_TIERED_COMPILATION
+
+    EE_TO_JIT_TRANSITION();
+
+    return hr;
+}
+
+void CEEJitInfo::setMethodAttribs (
+        CORINFO_METHOD_HANDLE ftnHnd,
+        CorInfoMethodRuntimeFlags attribs)
+{
+    CONTRACTL {
+        SO_TOLERANT;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    CEEInfo::setMethodAttribs(ftnHnd, attribs);
+
+#ifdef FEATURE_TIERED_COMPILATION
+    JIT_TO_EE_TRANSITION();
+
+    // A tier0 request that the jit chose to optimize (e.g. because the method has
+    // loops) must not be promoted to tier1 later, see AsyncPromoteMethodToTier1
+    if ((attribs & CORINFO_FLG_SWITCHED_TO_OPTIMIZED) && !m_nativeCodeVersion.IsNull() &&
+        (GetMethod(ftnHnd) == m_pMethodBeingCompiled))
+    {
+        CodeVersionManager::TableLockHolder lock(m_pMethodBeingCompiled->GetCodeVersionManager());
+
+        // On failure tier1 promotion just happens as usual
+        m_nativeCodeVersion.SetJitSwitchedToOptimized();
+    }
+
+    EE_TO_JIT_TRANSITION();
+#endif // FEATURE_TIERED_COMPILATION
+}
+
+void CEEJitInfo::reportJitPhaseStats(
+        unsigned         phaseIndex,
+        const char*      phaseName,
+        unsigned __int64 cycles,
+        unsigned __int64 allocatedBytes)
+{
+    CONTRACTL {
+        SO_TOLERANT;
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    JIT_TO_EE_TRANSITION();
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, MethodJitPhaseStats))
+    {
+        SString name;
+        name.SetANSI(phaseName != NULL ? phaseName : "");
+
+        FireEtwMethodJitPhaseStats((ULONGLONG)m_pMethodBeingCompiled,
+                                   (USHORT)phaseIndex,
+                                   name.GetUnicode(),
+                                   cycles,
+                                   allocatedBytes,
+                                   GetClrInstanceId());
+    }
+
+    EE_TO_JIT_TRANSITION();
 }
 
 void CEEJitInfo::allocMem (
@@ -11954,8 +12172,9 @@ void CEEJitInfo::allocMem (
     }
     if (roDataSize > 0)
     {
-        size_t codeAlignment = ((flag & CORJIT_ALLOCMEM_FLG_16BYTE_ALIGN)!= 0)
-                               ? 16 : sizeof(void*);
+        size_t codeAlignment = ((flag & CORJIT_ALLOCMEM_FLG_32BYTE_ALIGN) != 0) ? 32
+                             : ((flag & CORJIT_ALLOCMEM_FLG_16BYTE_ALIGN) != 0) ? 16
+                             : sizeof(void*);
         totalSize.AlignUp(codeAlignment);
         if (roDataAlignment > codeAlignment) {
             // Add padding to align read-only data.
@@ -12620,6 +12839,19 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
         flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_INFO);
     }
 
+    // Have the JIT report where its time goes for every Nth method while the event is on
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, MethodJitPhaseStats))
+    {
+        static LONG s_phaseStatsMethodCount = 0;
+
+        DWORD sampleInterval = g_pConfig->JitPhaseStatsSampleInterval();
+        if ((sampleInterval <= 1) ||
+            (((DWORD)FastInterlockIncrement(&s_phaseStatsMethodCount) % sampleInterval) == 0))
+        {
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_REPORT_PHASE_STATS);
+        }
+    }
+
     return flags;
 }
 
@@ -12680,7 +12912,7 @@ BOOL g_fAllowRel32 = TRUE;
 // are OK since they discard the return value of this method.
 
 PCODE UnsafeJitFunction(MethodDesc* ftn, COR_ILMETHOD_DECODER* ILHeader, CORJIT_FLAGS flags,
-                        ULONG * pSizeOfCode)
+                        ULONG * pSizeOfCode, NativeCodeVersion nativeCodeVersion)
 {
     STANDARD_VM_CONTRACT;
 
@@ -12842,6 +13074,10 @@ PCODE UnsafeJitFunction(MethodDesc* ftn, COR_ILMETHOD_DECODER* ILHeader, CORJIT_
         jitInfo.SetReserveForJumpStubs(reserveForJumpStubs);
 #endif
 
+#if defined(FEATURE_TIERED_COMPILATION) && !defined(CROSSGEN_COMPILE)
+        jitInfo.SetNativeCodeVersion(nativeCodeVersion);
+#endif
+
         MethodDesc * pMethodForSecurity = jitInfo.GetMethodForSecurity(ftnHnd);
 
         //Since the check could trigger a demand, we have to do this every time.
@@ -13951,6 +14187,16 @@ HRESULT CEEInfo::getBBProfileData(
     UNREACHABLE_RET();      // only called on derived class.
 }
 
+void CEEInfo::reportJitPhaseStats(
+        unsigned         phaseIndex,
+        const char*      phaseName,
+        unsigned __int64 cycles,
+        unsigned __int64 allocatedBytes)
+{
+    LIMITED_METHOD_CONTRACT;
+    UNREACHABLE();      // only called on derived class.
+}
+
 
 void CEEInfo::recordCallSite(
         ULONG                 instrOffset,  /* IN */
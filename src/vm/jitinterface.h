@@ -69,7 +69,8 @@ void InitJITHelpers1();
 void InitJITHelpers2();
 
 PCODE UnsafeJitFunction(MethodDesc* ftn, COR_ILMETHOD_DECODER* header,
-                        CORJIT_FLAGS flags, ULONG* sizeOfCode = NULL);
+                        CORJIT_FLAGS flags, ULONG* sizeOfCode = NULL,
+                        NativeCodeVersion nativeCodeVersion = NativeCodeVersion());
 
 void getMethodInfoHelper(MethodDesc * ftn,
                          CORINFO_METHOD_HANDLE ftnHnd,
@@ -659,10 +660,12 @@ public:
                        CORINFO_ACCESS_FLAGS   flags,
                        CORINFO_FIELD_INFO    *pResult
                       );
-    static CorInfoHelpFunc getSharedStaticsHelper(FieldDesc * pField, MethodTable * pFieldMT);
+    static CorInfoHelpFunc getSharedStaticsHelper(FieldDesc * pField, MethodTable * pFieldMT, BOOL fClassInited = FALSE);
 
     bool isFieldStatic(CORINFO_FIELD_HANDLE fldHnd);
 
+    CORINFO_CLASS_HANDLE getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative);
+
     // Given a signature token sigTOK, use class/method instantiation in context to instantiate any type variables in the signature and return a new signature
     void findSig(CORINFO_MODULE_HANDLE scopeHnd, unsigned sigTOK, CORINFO_CONTEXT_HANDLE context, CORINFO_SIG_INFO* sig);
     void findCallSiteSig(CORINFO_MODULE_HANDLE scopeHnd, unsigned methTOK, CORINFO_CONTEXT_HANDLE context, CORINFO_SIG_INFO* sig);
@@ -1138,6 +1141,9 @@ public:
 
     bool runWithErrorTrap(void (*function)(void*), void* param);
 
+    void reportJitPhaseStats(unsigned phaseIndex, const char* phaseName,
+                             unsigned __int64 cycles, unsigned __int64 allocatedBytes);
+
 private:
     // Shrinking these buffers drastically reduces the amount of stack space
     // required for each instance of the interpreter, and thereby reduces SOs.
@@ -1293,6 +1299,11 @@ public:
         ULONG *                       numRuns
     );
 
+    void setMethodAttribs (CORINFO_METHOD_HANDLE ftnHnd, CorInfoMethodRuntimeFlags attribs);
+
+    void reportJitPhaseStats(unsigned phaseIndex, const char* phaseName,
+                             unsigned __int64 cycles, unsigned __int64 allocatedBytes);
+
     void recordCallSite(
             ULONG                     instrOffset,  /* IN */
             CORINFO_SIG_INFO *        callSig,      /* IN */
@@ -1409,6 +1420,16 @@ public:
     }
 #endif
 
+#ifdef FEATURE_TIERED_COMPILATION
+    // The code version being compiled, which owns any block counts the
+    // jitted code collects
+    void SetNativeCodeVersion(NativeCodeVersion nativeCodeVersion)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_nativeCodeVersion = nativeCodeVersion;
+    }
+#endif
+
     CEEJitInfo(MethodDesc* fd,  COR_ILMETHOD_DECODER* header, 
                EEJitManager* jm, bool fVerifyOnly, bool allowInlining = true)
         : CEEInfo(fd, fVerifyOnly, allowInlining),
@@ -1531,6 +1552,10 @@ protected :
     ULONG32                 m_iNativeVarInfo;
     ICorDebugInfo::NativeVarInfo * m_pNativeVarInfo;
 
+#ifdef FEATURE_TIERED_COMPILATION
+    NativeCodeVersion       m_nativeCodeVersion;
+#endif
+
     // The first time a call is made to CEEJitInfo::GetProfilingHandle() from this thread
     // for this method, these values are filled in.   Thereafter, these values are used
     // in lieu of calling into the base CEEInfo::GetProfilingHandle() again.  This protects the
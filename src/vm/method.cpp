@@ -3438,6 +3438,7 @@ MethodDesc::Fixup(
         {
             image->ZeroPointerField(pWriteableData, offsetof(NDirectWriteableData, m_pNDirectTarget));
         }
+        image->ZeroPointerField(pWriteableData, offsetof(NDirectWriteableData, m_pILStubMD));
 #else // HAS_NDIRECT_IMPORT_PRECODE
         PORTABILITY_WARNING("NDirectImportThunkGlue");
 #endif // HAS_NDIRECT_IMPORT_PRECODE
@@ -5124,6 +5125,42 @@ BOOL MethodDesc::HasNativeCallableAttribute()
     return FALSE;
 }
 
+//*******************************************************************************
+// A P/Invoke marked with SuppressGCTransitionAttribute is called by JIT-inlined P/Invokes without
+// the InlinedCallFrame and without switching the thread to preemptive mode. The thread stays in
+// cooperative mode for the duration of the native call, so the native method must:
+//
+//   - be short and never block (no waits, no I/O, no locks that may be contended),
+//   - not call back into the runtime or into managed code,
+//   - not throw or otherwise unwind through the managed caller.
+//
+// A GC that is started while the call is in progress waits for it to return, and the debugger
+// and profilers do not see a managed-to-native transition for it. Calls that are not inlined by
+// the JIT, because they require marshaling or their call site does not allow it, still go
+// through the regular IL stub with a full transition.
+BOOL MethodDesc::HasSuppressGCTransitionAttribute()
+{
+
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = GetMDImport()->GetCustomAttributeByName(GetMemberDef(),
+        g_SuppressGCTransitionAttribute,
+        NULL,
+        NULL);
+    if (hr == S_OK)
+    {
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
 #ifdef FEATURE_COMINTEROP
 //*******************************************************************************
 void ComPlusCallMethodDesc::InitComEventCallInfo()
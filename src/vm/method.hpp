@@ -656,6 +656,7 @@ public:
 
     void ComputeSuppressUnmanagedCodeAccessAttr(IMDInternalImport *pImport);
     BOOL HasNativeCallableAttribute();
+    BOOL HasSuppressGCTransitionAttribute();
 
 #ifdef FEATURE_COMINTEROP 
     inline DWORD IsComPlusCall()
@@ -2511,6 +2512,11 @@ public:
     // Initialized to NDirectImportThunkGlue. Patched to the true target or 
     // host interceptor stub or alignment thunk after linking.
     LPVOID      m_pNDirectTarget;
+
+    // The IL stub generated at runtime for the default stub flags, cached here once the
+    // stub is complete so that later requests for it skip the ILStubCache lookup.
+    // Never persisted, see code:NDirectMethodDesc::GetCachedILStubMD
+    PTR_MethodDesc m_pILStubMD;
 };
 
 typedef DPTR(NDirectWriteableData)      PTR_NDirectWriteableData;
@@ -2820,6 +2826,27 @@ public:
 
     VOID SetNDirectTarget(LPVOID pTarget);
 
+    // Returns the runtime generated IL stub for this method, if one has been cached already
+    PTR_MethodDesc GetCachedILStubMD()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsNDirect());
+        return VolatileLoadWithoutBarrier(&GetWriteableData()->m_pILStubMD);
+    }
+
+#ifndef DACCESS_COMPILE
+    // All threads racing here get the same stub back from the ILStubCache, so a plain store is enough
+    void SetCachedILStubMD(MethodDesc* pStubMD)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsNDirect());
+        _ASSERTE(pStubMD != NULL && pStubMD->IsILStub());
+        VolatileStore(&GetWriteableData()->m_pILStubMD, dac_cast<PTR_MethodDesc>(pStubMD));
+    }
+#endif // !DACCESS_COMPILE
+
 #ifndef DACCESS_COMPILE
     BOOL NDirectTargetIsImportThunk()
     {
@@ -3305,6 +3332,22 @@ public:
         else
             return NULL;
     }
+
+    // Replace the dictionary layout returned by IMD_GetDictionaryLayout
+    void IMD_SetDictionaryLayout(DictionaryLayout* pDictLayout)
+    {
+        WRAPPER_NO_CONTRACT;
+        if (IMD_IsWrapperStubWithInstantiations() && IMD_HasMethodInstantiation())
+        {
+            InstantiatedMethodDesc* pIMD = IMD_GetWrappedMethodDesc()->AsInstantiatedMethodDesc();
+            EnsureWritablePages(&pIMD->m_pDictLayout)->SetValueMaybeNull(pDictLayout);
+        }
+        else
+        {
+            _ASSERTE(IMD_IsSharedByGenericMethodInstantiations());
+            EnsureWritablePages(&m_pDictLayout)->SetValueMaybeNull(pDictLayout);
+        }
+    }
 #endif // !DACCESS_COMPILE
 
     // Setup the IMD as shared code
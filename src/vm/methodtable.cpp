@@ -51,6 +51,7 @@
 #include "customattribute.h"
 #include "virtualcallstub.h"
 #include "contractimpl.h"
+#include "dispatchslotcache.h"
 #ifdef FEATURE_PREJIT
 #include "zapsig.h"
 #endif //FEATURE_PREJIT
@@ -7337,7 +7338,29 @@ DispatchSlot MethodTable::FindDispatchSlot(UINT32 typeID, UINT32 slotNumber)
     WRAPPER_NO_CONTRACT;
     STATIC_CONTRACT_SO_TOLERANT;
     DispatchSlot implSlot(NULL);
+
+#if !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
+    BOOL fUseCache = GetNumInterfaces() >= DispatchSlotCache::MinInterfaces;
+    if (fUseCache)
+    {
+        PCODE target = DispatchSlotCache::TryGet(this, typeID, slotNumber);
+        if (target != NULL)
+        {
+            implSlot = target;
+            return implSlot;
+        }
+    }
+#endif // !DACCESS_COMPILE && !CROSSGEN_COMPILE
+
     FindDispatchImpl(typeID, slotNumber, &implSlot);
+
+#if !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
+    if (fUseCache && !implSlot.IsNull())
+    {
+        DispatchSlotCache::TryAdd(this, typeID, slotNumber, implSlot.GetTarget());
+    }
+#endif // !DACCESS_COMPILE && !CROSSGEN_COMPILE
+
     return implSlot;
 }
 
@@ -3011,7 +3011,7 @@ public:
     // type parameters in the following cases:
     // * instantiated interfaces (no code)
     // * instantiated types whose code is not shared
-    // Otherwise, it starts with the type parameters and then has a fixed 
+    // Otherwise, it starts with the type parameters and its own size and then has a fixed 
     // number of slots for handles (types & methods)
     // that are filled in lazily at run-time. Finally there is a "spill-bucket" 
     // pointer used when the dictionary gets filled.
@@ -3019,6 +3019,7 @@ public:
     //    typar_1              type handle for first type parameter
     //    ...
     //    typar_n              type handle for last type parameter
+    //    size                 size of the dictionary in bytes (see code:Dictionary::GetDictionaryWithSizeCheck)
     //    slot_1               slot for first run-time handle (initially null)
     //    ...
     //    slot_m               slot for last run-time handle (initially null)
@@ -1344,7 +1344,7 @@ MethodTableBuilder::BuildMethodTableThrowing(
         if(safeLen.IsOverflow()) COMPlusThrowHR(COR_E_OVERFLOW);
 
         size_t len = safeLen.Value();
-        char *name = (char*) AllocateFromHighFrequencyHeap(safeLen);
+        char *name = (char*) AllocateFromLowFrequencyHeap(safeLen);
         strcpy_s(name, len, nameSpace);
         if (strlen(nameSpace) > 0) {
             name[strlen(nameSpace)] = '.';
@@ -3585,8 +3585,10 @@ VOID MethodTableBuilder::AllocateFieldDescs()
     // Allocate fields
     if (NumDeclaredFields() > 0)
     {
+        // FieldDescs are read when code is jitted and by reflection, not while dispatching or
+        // casting, so keep them out of the heap that holds the MethodTables.
         GetHalfBakedClass()->SetFieldDescList((FieldDesc *)
-            AllocateFromHighFrequencyHeap(S_SIZE_T(NumDeclaredFields()) * S_SIZE_T(sizeof(FieldDesc))));
+            AllocateFromLowFrequencyHeap(S_SIZE_T(NumDeclaredFields()) * S_SIZE_T(sizeof(FieldDesc))));
         INDEBUG(GetClassLoader()->m_dwDebugFieldDescs += NumDeclaredFields();)
         INDEBUG(GetClassLoader()->m_dwFieldDescData += (NumDeclaredFields() * sizeof(FieldDesc));)
     }
@@ -6826,8 +6828,11 @@ VOID MethodTableBuilder::AllocAndInitMethodDescChunk(COUNT_T startIndex, COUNT_T
         PRECONDITION(sizeOfMethodDescs <= MethodDescChunk::MaxSizeOfMethodDescs);
     } CONTRACTL_END;
 
+    // MethodDescChunks come from the low frequency heap so that the MethodTables, with their
+    // vtables and interface maps, are packed together in the high frequency heap. Once a method
+    // has code, calls and virtual dispatch no longer reach its MethodDesc.
     void * pMem = GetMemTracker()->Track(
-        GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(TADDR) + sizeof(MethodDescChunk) + sizeOfMethodDescs)));
+        GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(TADDR) + sizeof(MethodDescChunk) + sizeOfMethodDescs)));
 
     // Skip pointer to temporary entrypoints
     MethodDescChunk * pChunk = (MethodDescChunk *)((BYTE*)pMem + sizeof(TADDR));
@@ -10009,7 +10014,11 @@ MethodTable * MethodTableBuilder::AllocateNewMT(Module *pLoaderModule,
         if (cbInstAndDict)
         {
             MethodTable::PerInstInfoElem_t *pPInstInfo = (MethodTable::PerInstInfoElem_t *)(pPerInstInfo + (dwNumDicts-1));
-            pPInstInfo->SetValueMaybeNull((Dictionary*) (pPerInstInfo + dwNumDicts));
+            Dictionary *pDict = (Dictionary*) (pPerInstInfo + dwNumDicts);
+            pPInstInfo->SetValueMaybeNull(pDict);
+
+            if (GetHalfBakedClass()->GetDictionaryLayout() != NULL)
+                pDict->SetDictionarySize(bmtGenerics->GetNumGenericArgs(), cbInstAndDict);
         }
     }
 
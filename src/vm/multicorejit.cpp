@@ -731,7 +731,7 @@ void MulticoreJitRecorder::PreRecordFirstMethod()
 }
 
 
-void MulticoreJitRecorder::RecordMethodJit(MethodDesc * pMethod, bool application)
+void MulticoreJitRecorder::RecordMethodJit(MethodDesc * pMethod, bool application, bool tier1)
 {
     STANDARD_VM_CONTRACT;
     
@@ -776,6 +776,11 @@ void MulticoreJitRecorder::RecordMethodJit(MethodDesc * pMethod, bool applicatio
                 methodIndex |= JIT_BY_APP_THREAD;
             }
 
+            if (tier1) // Promoted to tier 1, the player will optimize it directly
+            {
+                methodIndex |= JIT_AT_TIER1;
+            }
+
             RecordJitInfo(moduleIndex, methodIndex);
         }
     }
@@ -1026,7 +1031,7 @@ void MulticoreJitManager::SetProfileRoot(AppDomain * pDomain, const wchar_t * pP
 
 #endif
 
-    if (g_SystemInfo.dwNumberOfProcessors >= 2)
+    if (GetCurrentProcessCpuCount() >= 2)
     {
         if (InterlockedCompareExchange(& m_fSetProfileRootCalled, SETPROFILEROOTCALLED, 0) == 0) // Only allow the first call per appdomain
         {
@@ -1057,7 +1062,7 @@ void MulticoreJitManager::StartProfile(AppDomain * pDomain, ICLRPrivBinder *pBin
     }
 
     // Need extra processor for multicore JIT feature
-    _ASSERTE(g_SystemInfo.dwNumberOfProcessors >= 2);
+    _ASSERTE(GetCurrentProcessCpuCount() >= 2);
 
 #ifdef PROFILING_SUPPORTED
 
@@ -1335,6 +1340,27 @@ void MulticoreJitManager::RecordMethodJit(MethodDesc * pMethod)
 }
 
 
+// Call back from TieredCompilationManager::OptimizeMethod once tier 1 code is activated
+// Threading: proected by m_playerLock
+
+void MulticoreJitManager::RecordMethodTier1Promotion(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->RecordMethodJit(pMethod, false, true);
+
+        if (m_pMulticoreJitRecorder->IsAtFullCapacity())
+        {
+            m_fRecorderActive = false;
+        }
+    }
+}
+
+
 // static 
 bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 {
@@ -227,6 +227,8 @@ public:
 
     void RecordMethodJit(MethodDesc * pMethod);
 
+    void RecordMethodTier1Promotion(MethodDesc * pMethod);
+
     MulticoreJitPlayerStat & GetStats()
     {
         LIMITED_METHOD_CONTRACT;
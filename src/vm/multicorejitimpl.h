@@ -41,6 +41,7 @@ const int      MULTICOREJITBLOCKLIMIT = 10 * 1000;  // 10 seconds
                                                     // Method JIT information: 8-bit module 4-bit flag 20-bit method index
 const unsigned MODULE_DEPENDENCY = 0x800000;        //  1-bit module dependency mask
 const unsigned JIT_BY_APP_THREAD = 0x400000;        //  1-bit application thread
+const unsigned JIT_AT_TIER1      = 0x200000;        //  1-bit promoted to tier 1 by tiered compilation
 
 const unsigned METHODINDEX_MASK  = 0x0FFFFF;        // 20-bit method index
 
@@ -429,7 +430,7 @@ public:
                (m_ModuleCount  >= MAX_MODULES);
     }
 
-    void RecordMethodJit(MethodDesc * pMethod, bool application);
+    void RecordMethodJit(MethodDesc * pMethod, bool application, bool tier1 = false);
 
     PCODE RequestMethodCode(MethodDesc * pMethod, MulticoreJitManager * pManager);
     
@@ -570,6 +570,8 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
 		return;
 	}
 
+    bool tier1 = (methodIndex & JIT_AT_TIER1) != 0;
+
     methodIndex &= METHODINDEX_MASK; // 20-bit
 
     unsigned token = TokenFromRid(methodIndex, mdtMethodDef);
@@ -593,6 +595,21 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
             pModule = pMethod->GetModule_NoLogging();
         }
 
+#ifdef FEATURE_TIERED_COMPILATION
+        // The method reached tier 1 in the recorded run, skip call counting and optimize it now. The tier 1
+        // code is jitted by the tiered compilation background workers and activated when it is ready.
+        if (tier1)
+        {
+            if (pMethod->IsEligibleForTieredCompilation() && TieredCompilationManager::RequiresCallCounting(pMethod))
+            {
+                GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMethod);
+                return;
+            }
+
+            goto BadMethod;
+        }
+#endif
+
         if (pMethod->GetNativeCode() != NULL) // last check before
         {
             m_stats.m_nHasNativeCode ++;
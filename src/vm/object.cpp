@@ -562,13 +562,21 @@ void STDCALL CopyValueClassUnchecked(void* dest, void* src, MethodTable *pMT)
             size_t offset = cur->GetSeriesOffset() - sizeof(void*);
             OBJECTREF* srcPtr = (OBJECTREF*)(((BYTE*) src) + offset);
             OBJECTREF* destPtr = (OBJECTREF*)(((BYTE*) dest) + offset);
-            OBJECTREF* srcPtrStop = (OBJECTREF*)((BYTE*) srcPtr + cur->GetSeriesSize() + size);         
+            size_t seriesBytes = cur->GetSeriesSize() + size;
+            OBJECTREF* srcPtrStop = (OBJECTREF*)((BYTE*) srcPtr + seriesBytes);
+            OBJECTREF* destPtrStart = destPtr;
+            // Store each reference atomically, then mark the cards for the whole series at once
+            // instead of running the write barrier per reference.
             while (srcPtr < srcPtrStop)                                         
             {   
-                SetObjectReferenceUnchecked(destPtr, ObjectToOBJECTREF(*(Object**)srcPtr));
+                VolatileStore((Object**)destPtr, *(Object**)srcPtr);
+#ifdef _DEBUG
+                Thread::ObjectRefAssign(destPtr);
+#endif
                 srcPtr++;
                 destPtr++;
             }                                                               
+            SetCardsAfterBulkCopy((Object**)destPtrStart, seriesBytes);
             cur--;                                                              
         } while (cur >= last);                                              
     }
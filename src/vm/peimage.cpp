@@ -1261,9 +1261,29 @@ void PEImage::Load()
     }
 
 #ifdef PLATFORM_UNIX
+    BOOL fFlatLayoutCreatedForLoad = FALSE;
+    if (m_pLayouts[IMAGE_FLAT] == NULL && IsFile() && !m_bIsTrustedNativeImage)
+    {
+        // Map the sections straight from the file when their file offsets allow it, so that
+        // the pages are shared with other processes using the same file.
+        PEImageLayout * pMappedLayout = PEImageLayout::TryMap(GetFileHandle(), this);
+        if (pMappedLayout != NULL)
+        {
+            SetLayout(IMAGE_LOADED, pMappedLayout);
+            return;
+        }
+
+        // The usual 512 byte file alignment does not allow that. Rather than copying the
+        // sections into anonymous memory, IL-only images are then used through the flat
+        // mapping of the file, which is file backed as well.
+        fFlatLayoutCreatedForLoad = (CreateLayoutFlat(FALSE /* bPermitWriteableSections */) != NULL);
+    }
+
     if (m_pLayouts[IMAGE_FLAT] != NULL
         && m_pLayouts[IMAGE_FLAT]->CheckILOnlyFormat()
-        && !m_pLayouts[IMAGE_FLAT]->HasWriteableSections())
+        && !m_pLayouts[IMAGE_FLAT]->HasWriteableSections()
+        // ReadyToRun code can only run from a mapped layout, keep the copy for those
+        && !(fFlatLayoutCreatedForLoad && m_pLayouts[IMAGE_FLAT]->HasReadyToRunHeader()))
     {
         // IL-only images with writeable sections are mapped in general way,
         // because the writeable sections should always be page-aligned
@@ -68,8 +68,8 @@ PEImageLayout* PEImageLayout::Map(HANDLE hFile, PEImage* pOwner)
     }
     CONTRACT_END;
     
-    PEImageLayoutHolder pAlloc(new MappedImageLayout(hFile,pOwner));
-    if (pAlloc->GetBase()==NULL)
+    PEImageLayoutHolder pAlloc(TryMap(hFile,pOwner));
+    if (pAlloc==NULL)
     {
         //cross-platform or a bad image
         PEImageLayoutHolder pFlat(new FlatImageLayout(hFile, pOwner));
@@ -78,12 +78,30 @@ PEImageLayout* PEImageLayout::Map(HANDLE hFile, PEImage* pOwner)
 
         pAlloc=new ConvertedImageLayout(pFlat);
     }
-    else
-        if(!pAlloc->CheckFormat())
-            ThrowHR(COR_E_BADIMAGEFORMAT);
     RETURN pAlloc.Extract();    
 }
 
+PEImageLayout* PEImageLayout::TryMap(HANDLE hFile, PEImage* pOwner)
+{
+    CONTRACT(PEImageLayout*)
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(pOwner));
+        POSTCONDITION(CheckPointer(RETVAL, NULL_OK));
+    }
+    CONTRACT_END;
+
+    PEImageLayoutHolder pAlloc(new MappedImageLayout(hFile,pOwner));
+    if (pAlloc->GetBase()==NULL)
+        RETURN NULL;
+
+    if(!pAlloc->CheckFormat())
+        ThrowHR(COR_E_BADIMAGEFORMAT);
+    RETURN pAlloc.Extract();
+}
+
 #ifdef FEATURE_PREJIT
 
 #ifdef FEATURE_PAL
@@ -56,6 +56,8 @@ public:
     static PEImageLayout* Load(PEImage* pOwner, BOOL bNTSafeLoad, BOOL bThrowOnError = TRUE);
     static PEImageLayout* LoadFlat(HANDLE hFile, PEImage* pOwner);
     static PEImageLayout* Map (HANDLE hFile, PEImage* pOwner);
+    // Like Map, but returns NULL instead of a converted copy when the OS style mapping fails
+    static PEImageLayout* TryMap (HANDLE hFile, PEImage* pOwner);
 #endif    
     PEImageLayout();
     virtual ~PEImageLayout();
@@ -201,7 +201,7 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::FindItem(TypeKey *pKey)
 
 
 #ifdef _DEBUG
-void PendingTypeLoadTable::Dump()
+void PendingTypeLoadTable::Dump(DWORD dwBucket)
 {
     CONTRACTL
     {
@@ -211,17 +211,16 @@ void PendingTypeLoadTable::Dump()
     }
     CONTRACTL_END
 
-    LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
-    for (DWORD i = 0; i < m_dwNumBuckets; i++)
+    _ASSERTE(dwBucket < m_dwNumBuckets);
+
+    LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: bucket %d contains:\n", dwBucket));
+    for (TableEntry *pSearch = m_pBuckets[dwBucket]; pSearch; pSearch = pSearch->pNext)
     {
-        for (TableEntry *pSearch = m_pBuckets[i]; pSearch; pSearch = pSearch->pNext)
-        {
-            SString name;
-            TypeKey entryTypeKey = pSearch->pData->GetTypeKey();
-            TypeString::AppendTypeKeyDebug(name, &entryTypeKey);
-            LOG((LF_CLASSLOADER, LL_INFO10000, "  Entry %S with handle %p at level %s\n", name.GetUnicode(), pSearch->pData->m_typeHandle.AsPtr(),
-                 pSearch->pData->m_typeHandle.IsNull() ? "not-applicable" : classLoadLevelName[pSearch->pData->m_typeHandle.GetLoadLevel()]));            
-        }
+        SString name;
+        TypeKey entryTypeKey = pSearch->pData->GetTypeKey();
+        TypeString::AppendTypeKeyDebug(name, &entryTypeKey);
+        LOG((LF_CLASSLOADER, LL_INFO10000, "  Entry %S with handle %p at level %s\n", name.GetUnicode(), pSearch->pData->m_typeHandle.AsPtr(),
+             pSearch->pData->m_typeHandle.IsNull() ? "not-applicable" : classLoadLevelName[pSearch->pData->m_typeHandle.GetLoadLevel()]));            
     }
 }
 #endif
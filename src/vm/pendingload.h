@@ -254,7 +254,7 @@ public:
     TableEntry* AllocNewEntry();
     void FreeEntry(TableEntry* pEntry);
 #ifdef _DEBUG
-    void            Dump();
+    void            Dump(DWORD dwBucket);
 #endif
 
 private:
@@ -38,6 +38,16 @@ void PerfMap::Initialize()
         // Create the map.
         s_Current = new PerfMap(currentPid);
 
+#ifndef CROSSGEN_COMPILE
+        // Start the thread that writes out buffered lines.  If it can't be created, lines are
+        // still written whenever the buffer fills up and at shutdown.
+        HANDLE hFlushThread = Thread::CreateUtilityThread(Thread::StackSize_Small, FlushThreadStart, NULL, W(".NET PerfMap Flush"));
+        if (hFlushThread != NULL)
+        {
+            CloseHandle(hFlushThread);
+        }
+#endif // !CROSSGEN_COMPILE
+
         int signalNum = (int) CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapIgnoreSignal);
 
         if (signalNum > 0)
@@ -54,11 +64,27 @@ void PerfMap::Destroy()
 
     if (s_Current != nullptr)
     {
-        delete s_Current;
-        s_Current = nullptr;
+        // The flush thread may be using the map, so it is not deleted.  Write out what is buffered,
+        // lines logged after this point stay in the buffer.
+        s_Current->Flush();
     }
 }
 
+#ifndef CROSSGEN_COMPILE
+DWORD WINAPI PerfMap::FlushThreadStart(LPVOID lpArgs)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (true)
+    {
+        ClrSleepEx(c_FlushIntervalMs, FALSE);
+        s_Current->Flush();
+    }
+
+    return 0;
+}
+#endif // !CROSSGEN_COMPILE
+
 // Construct a new map for the process.
 PerfMap::PerfMap(int pid)
 {
@@ -69,6 +95,8 @@ PerfMap::PerfMap(int pid)
 
     m_StubsMapped = 0;
 
+    InitBuffer();
+
     // Build the path to the map file on disk.
     WCHAR tempPath[MAX_LONGPATH+1];
     if(!GetTempPathW(MAX_LONGPATH, tempPath))
@@ -97,6 +125,8 @@ PerfMap::PerfMap()
     m_ErrorEncountered = false;
 
     m_StubsMapped = 0;
+
+    InitBuffer();
 }
 
 // Clean-up resources.
@@ -104,6 +134,13 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    Flush();
+
+    delete[] m_Buffer;
+    m_Buffer = nullptr;
+
+    m_Lock.Destroy();
+
     delete m_FileStream;
     m_FileStream = nullptr;
 
@@ -129,6 +166,19 @@ void PerfMap::OpenFile(SString& path)
     }
 }
 
+// Initialize the line buffer.
+void PerfMap::InitBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The lock is a leaf lock, it is taken while the callers of LogStubs hold their own locks.
+    m_Lock.Init(CrstLeafLock, CRST_UNSAFE_ANYMODE);
+
+    // Without a buffer every line is written directly.
+    m_Buffer = new (nothrow) BYTE[c_BufferSize];
+    m_BufferUsed = 0;
+}
+
 // Write a line to the map file.
 void PerfMap::WriteLine(SString& line)
 {
@@ -136,23 +186,71 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         StackScratchBuffer scratch;
         const char * strLine = line.GetANSI(scratch);
         ULONG inCount = line.GetCount();
+
+        CrstHolder ch(&m_Lock);
+
+        if (m_BufferUsed + inCount > c_BufferSize)
+        {
+            FlushBuffer();
+        }
+
+        if (m_Buffer != nullptr && inCount <= c_BufferSize)
+        {
+            // Copy the line, it is written with the rest of the batch.
+            memcpy(m_Buffer + m_BufferUsed, strLine, inCount);
+            m_BufferUsed += inCount;
+        }
+        else
+        {
+            ULONG outCount;
+            m_FileStream->Write(strLine, inCount, &outCount);
+
+            if (inCount != outCount)
+            {
+                // This will cause us to stop writing to the file.
+                // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+                m_ErrorEncountered = true;
+            }
+        }
+    }
+    EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
+}
+
+// Write out the buffered lines.
+void PerfMap::FlushBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(m_Lock.OwnedByCurrentThread());
+
+    if (m_BufferUsed == 0)
+    {
+        return;
+    }
+
+    if (m_FileStream != nullptr && !m_ErrorEncountered)
+    {
         ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
+        m_FileStream->Write(m_Buffer, (ULONG)m_BufferUsed, &outCount);
 
-        if (inCount != outCount)
+        if (outCount != m_BufferUsed)
         {
             // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
             m_ErrorEncountered = true;
         }
-
     }
-    EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
+
+    m_BufferUsed = 0;
+}
+
+void PerfMap::Flush()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    CrstHolder ch(&m_Lock);
+    FlushBuffer();
 }
 
 // Log a method to the map.
@@ -177,12 +275,12 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize)
     EX_TRY
     {
         // Get the full method signature.
-        SString fullMethodSignature;
+        StackSString fullMethodSignature;
         pMethod->GetFullMethodInfo(fullMethodSignature);
 
         // Build the map file line.
         StackScratchBuffer scratch;
-        SString line;
+        StackSString line;
         line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, fullMethodSignature.GetANSI(scratch));
 
         // Write the line.
@@ -262,7 +360,7 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         }
 
         // Build the map file line.
-        SString line;
+        StackSString line;
         line.Printf(FMT_CODE_ADDR " %x stub<%d> %s<%s>\n", pCode, codeSize, ++(s_Current->m_StubsMapped), stubType, stubOwner);
 
         // Write the line.
@@ -31,12 +31,37 @@ private:
     // Set to true if an error is encountered when writing to the file.
     unsigned m_StubsMapped;
 
+    // Lines are collected here and written to the file in batches, when the buffer is full
+    // or by the flush thread.
+    static const size_t c_BufferSize = 64 * 1024;
+    BYTE * m_Buffer;
+    size_t m_BufferUsed;
+
+    // Protects the buffer and the file stream.
+    CrstExplicitInit m_Lock;
+
+    // How often the flush thread writes out buffered lines, which bounds how long it takes for a
+    // method to appear in the file.
+    static const DWORD c_FlushIntervalMs = 100;
+
     // Construct a new map for the specified pid.
     PerfMap(int pid);
 
+    // Initialize the buffer and the lock.
+    void InitBuffer();
+
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write out the buffered lines.  The caller must hold m_Lock.
+    void FlushBuffer();
+
+    // Write out the buffered lines.
+    void Flush();
+
+    // Periodically writes out the lines buffered in the process map.
+    static DWORD WINAPI FlushThreadStart(LPVOID lpArgs);
+
 protected:
     // Construct a new map without a specified file name.
     // Used for offline creation of NGEN map files.
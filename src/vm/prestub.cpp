@@ -54,6 +54,8 @@
 #include "gdbjit.h"
 #endif // FEATURE_GDBJIT
 
+#include "runtimecounters.h"
+
 #ifndef DACCESS_COMPILE
 
 #if defined(FEATURE_JIT_PITCHING)
@@ -797,6 +799,8 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
         // Save the JIT'd method information so that perf can resolve JIT'd call frames.
         PerfMap::LogJITCompiledMethod(this, pCode, sizeOfCode);
 #endif
+
+        RuntimeCounters::MethodsJittedCount.Increment();
     }
 
 
@@ -840,7 +844,7 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEn
     PCODE pOtherCode = NULL;
     EX_TRY
     {
-        pCode = UnsafeJitFunction(this, pilHeader, *pFlags, pSizeOfCode);
+        pCode = UnsafeJitFunction(this, pilHeader, *pFlags, pSizeOfCode, pConfig->GetCodeVersion());
     }
     EX_CATCH
     {
@@ -2595,6 +2599,7 @@ void ProcessDynamicDictionaryLookup(TransitionBlock *           pTransitionBlock
 
     pResult->indirectFirstOffset = 0;
     pResult->indirectSecondOffset = 0;
+    pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
 
     pResult->indirections = CORINFO_USEHELPER;
 
@@ -2689,7 +2694,7 @@ void ProcessDynamicDictionaryLookup(TransitionBlock *           pTransitionBlock
 
     if (kind == ENCODE_DICTIONARY_LOOKUP_METHOD)
     {
-        if (DictionaryLayout::FindToken(pModule->GetLoaderAllocator(), numGenericArgs, pContextMD->GetDictionaryLayout(), pResult, (BYTE*)pBlobStart, 1, FromReadyToRunImage, &dictionarySlot))
+        if (DictionaryLayout::FindToken(pContextMD, NULL, pModule->GetLoaderAllocator(), pResult, (BYTE*)pBlobStart, 1, FromReadyToRunImage, &dictionarySlot))
         {
             pResult->testForNull = 1;
 
@@ -2708,7 +2713,7 @@ void ProcessDynamicDictionaryLookup(TransitionBlock *           pTransitionBlock
     // It's a class dictionary lookup (CORINFO_LOOKUP_CLASSPARAM or CORINFO_LOOKUP_THISOBJ)
     else
     {
-        if (DictionaryLayout::FindToken(pModule->GetLoaderAllocator(), numGenericArgs, pContextMT->GetClass()->GetDictionaryLayout(), pResult, (BYTE*)pBlobStart, 2, FromReadyToRunImage, &dictionarySlot))
+        if (DictionaryLayout::FindToken(NULL, pContextMT, pModule->GetLoaderAllocator(), pResult, (BYTE*)pBlobStart, 2, FromReadyToRunImage, &dictionarySlot))
         {
             pResult->testForNull = 1;
 
@@ -2727,6 +2732,16 @@ void ProcessDynamicDictionaryLookup(TransitionBlock *           pTransitionBlock
             *pDictionaryIndexAndSlot |= dictionarySlot;
         }
     }
+
+    // The lookup stubs do not check the size of the dictionary. Slots added when the layout grew are
+    // missing from older dictionaries, so look those up through the helper and its hash instead.
+    if (pResult->sizeOffset != CORINFO_NO_SIZE_CHECK)
+    {
+        pResult->indirections = CORINFO_USEHELPER;
+        pResult->testForNull = 0;
+        pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
+        *pDictionaryIndexAndSlot &= ~0xFFFF;
+    }
 }
 
 PCODE DynamicHelperFixup(TransitionBlock * pTransitionBlock, TADDR * pCell, DWORD sectionIndex, Module * pModule, CORCOMPILE_FIXUP_BLOB_KIND * pKind, TypeHandle * pTH, MethodDesc ** ppMD, FieldDesc ** ppFD)
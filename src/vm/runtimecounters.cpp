@@ -0,0 +1,367 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#include "common.h"
+#include "runtimecounters.h"
+#include "gcheaputilities.h"
+#include "win32threadpool.h"
+#include "threadpoolrequest.h"
+#include "finalizerthread.h"
+
+#ifdef FEATURE_PERFTRACING
+#include "eventpipe.h"
+#include "eventpipeevent.h"
+#include "eventpipemetadatagenerator.h"
+#include "eventpipeprovider.h"
+#endif // FEATURE_PERFTRACING
+
+RuntimeCounter RuntimeCounters::ExceptionCount;
+RuntimeCounter RuntimeCounters::MonitorLockContentionCount;
+RuntimeCounter RuntimeCounters::MethodsJittedCount;
+RuntimeCounter RuntimeCounters::Tier1MethodsQueuedCount;
+RuntimeCounter RuntimeCounters::Tier1MethodsCompiledCount;
+RuntimeCounter RuntimeCounters::Tier1JitTimeUs;
+
+RuntimeCounters::Entry RuntimeCounters::s_entries[RuntimeCounters::MaxCounters];
+unsigned int RuntimeCounters::s_count = 0;
+bool RuntimeCounters::s_registrationClosed = false;
+CrstStatic RuntimeCounters::s_lock;
+
+#ifdef FEATURE_PERFTRACING
+const WCHAR* RuntimeCounters::s_providerName = W("Microsoft-DotNETCore-RuntimeCounters");
+EventPipeProvider* RuntimeCounters::s_pEventPipeProvider = NULL;
+EventPipeEvent* RuntimeCounters::s_pCountersEvent = NULL;
+BYTE* RuntimeCounters::s_pPayload = NULL;
+unsigned int RuntimeCounters::s_payloadSize = 0;
+DWORD RuntimeCounters::s_intervalMs = 0;
+Volatile<BOOL> RuntimeCounters::s_samplingEnabled = false;
+Thread* RuntimeCounters::s_pSamplingThread = NULL;
+CLREventStatic RuntimeCounters::s_stopEvent;
+CLREventStatic RuntimeCounters::s_threadShutdownEvent;
+#endif // FEATURE_PERFTRACING
+
+static INT64 GetGCHeapSize()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (!GCHeapUtilities::IsGCHeapInitialized())
+    {
+        return 0;
+    }
+
+    GCX_COOP();
+    return (INT64)GCHeapUtilities::GetGCHeap()->GetTotalBytesInUse();
+}
+
+static INT64 GetCollectionCount(int generation)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (!GCHeapUtilities::IsGCHeapInitialized())
+    {
+        return 0;
+    }
+
+    return GCHeapUtilities::GetGCHeap()->CollectionCount(generation);
+}
+
+static INT64 GetGen0CollectionCount()
+{
+    WRAPPER_NO_CONTRACT;
+    return GetCollectionCount(0);
+}
+
+static INT64 GetGen1CollectionCount()
+{
+    WRAPPER_NO_CONTRACT;
+    return GetCollectionCount(1);
+}
+
+static INT64 GetGen2CollectionCount()
+{
+    WRAPPER_NO_CONTRACT;
+    return GetCollectionCount(2);
+}
+
+static INT64 GetThreadPoolCompletedWorkItemCount()
+{
+    WRAPPER_NO_CONTRACT;
+    return Thread::GetTotalThreadPoolCompletionCount();
+}
+
+static INT64 GetFinalizersRunCount()
+{
+    WRAPPER_NO_CONTRACT;
+    return (INT64)FinalizerThread::GetFinalizersRun();
+}
+
+static INT64 GetFinalizerDrainTimeMs()
+{
+    WRAPPER_NO_CONTRACT;
+    return (INT64)FinalizerThread::GetFinalizerDrainTimeMs();
+}
+
+// Only the work items queued from native code, the managed queue is not visible here.
+static INT64 GetThreadPoolNativeQueueLength()
+{
+    WRAPPER_NO_CONTRACT;
+    return PerAppDomainTPCountList::GetUnmanagedTPCount()->GetNumRequests();
+}
+
+void RuntimeCounters::Initialize()
+{
+    STANDARD_VM_CONTRACT;
+
+    s_lock.Init(CrstLeafLock);
+
+    Register(W("ExceptionCount"), &ExceptionCount);
+    Register(W("MonitorLockContentionCount"), &MonitorLockContentionCount);
+    Register(W("MethodsJittedCount"), &MethodsJittedCount);
+    Register(W("Tier1MethodsQueuedCount"), &Tier1MethodsQueuedCount);
+    Register(W("Tier1MethodsCompiledCount"), &Tier1MethodsCompiledCount);
+    Register(W("Tier1JitTimeUs"), &Tier1JitTimeUs);
+    Register(W("GCHeapSize"), GetGCHeapSize);
+    Register(W("Gen0CollectionCount"), GetGen0CollectionCount);
+    Register(W("Gen1CollectionCount"), GetGen1CollectionCount);
+    Register(W("Gen2CollectionCount"), GetGen2CollectionCount);
+    Register(W("ThreadPoolWorkerThreadCount"), ThreadpoolMgr::GetActiveWorkerThreadCount);
+    Register(W("ThreadPoolCompletedWorkItemCount"), GetThreadPoolCompletedWorkItemCount);
+    Register(W("ThreadPoolNativeQueueLength"), GetThreadPoolNativeQueueLength);
+    Register(W("FinalizersRunCount"), GetFinalizersRunCount);
+    Register(W("FinalizerDrainTimeMs"), GetFinalizerDrainTimeMs);
+}
+
+bool RuntimeCounters::Register(LPCWSTR pName, RuntimeCounter *pCounter)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(pCounter != NULL);
+
+    Entry entry = { pName, pCounter, NULL };
+    return Register(entry);
+}
+
+bool RuntimeCounters::Register(LPCWSTR pName, RuntimeCounterPollCallback pCallback)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(pCallback != NULL);
+
+    Entry entry = { pName, NULL, pCallback };
+    return Register(entry);
+}
+
+bool RuntimeCounters::Register(const Entry &entry)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(entry.pName != NULL);
+    }
+    CONTRACTL_END;
+
+    CrstHolder ch(&s_lock);
+
+    if (s_registrationClosed || s_count == MaxCounters)
+    {
+        _ASSERTE(!"Runtime counter registered too late or too many runtime counters.");
+        return false;
+    }
+
+    s_entries[s_count++] = entry;
+    return true;
+}
+
+#ifdef FEATURE_PERFTRACING
+
+void RuntimeCounters::CreateCountersEvent()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    unsigned int count;
+    {
+        CrstHolder ch(&s_lock);
+        s_registrationClosed = true;
+        count = s_count;
+    }
+
+    // Generate metadata with the interval followed by one field per counter.
+    const unsigned int numParams = count + 1;
+    NewArrayHolder<EventPipeParameterDesc> params = new EventPipeParameterDesc[numParams];
+    params[0].Type = EventPipeParameterType::UInt32;
+    params[0].Name = W("IntervalMilliseconds");
+    for (unsigned int i = 0; i < count; i++)
+    {
+        params[i + 1].Type = EventPipeParameterType::Int64;
+        params[i + 1].Name = s_entries[i].pName;
+    }
+
+    size_t metadataLength = 0;
+    BYTE *pMetadata = EventPipeMetadataGenerator::GenerateEventMetadata(
+        1,      /* eventID */
+        W("RuntimeCounters"),
+        0,      /* keywords */
+        0,      /* version */
+        EventPipeEventLevel::LogAlways,
+        params,
+        numParams,
+        metadataLength);
+
+    s_payloadSize = sizeof(UINT32) + count * sizeof(INT64);
+    s_pPayload = new BYTE[s_payloadSize];
+
+    s_pEventPipeProvider = EventPipe::CreateProvider(SL(s_providerName));
+    s_pCountersEvent = s_pEventPipeProvider->AddEvent(
+        1,      /* eventID */
+        0,      /* keywords */
+        0,      /* eventVersion */
+        EventPipeEventLevel::LogAlways,
+        false,  /* NeedStack */
+        pMetadata,
+        (unsigned int)metadataLength);
+
+    // The metadata blob is copied into EventPipe-owned memory.
+    delete[] pMetadata;
+}
+
+void RuntimeCounters::EnableSampling()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        PRECONDITION(!s_samplingEnabled);
+        // Synchronization of multiple callers occurs in EventPipe::Enable.
+        PRECONDITION(EventPipe::GetLock()->OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
+
+    if (s_pEventPipeProvider == NULL)
+    {
+        CreateCountersEvent();
+    }
+
+    // Don't spin up the sampling thread unless the counters are wanted.
+    if (!s_pCountersEvent->IsEnabled())
+    {
+        return;
+    }
+
+    s_intervalMs = max(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeRuntimeCountersIntervalMs), (DWORD)1);
+
+    s_stopEvent.CreateManualEvent(FALSE);
+    s_threadShutdownEvent.CreateManualEvent(FALSE);
+
+    s_pSamplingThread = SetupUnstartedThread();
+    if (s_pSamplingThread->CreateNewThread(0, ThreadProc, NULL))
+    {
+        s_samplingEnabled = true;
+        s_pSamplingThread->SetBackground(TRUE);
+        s_pSamplingThread->StartThread();
+    }
+    else
+    {
+        _ASSERT(!"Unable to create runtime counters thread.");
+        DestroyThread(s_pSamplingThread);
+        s_pSamplingThread = NULL;
+
+        s_stopEvent.CloseEvent();
+        s_threadShutdownEvent.CloseEvent();
+    }
+}
+
+void RuntimeCounters::DisableSampling()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        // Synchronization of multiple callers occurs in EventPipe::Disable.
+        PRECONDITION(EventPipe::GetLock()->OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
+
+    if (!s_samplingEnabled)
+    {
+        return;
+    }
+
+    s_samplingEnabled = false;
+
+    // Wake the sampling thread and wait for it to clean itself up.
+    s_stopEvent.Set();
+    s_threadShutdownEvent.Wait(INFINITE, FALSE /* bAlertable */);
+
+    s_stopEvent.CloseEvent();
+    s_threadShutdownEvent.CloseEvent();
+}
+
+void RuntimeCounters::WriteSample()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    *((UINT32 *)s_pPayload) = s_intervalMs;
+
+    INT64 *pValues = (INT64 *)(s_pPayload + sizeof(UINT32));
+    for (unsigned int i = 0; i < s_count; i++)
+    {
+        const Entry &entry = s_entries[i];
+        INT64 value = (entry.pCounter != NULL) ? entry.pCounter->GetTotal() : entry.pCallback();
+
+        // The payload is packed, so the values are not necessarily aligned.
+        memcpy(&pValues[i], &value, sizeof(INT64));
+    }
+
+    EventPipe::WriteEvent(*s_pCountersEvent, s_pPayload, s_payloadSize);
+}
+
+DWORD WINAPI RuntimeCounters::ThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        PRECONDITION(s_pSamplingThread != NULL);
+    }
+    CONTRACTL_END;
+
+    if (s_pSamplingThread->HasStarted())
+    {
+        // Switch to pre-emptive mode so that this thread doesn't starve the GC.
+        GCX_PREEMP();
+
+        // Write a sample right away so that short sessions get at least one.
+        do
+        {
+            WriteSample();
+        }
+        while (s_stopEvent.Wait(s_intervalMs, FALSE /* bAlertable */) == WAIT_TIMEOUT);
+    }
+
+    // Destroy the sampling thread when it is done running.
+    DestroyThread(s_pSamplingThread);
+    s_pSamplingThread = NULL;
+
+    // Signal DisableSampling() that the thread has been destroyed.
+    s_threadShutdownEvent.Set();
+
+    return S_OK;
+}
+
+#endif // FEATURE_PERFTRACING
@@ -0,0 +1,154 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#ifndef __RUNTIMECOUNTERS_H__
+#define __RUNTIMECOUNTERS_H__
+
+class EventPipeProvider;
+class EventPipeEvent;
+
+// A count that is incremented from many threads, such as the number of exceptions thrown.
+// The count is spread over cache line sized slots that are picked by the current processor,
+// so threads running on different processors usually don't write to the same line. Reading
+// the total sums the slots.
+class RuntimeCounter
+{
+public:
+    void Increment()
+    {
+        WRAPPER_NO_CONTRACT;
+        Add(1);
+    }
+
+    void Add(INT64 value)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Threads on one processor can still race for a slot, so the add must be interlocked.
+        InterlockedExchangeAdd64(&m_slots[GetCurrentProcessorNumber() % SlotCount].value, value);
+    }
+
+    INT64 GetTotal()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        INT64 total = 0;
+        for (DWORD i = 0; i < SlotCount; i++)
+        {
+            total += VolatileLoad(&m_slots[i].value);
+        }
+        return total;
+    }
+
+private:
+    static const DWORD SlotCount = 16;
+
+    struct DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) Slot
+    {
+        INT64 value;
+        BYTE padding[MAX_CACHE_LINE_SIZE - sizeof(INT64)];
+    };
+
+    // Counters are statics, so the slots start out zeroed.
+    Slot m_slots[SlotCount];
+};
+
+// Returns the current value of a counter that is read rather than accumulated, such as the
+// GC heap size.
+typedef INT64 (*RuntimeCounterPollCallback)();
+
+// The registry of named runtime counters. When the Microsoft-DotNETCore-RuntimeCounters
+// EventPipe provider is enabled, every registered counter is sampled at a configured interval
+// (EventPipeRuntimeCountersIntervalMs) and written as one RuntimeCounters event with a field
+// per counter. Accumulated counters report their running total, so rates are computed by the
+// reader from consecutive events.
+//
+// The event's fields are fixed when it is first created, so counters must be registered
+// before the first session enables the provider, normally from Initialize.
+class RuntimeCounters
+{
+public:
+    // Register the built-in counters - called from EEStartupHelper.
+    static void Initialize();
+
+    // Register a counter. Returns false if registration is closed or the registry is full.
+    // The name must stay valid for the lifetime of the process.
+    static bool Register(LPCWSTR pName, RuntimeCounter *pCounter);
+    static bool Register(LPCWSTR pName, RuntimeCounterPollCallback pCallback);
+
+    // Built-in accumulated counters.
+    static RuntimeCounter ExceptionCount;
+    static RuntimeCounter MonitorLockContentionCount;
+    static RuntimeCounter MethodsJittedCount;
+
+    // Tiered compilation: methods queued for tier1, methods compiled at tier1 in the background,
+    // and the total microseconds spent in those background compiles.
+    static RuntimeCounter Tier1MethodsQueuedCount;
+    static RuntimeCounter Tier1MethodsCompiledCount;
+    static RuntimeCounter Tier1JitTimeUs;
+
+#ifdef FEATURE_PERFTRACING
+    // Start sampling if the counters event is enabled.  Called from EventPipe::Enable.
+    static void EnableSampling();
+
+    // Stop sampling.  Called from EventPipe::Disable.
+    static void DisableSampling();
+#endif // FEATURE_PERFTRACING
+
+private:
+    struct Entry
+    {
+        LPCWSTR pName;
+        // Exactly one of these is set.
+        RuntimeCounter *pCounter;
+        RuntimeCounterPollCallback pCallback;
+    };
+
+    static bool Register(const Entry &entry);
+
+    static const unsigned int MaxCounters = 32;
+    static Entry s_entries[MaxCounters];
+    static unsigned int s_count;
+
+    // Set once the event has been created.  The entries are not changed after that, so the
+    // sampling thread reads them without the lock.
+    static bool s_registrationClosed;
+
+    // Protects registration.
+    static CrstStatic s_lock;
+
+#ifdef FEATURE_PERFTRACING
+    // Create the provider and event, closing registration.
+    static void CreateCountersEvent();
+
+    static void WriteSample();
+
+    // Sampling thread proc.  Invoked on a new thread when sampling is enabled.
+    static DWORD WINAPI ThreadProc(void *args);
+
+    static const WCHAR* s_providerName;
+    static EventPipeProvider *s_pEventPipeProvider;
+    static EventPipeEvent *s_pCountersEvent;
+
+    // The interval field followed by one INT64 per counter.
+    static BYTE *s_pPayload;
+    static unsigned int s_payloadSize;
+
+    static DWORD s_intervalMs;
+
+    // True while the sampling thread is running.
+    static Volatile<BOOL> s_samplingEnabled;
+
+    // The sampling thread.
+    static Thread *s_pSamplingThread;
+
+    // Set by DisableSampling to stop the sampling thread.
+    static CLREventStatic s_stopEvent;
+
+    // Set by the sampling thread when it is done.
+    static CLREventStatic s_threadShutdownEvent;
+#endif // FEATURE_PERFTRACING
+};
+
+#endif // __RUNTIMECOUNTERS_H__
@@ -17,6 +17,9 @@
 
 #define NUM_NANOSECONDS_IN_1_MS (1000000)
 
+// The longest the sampling interval is stretched to by the overhead budget.
+#define MAX_SLEEP_TIME_IN_NS (1000 * NUM_NANOSECONDS_IN_1_MS)
+
 Volatile<BOOL> SampleProfiler::s_profilingEnabled = false;
 Thread* SampleProfiler::s_pSamplingThread = NULL;
 const WCHAR* SampleProfiler::s_providerName = W("Microsoft-DotNETCore-SampleProfiler");
@@ -26,6 +29,7 @@ BYTE* SampleProfiler::s_pPayloadExternal = NULL;
 BYTE* SampleProfiler::s_pPayloadManaged = NULL;
 CLREventStatic SampleProfiler::s_threadShutdownEvent;
 unsigned long SampleProfiler::s_samplingRateInNs = NUM_NANOSECONDS_IN_1_MS; // 1ms
+unsigned int SampleProfiler::s_overheadBudgetPercent = 0;
 bool SampleProfiler::s_timePeriodIsSet = FALSE;
 
 #ifndef FEATURE_PAL
@@ -77,6 +81,8 @@ void SampleProfiler::Enable()
         *((unsigned int *)s_pPayloadManaged) = static_cast<unsigned int>(SampleProfilerSampleType::Managed);
     }
 
+    s_overheadBudgetPercent = min(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeSampleProfilerOverheadPercent), (DWORD)100);
+
     s_profilingEnabled = true;
     s_pSamplingThread = SetupUnstartedThread();
     if(s_pSamplingThread->CreateNewThread(0, ThreadProc, NULL))
@@ -177,6 +183,9 @@ DWORD WINAPI SampleProfiler::ThreadProc(void *args)
                 continue;
             }
 
+            LARGE_INTEGER sampleStartTimeStamp;
+            QueryPerformanceCounter(&sampleStartTimeStamp);
+
             // Actually suspend managed execution.
             ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_REASON::SUSPEND_OTHER);
 
@@ -187,7 +196,7 @@ DWORD WINAPI SampleProfiler::ThreadProc(void *args)
             ThreadSuspend::RestartEE(FALSE /* bFinishedGC */, TRUE /* SuspendSucceeded */);
 
             // Wait until it's time to sample again.
-            PlatformSleep(s_samplingRateInNs);
+            PlatformSleep(GetSleepTimeAfterSample(sampleStartTimeStamp));
         }
     }
 
@@ -242,6 +251,35 @@ void SampleProfiler::WalkManagedThreads()
     }
 }
 
+unsigned long SampleProfiler::GetSleepTimeAfterSample(LARGE_INTEGER sampleStartTimeStamp)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if(s_overheadBudgetPercent == 0)
+    {
+        return s_samplingRateInNs;
+    }
+
+    LARGE_INTEGER now, frequency;
+    if(!QueryPerformanceCounter(&now) || !QueryPerformanceFrequency(&frequency))
+    {
+        return s_samplingRateInNs;
+    }
+
+    // Taking the sample cost sampleTimeInNs, so sleeping sampleTimeInNs * (100 - budget) / budget
+    // keeps the time spent sampling at the budget.  With many threads, or deep stacks, this is
+    // longer than the sampling rate.
+    ULONGLONG sampleTimeInNs = (ULONGLONG)(now.QuadPart - sampleStartTimeStamp.QuadPart) * NUM_NANOSECONDS_IN_1_MS * 1000 / frequency.QuadPart;
+    ULONGLONG sleepTimeInNs = sampleTimeInNs * (100 - s_overheadBudgetPercent) / s_overheadBudgetPercent;
+
+    if(sleepTimeInNs <= s_samplingRateInNs)
+    {
+        return s_samplingRateInNs;
+    }
+
+    return (unsigned long)min(sleepTimeInNs, (ULONGLONG)max((unsigned long)MAX_SLEEP_TIME_IN_NS, s_samplingRateInNs));
+}
+
 void SampleProfiler::PlatformSleep(unsigned long nanoseconds)
 {
     CONTRACTL
@@ -255,7 +293,7 @@ void SampleProfiler::PlatformSleep(unsigned long nanoseconds)
 #ifdef FEATURE_PAL
     PAL_nanosleep(nanoseconds);
 #else //FEATURE_PAL
-    ClrSleepEx(s_samplingRateInNs / NUM_NANOSECONDS_IN_1_MS, FALSE);
+    ClrSleepEx(nanoseconds / NUM_NANOSECONDS_IN_1_MS, FALSE);
 #endif //FEATURE_PAL
 }
 
@@ -63,6 +63,10 @@ class SampleProfiler
         // and under light load the timings will achieve great accuracy!
         static void PlatformSleep(unsigned long nanoseconds);
 
+        // Get how long to sleep after a sample that started at sampleStartTimeStamp.
+        // This is the sampling rate, unless that would exceed the overhead budget.
+        static unsigned long GetSleepTimeAfterSample(LARGE_INTEGER sampleStartTimeStamp);
+
         static bool LoadDependencies();
         static void UnloadDependencies();
 
@@ -99,6 +103,9 @@ class SampleProfiler
         // The sampling rate.
         static unsigned long s_samplingRateInNs;
 
+        // The percentage of time that taking samples may use, 0 if it is not limited.
+        static unsigned int s_overheadBudgetPercent;
+
         // Whether or not timeBeginPeriod has been used to set the scheduler period
         static bool s_timePeriodIsSet;
 };
@@ -144,7 +144,7 @@ StringLiteralMap::~StringLiteralMap()
 
 
 
-STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload)
+STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound)
 {
     CONTRACTL
     {
@@ -172,10 +172,14 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
         // Retrieve the string literal from the global string literal map.
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-        // TODO: We can be more efficient by checking our local hash table now to see if
-        // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-        // (Rather than waiting until after we look the string up in the global map) 
-        
+        // Another thread may have inserted it into our table while we were waiting for the lock
+        if (m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+        {
+            STRINGREF *pStrObj = ((StringLiteralEntry*)Data)->GetStringObject();
+            _ASSERTE(!bAddIfNotFound || pStrObj);
+            return pStrObj;
+        }
+
         StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound));
 
         _ASSERTE(pEntry || !bAddIfNotFound);
@@ -183,30 +187,11 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
         // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
         if (pEntry)
         {
-            // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
-            
-            if (!bAppDomainWontUnload)
-            {                
-                // Make sure some other thread has not already added it.
-                if (!m_StringToEntryHashTable->GetValue(pStringData, &Data))
-                {
-                    // Insert the handle to the string into the hash table.
-                    m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
-                }
-                else
-                {
-                    pEntry.Release(); //while we're still under lock
-                }
-            }
-#ifdef _DEBUG
-            else
-            {
-                LOG((LF_APPDOMAIN, LL_INFO10000, "Avoided adding String literal to appdomain map: size: %d bytes\n", pStringData->GetCharCount()));
-            }
-#endif
+            // Always insert the entry into our table, even if the loader allocator never unloads, so
+            // that the next lookup of this literal succeeds at the lock free lookup above instead of
+            // taking the global map lock.
+            m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
+
             pEntry.SuppressRelease();
             STRINGREF *pStrObj = NULL;
             // Retrieve the string objectref from the string literal entry.
@@ -221,7 +206,7 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     return NULL;
 }
 
-STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload)
+STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound)
 {
     CONTRACTL
     {
@@ -249,10 +234,16 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     {
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-        // TODO: We can be more efficient by checking our local hash table now to see if
-        // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-        // (Rather than waiting until after we look the string up in the global map) 
-        
+        // Taking the lock could have caused a GC, so recreate the string data before checking
+        // whether another thread inserted it into our table while we were waiting.
+        StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
+        if (m_StringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
+        {
+            STRINGREF *pStrObj = ((StringLiteralEntry*)Data)->GetStringObject();
+            _ASSERTE(!bAddIfNotFound || pStrObj);
+            return pStrObj;
+        }
+
         // Retrieve the string literal from the global string literal map.
         StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetInternedString(pString, dwHash, bAddIfNotFound));
 
@@ -261,28 +252,14 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
         if (pEntry)
         {
-            // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
+            // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
+            // we need to recreate the string data.
+            StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
+
+            // Always insert the entry into our table so that the next lookup succeeds at the
+            // lock free lookup above instead of taking the global map lock.
+            m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
 
-            if (!bAppDomainWontUnload)
-            {
-                // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
-                // we need to recreate the string data.
-                StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
-
-                // Make sure some other thread has not already added it.
-                if (!m_StringToEntryHashTable->GetValue(&StringData, &Data))
-                {
-                    // Insert the handle to the string into the hash table.
-                    m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
-                }
-                else
-                {
-                    pEntry.Release(); // while we're under lock
-                }
-            }
             pEntry.SuppressRelease();
             // Retrieve the string objectref from the string literal entry.
             STRINGREF *pStrObj = NULL;
@@ -30,6 +30,8 @@
 #include "corhost.h"
 #include "comdelegate.h"
 #include "finalizerthread.h"
+#include "win32threadpool.h"
+#include "runtimecounters.h"
 
 #ifdef FEATURE_COMINTEROP
 #include "runtimecallablewrapper.h"
@@ -1903,15 +1905,19 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Only keep spinning for as long as spinning has recently been successful in acquiring this lock
+            const DWORD lockSpinCount = awareLock->GetSpinCountForContention();
+            _ASSERTE(lockSpinCount <= spinCount);
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1920,6 +1926,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(lockSpinCount, true);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1929,7 +1936,9 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 }
             }
 
-            if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
+            bool acquiredLock = awareLock->TryEnterAfterSpinLoopHelper(pCurThread);
+            awareLock->RecordSpinResult(lockSpinCount, acquiredLock);
+            if (acquiredLock)
             {
                 return AwareLock::EnterHelperResult_Entered;
             }
@@ -3055,10 +3064,24 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     _ASSERTE(pCurThread->PreemptiveGCDisabled());
 
     COUNTER_ONLY(GetPerfCounters().m_LocksAndThreads.cContention++);
+    RuntimeCounters::MonitorLockContentionCount.Increment();
 
     // Fire a contention start event for a managed contention
     FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
 
+    // Only time the contention when the stop event would report it
+    LARGE_INTEGER contentionStartTicks;
+    contentionStartTicks.QuadPart = 0;
+    BOOL fSampleContention = ETW::ContentionLog::ShouldSampleContention();
+    if (fSampleContention || ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ContentionStop_V1))
+    {
+        QueryPerformanceCounter(&contentionStartTicks);
+    }
+
+    // The owner is reported as its Thread*, which is how the managed thread is identified by the other
+    // events.  It is not dereferenced, the owner may exit while this thread waits.
+    UINT64 ownerThreadID = (UINT64)dac_cast<TADDR>(m_HoldingThread);
+
     LogContention();
 
     OBJECTREF obj = GetOwningObject();
@@ -3188,8 +3211,22 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     GCPROTECT_END();
     DecrementTransientPrecious();
 
-    // Fire a contention end event for a managed contention
-    FireEtwContentionStop(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
+    // Fire a contention end event for a managed contention, along with how long the thread waited for the lock
+    double contentionDurationNs = 0;
+    if (contentionStartTicks.QuadPart != 0)
+    {
+        LARGE_INTEGER contentionEndTicks, frequency;
+        QueryPerformanceCounter(&contentionEndTicks);
+        QueryPerformanceFrequency(&frequency);
+        contentionDurationNs = (double)(contentionEndTicks.QuadPart - contentionStartTicks.QuadPart) * 1000000000 / frequency.QuadPart;
+    }
+    FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), contentionDurationNs);
+
+    if (fSampleContention)
+    {
+        // Monitors have no Crst type
+        ETW::ContentionLog::SendContentionSample(ETW::ContentionLog::ContentionStructs::ManagedContention, this, (UINT32)-1, ownerThreadID, contentionStartTicks);
+    }
 
     if (ret == WAIT_TIMEOUT)
     {
@@ -3371,6 +3408,7 @@ BOOL SyncBlock::Wait(INT32 timeOut, BOOL exitContext)
         _ASSERTE(defaultContext);
         _ASSERTE( exitContext==NULL || targetContext == defaultContext);
         {
+            ThreadpoolMgr::BlockingWaitHolder blockingWaitHolder(pCurThread, timeOut);
             isTimedOut = pCurThread->Block(timeOut, &syncState);
         }
     }
@@ -162,7 +162,7 @@ inline void InitializeSpinConstants()
 
 #if !defined(DACCESS_COMPILE)
     g_SpinConstants.dwInitialDuration = g_pConfig->SpinInitialDuration();
-    g_SpinConstants.dwMaximumDuration = min(g_pConfig->SpinLimitProcCap(), g_SystemInfo.dwNumberOfProcessors) * g_pConfig->SpinLimitProcFactor() + g_pConfig->SpinLimitConstant();
+    g_SpinConstants.dwMaximumDuration = min(g_pConfig->SpinLimitProcCap(), (DWORD)GetCurrentProcessCpuCount()) * g_pConfig->SpinLimitProcFactor() + g_pConfig->SpinLimitConstant();
     g_SpinConstants.dwBackoffFactor   = g_pConfig->SpinBackoffFactor();
     g_SpinConstants.dwRepetitions     = g_pConfig->SpinRetryCount();
     g_SpinConstants.dwMonitorSpinCount = g_SpinConstants.dwMaximumDuration == 0 ? 0 : g_pConfig->MonitorSpinCount();
@@ -463,7 +463,14 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // Number of spin iterations to use when the lock is contended, adjusted based on whether spinning has recently been
+    // successful in acquiring the lock. Spinning stops paying off once the lock is typically held for longer than the spin
+    // duration, in which case a negative value counts contentions until spinning is attempted again. Updates are not
+    // synchronized since the value is only a heuristic.
+    INT16 m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const INT16 MinSpinCountForAdaptiveSpin = -100;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -474,7 +481,8 @@ private:
 #endif // DACCESS_COMPILE          
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(GetMaxSpinCount())
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -539,6 +547,17 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+private:
+    static INT16 GetMaxSpinCount()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (INT16)min(g_SpinConstants.dwMonitorSpinCount, (DWORD)SHRT_MAX);
+    }
+
+public:
+    DWORD GetSpinCountForContention();
+    void RecordSpinResult(DWORD spinCount, bool acquiredLock);
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
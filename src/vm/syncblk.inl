@@ -468,6 +468,57 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCountForContention()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (g_SpinConstants.dwMonitorSpinCount == 0)
+    {
+        return 0;
+    }
+
+    INT16 spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    if (spinCount < 0)
+    {
+        // Spinning has not been paying off recently. Count this contention and skip spinning, once enough contentions
+        // have been counted spinning is attempted again to see if it has become beneficial.
+        m_spinCount = (INT16)(spinCount + 1);
+        return 0;
+    }
+
+    // Spin at least a little when probing, the count grows back as long as spinning succeeds
+    return max(spinCount, (INT16)1);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(DWORD spinCount, bool acquiredLock)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (spinCount == 0)
+    {
+        // Did not spin, nothing was learned
+        return;
+    }
+
+    INT16 currentSpinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    if (acquiredLock)
+    {
+        if (currentSpinCount < GetMaxSpinCount())
+        {
+            m_spinCount = (INT16)(currentSpinCount + 1);
+        }
+    }
+    else if (currentSpinCount > 1)
+    {
+        m_spinCount = (INT16)(currentSpinCount - 1);
+    }
+    else
+    {
+        // Spinning keeps failing, the lock is probably held for longer than it makes sense to spin
+        m_spinCount = MinSpinCountForAdaptiveSpin;
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
@@ -420,19 +420,24 @@ void UnManagedPerAppDomainTPCount::QueueUnmanagedWorkRequest(LPTHREAD_START_ROUT
     _ASSERTE(pWorkRequest != NULL);
     PREFIX_ASSUME(pWorkRequest != NULL);
 
+    pWorkRequest->EnqueueTime = GetTickCount();
+
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolEnqueue) && 
         !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(function))
         FireEtwThreadPoolEnqueue(pWorkRequest, GetClrInstanceId());
 
     m_lock.Init(LOCK_TYPE_DEFAULT);
-    
+
+    // Count the request before it becomes visible, so the count never falls below the number of queued requests
+    FastInterlockIncrement(&m_NumRequests);
+
+    if (!ThreadpoolMgr::TryPushLocalWorkRequest(pWorkRequest))
     {
         SpinLock::Holder slh(&m_lock);
 
         ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
-        pWorkRequest.SuppressRelease();
-        m_NumRequests++;
     }
+    pWorkRequest.SuppressRelease();
 
     SetAppDomainRequestsActive();
 #endif //DACCESS_COMPILE
@@ -450,13 +455,22 @@ PVOID UnManagedPerAppDomainTPCount::DeQueueUnManagedWorkRequest(bool* lastOne)
 
     *lastOne = true;
 
-    WorkRequest * pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    // Requests queued on this processor come first, then the global queue in FIFO order, and only
+    // then the requests queued on the other processors
+    WorkRequest * pWorkRequest = ThreadpoolMgr::PopLocalWorkRequest();
 
-    if (pWorkRequest) 
+    if (pWorkRequest == NULL)
     {
-        m_NumRequests--;
+        SpinLock::Holder slh(&m_lock);
+        pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    }
 
-        if(m_NumRequests > 0) 
+    if (pWorkRequest == NULL)
+        pWorkRequest = ThreadpoolMgr::StealLocalWorkRequest();
+
+    if (pWorkRequest) 
+    {
+        if (FastInterlockDecrement(&m_NumRequests) > 0) 
             *lastOne = false;
     }
 
@@ -497,10 +511,7 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
     while (*wasNotRecalled) 
     {
         m_lock.Init(LOCK_TYPE_DEFAULT);
-        {
-            SpinLock::Holder slh(&m_lock);
-            pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
-        }
+        pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
 
         if (NULL == pWorkRequest)
             break;
@@ -524,6 +535,8 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
         wrFunction = pWorkRequest->Function;
         wrContext  = pWorkRequest->Context;
 
+        ThreadpoolMgr::RecordQueueLatency(GetTickCount() - pWorkRequest->EnqueueTime);
+
         if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolDequeue) &&
             !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(wrFunction))
             FireEtwThreadPoolDequeue(pWorkRequest, GetClrInstanceId());
@@ -235,6 +235,12 @@ public:
         return VolatileLoad(&m_outstandingThreadRequestCount) != (LONG)0 ? TRUE : FALSE;
     }
 
+    inline LONG GetNumRequests()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return max(VolatileLoad(&m_NumRequests), (LONG)0);
+    }
+
     void SetAppDomainRequestsActive();
     
     inline void ClearAppDomainRequestsActive(BOOL bADU)
@@ -286,8 +292,8 @@ public:
     }
 
 private:
-    SpinLock m_lock;
-    ULONG m_NumRequests;
+    SpinLock m_lock;                    // protects the global work request queue
+    LONG m_NumRequests;                 // requests in the global and the worker local queues, only use with FastInterlock*
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) struct {
         BYTE m_padding1[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
         // Only use with VolatileLoad+VolatileStore+FastInterlockCompareExchange
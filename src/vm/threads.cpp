@@ -292,6 +292,7 @@ ThreadLocalInfo gCurrentThreadInfo =
                                                   NULL,    // m_pThread
                                                   NULL,    // m_pAppDomain
                                                   NULL,    // m_EETlsData
+                                                  NULL,    // m_pThreadLocalBlock
                                               };
 } // extern "C"
 
@@ -305,6 +306,7 @@ BOOL SetThread(Thread* t)
     LIMITED_METHOD_CONTRACT
 
     gCurrentThreadInfo.m_pThread = t;
+    gCurrentThreadInfo.m_pThreadLocalBlock = (t != NULL) ? t->m_pThreadLocalBlock : NULL;
     return TRUE;
 }
 
@@ -7860,7 +7862,7 @@ void Thread::EnterContextRestricted(Context *pContext, ContextTransitionFrame *p
         // NULL out the Thread's pointer to the current ThreadLocalBlock. On the next
         // access to thread static data, the Thread's pointer to the current ThreadLocalBlock
         // will be updated correctly.
-        m_pThreadLocalBlock = NULL;
+        SetThreadLocalBlock(NULL);
 
         m_pDomain = pDomain;
         SetAppDomain(m_pDomain);
@@ -7981,7 +7983,7 @@ void Thread::ReturnToContext(ContextTransitionFrame *pFrame)
         // NULL out the Thread's pointer to the current ThreadLocalBlock. On the next
         // access to thread static data, the Thread's pointer to the current ThreadLocalBlock
         // will be updated correctly.
-        m_pThreadLocalBlock = NULL;
+        SetThreadLocalBlock(NULL);
 
         m_pDomain = pReturnDomain;
         SetAppDomain(pReturnDomain);
@@ -9047,6 +9049,16 @@ Frame * Thread::NotifyFrameChainOfExceptionUnwind(Frame* pStartFrame, LPVOID pvL
 // 
 //+----------------------------------------------------------------------------
 
+void Thread::SetThreadLocalBlock(PTR_ThreadLocalBlock pThreadLocalBlock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_pThreadLocalBlock = pThreadLocalBlock;
+
+    if (this == GetThreadNULLOk())
+        gCurrentThreadInfo.m_pThreadLocalBlock = pThreadLocalBlock;
+}
+
 void Thread::DeleteThreadStaticData()
 {
     CONTRACTL {
@@ -9058,9 +9070,11 @@ void Thread::DeleteThreadStaticData()
     // Deallocate the memory used by the table of ThreadLocalBlocks
     if (m_pThreadLocalBlock != NULL)
     {
-        m_pThreadLocalBlock->FreeTable();
-        delete m_pThreadLocalBlock;
-        m_pThreadLocalBlock = NULL;
+        ThreadLocalBlock * pTLB = m_pThreadLocalBlock;
+        SetThreadLocalBlock(NULL);
+
+        pTLB->FreeTable();
+        delete pTLB;
     }
 }
 
@@ -9104,7 +9118,7 @@ void Thread::DeleteThreadStaticData(AppDomain *pDomain)
     SIZE_T index = pDomain->GetIndex().m_dwIndex;
 
     ThreadLocalBlock * pTLB = m_pThreadLocalBlock;
-    m_pThreadLocalBlock = NULL;
+    SetThreadLocalBlock(NULL);
 
     if (pTLB != NULL)
     {
@@ -2746,6 +2746,12 @@ public:
         return m_State & (Thread::TS_TPWorkerThread | Thread::TS_CompletionPortThread);
     }
 
+    BOOL        IsThreadPoolWorkerThread()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_State & Thread::TS_TPWorkerThread;
+    }
+
     // public suspend functions.  System ones are internal, like for GC.  User ones
     // correspond to suspend/resume calls on the exposed System.Thread object.
     static bool    SysStartSuspendForDebug(AppDomain *pAppDomain);
@@ -4466,6 +4472,10 @@ public:
     
     PTR_ThreadLocalBlock m_pThreadLocalBlock;
 
+    // Updates m_pThreadLocalBlock, as well as the copy in gCurrentThreadInfo if this is the
+    // current thread. All updates after the thread has been set up must go through here.
+    void SetThreadLocalBlock(PTR_ThreadLocalBlock pThreadLocalBlock);
+
     // Called during AssemblyLoadContext teardown to clean up all structures
     // associated with thread statics for the specific Module
     void DeleteThreadStaticData(ModuleIndex index);
@@ -7279,8 +7289,15 @@ struct ThreadLocalInfo
     Thread* m_pThread;
     AppDomain* m_pAppDomain;
     void** m_EETlsData; // ClrTlsInfo::data
+    ThreadLocalBlock* m_pThreadLocalBlock; // Copy of m_pThread->m_pThreadLocalBlock
 };
 
+#ifndef DACCESS_COMPILE
+// Returns the current thread's ThreadLocalBlock, or NULL if it has not been allocated yet,
+// without going through the Thread object first.
+inline PTR_ThreadLocalBlock GetCurrentThreadLocalBlock();
+#endif
+
 class ThreadStateHolder
 {
 public:
@@ -39,6 +39,11 @@ EXTERN_C inline AppDomain* STDCALL GetAppDomain()
     return gCurrentThreadInfo.m_pAppDomain;
 }
 
+inline PTR_ThreadLocalBlock GetCurrentThreadLocalBlock()
+{
+    return gCurrentThreadInfo.m_pThreadLocalBlock;
+}
+
 #endif // !DACCESS_COMPILE
 
 inline void Thread::IncLockCount()
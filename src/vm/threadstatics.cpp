@@ -711,7 +711,7 @@ PTR_ThreadLocalBlock ThreadStatics::AllocateTLB(PTR_Thread pThread) //static
 
     // Allocate a new TLB and update this Thread's pointer to the current 
     // ThreadLocalBlock. Constructor zeroes out everything for us.
-    pThread->m_pThreadLocalBlock = new ThreadLocalBlock();
+    pThread->SetThreadLocalBlock(new ThreadLocalBlock());
 
     return pThread->m_pThreadLocalBlock;
 }
@@ -615,10 +615,12 @@ class ThreadStatics
 #ifndef DACCESS_COMPILE
     FORCEINLINE static PTR_ThreadLocalBlock GetCurrentTLBIfExists()
     {
-        // Get the current thread
-        PTR_Thread pThread = GetThread();
-    
-        return pThread->m_pThreadLocalBlock;
+        // Read the copy kept in thread local storage rather than loading the Thread first,
+        // this saves a dependent load on every thread static access
+        PTR_ThreadLocalBlock pThreadLocalBlock = GetCurrentThreadLocalBlock();
+        _ASSERTE(pThreadLocalBlock == GetThread()->m_pThreadLocalBlock);
+
+        return pThreadLocalBlock;
     }
 #endif
 
@@ -58,8 +58,11 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 
 // Every PING_JIT_TIMEOUT ms, check to see if a thread in JITted code has wandered
 // into some fully interruptible code (or should have a different hijack to improve
-// our chances of snagging it at a safe spot).
+// our chances of snagging it at a safe spot).  SuspendRuntime starts with
+// MIN_PING_JIT_TIMEOUT and doubles it each time the wait times out, so a thread that
+// just left the hijacked frame is retried quickly.
 #define PING_JIT_TIMEOUT        10
+#define MIN_PING_JIT_TIMEOUT    1
 
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
@@ -4215,6 +4218,21 @@ void __stdcall PauseAPC(__in ULONG_PTR dwParam)
 }
 
 
+// Reports how long a thread that was in cooperative mode when SuspendRuntime started took to
+// reach a GC safe point.  The time is when SuspendRuntime noticed, so it is an upper bound.
+static void FireThreadRendezvousEvent(Thread* thread, LARGE_INTEGER suspendStart)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LARGE_INTEGER now, frequency;
+    if (!QueryPerformanceCounter(&now) || !QueryPerformanceFrequency(&frequency))
+        return;
+
+    ULONGLONG elapsedUs = (ULONGLONG)(now.QuadPart - suspendStart.QuadPart) * 1000000 / frequency.QuadPart;
+    FireEtwGCSuspendEEThreadRendezvous((ULONGLONG)thread, thread->GetOSThreadId(),
+                                       (ULONG)min(elapsedUs, (ULONGLONG)UINT32_MAX), GetClrInstanceId());
+}
+
 //************************************************************************************
 //
 // SuspendRuntime is responsible for ensuring that all managed threads reach a
@@ -4279,6 +4297,14 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
     DWORD    res;
 
+    // How long to wait for a rendezvous before retrying hijacks and redirections
+    DWORD    pingTimeout = MIN_PING_JIT_TIMEOUT;
+
+    // Time-to-safepoint of each thread is only measured when someone is listening
+    LARGE_INTEGER suspendStart;
+    bool fTraceRendezvous = ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, GCSuspendEEThreadRendezvous) &&
+                            QueryPerformanceCounter(&suspendStart);
+
     // Caller is expected to be holding the ThreadStore lock.  Also, caller must
     // have set GcInProgress before coming here, or things will break;
     _ASSERTE(ThreadStore::HoldingThreadStore() || IsAtProcessExit());
@@ -4587,6 +4613,9 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 countThreads--;
                 thread->ResetThreadState(Thread::TS_GCSuspendPending);
 
+                if (fTraceRendezvous)
+                    FireThreadRendezvousEvent(thread, suspendStart);
+
                 // To ensure 0 CPU utilization for FAS (see implementation of PauseAPC)
                 // we queue the APC to all interruptable threads.
                 if(g_IsPaused && (thread->m_State & Thread::TS_Interruptible))
@@ -4641,17 +4670,12 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // return from the method we hijacked (maybe it calls into some other managed code that
         // executes a long loop, for example).  We we wait with a timeout, and retry hijacking/redirection.
         //
-        // This is unfortunate, because it means that in some cases we wait for PING_JIT_TIMEOUT
-        // milliseconds, causing long GC pause times.
-        //
-        // We should fix this, by calling SwitchToThread/Sleep(0) a few times before waiting on the event.
-        // This will not fix it 100% of the time (we may still have to wait on the event), but 
-        // the event is needed to work around limitations of SwitchToThread/Sleep(0).  
-        //
-        // For now, we simply wait.
+        // The first retry comes after MIN_PING_JIT_TIMEOUT milliseconds, and the timeout doubles
+        // up to PING_JIT_TIMEOUT while threads keep failing to rendezvous, so a thread in a loop
+        // without a safe point is redirected again quickly without spinning the suspending thread.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        res = g_pGCSuspendEvent->Wait(pingTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -4667,6 +4691,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+            pingTimeout = min(pingTimeout * 2, (DWORD)PING_JIT_TIMEOUT);
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
@@ -14,6 +14,7 @@
 #include "win32threadpool.h"
 #include "threadsuspend.h"
 #include "tieredcompilation.h"
+#include "runtimecounters.h"
 
 // TieredCompilationManager determines which methods should be recompiled and
 // how they should be recompiled to best optimize the running code. It then
@@ -38,17 +39,28 @@
 //
 // Methods initially call into OnMethodCalled() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
-// servicing our queue asynchronously then we use the runtime threadpool
-// QueueUserWorkItem to recruit one. During the callback for each threadpool work
+// be recompiled (m_methodsToOptimize). The queue is ordered by how quickly each
+// method reached the call count limit, so the hottest methods are optimized first.
+// While the queue holds more methods than there are threads servicing it (up to
+// TieredCompilation_BackgroundWorkerCount) we use the runtime threadpool
+// QueueUserWorkItem to recruit another one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
+// All threads but the last one stop early when the threadpool is saturated.
 //
 // The background thread enters at StaticOptimizeMethodsCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
-// 
+//
+// Code loaded from a ReadyToRun image is treated as tier0. The default native code
+// version of an eligible method uses the R2R entrypoint when one is available
+// (MethodDesc::GetPrecompiledR2RCode), calls from R2R code reach it through the
+// precode since its native code is not stable after init, and call counting runs
+// in the prestub as it does for jitted tier0 code. The tier1 code version is jitted
+// with VersionedPrepareCodeConfig, which never uses precompiled code, so hot R2R
+// methods get fully optimized code without the R2R version resilience limitations.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -65,11 +77,14 @@ TieredCompilationManager::TieredCompilationManager() :
     m_lock(CrstTieredCompilation),
     m_isAppDomainShuttingDown(FALSE),
     m_countOptimizationThreadsRunning(0),
+    m_maxOptimizationThreads(1),
     m_callCountOptimizationThreshhold(1),
     m_optimizationQuantumMs(50),
     m_methodsPendingCountingForTier1(nullptr),
     m_tieringDelayTimerHandle(nullptr),
-    m_tier1CallCountingCandidateMethodRecentlyRecorded(false)
+    m_tieringDelayStartTickCount(0),
+    m_countTier1CallCountingCandidateMethodsRecentlyRecorded(0),
+    m_isStartupComplete(false)
 {
     WRAPPER_NO_CONTRACT;
     // On Unix, we can reach here before EEConfig is initialized, so defer config-based initialization to Init()
@@ -89,6 +104,7 @@ void TieredCompilationManager::Init(ADID appDomainId)
     CrstHolder holder(&m_lock);
     m_domainId = appDomainId;
     m_callCountOptimizationThreshhold = g_pConfig->TieredCompilation_Tier1CallCountThreshold();
+    m_maxOptimizationThreads = g_pConfig->TieredCompilation_BackgroundWorkerCount();
 }
 
 #endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
@@ -129,9 +145,11 @@ bool TieredCompilationManager::RequiresCallCounting(MethodDesc* pMethodDesc)
 //
 // currentCallCount is pre-incremented, that is to say the value is 1 on first call for a given
 //      method.
+// firstCallTickCount is the tick count at the first counted call, used to prioritize promotion.
 void TieredCompilationManager::OnMethodCalled(
     MethodDesc* pMethodDesc,
     DWORD currentCallCount,
+    DWORD firstCallTickCount,
     BOOL* shouldStopCountingCallsRef,
     BOOL* wasPromotedToTier1Ref)
 {
@@ -144,7 +162,7 @@ void TieredCompilationManager::OnMethodCalled(
         // Stop call counting when the delay is in effect
         IsTieringDelayActive() ||
         // Initiate the delay on tier 0 activity (when a new eligible method is called the first time)
-        (currentCallCount == 1 && g_pConfig->TieredCompilation_Tier1CallCountingDelayMs() != 0) ||
+        (currentCallCount == 1 && g_pConfig->TieredCompilation_Tier1CallCountingDelayMs() != 0 && !m_isStartupComplete) ||
         // Stop call counting when ready for tier 1 promotion
         currentCallCount >= m_callCountOptimizationThreshhold;
 
@@ -152,7 +170,13 @@ void TieredCompilationManager::OnMethodCalled(
 
     if (currentCallCount == m_callCountOptimizationThreshhold)
     {
-        AsyncPromoteMethodToTier1(pMethodDesc);
+        DWORD elapsedMs = GetTickCount() - firstCallTickCount;
+        ULONGLONG callRate = (ULONGLONG)currentCallCount * 1000 / (elapsedMs == 0 ? 1 : elapsedMs);
+        if (callRate > MAXDWORD)
+        {
+            callRate = MAXDWORD;
+        }
+        AsyncPromoteMethodToTier1(pMethodDesc, (DWORD)callRate);
     }
 }
 
@@ -208,7 +232,7 @@ void TieredCompilationManager::OnMethodCallCountingStoppedWithoutTier1Promotion(
             if (!attemptedToInitiateDelay)
             {
                 // Delay call counting for currently recoded methods further
-                m_tier1CallCountingCandidateMethodRecentlyRecorded = true;
+                ++m_countTier1CallCountingCandidateMethodsRecentlyRecorded;
             }
         }
         return;
@@ -217,7 +241,9 @@ void TieredCompilationManager::OnMethodCallCountingStoppedWithoutTier1Promotion(
     ResumeCountingCalls(pMethodDesc);
 }
 
-void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc)
+// callRate is the number of calls per second observed while counting calls, methods with
+// higher rates are optimized first.
+void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, DWORD callRate)
 {
     STANDARD_VM_CONTRACT;
 
@@ -242,6 +268,14 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
                     pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName));
                 return;
             }
+
+            if (cur->IsJitSwitchedToOptimized())
+            {
+                // the tier0 jit request already produced optimized code
+                LOG((LF_TIEREDCOMPILATION, LL_INFO100000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s) ignoring method already jitted optimized\n",
+                    pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName));
+                return;
+            }
         }
 
         HRESULT hr = S_OK;
@@ -265,11 +299,10 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
     // unserviced. Synchronous retries appear unlikely to offer any material improvement 
     // and complicating the code to narrow an already rare error case isn't desirable.
     {
-        SListElem<NativeCodeVersion>* pMethodListItem = new (nothrow) SListElem<NativeCodeVersion>(t1NativeCodeVersion);
         CrstHolder holder(&m_lock);
-        if (pMethodListItem != NULL)
+        if (TryQueueMethodToOptimize(t1NativeCodeVersion, callRate))
         {
-            m_methodsToOptimize.InsertTail(pMethodListItem);
+            RuntimeCounters::Tier1MethodsQueuedCount.Increment();
         }
 
         LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
@@ -289,6 +322,15 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
     }
 }
 
+// Called when the host signals that its startup work is done (see CorHost2::NotifyStartupComplete), and
+// when the tiering delay reaches its limit. Tier 0 activity no longer delays call counting, and a delay
+// in effect ends at its next timer tick.
+void TieredCompilationManager::OnStartupComplete()
+{
+    LIMITED_METHOD_CONTRACT;
+    m_isStartupComplete = true;
+}
+
 void TieredCompilationManager::Shutdown()
 {
     STANDARD_VM_CONTRACT;
@@ -309,6 +351,11 @@ bool TieredCompilationManager::TryInitiateTieringDelay()
     _ASSERTE(g_pConfig->TieredCompilation());
     _ASSERTE(g_pConfig->TieredCompilation_Tier1CallCountingDelayMs() != 0);
 
+    if (m_isStartupComplete)
+    {
+        return false;
+    }
+
     NewHolder<SArray<MethodDesc*>> methodsPendingCountingHolder = new(nothrow) SArray<MethodDesc*>();
     if (methodsPendingCountingHolder == nullptr)
     {
@@ -376,6 +423,8 @@ bool TieredCompilationManager::TryInitiateTieringDelay()
         }
 
         m_methodsPendingCountingForTier1 = methodsPendingCountingHolder.Extract();
+        m_tieringDelayStartTickCount = GetTickCount();
+        m_countTier1CallCountingCandidateMethodsRecentlyRecorded = 0;
         _ASSERTE(IsTieringDelayActive());
     }
 
@@ -415,7 +464,7 @@ void TieredCompilationManager::TieringDelayTimerCallbackWorker()
     _ASSERTE(GetAppDomain()->GetId() == m_domainId);
 
     HANDLE tieringDelayTimerHandle;
-    bool tier1CallCountingCandidateMethodRecentlyRecorded;
+    bool extendTieringDelay;
     {
         // It's possible for the timer to tick before it is recorded that the delay is in effect. This lock guarantees that the
         // delay is in effect.
@@ -425,16 +474,24 @@ void TieredCompilationManager::TieringDelayTimerCallbackWorker()
         tieringDelayTimerHandle = m_tieringDelayTimerHandle;
         _ASSERTE(tieringDelayTimerHandle != nullptr);
 
-        tier1CallCountingCandidateMethodRecentlyRecorded = m_tier1CallCountingCandidateMethodRecentlyRecorded;
-        if (tier1CallCountingCandidateMethodRecentlyRecorded)
+        // Once the delay has reached its limit, treat startup as complete so that steady tier 0 activity doesn't keep
+        // initiating new delays either
+        DWORD maxDelayMs = g_pConfig->TieredCompilation_Tier1CallCountingMaxDelayMs();
+        if (maxDelayMs != 0 && GetTickCount() - m_tieringDelayStartTickCount >= maxDelayMs)
         {
-            m_tier1CallCountingCandidateMethodRecentlyRecorded = false;
+            m_isStartupComplete = true;
         }
+
+        // Only extend the delay for a burst of tier 0 activity (eligible methods being called the first time). A trickle of new
+        // methods, as from plugins or dynamic code generation, must not hold off tier 1 indefinitely.
+        extendTieringDelay =
+            m_countTier1CallCountingCandidateMethodsRecentlyRecorded >= g_pConfig->TieredCompilation_Tier1DelayActivityThreshold() &&
+            !m_isStartupComplete;
+        m_countTier1CallCountingCandidateMethodsRecentlyRecorded = 0;
     }
 
-    // Reschedule the timer if there has been recent tier 0 activity (when a new eligible method is called the first time) to
-    // further delay call counting
-    if (tier1CallCountingCandidateMethodRecentlyRecorded)
+    // Reschedule the timer if there has been enough recent tier 0 activity to further delay call counting
+    if (extendTieringDelay)
     {
         bool success = false;
         EX_TRY
@@ -596,11 +653,18 @@ void TieredCompilationManager::OptimizeMethods()
 
     ULONGLONG startTickCount = CLRGetTickCount64();
     NativeCodeVersion nativeCodeVersion;
+
+    // Activating takes the code version manager lock, which the prestub also takes to publish code. Activate
+    // compiled versions a batch at a time to take it less often.
+    NativeCodeVersion versionsToActivate[ActivationBatchSize];
+    COUNT_T countVersionsToActivate = 0;
+
     EX_TRY
     {
         GCX_PREEMP();
         while (true)
         {
+            bool recruitWorkerThread;
             {
                 CrstHolder holder(&m_lock);
 
@@ -610,14 +674,40 @@ void TieredCompilationManager::OptimizeMethods()
                     break;
                 }
 
+                // Leave the threadpool to other work when it has no threads to spare, as long
+                // as another thread is still servicing the queue
+                if (m_countOptimizationThreadsRunning > 1 && ThreadpoolMgr::AreWorkerThreadsSaturated())
+                {
+                    DecrementWorkerThreadCount();
+                    break;
+                }
+
                 nativeCodeVersion = GetNextMethodToOptimize();
                 if (nativeCodeVersion.IsNull())
                 {
                     DecrementWorkerThreadCount();
                     break;
                 }
+
+                // Recruit another thread if the queue is backed up
+                recruitWorkerThread = IncrementWorkerThreadCountIfNeeded();
+            }
+
+            if (recruitWorkerThread && !TryAsyncOptimizeMethods())
+            {
+                CrstHolder holder(&m_lock);
+                DecrementWorkerThreadCount();
+            }
+
+            if (OptimizeMethod(nativeCodeVersion))
+            {
+                versionsToActivate[countVersionsToActivate++] = nativeCodeVersion;
+                if (countVersionsToActivate == ActivationBatchSize)
+                {
+                    ActivateCodeVersions(versionsToActivate, countVersionsToActivate);
+                    countVersionsToActivate = 0;
+                }
             }
-            OptimizeMethod(nativeCodeVersion);
 
             // If we have been running for too long return the thread to the threadpool and queue another event
             // This gives the threadpool a chance to service other requests on this thread before returning to
@@ -645,19 +735,60 @@ void TieredCompilationManager::OptimizeMethods()
             GET_EXCEPTION()->GetHR(), nativeCodeVersion.GetMethodDesc());
     }
     EX_END_CATCH(RethrowTerminalExceptions);
+
+    // Activate the pending batch even if the loop above ended with an exception, otherwise the
+    // code already compiled for it would be wasted and the methods would stay at tier0
+    if (countVersionsToActivate != 0)
+    {
+        EX_TRY
+        {
+            GCX_PREEMP();
+            ActivateCodeVersions(versionsToActivate, countVersionsToActivate);
+        }
+        EX_CATCH
+        {
+            STRESS_LOG1(LF_TIEREDCOMPILATION, LL_ERROR, "TieredCompilationManager::OptimizeMethods: "
+                "Unhandled exception during code version activation, hr=0x%x\n",
+                GET_EXCEPTION()->GetHR());
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
 }
 
-// Jit compiles and installs new optimized code for a method.
+// Jit compiles new optimized code for a method. Returns TRUE if the code version
+// is ready to be activated.
 // Called on a background thread.
-void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion)
+BOOL TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion)
 {
     STANDARD_VM_CONTRACT;
 
     _ASSERTE(nativeCodeVersion.GetMethodDesc()->IsEligibleForTieredCompilation());
-    if (CompileCodeVersion(nativeCodeVersion))
+
+    LARGE_INTEGER startTime, endTime, frequency;
+    QueryPerformanceCounter(&startTime);
+    BOOL compiled = CompileCodeVersion(nativeCodeVersion);
+    QueryPerformanceCounter(&endTime);
+    if (QueryPerformanceFrequency(&frequency) && frequency.QuadPart != 0)
+    {
+        RuntimeCounters::Tier1JitTimeUs.Add((endTime.QuadPart - startTime.QuadPart) * 1000000 / frequency.QuadPart);
+    }
+
+    if (!compiled)
+    {
+        return FALSE;
+    }
+    RuntimeCounters::Tier1MethodsCompiledCount.Increment();
+
+#ifdef FEATURE_MULTICOREJIT
+    // Record the promotion so the next run can optimize the method at startup
+    MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+    if (mcJitManager.IsRecorderActive() && MulticoreJitManager::IsMethodSupported(nativeCodeVersion.GetMethodDesc()))
     {
-        ActivateCodeVersion(nativeCodeVersion);
+        mcJitManager.RecordMethodTier1Promotion(nativeCodeVersion.GetMethodDesc());
     }
+#endif
+
+    return TRUE;
 }
 
 // Compiles new optimized code for a method.
@@ -687,73 +818,164 @@ BOOL TieredCompilationManager::CompileCodeVersion(NativeCodeVersion nativeCodeVe
     return pCode != NULL;
 }
 
-// Updates the MethodDesc and precode so that future invocations of a method will
-// execute the native code pointed to by pCode.
+// Updates the MethodDescs and precodes so that future invocations of each method will
+// execute the native code of the corresponding code version. Consecutive versions that
+// share a code version manager are activated under a single acquisition of its lock.
 // Called on a background thread.
-void TieredCompilationManager::ActivateCodeVersion(NativeCodeVersion nativeCodeVersion)
+void TieredCompilationManager::ActivateCodeVersions(NativeCodeVersion* nativeCodeVersions, COUNT_T count)
 {
     STANDARD_VM_CONTRACT;
 
-    MethodDesc* pMethod = nativeCodeVersion.GetMethodDesc();
-    CodeVersionManager* pCodeVersionManager = pMethod->GetCodeVersionManager();
+    _ASSERTE(count <= ActivationBatchSize);
+    if (count == 0)
+    {
+        return;
+    }
 
     // If the ilParent version is active this will activate the native code version now.
     // Otherwise if the ilParent version becomes active again in the future the native
     // code version will activate then.
-    ILCodeVersion ilParent;
-    HRESULT hr = S_OK;
+    HRESULT hrs[ActivationBatchSize];
+    bool suspendRequired = false;
+    for (COUNT_T start = 0; start < count;)
     {
         // As long as we are exclusively using precode publishing for tiered compilation
         // methods this first attempt should succeed
+        CodeVersionManager* pCodeVersionManager = nativeCodeVersions[start].GetMethodDesc()->GetCodeVersionManager();
         CodeVersionManager::TableLockHolder lock(pCodeVersionManager);
-        ilParent = nativeCodeVersion.GetILCodeVersion();
-        hr = ilParent.SetActiveNativeCodeVersion(nativeCodeVersion, FALSE);
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersion Method=0x%pM (%s::%s), code version id=0x%x. SetActiveNativeCodeVersion ret=0x%x\n",
-            pMethod, pMethod->m_pszDebugClassName, pMethod->m_pszDebugMethodName,
-            nativeCodeVersion.GetVersionId(),
-            hr));
+        COUNT_T i = start;
+        for (; i < count && nativeCodeVersions[i].GetMethodDesc()->GetCodeVersionManager() == pCodeVersionManager; i++)
+        {
+            MethodDesc* pMethod = nativeCodeVersions[i].GetMethodDesc();
+            hrs[i] = nativeCodeVersions[i].GetILCodeVersion().SetActiveNativeCodeVersion(nativeCodeVersions[i], FALSE);
+            LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersions Method=0x%pM (%s::%s), code version id=0x%x. SetActiveNativeCodeVersion ret=0x%x\n",
+                pMethod, pMethod->m_pszDebugClassName, pMethod->m_pszDebugMethodName,
+                nativeCodeVersions[i].GetVersionId(),
+                hrs[i]));
+            suspendRequired = suspendRequired || hrs[i] == CORPROF_E_RUNTIME_SUSPEND_REQUIRED;
+        }
+        start = i;
     }
-    if (hr == CORPROF_E_RUNTIME_SUSPEND_REQUIRED)
+
+    if (suspendRequired)
     {
         // if we start using jump-stamp publishing for tiered compilation, the first attempt
         // without the runtime suspended will fail and then this second attempt will
-        // succeed.
-        // Even though this works performance is likely to be quite bad. Realistically
-        // we are going to need batched updates to makes tiered-compilation + jump-stamp
-        // viable. This fallback path is just here as a proof-of-concept.
+        // succeed. The whole batch shares one suspension.
         ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_FOR_REJIT);
+        for (COUNT_T i = 0; i < count; i++)
         {
-            CodeVersionManager::TableLockHolder lock(pCodeVersionManager);
-            hr = ilParent.SetActiveNativeCodeVersion(nativeCodeVersion, TRUE);
-            LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersion Method=0x%pM (%s::%s), code version id=0x%x. [Suspended] SetActiveNativeCodeVersion ret=0x%x\n",
+            if (hrs[i] != CORPROF_E_RUNTIME_SUSPEND_REQUIRED)
+            {
+                continue;
+            }
+
+            MethodDesc* pMethod = nativeCodeVersions[i].GetMethodDesc();
+            CodeVersionManager::TableLockHolder lock(pMethod->GetCodeVersionManager());
+            hrs[i] = nativeCodeVersions[i].GetILCodeVersion().SetActiveNativeCodeVersion(nativeCodeVersions[i], TRUE);
+            LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::ActivateCodeVersions Method=0x%pM (%s::%s), code version id=0x%x. [Suspended] SetActiveNativeCodeVersion ret=0x%x\n",
                 pMethod, pMethod->m_pszDebugClassName, pMethod->m_pszDebugMethodName,
-                nativeCodeVersion.GetVersionId(),
-                hr));
+                nativeCodeVersions[i].GetVersionId(),
+                hrs[i]));
         }
         ThreadSuspend::RestartEE(FALSE, TRUE);
     }
-    if (FAILED(hr))
+
+    for (COUNT_T i = 0; i < count; i++)
     {
-        STRESS_LOG2(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::ActivateCodeVersion: Method %pM failed to publish native code for native code version %d\n",
-            pMethod, nativeCodeVersion.GetVersionId());
+        if (FAILED(hrs[i]))
+        {
+            STRESS_LOG2(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::ActivateCodeVersions: Method %pM failed to publish native code for native code version %d\n",
+                nativeCodeVersions[i].GetMethodDesc(), nativeCodeVersions[i].GetVersionId());
+        }
     }
 }
 
-// Dequeues the next method in the optmization queue.
+// Adds a method to the optimization queue, ordered by its call rate.
+// This should be called with m_lock already held. Returns false if
+// the method could not be queued (presumably OOM).
+bool TieredCompilationManager::TryQueueMethodToOptimize(NativeCodeVersion nativeCodeVersion, DWORD callRate)
+{
+    STANDARD_VM_CONTRACT;
+
+    MethodToOptimize newItem;
+    newItem.nativeCodeVersion = nativeCodeVersion;
+    newItem.callRate = callRate;
+
+    bool success = false;
+    EX_TRY
+    {
+        m_methodsToOptimize.Append(newItem);
+        success = true;
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+    if (!success)
+    {
+        return false;
+    }
+
+    // Sift the new item up the heap
+    MethodToOptimize* items = m_methodsToOptimize.GetElements();
+    COUNT_T index = m_methodsToOptimize.GetCount() - 1;
+    while (index > 0)
+    {
+        COUNT_T parentIndex = (index - 1) / 2;
+        if (items[parentIndex].callRate >= newItem.callRate)
+        {
+            break;
+        }
+        items[index] = items[parentIndex];
+        index = parentIndex;
+    }
+    items[index] = newItem;
+    return true;
+}
+
+// Dequeues the method with the highest call rate from the optmization queue.
 // This should be called with m_lock already held and runs
 // on the background thread.
 NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
 {
     STANDARD_VM_CONTRACT;
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
-    if (pElem != NULL)
+    COUNT_T count = m_methodsToOptimize.GetCount();
+    if (count == 0)
+    {
+        return NativeCodeVersion();
+    }
+
+    MethodToOptimize* items = m_methodsToOptimize.GetElements();
+    NativeCodeVersion nativeCodeVersion = items[0].nativeCodeVersion;
+
+    // Move the last item to the root and sift it down the heap
+    count--;
+    MethodToOptimize lastItem = items[count];
+    COUNT_T index = 0;
+    while (true)
     {
-        NativeCodeVersion nativeCodeVersion = pElem->GetValue();
-        delete pElem;
-        return nativeCodeVersion;
+        COUNT_T childIndex = index * 2 + 1;
+        if (childIndex >= count)
+        {
+            break;
+        }
+        if (childIndex + 1 < count && items[childIndex + 1].callRate > items[childIndex].callRate)
+        {
+            childIndex++;
+        }
+        if (lastItem.callRate >= items[childIndex].callRate)
+        {
+            break;
+        }
+        items[index] = items[childIndex];
+        index = childIndex;
     }
-    return NativeCodeVersion();
+    items[index] = lastItem;
+    m_methodsToOptimize.SetCount(count);
+
+    return nativeCodeVersion;
 }
 
 bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
@@ -761,13 +983,14 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
+    // Only add a thread when there is more queued work than the running threads are about to take,
+    // and don't add to a saturated threadpool beyond the first thread
+    if (m_countOptimizationThreadsRunning < m_maxOptimizationThreads &&
         !m_isAppDomainShuttingDown &&
-        !m_methodsToOptimize.IsEmpty() &&
-        !IsTieringDelayActive())
+        m_methodsToOptimize.GetCount() > m_countOptimizationThreadsRunning &&
+        !IsTieringDelayActive() &&
+        (m_countOptimizationThreadsRunning == 0 || !ThreadpoolMgr::AreWorkerThreadsSaturated()))
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
         m_countOptimizationThreadsRunning++;
         return true;
     }
@@ -811,6 +1034,12 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
         !g_pConfig->TieredCompilation_OptimizeTier0())
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+
+        // Instrument tier0 code so that the tier1 compile knows which blocks are hot
+        if (g_pConfig->TieredPGO())
+        {
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+        }
     }
     else
     {
@@ -818,6 +1047,12 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
 #ifdef FEATURE_INTERPRETER
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_MAKEFINALCODE);
 #endif
+
+        // Optimize using the block counts collected by the instrumented tier0 code, if any
+        if (g_pConfig->TieredPGO())
+        {
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+        }
     }
     return flags;
 }
@@ -35,9 +35,10 @@ public:
 
 public:
     static bool RequiresCallCounting(MethodDesc* pMethodDesc);
-    void OnMethodCalled(MethodDesc* pMethodDesc, DWORD currentCallCount, BOOL* shouldStopCountingCallsRef, BOOL* wasPromotedToTier1Ref);
+    void OnMethodCalled(MethodDesc* pMethodDesc, DWORD currentCallCount, DWORD firstCallTickCount, BOOL* shouldStopCountingCallsRef, BOOL* wasPromotedToTier1Ref);
     void OnMethodCallCountingStoppedWithoutTier1Promotion(MethodDesc* pMethodDesc);
-    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc);
+    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, DWORD callRate = 0);
+    void OnStartupComplete();
     void Shutdown();
     static CORJIT_FLAGS GetJitFlags(NativeCodeVersion nativeCodeVersion);
 
@@ -53,10 +54,11 @@ private:
     static DWORD StaticOptimizeMethodsCallback(void* args);
     void OptimizeMethodsCallback();
     void OptimizeMethods();
-    void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
+    BOOL OptimizeMethod(NativeCodeVersion nativeCodeVersion);
+    bool TryQueueMethodToOptimize(NativeCodeVersion nativeCodeVersion, DWORD callRate);
     NativeCodeVersion GetNextMethodToOptimize();
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
-    void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
+    void ActivateCodeVersions(NativeCodeVersion* nativeCodeVersions, COUNT_T count);
 
     bool IncrementWorkerThreadCountIfNeeded();
     void DecrementWorkerThreadCount();
@@ -64,16 +66,30 @@ private:
     DWORD DebugGetWorkerThreadCount();
 #endif
 
+    // Compiled code versions are activated in batches of up to this many
+    static const COUNT_T ActivationBatchSize = 16;
+
+    // A method waiting to be optimized. Methods that were called more often while
+    // counting calls are optimized first.
+    struct MethodToOptimize
+    {
+        NativeCodeVersion nativeCodeVersion;
+        DWORD callRate; // calls per second
+    };
+
     Crst m_lock;
-    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    SArray<MethodToOptimize> m_methodsToOptimize; // binary max-heap on callRate
     ADID m_domainId;
     BOOL m_isAppDomainShuttingDown;
     DWORD m_countOptimizationThreadsRunning;
+    DWORD m_maxOptimizationThreads;
     DWORD m_callCountOptimizationThreshhold;
     DWORD m_optimizationQuantumMs;
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
     HANDLE m_tieringDelayTimerHandle;
-    bool m_tier1CallCountingCandidateMethodRecentlyRecorded;
+    DWORD m_tieringDelayStartTickCount;
+    DWORD m_countTier1CallCountingCandidateMethodsRecentlyRecorded;
+    Volatile<bool> m_isStartupComplete;
 
     CLREvent m_asyncWorkDoneEvent;
 
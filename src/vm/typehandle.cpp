@@ -22,6 +22,7 @@
 #include "typestring.h"
 #include "classloadlevel.h"
 #include "array.h"
+#include "castcache.h"
 #ifdef FEATURE_PREJIT 
 #include "zapsig.h"
 #endif
@@ -726,16 +727,26 @@ BOOL TypeHandle::CanCastTo(TypeHandle type, TypeHandlePairList *pVisited)  const
     if (*this == type)
         return(true);
 
+    CastResult cachedResult = CastCache::TryGet(*this, type);
+    if (cachedResult != MaybeCast)
+        return (cachedResult == CanCast);
+
+    BOOL result;
     if (IsTypeDesc())
-        return AsTypeDesc()->CanCastTo(type, pVisited);
-                
-    if (type.IsTypeDesc())
-        return(false);
+        result = AsTypeDesc()->CanCastTo(type, pVisited);
+    else if (type.IsTypeDesc())
+        result = FALSE;
+    else if (AsMethodTable()->IsTransparentProxy())
+        result = FALSE;
+    else
+        result = AsMethodTable()->CanCastToClassOrInterface(type.AsMethodTable(), pVisited);
 
-    if (AsMethodTable()->IsTransparentProxy())
-        return (false);
-        
-    return AsMethodTable()->CanCastToClassOrInterface(type.AsMethodTable(), pVisited);
+    // A result reached while already walking a cycle of variant types may have been cut
+    // short, so only top level results are cached
+    if (pVisited == NULL)
+        CastCache::TryAdd(*this, type, result);
+
+    return result;
 }
 
 #include <optsmallperfcritical.h>
@@ -746,16 +757,23 @@ TypeHandle::CastResult TypeHandle::CanCastToNoGC(TypeHandle type)  const
     if (*this == type)
         return(CanCast);
 
+    CastResult result = CastCache::TryGet(*this, type);
+    if (result != MaybeCast)
+        return result;
+
     if (IsTypeDesc())
-        return AsTypeDesc()->CanCastToNoGC(type);
-                
-    if (type.IsTypeDesc())
-        return(CannotCast);
+        result = AsTypeDesc()->CanCastToNoGC(type);
+    else if (type.IsTypeDesc())
+        result = CannotCast;
+    else if (AsMethodTable()->IsTransparentProxy())
+        result = CannotCast;
+    else
+        result = AsMethodTable()->CanCastToClassOrInterfaceNoGC(type.AsMethodTable());
 
-    if (AsMethodTable()->IsTransparentProxy())
-        return (CannotCast);
-        
-    return AsMethodTable()->CanCastToClassOrInterfaceNoGC(type.AsMethodTable());
+    if (result != MaybeCast)
+        CastCache::TryAdd(*this, type, result == CanCast);
+
+    return result;
 }
 #include <optdefault.h>
 
@@ -1102,8 +1102,7 @@ void TypeString::AppendMethodImpl(SString& ss, MethodDesc *pMD, Instantiation ty
         
         SString sss1(SString::Literal, NAMESPACE_SEPARATOR_STR);
         ss += sss1;
-        SString sss2(SString::Utf8, pMD->GetName());
-        ss += sss2;
+        ss.AppendUTF8(pMD->GetName());
 
         if (pMD->HasMethodInstantiation() && !pMD->IsGenericMethodDefinition())
         {
@@ -1116,8 +1115,7 @@ void TypeString::AppendMethodImpl(SString& ss, MethodDesc *pMD, Instantiation ty
             
             SigFormat sigFormatter(pMD, th);
             const char* sigStr = sigFormatter.GetCStringParmsOnly();
-            SString sss(SString::Utf8, sigStr);
-            ss += sss;
+            ss.AppendUTF8(sigStr);
         }
         
         if (format & FormatStubInfo) {
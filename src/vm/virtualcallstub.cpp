@@ -32,6 +32,7 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_poly_dispatch = 0;  //# of call site backpatch writes to add a polymorphic dispatch stub
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
@@ -105,6 +106,9 @@ UINT32 STUB_COLLIDE_WRITE_PCT = 100;
 UINT32 STUB_COLLIDE_MONO_PCT  =   0;
 #endif // STUB_LOGGING
 
+// Maximum number of dispatch stubs chained at a call site before it is switched to the resolve stub
+UINT32 g_maxPolymorphicDispatchStubs = 4;
+
 FastTable* BucketTable::dead = NULL;    //linked list of the abandoned buckets
 
 DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line lookup by resolve stubs.
@@ -226,6 +230,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly_dispatch", g_site_write_poly_dispatch);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), "\r\n%-30s %d\r\n", "reclaim_counter", g_reclaim_counter);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -872,6 +878,8 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    g_maxPolymorphicDispatchStubs = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_VirtualCallStubPolymorphicDispatchStubs);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -1440,8 +1448,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     if (kind == SK_DISPATCH)
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
-        DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = pMgr->GetResolveHolderForDispatchStub(stub);
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1936,6 +1943,14 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                         }
                     }
                 }
+
+                // A dispatch stub at this call site missed on a type that is not in the resolve
+                // cache yet. Check that type inline at this site as well, so that call sites that
+                // only ever see a few types do not end up probing the resolve cache on every call.
+                if (stubKind == SK_DISPATCH && bCreateDispatchStub)
+                {
+                    TryAddPolymorphicDispatchStub(pCallSite, objectType, token, target);
+                }
             }
             else
             {
@@ -2549,20 +2564,26 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
     if (isDispatchingStub(callSiteTarget))
     {
         DispatchHolder * dispatchHolder = DispatchHolder::FromDispatchEntry(callSiteTarget);
-        DispatchStub *   dispatchStub   = dispatchHolder->stub();
 
         //yes, patch it to point to the resolve stub
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
         //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
-        ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
+        UINT32 dispatchStubCount;
+        ResolveStub* resolveStub  = GetResolveHolderForDispatchStub(callSiteTarget, &dispatchStubCount)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
 
         LOG((LF_STUBS, LL_INFO10000, "BackPatchWorker call-site" FMT_ADDR "dispatchStub" FMT_ADDR "\n",
              DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(dispatchHolder->stub())));
 
+        // Report the site so that megamorphic call sites can be found in traces
+        FireEtwStubDispatchSiteMegamorphic(GetClrInstanceId(),
+                                           (ULONGLONG)dac_cast<TADDR>(pCallSite->GetIndirectCell()),
+                                           (ULONGLONG)pCallSite->GetReturnAddress(),
+                                           (ULONGLONG)resolveStub->token(),
+                                           dispatchStubCount);
+
         //Add back the default miss count to the counter being used by this resolve stub
         //Since resolve stub are shared among many dispatch stubs each dispatch stub
         //that fails decrements the shared counter and the dispatch stub that trips the
@@ -2572,6 +2593,77 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
     }
 }
 
+//----------------------------------------------------------------------------
+/* Make a polymorphic site out of a dispatching call site by chaining a new dispatch stub for
+objectType in front of the ones already there. The new stub fails over to the stub the site
+currently points to, so the chain still ends in the resolve stub's fail entry and the miss
+counter only sees calls that missed every type checked inline. The chained stubs are specific
+to the site and are therefore not added to the dispatchers table.
+*/
+void VirtualCallStubManager::TryAddPolymorphicDispatchStub(StubCallSite* pCallSite,
+                                                           MethodTable*  objectType,
+                                                           DispatchToken token,
+                                                           PCODE         target)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(CheckPointer(objectType));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+
+    // The site may have been backpatched to the resolve stub on the way here
+    if (!isDispatchingStub(prior))
+        return;
+
+    UINT32 dispatchStubCount;
+    GetResolveHolderForDispatchStub(prior, &dispatchStubCount);
+    if (dispatchStubCount >= g_maxPolymorphicDispatchStubs)
+        return;
+
+    DispatchHolder *pDispatchHolder = GenerateDispatchStub(target, prior, objectType, token.To_SIZE_T());
+    PCODE stub = pDispatchHolder->stub()->entryPoint();
+
+    // If another thread changed the site in the meantime leave its change in place, the
+    // stub we just generated is simply never used
+    PTR_PCODE pCell = pCallSite->GetIndirectCell();
+    if (EnsureWritablePagesNoThrow(pCell, sizeof(PCODE)) &&
+        InterlockedCompareExchangeT(pCell, stub, prior) == prior)
+    {
+        stats.site_write_poly_dispatch++;
+        stats.site_write++;
+    }
+}
+
+//----------------------------------------------------------------------------
+ResolveHolder *VirtualCallStubManager::GetResolveHolderForDispatchStub(PCODE dispatchEntry, UINT32 *pDispatchStubCount)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(isDispatchingStub(dispatchEntry));
+    } CONTRACTL_END
+
+    UINT32 count = 0;
+    PCODE entry = dispatchEntry;
+    do
+    {
+        entry = DispatchHolder::FromDispatchEntry(entry)->stub()->failTarget();
+        count++;
+    } while (isDispatchingStub(entry));
+
+    if (pDispatchStubCount != NULL)
+    {
+        *pDispatchStubCount = count;
+    }
+    return ResolveHolder::FromFailEntry(entry);
+}
+
 //----------------------------------------------------------------------------
 /* consider changing the call site to point to stub, if appropriate do it
 */
@@ -2998,6 +3090,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly_dispatch", stats.site_write_poly_dispatch);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), "\r\nstub data\r\n");
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -3038,6 +3132,7 @@ void VirtualCallStubManager::LogStats()
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_poly_dispatch += stats.site_write_poly_dispatch;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -3052,6 +3147,7 @@ void VirtualCallStubManager::LogStats()
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_poly_dispatch = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
@@ -563,6 +563,13 @@ public:
     PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind);
     void BackPatchWorker(StubCallSite* pCallSite);
 
+    // Puts a dispatch stub for objectType in front of the dispatch stubs already at the call site
+    void TryAddPolymorphicDispatchStub(StubCallSite* pCallSite, MethodTable* objectType, DispatchToken token, PCODE target);
+
+    // Follows the failure path of the chain of dispatch stubs starting at dispatchEntry to the
+    // resolve stub it ends in, optionally counting the dispatch stubs on the way
+    ResolveHolder *GetResolveHolderForDispatchStub(PCODE dispatchEntry, UINT32 *pDispatchStubCount = NULL);
+
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
@@ -761,6 +768,7 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_poly_dispatch;//# of call site backpatch writes to add a polymorphic dispatch stub
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
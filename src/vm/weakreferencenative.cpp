@@ -576,6 +576,9 @@ FCIMPLEND
 
 #include <optsmallperfcritical.h>
 
+// Number of times GetWeakReferenceTarget retries the lock-free read before taking the spin lock
+static const DWORD SpeculativeReadRetries = 8;
+
 static FORCEINLINE OBJECTREF GetWeakReferenceTarget(WEAKREFERENCEREF pThis)
 {
     CONTRACTL
@@ -587,38 +590,50 @@ static FORCEINLINE OBJECTREF GetWeakReferenceTarget(WEAKREFERENCEREF pThis)
     }
     CONTRACTL_END;
 
-    OBJECTHANDLE rawHandle = pThis->m_Handle.LoadWithoutBarrier();
-    OBJECTHANDLE handle = GetHandleValue(rawHandle);
-
-    if (handle == NULL)
-        return NULL;
-
-    // Try a speculative lock-free read first
-    if (rawHandle != SPECIAL_HANDLE_SPINLOCK)
-    {
-        //
-        // There is a theoretic chance that the speculative lock-free read may AV while reading the value 
-        // of freed handle if the handle table decides to release the memory that the handle lives in. 
-        // It is not exploitable security issue because of we will fail fast on the AV. It is denial of service only. 
-        // Non-malicious user code will never hit.
-        //
-        // We had this theoretical bug in there since forever. Fixing it by always taking the lock would 
-        // degrade the performance critical weak handle getter several times. The right fix may be
-        // to ensure that handle table memory is released only if the runtime is suspended.
-        //
-        Object * pSpeculativeTarget = VolatileLoad((Object **)(handle));
-
-        //
-        // We want to ensure that the handle was still alive when we fetched the target,
-        // so we double check m_handle here. Note that the reading of the handle
-        // value has to take memory barrier for this to work, but reading of m_handle does not.
-        //
-        if (rawHandle == pThis->m_Handle.LoadWithoutBarrier())
+    OBJECTHANDLE rawHandle;
+    OBJECTHANDLE handle;
+
+    // Try a speculative lock-free read first. If a writer holds the spin lock, wait a little
+    // for it to go away and retry rather than acquiring the lock, so that concurrent readers
+    // don't serialize behind each other or write to the WeakReference's cache line.
+    for (DWORD retry = 0; ; retry++)
+    {
+        rawHandle = pThis->m_Handle.LoadWithoutBarrier();
+        handle = GetHandleValue(rawHandle);
+
+        if (handle == NULL)
+            return NULL;
+
+        if (rawHandle != SPECIAL_HANDLE_SPINLOCK)
         {
-            return OBJECTREF(pSpeculativeTarget);
+            //
+            // There is a theoretic chance that the speculative lock-free read may AV while reading the value 
+            // of freed handle if the handle table decides to release the memory that the handle lives in. 
+            // It is not exploitable security issue because of we will fail fast on the AV. It is denial of service only. 
+            // Non-malicious user code will never hit.
+            //
+            // We had this theoretical bug in there since forever. Fixing it by always taking the lock would 
+            // degrade the performance critical weak handle getter several times. The right fix may be
+            // to ensure that handle table memory is released only if the runtime is suspended.
+            //
+            Object * pSpeculativeTarget = VolatileLoad((Object **)(handle));
+
+            //
+            // We want to ensure that the handle was still alive when we fetched the target,
+            // so we double check m_handle here. Note that the reading of the handle
+            // value has to take memory barrier for this to work, but reading of m_handle does not.
+            //
+            if (rawHandle == pThis->m_Handle.LoadWithoutBarrier())
+            {
+                return OBJECTREF(pSpeculativeTarget);
+            }
         }
-    }
 
+        if (retry >= SpeculativeReadRetries)
+            break;
+
+        YieldProcessor();
+    }
 
     rawHandle = AcquireWeakHandleSpinLock(pThis);
     GCX_NOTRIGGER();
@@ -106,6 +106,7 @@ LARGE_INTEGER ThreadpoolMgr::CurrentSampleStartTime;
 unsigned int ThreadpoolMgr::WorkerThreadSpinLimit;
 bool ThreadpoolMgr::IsHillClimbingDisabled;
 int ThreadpoolMgr::ThreadAdjustmentInterval;
+DWORD ThreadpoolMgr::QueueBacklogStartTime;
 
 #define INVALID_HANDLE ((HANDLE) -1)
 #define NEW_THREAD_THRESHOLD            7       // Number of requests outstanding before we start a new thread
@@ -126,7 +127,8 @@ DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) int ThreadpoolMgr::offset_counter = 0;
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestHead);        // Head of work request queue
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestTail);        // Head of work request queue
 
-SVAL_IMPL(ThreadpoolMgr::LIST_ENTRY,ThreadpoolMgr,TimerQueue);  // queue of timers
+ThreadpoolMgr::TimerWheel ThreadpoolMgr::ActiveTimers;
+SVAL_IMPL_INIT(LONG,ThreadpoolMgr,NumActiveTimers,0);
 
 //unsigned int ThreadpoolMgr::LastCpuSamplingTime=0;      //  last time cpu utilization was sampled by gate thread
 unsigned int ThreadpoolMgr::LastCPThreadCreation=0;     //  last time a completion port thread was created
@@ -158,6 +160,9 @@ DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) LONG  ThreadpoolMgr::GateThreadStatus=GATE_T
 // Move out of from preceeding variables' cache line
 DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) ThreadpoolMgr::RecycledListsWrapper ThreadpoolMgr::RecycledLists;
 
+ThreadpoolMgr::WorkerLocalQueue* ThreadpoolMgr::WorkerLocalQueues = NULL;
+unsigned int ThreadpoolMgr::NumWorkerLocalQueues;
+
 ThreadpoolMgr::TimerInfo *ThreadpoolMgr::TimerInfosToBeRecycled = NULL;
 
 BOOL ThreadpoolMgr::IsApcPendingOnWaitThread = FALSE;
@@ -348,7 +353,14 @@ BOOL ThreadpoolMgr::Initialize()
     //ThreadPool_CPUGroup
     CPUGroupInfo::EnsureInitialized();
     if (CPUGroupInfo::CanEnableGCCPUGroups() && CPUGroupInfo::CanEnableThreadUseAllCpuGroups())
+    {
         NumberOfProcessors = CPUGroupInfo::GetNumActiveProcessors();
+
+        // GetCurrentProcessCpuCount applies the CPU time limit, do the same for the processors of all the groups
+        DWORD cpuLimit;
+        if (GetCurrentProcessCpuLimit(&cpuLimit) && cpuLimit < NumberOfProcessors)
+            NumberOfProcessors = cpuLimit;
+    }
     else
         NumberOfProcessors = GetCurrentProcessCpuCount();
     InitPlatformVariables();
@@ -358,6 +370,18 @@ BOOL ThreadpoolMgr::Initialize()
         WorkerThreadSpinLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UnfairSemaphoreSpinLimit);
         IsHillClimbingDisabled = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_Disable) != 0;
         ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_SampleIntervalLow);
+
+        DWORD timerTickMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_TimerCoalescingMs);
+        if (timerTickMs == 0)
+            timerTickMs = 1;
+
+        MaxBlockingCompensationThreads = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_MaxBlockingCompensationThreads);
+        if (MaxBlockingCompensationThreads <= 0)
+            MaxBlockingCompensationThreads = NumberOfProcessors;
+
+        // AppX processes want idle threads to exit before the app is suspended, so they get no parked threads
+        NumPrewarmedWorkerThreads = AppX::IsAppXProcess() ? 0 :
+            (int)min(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_PrewarmedWorkerThreads), (DWORD)ThreadCounter::MaxPossibleCount);
         
         pADTPCount->InitResources();
         WorkerCriticalSection.Init(CrstThreadpoolWorker);
@@ -367,8 +391,8 @@ BOOL ThreadpoolMgr::Initialize()
         // initialize WaitThreadsHead
         InitializeListHead(&WaitThreadsHead);
 
-        // initialize TimerQueue
-        InitializeListHead(&TimerQueue);
+        // initialize the timer wheel
+        ActiveTimers.Initialize(GetTickCount(), timerTickMs);
 
         RetiredCPWakeupEvent = new CLREvent();
         RetiredCPWakeupEvent->CreateAutoEvent(FALSE);
@@ -385,6 +409,14 @@ BOOL ThreadpoolMgr::Initialize()
             RecycledLists.Initialize( CPUGroupInfo::GetNumActiveProcessors() );
         else
             RecycledLists.Initialize( g_SystemInfo.dwNumberOfProcessors );
+
+        // A single processor gains nothing from local queues, everything would go through one queue anyway
+        if (NumberOfProcessors > 1 &&
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerLocalQueues) != 0)
+        {
+            NumWorkerLocalQueues = NumberOfProcessors;
+            WorkerLocalQueues = new WorkerLocalQueue[NumWorkerLocalQueues];
+        }
         /*
             {
                 SYSTEM_INFO sysInfo;
@@ -702,6 +734,21 @@ BOOL ThreadpoolMgr::GetAvailableThreads(DWORD* AvailableWorkerThreads,
     return TRUE;
 }
 
+// Returns true when as many worker threads are working as the thread injection
+// algorithm currently allows, so new work items would have to wait for a thread.
+bool ThreadpoolMgr::AreWorkerThreadsSaturated()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!IsInitialized())
+    {
+        return false;
+    }
+
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    return counts.NumWorking >= counts.MaxWorking;
+}
+
 void QueueUserWorkItemHelp(LPTHREAD_START_ROUTINE Function, PVOID Context)
 {
     STATIC_CONTRACT_THROWS;
@@ -947,11 +994,40 @@ void ThreadpoolMgr::AdjustMaxWorkersActive()
     {
         ThreadCounter::Counts currentCounts = WorkerCounter.GetCleanCounts();
 
-        int newMax = HillClimbingInstance.Update(
-            currentCounts.MaxWorking, 
-            elapsed, 
-            numCompletions,
-            &ThreadAdjustmentInterval);
+        int newMax;
+        if (HillClimbingInstance.UseQueueLatencyController())
+        {
+            //
+            // Work has been waiting since the first sample that found requests that no worker had picked up
+            //
+            DWORD queueBacklogMs = 0;
+            if (PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+            {
+                if (QueueBacklogStartTime == 0)
+                    QueueBacklogStartTime = max(currentTicks, (DWORD)1);
+                else
+                    queueBacklogMs = currentTicks - QueueBacklogStartTime;
+            }
+            else
+            {
+                QueueBacklogStartTime = 0;
+            }
+
+            newMax = HillClimbingInstance.UpdateForQueueLatency(
+                currentCounts.MaxWorking, 
+                elapsed, 
+                numCompletions,
+                queueBacklogMs,
+                &ThreadAdjustmentInterval);
+        }
+        else
+        {
+            newMax = HillClimbingInstance.Update(
+                currentCounts.MaxWorking, 
+                elapsed, 
+                numCompletions,
+                &ThreadAdjustmentInterval);
+        }
 
         while (newMax != currentCounts.MaxWorking)
         {
@@ -1085,6 +1161,130 @@ void ThreadpoolMgr::MaybeAddWorkingWorker()
     }
 }
 
+int ThreadpoolMgr::NumBlockedWorkerThreads;
+int ThreadpoolMgr::NumBlockingCompensationThreads;
+int ThreadpoolMgr::MaxBlockingCompensationThreads;
+int ThreadpoolMgr::NumPrewarmedWorkerThreads;
+LONGLONG ThreadpoolMgr::TotalBlockedTimeMs;
+LONG ThreadpoolMgr::QueueLatencyHistogram[ThreadpoolMgr::QueueLatencyBucketCount];
+
+void ThreadpoolMgr::NotifyWorkerThreadBlocked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        if (GetThread()) { GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsInitialized());
+
+    DangerousNonHostedSpinLockHolder tal(&ThreadAdjustmentLock);
+
+    NumBlockedWorkerThreads++;
+    if (NumBlockingCompensationThreads >= MaxBlockingCompensationThreads)
+    {
+        // Past the limit it is up to starvation detection in the gate thread to add threads
+        return;
+    }
+
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    while (counts.MaxWorking < MaxLimitTotalWorkerThreads)
+    {
+        ThreadCounter::Counts newCounts = counts;
+        newCounts.MaxWorking = counts.MaxWorking + 1;
+
+        ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
+        if (oldCounts == counts)
+        {
+            // Release a worker right away to take the place of the blocked one
+            NumBlockingCompensationThreads++;
+            HillClimbingInstance.ForceChange(newCounts.MaxWorking, CooperativeBlocking);
+            MaybeAddWorkingWorker();
+            break;
+        }
+
+        counts = oldCounts;
+    }
+}
+
+void ThreadpoolMgr::NotifyWorkerThreadUnblocked(DWORD blockedTimeMs)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    FastInterlockExchangeAddLong(&TotalBlockedTimeMs, (LONGLONG)blockedTimeMs);
+
+    DangerousNonHostedSpinLockHolder tal(&ThreadAdjustmentLock);
+
+    _ASSERTE(NumBlockedWorkerThreads > 0);
+    NumBlockedWorkerThreads--;
+    if (NumBlockingCompensationThreads <= NumBlockedWorkerThreads)
+    {
+        // The other blocked workers still account for all of the compensation
+        return;
+    }
+
+    NumBlockingCompensationThreads--;
+
+    // Take back the compensation for this thread. Whichever workers notice that there are now too many active threads
+    // first will retire themselves (see ShouldWorkerKeepRunning).
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    while (true)
+    {
+        ThreadCounter::Counts newCounts = counts;
+        newCounts.MaxWorking = max(MinLimitTotalWorkerThreads, counts.MaxWorking - 1);
+        if (newCounts == counts)
+        {
+            break;
+        }
+
+        ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
+        if (oldCounts == counts)
+        {
+            HillClimbingInstance.ForceChange(newCounts.MaxWorking, CooperativeBlocking);
+            break;
+        }
+
+        counts = oldCounts;
+    }
+}
+
+void ThreadpoolMgr::GetCounters(ThreadPoolCounters* pCounters)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pCounters != NULL);
+
+    // Each counter is read on its own, so the snapshot is not consistent across counters but never takes a lock
+    pCounters->NativeQueueLength = (DWORD)PerAppDomainTPCountList::GetUnmanagedTPCount()->GetNumRequests();
+
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    pCounters->ActiveWorkerThreads = (DWORD)counts.NumActive;
+    pCounters->WorkingWorkerThreads = (DWORD)counts.NumWorking;
+    pCounters->BlockedWorkerThreads = (DWORD)max(VolatileLoad(&NumBlockedWorkerThreads), 0);
+
+    pCounters->CompletedWorkItems = (DWORD)VolatileLoad(&PriorCompletedWorkRequests);
+    pCounters->CompletedWorkItemsTime = VolatileLoad(&PriorCompletedWorkRequestsTime);
+
+    pCounters->BlockedTimeMs = (ULONGLONG)FastInterlockCompareExchangeLong(&TotalBlockedTimeMs, 0, 0);
+
+    for (int i = 0; i < QueueLatencyBucketCount; i++)
+        pCounters->QueueLatency[i] = (DWORD)VolatileLoad(&QueueLatencyHistogram[i]);
+}
+
 BOOL ThreadpoolMgr::PostQueuedCompletionStatus(LPOVERLAPPED lpOverlapped,
                                       LPOVERLAPPED_COMPLETION_ROUTINE Function)
 {
@@ -1507,6 +1707,99 @@ WorkRequest* ThreadpoolMgr::DequeueWorkRequest()
     RETURN entry;
 }
 
+//************************************************************************
+// Work requests queued from a worker thread are pushed onto the local queue of the processor the worker
+// is running on and are popped in LIFO order, so a callback that queues more work tends to have it run
+// next on the same processor while its data is still in the cache. That also keeps workers that feed
+// themselves off the lock of the global queue. Workers look at their own local queue first, then at the
+// global FIFO queue, and only then steal from the local queues of the other processors.
+//
+// Returns false if the request has to go to the global queue instead.
+bool ThreadpoolMgr::TryPushLocalWorkRequest(WorkRequest* workRequest)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (WorkerLocalQueues == NULL)
+        return false;
+
+    Thread* pThread = GetThread();
+    if (pThread == NULL || !pThread->IsThreadPoolWorkerThread())
+        return false;
+
+    WorkerLocalQueue* pQueue = GetCurrentWorkerLocalQueue();
+
+    DangerousNonHostedSpinLockHolder lh(&pQueue->lock);
+    workRequest->next = pQueue->head;
+    pQueue->head = workRequest;
+    return true;
+}
+
+WorkRequest* ThreadpoolMgr::PopLocalWorkRequest()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (WorkerLocalQueues == NULL)
+        return NULL;
+
+    WorkerLocalQueue* pQueue = GetCurrentWorkerLocalQueue();
+    if (pQueue->head == NULL)
+        return NULL;
+
+    DangerousNonHostedSpinLockHolder lh(&pQueue->lock);
+    WorkRequest* entry = pQueue->head;
+    if (entry != NULL)
+    {
+        pQueue->head = entry->next;
+        entry->next = NULL;
+    }
+    return entry;
+}
+
+WorkRequest* ThreadpoolMgr::StealLocalWorkRequest()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (WorkerLocalQueues == NULL)
+        return NULL;
+
+    // Start with the queue after our own, so that workers looking for work spread out over the other queues
+    unsigned int start = (unsigned int)(GetCurrentWorkerLocalQueue() - WorkerLocalQueues);
+    for (unsigned int i = 1; i < NumWorkerLocalQueues; i++)
+    {
+        WorkerLocalQueue* pQueue = &WorkerLocalQueues[(start + i) % NumWorkerLocalQueues];
+        if (pQueue->head == NULL)
+            continue;
+
+        DangerousNonHostedSpinLockHolder lh(&pQueue->lock);
+        WorkRequest* entry = pQueue->head;
+        if (entry != NULL)
+        {
+            pQueue->head = entry->next;
+            entry->next = NULL;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
 DWORD WINAPI ThreadpoolMgr::ExecuteHostRequest(PVOID pArg)
 {
     CONTRACTL
@@ -1863,7 +2156,7 @@ Thread* ThreadpoolMgr::CreateUnimpersonatedThread(LPTHREAD_START_ROUTINE lpStart
 }
 
 
-BOOL ThreadpoolMgr::CreateWorkerThread()
+BOOL ThreadpoolMgr::CreateWorkerThread(BOOL startRetired)
 {
     CONTRACTL
     {
@@ -1875,7 +2168,7 @@ BOOL ThreadpoolMgr::CreateWorkerThread()
 
     Thread *pThread;
     BOOL fIsCLRThread;
-    if ((pThread = CreateUnimpersonatedThread(WorkerThreadStart, NULL, &fIsCLRThread)) != NULL)
+    if ((pThread = CreateUnimpersonatedThread(WorkerThreadStart, (LPVOID)(SIZE_T)startRetired, &fIsCLRThread)) != NULL)
     {
         if (fIsCLRThread) {
             pThread->ChooseThreadCPUGroupAffinity();
@@ -1894,6 +2187,37 @@ BOOL ThreadpoolMgr::CreateWorkerThread()
     return FALSE;
 }
 
+// Creates the pre-warmed worker threads. Each one sets up its Thread object and then waits on
+// RetiredWorkerSemaphore like a retired worker, so MaybeAddWorkingWorker can unretire it instead
+// of creating a thread. Parked threads do not time out while there are no more of them than
+// NumPrewarmedWorkerThreads.
+void ThreadpoolMgr::PrewarmWorkerThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // Threads started before EE startup would park without a Thread object, which is what
+    // pre-warming is meant to avoid
+    if (!g_fEEStarted)
+        return;
+
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    int toCreate = min(NumPrewarmedWorkerThreads - counts.NumRetired,
+                       MaxLimitTotalWorkerThreads - (counts.NumActive + counts.NumRetired));
+
+    // The threads count themselves as retired once they are set up, and exit if there are already enough
+    for (int i = 0; i < toCreate; i++)
+    {
+        if (!CreateWorkerThread(TRUE))
+            break;
+    }
+}
+
 
 DWORD WINAPI ThreadpoolMgr::WorkerThreadStart(LPVOID lpArgs)
 {
@@ -1914,6 +2238,7 @@ DWORD WINAPI ThreadpoolMgr::WorkerThreadStart(LPVOID lpArgs)
 
     ThreadCounter::Counts counts, oldCounts, newCounts;
     bool foundWork = true, wasNotRecalled = true;
+    bool startRetired = lpArgs != NULL;
 
     counts = WorkerCounter.GetCleanCounts();
     FireEtwThreadPoolWorkerThreadStart(counts.NumActive, counts.NumRetired, GetClrInstanceId());
@@ -1946,6 +2271,10 @@ Work:
             #ifdef FEATURE_COMINTEROP
             if (pThread->SetApartment(Thread::AS_InMTA, TRUE) != Thread::AS_InMTA)
             {
+                // A pre-warmed thread has not been counted yet
+                if (startRetired)
+                    goto Exit;
+
                 // counts volatile read paired with CompareExchangeCounts loop set
                 counts = WorkerCounter.DangerousGetDirtyCounts();
                 while (true)
@@ -1970,6 +2299,29 @@ Work:
     GCX_PREEMP_NO_DTOR();
     _ASSERTE(pThread == NULL || !pThread->PreemptiveGCDisabled());
 
+    if (startRetired)
+    {
+        startRetired = false;
+
+        // counts volatile read paired with CompareExchangeCounts loop set
+        counts = WorkerCounter.DangerousGetDirtyCounts();
+        while (true)
+        {
+            if (counts.NumRetired >= NumPrewarmedWorkerThreads ||
+                counts.NumActive + counts.NumRetired >= MaxLimitTotalWorkerThreads)
+                goto Exit;
+
+            newCounts = counts;
+            newCounts.NumRetired++;
+
+            oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
+            if (oldCounts == counts)
+                goto Retire;
+
+            counts = oldCounts;
+        }
+    }
+
     // make sure there's really work.  If not, go back to sleep
 
     // counts volatile read paired with CompareExchangeCounts loop set
@@ -2100,7 +2452,8 @@ RetryRetire:
             counts = WorkerCounter.DangerousGetDirtyCounts();
             while (true)
             {
-                if (counts.NumRetired == 0)
+                // Keep the pre-warmed threads parked
+                if (counts.NumRetired == 0 || counts.NumRetired <= NumPrewarmedWorkerThreads)
                     goto RetryRetire;
 
                 newCounts = counts;
@@ -4201,6 +4554,8 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
     
     BOOL IgnoreNextSample = FALSE;
 
+    PrewarmWorkerThreads();
+
     do
     {
         timer.Wait();
@@ -4208,6 +4563,26 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
         if(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking))
             FireEtwThreadPoolWorkingThreadCount(TakeMaxWorkingThreadCount(), GetClrInstanceId());
 
+        if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolWorkerThreadAdjustmentCounters))
+        {
+            ThreadPoolCounters counters;
+            GetCounters(&counters);
+            FireEtwThreadPoolWorkerThreadAdjustmentCounters(
+                counters.NativeQueueLength,
+                counters.ActiveWorkerThreads,
+                counters.WorkingWorkerThreads,
+                counters.BlockedWorkerThreads,
+                counters.CompletedWorkItems,
+                counters.BlockedTimeMs,
+                counters.QueueLatency[0],
+                counters.QueueLatency[1],
+                counters.QueueLatency[2],
+                counters.QueueLatency[3],
+                counters.QueueLatency[4],
+                counters.QueueLatency[5],
+                GetClrInstanceId());
+        }
+
 #ifdef DEBUGGING_SUPPORTED
         // if we are stopped at a debug breakpoint, go back to sleep
         if (CORDebuggerAttached() && g_pDebugInterface->IsStopped())
@@ -4709,13 +5084,237 @@ void ThreadpoolMgr::InsertNewTimer(TimerInfo* pArg)
         timerInfo->state = (TIMER_REGISTERED | TIMER_ACTIVE);
         timerInfo->refCount = 1;
 
-        // insert the timer in the queue
-        InsertTailList(&TimerQueue,(&timerInfo->link));
+        // insert the timer in the wheel
+        ActiveTimers.Insert(timerInfo, currentTime);
     }
 
     return;
 }
 
+//************************************************************************
+void ThreadpoolMgr::TimerWheel::Initialize(DWORD currentTime, DWORD tickMs)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(tickMs > 0);
+
+    for (DWORD i = 0; i < Level0Size; i++)
+        InitializeListHead(&m_level0[i]);
+    for (DWORD i = 0; i < Level1Size; i++)
+        InitializeListHead(&m_level1[i]);
+    for (DWORD i = 0; i < Level2Size; i++)
+        InitializeListHead(&m_level2[i]);
+    InitializeListHead(&m_overflow);
+    InitializeListHead(&m_expired);
+
+    m_tick = 0;
+    m_tickTime = currentTime;
+    m_tickMs = tickMs;
+    m_numTimers = 0;
+    m_numLevel0Timers = 0;
+}
+
+void ThreadpoolMgr::TimerWheel::Insert(TimerInfo* timerInfo, DWORD currentTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_numTimers == 0)
+    {
+        // Nothing is waiting, so the wheel may not have been advanced for a while. Restart it from now.
+        m_tickTime = currentTime;
+    }
+
+    // The wheel can be a little ahead of or, if the timer thread is about to run, behind the current time.
+    // Round up, a timer must never fire early.
+    DWORD dueTime = timerInfo->FiringTime - currentTime;
+    LONGLONG remaining = (LONGLONG)dueTime + (LONG)(currentTime - m_tickTime);
+    DWORD ticks = remaining <= 0 ? 0 : (DWORD)((remaining + m_tickMs - 1) / m_tickMs);
+
+    timerInfo->FiringTick = m_tick + ticks;
+    Place(timerInfo);
+
+    NumActiveTimers++;
+}
+
+void ThreadpoolMgr::TimerWheel::Remove(TimerInfo* timerInfo)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    RemoveEntryList((LIST_ENTRY*) timerInfo);
+
+    if (timerInfo->WheelLevel == InLevel0)
+        m_numLevel0Timers--;
+    if (timerInfo->WheelLevel != InExpired)
+        m_numTimers--;
+
+    NumActiveTimers--;
+}
+
+void ThreadpoolMgr::TimerWheel::Place(TimerInfo* timerInfo)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Timers are never behind the wheel, so the distance to the firing tick is always meaningful
+    DWORD ticks = timerInfo->FiringTick - m_tick;
+    DWORD tick = timerInfo->FiringTick;
+    LIST_ENTRY* bucket;
+
+    if (ticks < Level0Size)
+    {
+        bucket = &m_level0[tick & (Level0Size - 1)];
+        timerInfo->WheelLevel = InLevel0;
+        m_numLevel0Timers++;
+    }
+    else if (ticks < (1 << Level2Shift))
+    {
+        bucket = &m_level1[(tick >> Level1Shift) & (Level1Size - 1)];
+        timerInfo->WheelLevel = InLevel1;
+    }
+    else if (ticks < (1 << OverflowShift))
+    {
+        bucket = &m_level2[(tick >> Level2Shift) & (Level2Size - 1)];
+        timerInfo->WheelLevel = InLevel2;
+    }
+    else
+    {
+        bucket = &m_overflow;
+        timerInfo->WheelLevel = InOverflow;
+    }
+
+    InsertTailList(bucket, (&timerInfo->link));
+    m_numTimers++;
+}
+
+// Spreads the timers of an upper level bucket over the levels below it
+void ThreadpoolMgr::TimerWheel::Cascade(LIST_ENTRY* bucket)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsListEmpty(bucket))
+        return;
+
+    // Detach the timers first, overflow timers that are still far away go back to the same list
+    LIST_ENTRY timers;
+    timers.Flink = bucket->Flink;
+    timers.Blink = bucket->Blink;
+    timers.Flink->Blink = &timers;
+    timers.Blink->Flink = &timers;
+    InitializeListHead(bucket);
+
+    while (!IsListEmpty(&timers))
+    {
+        LIST_ENTRY* entry;
+        RemoveHeadList(&timers, entry);
+        m_numTimers--;
+        Place((TimerInfo*) entry);
+    }
+}
+
+void ThreadpoolMgr::TimerWheel::Advance(DWORD currentTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while ((LONG)(currentTime - m_tickTime) >= 0)
+    {
+        if (m_numTimers == 0)
+        {
+            // Nothing left to fire, Insert restarts the wheel from the current time
+            m_tickTime = currentTime;
+            break;
+        }
+
+        if ((m_tick & (Level0Size - 1)) == 0)
+        {
+            // The first level has turned once, bring in the timers of the next turn from the upper levels.
+            // The levels are cascaded from the top, so that the timers land in their final bucket.
+            if ((m_tick & ((1 << OverflowShift) - 1)) == 0)
+                Cascade(&m_overflow);
+            if ((m_tick & ((1 << Level2Shift) - 1)) == 0)
+                Cascade(&m_level2[(m_tick >> Level2Shift) & (Level2Size - 1)]);
+            Cascade(&m_level1[(m_tick >> Level1Shift) & (Level1Size - 1)]);
+        }
+
+        DWORD ticks = 1;
+        if (m_numLevel0Timers == 0)
+        {
+            // Nothing can fire before the next turn of the first level, skip as far towards it as we can
+            DWORD ticksToTurn = Level0Size - (m_tick & (Level0Size - 1));
+            DWORD ticksElapsed = (currentTime - m_tickTime) / m_tickMs + 1;
+            ticks = min(ticksToTurn, ticksElapsed);
+        }
+        else
+        {
+            LIST_ENTRY* bucket = &m_level0[m_tick & (Level0Size - 1)];
+            while (!IsListEmpty(bucket))
+            {
+                LIST_ENTRY* entry;
+                RemoveHeadList(bucket, entry);
+                ((TimerInfo*) entry)->WheelLevel = InExpired;
+                InsertTailList(&m_expired, entry);
+                m_numLevel0Timers--;
+                m_numTimers--;
+            }
+        }
+
+        m_tick += ticks;
+        m_tickTime += ticks * m_tickMs;
+    }
+}
+
+ThreadpoolMgr::TimerInfo* ThreadpoolMgr::TimerWheel::RemoveExpiredTimer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsListEmpty(&m_expired))
+        return NULL;
+
+    LIST_ENTRY* entry;
+    RemoveHeadList(&m_expired, entry);
+    NumActiveTimers--;
+    return (TimerInfo*) entry;
+}
+
+DWORD ThreadpoolMgr::TimerWheel::GetNextFiringInterval(DWORD currentTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_numTimers == 0)
+        return INFINITE;
+
+    // Find the first tick that has work to do, either a first level bucket with timers or a turn
+    // of the first level that brings in timers from the upper levels
+    DWORD ticks = (DWORD)-1;
+    if (m_numLevel0Timers != 0)
+    {
+        for (DWORD i = 0; i < Level0Size; i++)
+        {
+            if (!IsListEmpty(&m_level0[(m_tick + i) & (Level0Size - 1)]))
+            {
+                ticks = i;
+                break;
+            }
+        }
+    }
+
+    DWORD ticksToTurn = (Level0Size - (m_tick & (Level0Size - 1))) & (Level0Size - 1);
+    for (; ticksToTurn < ticks; ticksToTurn += Level0Size)
+    {
+        DWORD tick = m_tick + ticksToTurn;
+        if (!IsListEmpty(&m_level1[(tick >> Level1Shift) & (Level1Size - 1)]) ||
+            ((tick & ((1 << Level2Shift) - 1)) == 0 && !IsListEmpty(&m_level2[(tick >> Level2Shift) & (Level2Size - 1)])) ||
+            ((tick & ((1 << OverflowShift) - 1)) == 0 && !IsListEmpty(&m_overflow)))
+        {
+            ticks = ticksToTurn;
+            break;
+        }
+    }
+    _ASSERTE(ticks != (DWORD)-1);
+
+    LONGLONG interval = (LONGLONG)ticks * m_tickMs + (LONG)(m_tickTime - currentTime);
+    if (interval <= 0)
+        return 0;
+    return (DWORD)min(interval, (LONGLONG)(INFINITE - 1));
+}
+
 
 // executed by the Timer thread
 // sweeps through the list of timers, readjusting the firing times, queueing APCs for
@@ -4731,57 +5330,42 @@ DWORD ThreadpoolMgr::FireTimers()
     CONTRACTL_END;
 
     DWORD currentTime = GetTickCount();
-    DWORD nextFiringInterval = (DWORD) -1;
     TimerInfo* timerInfo = NULL;
     
     EX_TRY 
     {
-        for (LIST_ENTRY* node = (LIST_ENTRY*) TimerQueue.Flink;
-             node != &TimerQueue;
-            )
-        {
-            timerInfo = (TimerInfo*) node;
-            node = (LIST_ENTRY*) node->Flink;
+        ActiveTimers.Advance(currentTime);
 
-            if (TimeExpired(LastTickCount, currentTime, timerInfo->FiringTime))
+        while ((timerInfo = ActiveTimers.RemoveExpiredTimer()) != NULL)
+        {
+            if (timerInfo->Period == 0 || timerInfo->Period == (ULONG) -1)
             {
-                if (timerInfo->Period == 0 || timerInfo->Period == (ULONG) -1)
-                {
-                    DeactivateTimer(timerInfo);
-                }
+                // The timer has already been taken out of the wheel, finish deactivating it
+                InitializeListHead(&timerInfo->link);
+                timerInfo->state = timerInfo->state & ~TIMER_ACTIVE;
+            }
 
-                InterlockedIncrement(&timerInfo->refCount);
+            InterlockedIncrement(&timerInfo->refCount);
 
-                QueueUserWorkItem(AsyncTimerCallbackCompletion,
-                                  timerInfo,
-                                  QUEUE_ONLY /* TimerInfo take care of deleting*/);
+            QueueUserWorkItem(AsyncTimerCallbackCompletion,
+                              timerInfo,
+                              QUEUE_ONLY /* TimerInfo take care of deleting*/);
 
-                if (timerInfo->Period != 0 && timerInfo->Period != (ULONG)-1)
+            if (timerInfo->Period != 0 && timerInfo->Period != (ULONG)-1)
+            {
+                ULONG nextFiringTime = timerInfo->FiringTime + timerInfo->Period;
+                if (TimeExpired(timerInfo->FiringTime, currentTime, nextFiringTime))
                 {
-                    ULONG nextFiringTime = timerInfo->FiringTime + timerInfo->Period;
-                    DWORD firingInterval;
-                    if (TimeExpired(timerInfo->FiringTime, currentTime, nextFiringTime))
-                    {
-                        // Enough time has elapsed to fire the timer yet again. The timer is not able to keep up with the short
-                        // period, have it fire 1 ms from now to avoid spinning without a delay.
-                        timerInfo->FiringTime = currentTime + 1;
-                        firingInterval = 1;
-                    }
-                    else
-                    {
-                        timerInfo->FiringTime = nextFiringTime;
-                        firingInterval = TimeInterval(nextFiringTime, currentTime);
-                    }
-
-                    if (firingInterval < nextFiringInterval)
-                        nextFiringInterval = firingInterval;
+                    // Enough time has elapsed to fire the timer yet again. The timer is not able to keep up with the short
+                    // period, have it fire 1 ms from now to avoid spinning without a delay.
+                    timerInfo->FiringTime = currentTime + 1;
                 }
-            }
-            else
-            {
-                DWORD firingInterval = TimeInterval(timerInfo->FiringTime, currentTime);
-                if (firingInterval < nextFiringInterval)
-                    nextFiringInterval = firingInterval;
+                else
+                {
+                    timerInfo->FiringTime = nextFiringTime;
+                }
+
+                ActiveTimers.Insert(timerInfo, currentTime);
             }
         }
     } 
@@ -4790,10 +5374,10 @@ DWORD ThreadpoolMgr::FireTimers()
         // If QueueUserWorkItem throws OOM, swallow the exception and retry on
         // the next call to FireTimers(), otherwise retrhow.
         Exception *ex = GET_EXCEPTION();
-        // undo the call to DeactivateTimer()
+        // put the timer back into the wheel, it is due so it fires on the next tick
         InterlockedDecrement(&timerInfo->refCount);
-        timerInfo->state = timerInfo->state & TIMER_ACTIVE;
-        InsertTailList(&TimerQueue, (&timerInfo->link));
+        timerInfo->state = timerInfo->state | TIMER_ACTIVE;
+        ActiveTimers.Insert(timerInfo, currentTime);
         if (ex->GetHR() != E_OUTOFMEMORY)
         {
            EX_RETHROW;
@@ -4803,7 +5387,7 @@ DWORD ThreadpoolMgr::FireTimers()
 
     LastTickCount = currentTime;
 
-    return nextFiringInterval;
+    return ActiveTimers.GetNextFiringInterval(currentTime);
 }
 
 DWORD WINAPI ThreadpoolMgr::AsyncTimerCallbackCompletion(PVOID pArgs)
@@ -4854,7 +5438,7 @@ void ThreadpoolMgr::DeactivateTimer(TimerInfo* timerInfo)
 {
     LIMITED_METHOD_CONTRACT;
 
-    RemoveEntryList((LIST_ENTRY*) timerInfo);
+    ActiveTimers.Remove(timerInfo);
 
     // This timer info could go into another linked list of timer infos
     // waiting to be released. Reinitialize the list pointers
@@ -5135,16 +5719,21 @@ void ThreadpoolMgr::UpdateTimer(TimerUpdateInfo* pArgs)
 
     delete updateInfo;
 
-    if (! (timerInfo->state & TIMER_ACTIVE))
+    if (timerInfo->state & TIMER_ACTIVE)
+    {
+        // the timer has to move to the bucket of its new firing time
+        ActiveTimers.Remove(timerInfo);
+    }
+    else
     {
         // timer not active (probably a one shot timer that has expired), so activate it
         timerInfo->state |= TIMER_ACTIVE;
         _ASSERTE(timerInfo->refCount >= 1);
-        // insert the timer in the queue
-        InsertTailList(&TimerQueue,(&timerInfo->link));
-
     }
 
+    // insert the timer in the wheel
+    ActiveTimers.Insert(timerInfo, currentTime);
+
     return;
 }
 
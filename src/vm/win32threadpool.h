@@ -81,6 +81,7 @@ struct WorkRequest {
     WorkRequest*            next;
     LPTHREAD_START_ROUTINE  Function; 
     PVOID                   Context;
+    DWORD                   EnqueueTime;    // tick count when the request was queued, for the queue latency counters
 
 };
 
@@ -211,6 +212,76 @@ public:
 
     static void ReportThreadStatus(bool isWorking);
 
+    // Called when a worker thread starts and stops a wait that may block for a while. While workers are blocked, the
+    // thread pool raises the number of working threads by the same amount (up to ThreadPool_MaxBlockingCompensationThreads)
+    // so that queued work items don't have to wait for starvation detection to inject threads.
+    static void NotifyWorkerThreadBlocked();
+    static void NotifyWorkerThreadUnblocked(DWORD blockedTimeMs);
+
+#ifndef DACCESS_COMPILE
+    class BlockingWaitHolder
+    {
+        bool m_isBlocked;
+        DWORD m_startTime;
+
+    public:
+        BlockingWaitHolder(Thread *pThread, INT32 timeout)
+            : m_isBlocked(false)
+        {
+            WRAPPER_NO_CONTRACT;
+
+            if (timeout != 0 && pThread->IsThreadPoolWorkerThread() && IsInitialized())
+            {
+                NotifyWorkerThreadBlocked();
+                m_isBlocked = true;
+                m_startTime = GetTickCount();
+            }
+        }
+
+        ~BlockingWaitHolder()
+        {
+            WRAPPER_NO_CONTRACT;
+
+            if (m_isBlocked)
+            {
+                NotifyWorkerThreadUnblocked(GetTickCount() - m_startTime);
+            }
+        }
+    };
+#endif // !DACCESS_COMPILE
+
+    // Native work requests are counted by the time they waited in the queue, bucket i holds the requests that
+    // waited less than 4^i ms and the last bucket all the others
+    static const int QueueLatencyBucketCount = 6;
+
+    // A snapshot of the state of the worker thread pool. The counters behind it are maintained all the time and
+    // GetCounters reads them without taking any locks, so it is cheap enough to be polled.
+    struct ThreadPoolCounters
+    {
+        DWORD NativeQueueLength;                // native work requests waiting for a worker
+        DWORD ActiveWorkerThreads;              // worker threads that are not retired
+        DWORD WorkingWorkerThreads;             // worker threads that are not waiting for work
+        DWORD BlockedWorkerThreads;             // worker threads blocked in a wait, see BlockingWaitHolder
+        DWORD CompletedWorkItems;               // work items completed as of CompletedWorkItemsTime, wraps around
+        DWORD CompletedWorkItemsTime;           // tick count of the last thread count adjustment sample
+        ULONGLONG BlockedTimeMs;                // total time worker threads have spent blocked in waits
+        DWORD QueueLatency[QueueLatencyBucketCount];    // native work requests dequeued so far by queue latency
+    };
+
+    static void GetCounters(ThreadPoolCounters* pCounters);
+
+#ifndef DACCESS_COMPILE
+    static void RecordQueueLatency(DWORD latencyMs)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        int bucket = 0;
+        while (bucket < QueueLatencyBucketCount - 1 && latencyMs >= (1u << (2 * bucket)))
+            bucket++;
+        FastInterlockIncrement(&QueueLatencyHistogram[bucket]);
+    }
+#endif // !DACCESS_COMPILE
+
     // enumeration of different kinds of memory blocks that are recycled
     enum MemType
     {
@@ -245,6 +316,8 @@ public:
     static BOOL GetAvailableThreads(DWORD* AvailableWorkerThreads, 
                                  DWORD* AvailableIOCompletionThreads);
 
+    static bool AreWorkerThreadsSaturated();
+
     static BOOL QueueUserWorkItem(LPTHREAD_START_ROUTINE Function, 
                                   PVOID Context,
                                   ULONG Flags,
@@ -568,6 +641,8 @@ private:
         WAITORTIMERCALLBACK Function;             // Function to call when timer fires
         PVOID Context;              // Context to pass to function when timer fires
         ULONG Period;
+        DWORD FiringTick;           // tick of the timer wheel in which the timer fires
+        DWORD WheelLevel;           // which part of the timer wheel holds the timer, see TimerWheel
         DWORD flag;                 // How do we deal with the context
         DWORD state;
         LONG refCount;
@@ -611,6 +686,63 @@ private:
         ULONG Period ;              // new period
     } TimerUpdateInfo;
 
+    // Active timers are kept in a hierarchical timing wheel, so that inserting and cancelling a timer is
+    // O(1) and the timer thread only looks at the timers that are about to fire instead of all of them.
+    // Time is divided into ticks of a configurable number of milliseconds, and timers that are due in the
+    // same tick fire together. The first level has a bucket per tick. Each bucket of the second and third
+    // levels spans a whole turn of the level below it, and is spread over the lower levels when they get
+    // to it. Timers beyond the third level wait in an overflow list. Only used on the timer thread.
+    class TimerWheel
+    {
+    public:
+        void Initialize(DWORD currentTime, DWORD tickMs);
+
+        void Insert(TimerInfo* timerInfo, DWORD currentTime);
+        void Remove(TimerInfo* timerInfo);
+
+        // Moves the timers that are due at currentTime to the expired list
+        void Advance(DWORD currentTime);
+        TimerInfo* RemoveExpiredTimer();
+
+        // Returns how long the timer thread can sleep before the wheel needs to be advanced again
+        DWORD GetNextFiringInterval(DWORD currentTime);
+
+    private:
+        static const DWORD Level0Bits = 8;
+        static const DWORD Level1Bits = 6;
+        static const DWORD Level2Bits = 6;
+        static const DWORD Level0Size = 1 << Level0Bits;
+        static const DWORD Level1Size = 1 << Level1Bits;
+        static const DWORD Level2Size = 1 << Level2Bits;
+        static const DWORD Level1Shift = Level0Bits;
+        static const DWORD Level2Shift = Level0Bits + Level1Bits;
+        static const DWORD OverflowShift = Level0Bits + Level1Bits + Level2Bits;
+
+        enum
+        {
+            InLevel0,
+            InLevel1,
+            InLevel2,
+            InOverflow,
+            InExpired
+        };
+
+        void Place(TimerInfo* timerInfo);
+        void Cascade(LIST_ENTRY* bucket);
+
+        LIST_ENTRY m_level0[Level0Size];
+        LIST_ENTRY m_level1[Level1Size];
+        LIST_ENTRY m_level2[Level2Size];
+        LIST_ENTRY m_overflow;
+        LIST_ENTRY m_expired;
+
+        DWORD m_tick;           // next tick to process, no timer is due in an earlier tick
+        DWORD m_tickTime;       // tick count at which m_tick starts
+        DWORD m_tickMs;
+        DWORD m_numTimers;      // timers in the levels and the overflow list
+        DWORD m_numLevel0Timers;
+    };
+
     // Definitions and data structures to support recycling of high-frequency 
     // memory blocks. We use a spin-lock to access the list
 
@@ -755,6 +887,15 @@ public:
     	}
     };
 
+    // Work requests queued by a worker thread are kept in a LIFO queue for the processor the worker is
+    // running on, see TryPushLocalWorkRequest.
+    struct WorkerLocalQueue
+    {
+        DangerousNonHostedSpinLock  lock;
+        Volatile<WorkRequest*>      head;                           // protected by lock
+        BYTE                        padding[MAX_CACHE_LINE_SIZE];   // keeps the queues on separate cache lines
+    };
+
 #define GATE_THREAD_STATUS_NOT_RUNNING         0 // There is no gate thread
 #define GATE_THREAD_STATUS_REQUESTED           1 // There is a gate thread, and someone has asked it to stick around recently
 #define GATE_THREAD_STATUS_WAITING_FOR_REQUEST 2 // There is a gate thread, but nobody has asked it to stay.  It may die soon
@@ -770,12 +911,20 @@ public:
 
     static Thread* CreateUnimpersonatedThread(LPTHREAD_START_ROUTINE lpStartAddress, LPVOID lpArgs, BOOL *pIsCLRThread);
 
-    static BOOL CreateWorkerThread();
+    static BOOL CreateWorkerThread(BOOL startRetired = FALSE);
+
+    static void PrewarmWorkerThreads();
 
     static void EnqueueWorkRequest(WorkRequest* wr);
 
     static WorkRequest* DequeueWorkRequest();
 
+    static bool TryPushLocalWorkRequest(WorkRequest* wr);
+
+    static WorkRequest* PopLocalWorkRequest();
+
+    static WorkRequest* StealLocalWorkRequest();
+
     static void ExecuteWorkRequest(bool* foundWork, bool* wasNotRecalled);
 
     static DWORD WINAPI ExecuteHostRequest(PVOID pArg);
@@ -828,6 +977,17 @@ public:
         return entry;
     }
 
+    FORCEINLINE static WorkerLocalQueue* GetCurrentWorkerLocalQueue()
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE(WorkerLocalQueues != NULL);
+
+        if (CPUGroupInfo::CanEnableGCCPUGroups() && CPUGroupInfo::CanEnableThreadUseAllCpuGroups())
+            return &WorkerLocalQueues[CPUGroupInfo::CalculateCurrentProcessorNumber() % NumWorkerLocalQueues];
+        else
+            return &WorkerLocalQueues[GetCurrentProcessorNumber() % NumWorkerLocalQueues];
+    }
+
     static void EnsureInitialized();
     static void InitPlatformVariables();
 
@@ -846,6 +1006,13 @@ public:
         UpdateLastDequeueTime();
     }
 
+    // The number of worker threads that are working or waiting for work, reported by the runtime counters.
+    static INT64 GetActiveWorkerThreadCount()
+    {
+        WRAPPER_NO_CONTRACT;
+        return WorkerCounter.GetCleanCounts().NumActive;
+    }
+
     static bool ShouldAdjustMaxWorkersActive()
     {
         WRAPPER_NO_CONTRACT;
@@ -1024,6 +1191,7 @@ private:
     static unsigned int WorkerThreadSpinLimit;
     static bool IsHillClimbingDisabled;
     static int ThreadAdjustmentInterval;
+    static DWORD QueueBacklogStartTime;                 // 0 if no work was waiting at the last sample, protected by ThreadAdjustmentLock
 
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
@@ -1036,6 +1204,17 @@ private:
     // This needs to be non-hosted, because worker threads can run prior to EE startup.
     static DangerousNonHostedSpinLock ThreadAdjustmentLock;
 
+    // Protected by ThreadAdjustmentLock
+    static int NumBlockedWorkerThreads;                 // worker threads currently in a blocking wait
+    static int NumBlockingCompensationThreads;          // how much MaxWorking was raised on behalf of blocked workers
+    static int MaxBlockingCompensationThreads;
+
+    static int NumPrewarmedWorkerThreads;               // retired worker threads that are kept parked instead of timing out
+
+    // Counters for GetCounters, only use with FastInterlock*
+    static LONGLONG TotalBlockedTimeMs;
+    static LONG QueueLatencyHistogram[QueueLatencyBucketCount];
+
 public:
     static CrstStatic WorkerCriticalSection;
 
@@ -1069,7 +1248,8 @@ private:
 
     static TimerInfo *TimerInfosToBeRecycled;           // list of delegate infos associated with deleted timers
     static CrstStatic TimerQueueCriticalSection;        // critical section to synchronize timer queue access
-    SVAL_DECL(LIST_ENTRY,TimerQueue);                   // queue of timers
+    static TimerWheel ActiveTimers;                     // active timers, only used on the timer thread
+    SVAL_DECL(LONG,NumActiveTimers);                    // number of timers in ActiveTimers
     static HANDLE TimerThread;                          // Currently we only have one timer thread
     static Thread*  pTimerThread;
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static DWORD LastTickCount;      // the count just before timer thread goes to sleep
@@ -1094,6 +1274,9 @@ private:
 
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static RecycledListsWrapper RecycledLists;
 
+    static WorkerLocalQueue* WorkerLocalQueues;         // one per processor, NULL if local queues are disabled
+    static unsigned int NumWorkerLocalQueues;
+
 #ifdef _DEBUG
     static DWORD   TickCountAdjustment;                 // add this value to value returned by GetTickCount
 #endif
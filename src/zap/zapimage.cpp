@@ -42,6 +42,7 @@ ZapImage::ZapImage(Zapper *zapper)
     m_stats(new ZapperStats())
     /* Everything else is initialized to 0 by default */
 {
+    m_stats->InitMethodStats();
 }
 
 ZapImage::~ZapImage()
@@ -1113,6 +1114,8 @@ HANDLE ZapImage::SaveImage(LPCWSTR wszOutputFileName, LPCWSTR wszDllPath, CORCOM
         PrintStats(wszOutputFileName);
     }
 
+    m_stats->WriteMethodStatsSummary();
+
     return hFile;
 }
 
@@ -2145,6 +2148,11 @@ ZapImage::CompileStatus ZapImage::TryCompileMethodWorker(CORINFO_METHOD_HANDLE h
 
     ZapInfo zapInfo(this, md, handle, module, methodProfilingDataFlags);
 
+    LARGE_INTEGER startTime;
+    startTime.QuadPart = 0;
+    if (m_stats->IsCollectingMethodStats())
+        QueryPerformanceCounter(&startTime);
+
     EX_TRY
     {
         zapInfo.CompileMethod();
@@ -2217,7 +2225,27 @@ ZapImage::CompileStatus ZapImage::TryCompileMethodWorker(CORINFO_METHOD_HANDLE h
         }
     }
     EX_END_CATCH(SwallowAllExceptions);
-    
+
+    // Methods that were skipped before reaching the JIT do not get a row
+    if (m_stats->IsCollectingMethodStats() && (zapInfo.m_pCode != NULL || result == COMPILE_FAILED))
+    {
+        LARGE_INTEGER endTime, frequency;
+        QueryPerformanceCounter(&endTime);
+        QueryPerformanceFrequency(&frequency);
+        ULONGLONG compileTimeUs = (ULONGLONG)(endTime.QuadPart - startTime.QuadPart) * 1000000 / frequency.QuadPart;
+
+        const char * szNamespace = NULL;
+        m_zapper->m_pEEJitInfo->getClassNameFromMetadata(m_zapper->m_pEEJitInfo->getMethodClass(handle), &szNamespace);
+        const char * szAssembly = m_zapper->m_pEEJitInfo->getAssemblyName(m_zapper->m_pEEJitInfo->getModuleAssembly(module));
+
+        m_stats->AddMethodStats(szAssembly, szNamespace, zapInfo.m_currentMethodName.GetUnicode(),
+                                zapInfo.m_currentMethodInfo.ILCodeSize,
+                                zapInfo.m_pCode != NULL ? zapInfo.m_pCode->GetSize() : 0,
+                                zapInfo.m_pColdCode != NULL ? zapInfo.m_pColdCode->GetSize() : 0,
+                                compileTimeUs,
+                                result == COMPILE_FAILED);
+    }
+
     return result;
 }
 
@@ -2672,6 +2672,12 @@ DWORD ZapInfo::getExpectedTargetArchitecture()
     return IMAGE_FILE_MACHINE_NATIVE;
 }
 
+void ZapInfo::reportJitPhaseStats(unsigned phaseIndex, const char* phaseName,
+                                  unsigned __int64 cycles, unsigned __int64 allocatedBytes)
+{
+    // CORJIT_FLAG_REPORT_PHASE_STATS is never set for NGen compilations
+}
+
 CORINFO_METHOD_HANDLE ZapInfo::GetDelegateCtor(CORINFO_METHOD_HANDLE   methHnd,
                                                CORINFO_CLASS_HANDLE    clsHnd,
                                                CORINFO_METHOD_HANDLE   targetMethodHnd,
@@ -3025,6 +3031,13 @@ bool ZapInfo::isFieldStatic(CORINFO_FIELD_HANDLE fldHnd)
     return m_pEEJitInfo->isFieldStatic(fldHnd);
 }
 
+CORINFO_CLASS_HANDLE ZapInfo::getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative)
+{
+    // The values of statics at compile time say nothing about their values when the image runs.
+    *pIsSpeculative = true;
+    return NULL;
+}
+
 //
 // ICorClassInfo
 //
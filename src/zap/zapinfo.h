@@ -445,6 +445,9 @@ public:
 
     DWORD getExpectedTargetArchitecture();
 
+    void reportJitPhaseStats(unsigned phaseIndex, const char* phaseName,
+                             unsigned __int64 cycles, unsigned __int64 allocatedBytes);
+
     // ICorJitInfo delegate ctor optimization
     CORINFO_METHOD_HANDLE GetDelegateCtor(
                             CORINFO_METHOD_HANDLE   methHnd,
@@ -505,6 +508,8 @@ public:
 
     bool isFieldStatic(CORINFO_FIELD_HANDLE fldHnd);
 
+    CORINFO_CLASS_HANDLE getStaticFieldCurrentClass(CORINFO_FIELD_HANDLE field, bool* pIsSpeculative);
+
     // ICorClassInfo
 
     CorInfoType asCorInfoType(CORINFO_CLASS_HANDLE cls);
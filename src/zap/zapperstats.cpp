@@ -120,10 +120,147 @@ ZapperStats::ZapperStats()
     , m_externalMethodDataSize( 0 )
     , m_prestubMethods( 0 )
     , m_directMethods( 0 )
+    , m_pMethodStatsFile( NULL )
+    , m_lastNamespaceStats( 0 )
 {
     init_array( m_indirectMethodReasons, CORINFO_INDIRECT_CALL_COUNT );
 }
 
+ZapperStats::~ZapperStats()
+{
+    if (m_pMethodStatsFile != NULL)
+        fclose(m_pMethodStatsFile);
+}
+
+void ZapperStats::InitMethodStats()
+{
+    // Any errors cause the per-method statistics to be disabled
+    NewArrayHolder<WCHAR> wszMethodStatsFile;
+    if (FAILED(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_NGenMethodStatsFile, &wszMethodStatsFile)) || !wszMethodStatsFile)
+        return;
+
+    m_pMethodStatsFile = _wfopen(wszMethodStatsFile, W("w"));
+    if (m_pMethodStatsFile == NULL)
+        return;
+
+    fputs("Kind,Assembly,Namespace,Method,Methods,FailedMethods,ILCodeSize,HotCodeSize,ColdCodeSize,CompileTimeUs\n", m_pMethodStatsFile);
+}
+
+void ZapperStats::AddMethodStats(LPCUTF8 assemblyName, LPCUTF8 namespaceName, LPCWSTR methodName,
+                                 ULONG ilCodeSize, ULONG hotCodeSize, ULONG coldCodeSize,
+                                 ULONGLONG compileTimeUs, bool failed)
+{
+    _ASSERTE(IsCollectingMethodStats());
+
+    if (assemblyName == NULL)
+        assemblyName = "";
+    if (namespaceName == NULL)
+        namespaceName = "";
+
+    MethodStatsTotals method;
+    method.assemblyName = assemblyName;
+    method.namespaceName = namespaceName;
+    method.methods = 1;
+    method.failedMethods = failed ? 1 : 0;
+    method.ilCodeSize = ilCodeSize;
+    method.hotCodeSize = hotCodeSize;
+    method.coldCodeSize = coldCodeSize;
+    method.compileTimeUs = compileTimeUs;
+
+    WriteMethodStatsRow("Method", method, methodName);
+
+    // Methods tend to be compiled type by type, so the namespace of the previous
+    // method is checked first. The strings come from metadata and stay alive for
+    // the whole compilation.
+    MethodStatsTotals * pTotals = NULL;
+    COUNT_T count = m_namespaceStats.GetCount();
+    for (COUNT_T i = 0; i < count; i++)
+    {
+        COUNT_T index = (m_lastNamespaceStats + i) % count;
+        MethodStatsTotals & totals = m_namespaceStats[index];
+        if (strcmp(totals.namespaceName, namespaceName) == 0 && strcmp(totals.assemblyName, assemblyName) == 0)
+        {
+            pTotals = &totals;
+            m_lastNamespaceStats = index;
+            break;
+        }
+    }
+
+    if (pTotals == NULL)
+    {
+        m_lastNamespaceStats = count;
+        m_namespaceStats.Append(method);
+        return;
+    }
+
+    pTotals->methods++;
+    pTotals->failedMethods += method.failedMethods;
+    pTotals->ilCodeSize += ilCodeSize;
+    pTotals->hotCodeSize += hotCodeSize;
+    pTotals->coldCodeSize += coldCodeSize;
+    pTotals->compileTimeUs += compileTimeUs;
+}
+
+void ZapperStats::WriteMethodStatsSummary()
+{
+    if (!IsCollectingMethodStats())
+        return;
+
+    COUNT_T count = m_namespaceStats.GetCount();
+    for (COUNT_T i = 0; i < count; i++)
+        WriteMethodStatsRow("Namespace", m_namespaceStats[i], W(""));
+
+    // Fold the namespace totals into one row per assembly, in the order the
+    // assemblies were first seen
+    for (COUNT_T i = 0; i < count; i++)
+    {
+        LPCUTF8 assemblyName = m_namespaceStats[i].assemblyName;
+
+        bool fSeen = false;
+        for (COUNT_T j = 0; j < i && !fSeen; j++)
+            fSeen = (strcmp(m_namespaceStats[j].assemblyName, assemblyName) == 0);
+        if (fSeen)
+            continue;
+
+        MethodStatsTotals assembly = m_namespaceStats[i];
+        assembly.namespaceName = "";
+        for (COUNT_T j = i + 1; j < count; j++)
+        {
+            const MethodStatsTotals & totals = m_namespaceStats[j];
+            if (strcmp(totals.assemblyName, assemblyName) != 0)
+                continue;
+
+            assembly.methods += totals.methods;
+            assembly.failedMethods += totals.failedMethods;
+            assembly.ilCodeSize += totals.ilCodeSize;
+            assembly.hotCodeSize += totals.hotCodeSize;
+            assembly.coldCodeSize += totals.coldCodeSize;
+            assembly.compileTimeUs += totals.compileTimeUs;
+        }
+
+        WriteMethodStatsRow("Assembly", assembly, W(""));
+    }
+
+    fclose(m_pMethodStatsFile);
+    m_pMethodStatsFile = NULL;
+}
+
+void ZapperStats::WriteMethodStatsRow(LPCSTR kind, const MethodStatsTotals & totals, LPCWSTR methodName)
+{
+    // Names are quoted since generic instantiations contain commas
+    fprintf(m_pMethodStatsFile, "%s,\"%s\",\"%s\",\"%S\",%u,%u,%u,%u,%u,%llu\n",
+            kind,
+            totals.assemblyName,
+            totals.namespaceName,
+            methodName,
+            totals.methods,
+            totals.failedMethods,
+            totals.ilCodeSize,
+            totals.hotCodeSize,
+            totals.coldCodeSize,
+            totals.compileTimeUs);
+}
+
 #ifdef _PREFAST_
 #pragma warning(push)
 #pragma warning(disable:21000) // Suppress PREFast warning about overly large function
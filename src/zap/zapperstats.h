@@ -84,7 +84,44 @@ class ZapperStats
     unsigned m_indirectMethodReasons[CORINFO_INDIRECT_CALL_COUNT];
 
     ZapperStats();
+    ~ZapperStats();
     void PrintStats();
+
+    // Per-method compile statistics. These are only collected when NGenMethodStatsFile
+    // names a file: every compiled method gets a CSV row as soon as it is done, and the
+    // totals by namespace and by assembly are appended by WriteMethodStatsSummary.
+    void InitMethodStats();
+
+    bool IsCollectingMethodStats()
+    {
+        return m_pMethodStatsFile != NULL;
+    }
+
+    void AddMethodStats(LPCUTF8 assemblyName, LPCUTF8 namespaceName, LPCWSTR methodName,
+                        ULONG ilCodeSize, ULONG hotCodeSize, ULONG coldCodeSize,
+                        ULONGLONG compileTimeUs, bool failed);
+
+    void WriteMethodStatsSummary();
+
+ private:
+
+    struct MethodStatsTotals
+    {
+        LPCUTF8   assemblyName;
+        LPCUTF8   namespaceName;
+        unsigned  methods;
+        unsigned  failedMethods;
+        ULONG     ilCodeSize;
+        ULONG     hotCodeSize;
+        ULONG     coldCodeSize;
+        ULONGLONG compileTimeUs;
+    };
+
+    void WriteMethodStatsRow(LPCSTR kind, const MethodStatsTotals & totals, LPCWSTR methodName);
+
+    FILE *                    m_pMethodStatsFile;
+    SArray<MethodStatsTotals> m_namespaceStats;
+    COUNT_T                   m_lastNamespaceStats;
 };
 
 char const * GetCallReasonString( CorInfoIndirectCallReason reason );
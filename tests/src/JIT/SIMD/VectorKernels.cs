@@ -0,0 +1,203 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Small data-parallel kernels written with Vector<T>, each checked against a scalar baseline.
+// The throughput of both versions is printed so codegen changes can be compared between runs.
+
+using System;
+using System.Diagnostics;
+using System.Numerics;
+
+namespace VectorMathTests
+{
+    class Program
+    {
+        const int Pass = 100;
+        const int Fail = -1;
+
+        const int N = 64 * 1024;
+        const int Iterations = 200;
+
+        static int DotScalar(int[] a, int[] b)
+        {
+            int sum = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                sum += a[i] * b[i];
+            }
+            return sum;
+        }
+
+        static int DotVector(int[] a, int[] b)
+        {
+            Vector<int> acc = Vector<int>.Zero;
+            int i = 0;
+            for (; i <= a.Length - Vector<int>.Count; i += Vector<int>.Count)
+            {
+                acc += new Vector<int>(a, i) * new Vector<int>(b, i);
+            }
+            int sum = Vector.Dot(acc, Vector<int>.One);
+            for (; i < a.Length; i++)
+            {
+                sum += a[i] * b[i];
+            }
+            return sum;
+        }
+
+        static int IndexOfScalar(byte[] data, byte value)
+        {
+            for (int i = 0; i < data.Length; i++)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        static int IndexOfVector(byte[] data, byte value)
+        {
+            Vector<byte> needle = new Vector<byte>(value);
+            int i = 0;
+            for (; i <= data.Length - Vector<byte>.Count; i += Vector<byte>.Count)
+            {
+                if (!Vector.EqualsAny(new Vector<byte>(data, i), needle))
+                {
+                    continue;
+                }
+                for (int j = i; j < i + Vector<byte>.Count; j++)
+                {
+                    if (data[j] == value)
+                    {
+                        return j;
+                    }
+                }
+            }
+            for (; i < data.Length; i++)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        static ulong ChecksumScalar(ulong[] data)
+        {
+            ulong x = 0;
+            for (int i = 0; i < data.Length; i++)
+            {
+                x ^= data[i];
+            }
+            return x;
+        }
+
+        static ulong ChecksumVector(ulong[] data)
+        {
+            Vector<ulong> acc = Vector<ulong>.Zero;
+            int i = 0;
+            for (; i <= data.Length - Vector<ulong>.Count; i += Vector<ulong>.Count)
+            {
+                acc ^= new Vector<ulong>(data, i);
+            }
+            ulong x = 0;
+            for (int j = 0; j < Vector<ulong>.Count; j++)
+            {
+                x ^= acc[j];
+            }
+            for (; i < data.Length; i++)
+            {
+                x ^= data[i];
+            }
+            return x;
+        }
+
+        static void Report(string name, long bytes, Stopwatch scalar, Stopwatch vector)
+        {
+            double totalBytes = (double)bytes * Iterations;
+            Console.WriteLine("{0}: scalar {1:F2} GB/s, vector {2:F2} GB/s",
+                name,
+                totalBytes / Math.Max(scalar.Elapsed.TotalSeconds, 1e-9) / 1e9,
+                totalBytes / Math.Max(vector.Elapsed.TotalSeconds, 1e-9) / 1e9);
+        }
+
+        static int Main(string[] args)
+        {
+            Random random = new Random(13);
+
+            int[] a = new int[N + 3];
+            int[] b = new int[N + 3];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = random.Next(-1000, 1000);
+                b[i] = random.Next(-1000, 1000);
+            }
+
+            byte[] bytes = new byte[N + 5];
+            for (int i = 0; i < bytes.Length; i++)
+            {
+                bytes[i] = (byte)random.Next(0, 255);
+            }
+            // Place the only occurrence of the needle in the tail so both loops scan everything
+            bytes[bytes.Length - 2] = 255;
+
+            ulong[] words = new ulong[N + 1];
+            for (int i = 0; i < words.Length; i++)
+            {
+                words[i] = ((ulong)random.Next() << 32) | (uint)random.Next();
+            }
+
+            if (DotScalar(a, b) != DotVector(a, b))
+            {
+                Console.WriteLine("DotVector doesn't match DotScalar");
+                return Fail;
+            }
+            if (IndexOfScalar(bytes, 255) != IndexOfVector(bytes, 255))
+            {
+                Console.WriteLine("IndexOfVector doesn't match IndexOfScalar");
+                return Fail;
+            }
+            if (ChecksumScalar(words) != ChecksumVector(words))
+            {
+                Console.WriteLine("ChecksumVector doesn't match ChecksumScalar");
+                return Fail;
+            }
+
+            Stopwatch scalar = new Stopwatch();
+            Stopwatch vector = new Stopwatch();
+
+            scalar.Start();
+            for (int i = 0; i < Iterations; i++) DotScalar(a, b);
+            scalar.Stop();
+            vector.Start();
+            for (int i = 0; i < Iterations; i++) DotVector(a, b);
+            vector.Stop();
+            Report("Dot", 2L * a.Length * sizeof(int), scalar, vector);
+
+            scalar.Reset();
+            vector.Reset();
+            scalar.Start();
+            for (int i = 0; i < Iterations; i++) IndexOfScalar(bytes, 255);
+            scalar.Stop();
+            vector.Start();
+            for (int i = 0; i < Iterations; i++) IndexOfVector(bytes, 255);
+            vector.Stop();
+            Report("IndexOf", bytes.Length, scalar, vector);
+
+            scalar.Reset();
+            vector.Reset();
+            scalar.Start();
+            for (int i = 0; i < Iterations; i++) ChecksumScalar(words);
+            scalar.Stop();
+            vector.Start();
+            for (int i = 0; i < Iterations; i++) ChecksumVector(words);
+            vector.Stop();
+            Report("Checksum", (long)words.Length * sizeof(ulong), scalar, vector);
+
+            return Pass;
+        }
+    }
+}